@@ -0,0 +1,115 @@
+//===--- ExpressionHeavy.swift --------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2020 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+// Compile-time benchmark corpus: expression checking.
+//
+// Stresses the constraint solver with mixed-literal arithmetic, closures with
+// inferred parameter and result types, collection literals and string
+// interpolation. Each expression is kept small enough to avoid exponential
+// solver behavior; the load comes from their number, like in typical
+// application code.
+
+func polynomialEvaluation(_ x: Double) -> Double {
+  let a = 1.5 * x * x * x + 2.25 * x * x - 0.75 * x + 12.0
+  let b = a / 3.0 + x * 0.5 - 1.0 / (x + 1.0)
+  let c = (a + b) * (a - b) + 2.0 * a * b
+  let d = c - a * 0.25 + b * 0.125 - x * 8.0
+  return a + b + c + d
+}
+
+func mixedIntegerArithmetic(_ n: Int) -> Int {
+  let a = n * 3 + 7 - n / 2 + n % 5
+  let b = (a << 2) | (n >> 1) & 0xFF ^ 0x3C
+  let c = a * b - a / (b + 1) + b % (a + 1)
+  let d = c &+ a &* 2 &- b
+  return a + b + c + d
+}
+
+func closureInference() -> [Int] {
+  let numbers = [3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5, 8, 9, 7, 9, 3]
+  let doubled = numbers.map { $0 * 2 }
+  let evens = doubled.filter { $0 % 4 == 0 }
+  let sums = evens.reduce(0) { $0 + $1 }
+  let pairs = numbers.map { ($0, $0 * $0) }
+  let described = pairs.map { "\($0.0) squared is \($0.1)" }
+  let lengths = described.map { $0.count }
+  return lengths + [sums]
+}
+
+func nestedClosures(_ input: [[Int]]) -> [Int] {
+  return input.map { row in
+    row.enumerated().map { offset, value in
+      value * offset + row.count
+    }.reduce(0, +)
+  }.sorted { $0 > $1 }
+}
+
+func collectionLiterals() -> Int {
+  let matrix = [
+    [1.0, 0.0, 0.0, 4.5],
+    [0.0, 1.0, 0.0, -2.25],
+    [0.0, 0.0, 1.0, 16.125],
+    [0.0, 0.0, 0.0, 1.0],
+  ]
+  let lookup = [
+    "north": (dx: 0, dy: -1), "south": (dx: 0, dy: 1),
+    "east": (dx: 1, dy: 0), "west": (dx: -1, dy: 0),
+  ]
+  let nested: [String: [Int]] = [
+    "fib": [1, 1, 2, 3, 5, 8, 13, 21],
+    "squares": [1, 4, 9, 16, 25, 36],
+    "primes": [2, 3, 5, 7, 11, 13, 17, 19],
+  ]
+  let rows = matrix.count + lookup.count
+  return rows + nested.values.map { $0.count }.reduce(0, +)
+}
+
+func stringInterpolation(_ name: String, _ score: Double, _ rank: Int) -> String {
+  let headline = "Player \(name) finished #\(rank) with \(score) points"
+  let detail = "(\(score / Double(rank)) points per rank, " +
+    "\(name.count) characters, \(rank * 100)% effort)"
+  let summary = "\(headline)\n\(detail)\n" +
+    "normalized: \(score.rounded()) vs \(Double(rank) * 1.5 + 0.5)"
+  return summary
+}
+
+func ternaryChains(_ value: Int) -> String {
+  let size = value < 10 ? "small" : value < 100 ? "medium"
+    : value < 1000 ? "large" : "huge"
+  let parity = value % 2 == 0 ? "even" : "odd"
+  let sign = value < 0 ? -1 : value > 0 ? 1 : 0
+  return "\(size) \(parity) \(sign)"
+}
+
+func optionalChains(_ words: [String?]) -> Int {
+  let first = words.first ?? nil
+  let count = first?.count ?? 0
+  let total = words.compactMap { $0?.uppercased().count }.reduce(0, +)
+  let fallback = words.last.flatMap { $0 }?.isEmpty ?? true ? 1 : 0
+  return count + total + fallback
+}
+
+func tupleShuffles() -> (Int, Double, String) {
+  let origin = (x: 0.0, y: 0.0, label: "origin")
+  let offset = (dx: 3.0, dy: 4.0)
+  let moved = (x: origin.x + offset.dx, y: origin.y + offset.dy)
+  let distance = (moved.x * moved.x + moved.y * moved.y).squareRoot()
+  let tagged = (Int(distance), distance / 2.0, "\(origin.label)+\(distance)")
+  return tagged
+}
+
+func operatorSections(_ values: [Double]) -> Double {
+  let shifted = values.map { $0 + 1.0 }.map { $0 * 0.5 }
+  let clamped = shifted.map { Swift.max(0.0, Swift.min(1.0, $0)) }
+  let weighted = zip(clamped, values).map { $0 * $1 }
+  return weighted.reduce(0.0, +) / Double(Swift.max(1, values.count))
+}
@@ -0,0 +1,152 @@
+//===--- GenericsHeavy.swift ----------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2020 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+// Compile-time benchmark corpus: generics.
+//
+// Stresses requirement machinery and specialization: protocols with
+// associated types, constrained extensions, conditional conformances and
+// generic compositions several levels deep.
+
+protocol Measurable {
+  associatedtype Unit: Comparable
+  var magnitude: Unit { get }
+}
+
+protocol Scalable: Measurable {
+  func scaled(by factor: Unit) -> Self
+}
+
+protocol Container {
+  associatedtype Element
+  associatedtype Index: Comparable
+  var startIndex: Index { get }
+  var endIndex: Index { get }
+  subscript(position: Index) -> Element { get }
+}
+
+struct Span<Bound: Comparable & AdditiveArithmetic>: Measurable {
+  var lowerBound: Bound
+  var upperBound: Bound
+  var magnitude: Bound { return upperBound - lowerBound }
+}
+
+extension Span: Scalable where Bound: Numeric {
+  func scaled(by factor: Bound) -> Span {
+    return Span(lowerBound: lowerBound * factor, upperBound: upperBound * factor)
+  }
+}
+
+extension Span: Equatable where Bound: Equatable {}
+extension Span: Hashable where Bound: Hashable {}
+
+struct Grid<Cell>: Container {
+  var cells: [[Cell]]
+  var startIndex: Int { return 0 }
+  var endIndex: Int { return cells.count }
+  subscript(position: Int) -> [Cell] { return cells[position] }
+}
+
+extension Grid where Cell: Comparable {
+  func rowMaxima() -> [Cell] {
+    return cells.compactMap { $0.max() }
+  }
+}
+
+extension Grid where Cell: Numeric {
+  func rowSums() -> [Cell] {
+    return cells.map { $0.reduce(Cell.zero, +) }
+  }
+}
+
+struct Labeled<Base: Measurable>: Measurable {
+  var label: String
+  var base: Base
+  var magnitude: Base.Unit { return base.magnitude }
+}
+
+extension Labeled: Scalable where Base: Scalable {
+  func scaled(by factor: Base.Unit) -> Labeled {
+    return Labeled(label: label, base: base.scaled(by: factor))
+  }
+}
+
+func widest<S: Sequence>(_ spans: S) -> S.Element?
+where S.Element: Measurable {
+  return spans.max { $0.magnitude < $1.magnitude }
+}
+
+func totalMagnitude<S: Sequence>(_ values: S) -> S.Element.Unit
+where S.Element: Measurable, S.Element.Unit: AdditiveArithmetic {
+  return values.reduce(S.Element.Unit.zero) { $0 + $1.magnitude }
+}
+
+func rescaleAll<C: Collection>(_ values: C, by factor: C.Element.Unit) -> [C.Element]
+where C.Element: Scalable {
+  return values.map { $0.scaled(by: factor) }
+}
+
+func mergeSorted<C1: Collection, C2: Collection>(
+  _ lhs: C1, _ rhs: C2
+) -> [C1.Element]
+where C1.Element: Comparable, C2.Element == C1.Element {
+  var result: [C1.Element] = []
+  result.reserveCapacity(lhs.count + rhs.count)
+  var i = lhs.startIndex
+  var j = rhs.startIndex
+  while i != lhs.endIndex, j != rhs.endIndex {
+    if lhs[i] <= rhs[j] {
+      result.append(lhs[i])
+      i = lhs.index(after: i)
+    } else {
+      result.append(rhs[j])
+      j = rhs.index(after: j)
+    }
+  }
+  result.append(contentsOf: lhs[i...])
+  result.append(contentsOf: rhs[j...])
+  return result
+}
+
+struct Pipeline<Input, Output> {
+  var transform: (Input) -> Output
+
+  func then<Next>(_ next: Pipeline<Output, Next>) -> Pipeline<Input, Next> {
+    return Pipeline<Input, Next> { next.transform(self.transform($0)) }
+  }
+
+  func mapped<Next>(_ body: @escaping (Output) -> Next) -> Pipeline<Input, Next> {
+    return Pipeline<Input, Next> { body(self.transform($0)) }
+  }
+}
+
+func composedPipelines() -> Pipeline<Int, String> {
+  let widen = Pipeline<Int, Double> { Double($0) }
+  let scale = Pipeline<Double, Double> { $0 * 1.5 }
+  let round = Pipeline<Double, Int> { Int($0.rounded()) }
+  let label = Pipeline<Int, String> { "value: \($0)" }
+  return widen.then(scale).then(round).then(label)
+}
+
+func exerciseGenerics() -> Int {
+  let spans = [
+    Span(lowerBound: 0, upperBound: 10),
+    Span(lowerBound: -5, upperBound: 5),
+    Span(lowerBound: 3, upperBound: 21),
+  ]
+  let labeled = spans.map { Labeled(label: "span", base: $0) }
+  let rescaled = rescaleAll(labeled, by: 2)
+  let grid = Grid(cells: [[1, 2, 3], [4, 5, 6], [7, 8, 9]])
+  let merged = mergeSorted(grid.rowSums(), grid.rowMaxima())
+  let total = totalMagnitude(rescaled)
+  let widestSpan = widest(spans)?.magnitude ?? 0
+  return merged.count + total + widestSpan
+}
@@ -0,0 +1,266 @@
+//===--- LargeInterface.swift ---------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2020 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+// Compile-time benchmark corpus: declaration volume.
+//
+// A wide public surface of simple declarations: SILGen and IRGen have to emit
+// code, metadata and witness tables for everything here, while the
+// type-checking work per declaration stays trivial. Mirrors the shape of a
+// model layer or generated API bindings.
+
+public enum Weekday: Int, CaseIterable, Codable {
+  case monday, tuesday, wednesday, thursday, friday, saturday, sunday
+
+  public var isWeekend: Bool {
+    return self == .saturday || self == .sunday
+  }
+
+  public var shortName: String {
+    switch self {
+    case .monday: return "Mon"
+    case .tuesday: return "Tue"
+    case .wednesday: return "Wed"
+    case .thursday: return "Thu"
+    case .friday: return "Fri"
+    case .saturday: return "Sat"
+    case .sunday: return "Sun"
+    }
+  }
+}
+
+public struct Color: Equatable, Hashable, Codable {
+  public var red: Double
+  public var green: Double
+  public var blue: Double
+  public var alpha: Double
+
+  public init(red: Double, green: Double, blue: Double, alpha: Double = 1.0) {
+    self.red = red
+    self.green = green
+    self.blue = blue
+    self.alpha = alpha
+  }
+
+  public static let black = Color(red: 0, green: 0, blue: 0)
+  public static let white = Color(red: 1, green: 1, blue: 1)
+  public static let clear = Color(red: 0, green: 0, blue: 0, alpha: 0)
+
+  public var luminance: Double {
+    return 0.2126 * red + 0.7152 * green + 0.0722 * blue
+  }
+
+  public func blended(with other: Color, amount: Double) -> Color {
+    let t = Swift.max(0, Swift.min(1, amount))
+    return Color(
+      red: red + (other.red - red) * t,
+      green: green + (other.green - green) * t,
+      blue: blue + (other.blue - blue) * t,
+      alpha: alpha + (other.alpha - alpha) * t)
+  }
+}
+
+public struct Point: Equatable, Hashable, Codable {
+  public var x: Double
+  public var y: Double
+
+  public init(x: Double, y: Double) {
+    self.x = x
+    self.y = y
+  }
+
+  public static let zero = Point(x: 0, y: 0)
+
+  public func distance(to other: Point) -> Double {
+    let dx = other.x - x
+    let dy = other.y - y
+    return (dx * dx + dy * dy).squareRoot()
+  }
+
+  public func offset(dx: Double, dy: Double) -> Point {
+    return Point(x: x + dx, y: y + dy)
+  }
+}
+
+public struct Size: Equatable, Hashable, Codable {
+  public var width: Double
+  public var height: Double
+
+  public init(width: Double, height: Double) {
+    self.width = width
+    self.height = height
+  }
+
+  public static let zero = Size(width: 0, height: 0)
+
+  public var area: Double { return width * height }
+  public var isEmpty: Bool { return width <= 0 || height <= 0 }
+}
+
+public struct Rect: Equatable, Hashable, Codable {
+  public var origin: Point
+  public var size: Size
+
+  public init(origin: Point, size: Size) {
+    self.origin = origin
+    self.size = size
+  }
+
+  public static let zero = Rect(origin: .zero, size: .zero)
+
+  public var minX: Double { return origin.x }
+  public var minY: Double { return origin.y }
+  public var maxX: Double { return origin.x + size.width }
+  public var maxY: Double { return origin.y + size.height }
+  public var center: Point {
+    return Point(x: minX + size.width / 2, y: minY + size.height / 2)
+  }
+
+  public func contains(_ point: Point) -> Bool {
+    return point.x >= minX && point.x < maxX
+      && point.y >= minY && point.y < maxY
+  }
+
+  public func intersects(_ other: Rect) -> Bool {
+    return minX < other.maxX && other.minX < maxX
+      && minY < other.maxY && other.minY < maxY
+  }
+
+  public func insetBy(dx: Double, dy: Double) -> Rect {
+    return Rect(
+      origin: Point(x: minX + dx, y: minY + dy),
+      size: Size(width: size.width - 2 * dx, height: size.height - 2 * dy))
+  }
+}
+
+public enum Alignment: String, CaseIterable, Codable {
+  case leading, center, trailing, top, bottom
+
+  public var isHorizontal: Bool {
+    switch self {
+    case .leading, .center, .trailing: return true
+    case .top, .bottom: return false
+    }
+  }
+}
+
+public struct EdgeInsets: Equatable, Codable {
+  public var top: Double
+  public var leading: Double
+  public var bottom: Double
+  public var trailing: Double
+
+  public init(top: Double, leading: Double, bottom: Double, trailing: Double) {
+    self.top = top
+    self.leading = leading
+    self.bottom = bottom
+    self.trailing = trailing
+  }
+
+  public static let zero = EdgeInsets(top: 0, leading: 0, bottom: 0, trailing: 0)
+
+  public var horizontal: Double { return leading + trailing }
+  public var vertical: Double { return top + bottom }
+}
+
+public protocol Shape {
+  var boundingBox: Rect { get }
+  func contains(_ point: Point) -> Bool
+}
+
+public struct Circle: Shape, Equatable, Codable {
+  public var center: Point
+  public var radius: Double
+
+  public init(center: Point, radius: Double) {
+    self.center = center
+    self.radius = radius
+  }
+
+  public var boundingBox: Rect {
+    return Rect(
+      origin: Point(x: center.x - radius, y: center.y - radius),
+      size: Size(width: radius * 2, height: radius * 2))
+  }
+
+  public func contains(_ point: Point) -> Bool {
+    return center.distance(to: point) <= radius
+  }
+}
+
+public struct Polygon: Shape, Equatable, Codable {
+  public var vertices: [Point]
+
+  public init(vertices: [Point]) {
+    self.vertices = vertices
+  }
+
+  public var boundingBox: Rect {
+    guard let first = vertices.first else { return .zero }
+    var minX = first.x, minY = first.y, maxX = first.x, maxY = first.y
+    for v in vertices.dropFirst() {
+      minX = Swift.min(minX, v.x)
+      minY = Swift.min(minY, v.y)
+      maxX = Swift.max(maxX, v.x)
+      maxY = Swift.max(maxY, v.y)
+    }
+    return Rect(
+      origin: Point(x: minX, y: minY),
+      size: Size(width: maxX - minX, height: maxY - minY))
+  }
+
+  public func contains(_ point: Point) -> Bool {
+    var inside = false
+    var j = vertices.count - 1
+    for i in 0..<vertices.count {
+      let a = vertices[i], b = vertices[j]
+      if (a.y > point.y) != (b.y > point.y),
+        point.x < (b.x - a.x) * (point.y - a.y) / (b.y - a.y) + a.x {
+        inside.toggle()
+      }
+      j = i
+    }
+    return inside
+  }
+}
+
+public struct Canvas {
+  public private(set) var shapes: [Shape] = []
+  public var background: Color = .white
+  public var insets: EdgeInsets = .zero
+
+  public init() {}
+
+  public mutating func add(_ shape: Shape) {
+    shapes.append(shape)
+  }
+
+  public func hitTest(_ point: Point) -> Int? {
+    for (index, shape) in shapes.enumerated().reversed()
+    where shape.contains(point) {
+      return index
+    }
+    return nil
+  }
+
+  public var boundingBox: Rect {
+    return shapes.map { $0.boundingBox }.reduce(Rect.zero) { box, next in
+      guard box.size.area > 0 else { return next }
+      let minX = Swift.min(box.minX, next.minX)
+      let minY = Swift.min(box.minY, next.minY)
+      let maxX = Swift.max(box.maxX, next.maxX)
+      let maxY = Swift.max(box.maxY, next.maxY)
+      return Rect(
+        origin: Point(x: minX, y: minY),
+        size: Size(width: maxX - minX, height: maxY - minY))
+    }
+  }
+}
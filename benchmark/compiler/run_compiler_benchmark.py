@@ -0,0 +1,185 @@
+#!/usr/bin/env python3
+# ===--- run_compiler_benchmark.py ---------------------------------------===//
+#
+#  This source file is part of the Swift.org open source project
+#
+#  Copyright (c) 2014 - 2020 Apple Inc. and the Swift project authors
+#  Licensed under Apache License v2.0 with Runtime Library Exception
+#
+#  See https://swift.org/LICENSE.txt for license information
+#  See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+#
+# ===---------------------------------------------------------------------===//
+#
+# Measures the compiler's own speed on the checked-in corpus of representative
+# sources, with per-phase attribution. Each corpus file is compiled with
+# `swiftc -frontend -c -stats-output-dir` and the phase timers reported by the
+# UnifiedStatsReporter (Parse, Sema, SILOpt, IRGen) are extracted with the
+# `jobstats` module from utils. The best (minimum) time per phase over
+# --iterations runs is compared against a baseline JSON; regressions over
+# --threshold fail the run, so frontend performance changes surface at PR time
+# rather than on the long-term dashboard.
+#
+# Usage:
+#   run_compiler_benchmark.py --swiftc /path/to/swiftc --set-baseline
+#   ... make compiler changes, rebuild ...
+#   run_compiler_benchmark.py --swiftc /path/to/swiftc
+
+import argparse
+import json
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+sys.path.append(os.path.join(SCRIPT_DIR, os.pardir, os.pardir, 'utils'))
+
+from jobstats import load_stats_dir, merge_all_jobstats  # noqa (see above)
+
+
+# Reported phase -> UnifiedStatsReporter frontend timer names contributing
+# to it. The timers appear in the stats JSON as "time.swift.<name>.wall".
+PHASES = [
+    ("Parse", ["parse-and-resolve-imports"]),
+    ("Sema", ["perform-sema"]),
+    ("SILOpt", ["SIL optimization"]),
+    ("IRGen", ["IRGen", "LLVM pipeline"]),
+]
+
+
+def corpus_files(args):
+    return sorted(f for f in os.listdir(args.corpus)
+                  if f.endswith(".swift"))
+
+
+def compile_once(args, source, stats_dir):
+    command = [args.swiftc_binary, "-frontend", "-c",
+               os.path.join(args.corpus, source),
+               "-o", os.devnull,
+               "-stats-output-dir", stats_dir]
+    if args.optimize:
+        command.append("-O")
+    command += args.Xfrontend
+    if args.verbose:
+        print("running: " + " ".join(command))
+    subprocess.check_call(command)
+
+
+def phase_times_ms(stats_dir):
+    """Extract per-phase wall times (ms) from one stats-output-dir."""
+    merged = merge_all_jobstats(load_stats_dir(stats_dir))
+    times = {}
+    for (phase, timers) in PHASES:
+        times[phase] = sum(
+            float(merged.stats.get("time.swift.%s.wall" % t, 0.0)) * 1000.0
+            for t in timers)
+    # Whole-job wall time, converted from the usec duration jobstats
+    # derives from the frontend's own timer.
+    times["Total"] = merged.dur_usec / 1000.0
+    return times
+
+
+def measure(args, source):
+    """Return the best (minimum) per-phase times over --iterations runs."""
+    best = None
+    for _ in range(args.iterations):
+        stats_dir = tempfile.mkdtemp(dir=args.tmpdir)
+        try:
+            compile_once(args, source, stats_dir)
+            times = phase_times_ms(stats_dir)
+        finally:
+            shutil.rmtree(stats_dir)
+        best = times if best is None else \
+            dict((k, min(v, best[k])) for (k, v) in times.items())
+    return best
+
+
+def measure_corpus(args):
+    return dict((source, measure(args, source))
+                for source in corpus_files(args))
+
+
+def report_results(args, results, baseline):
+    """Print per-phase deltas against baseline; return names of regressions."""
+    columns = [phase for (phase, _) in PHASES] + ["Total"]
+    header = ["%s(ms)" % c for c in columns]
+    print("  ".join(["%-24s" % "TEST"] + ["%12s" % h for h in header]))
+    regressions = []
+    for (source, times) in sorted(results.items()):
+        cells = ["%-24s" % source]
+        base = baseline.get(source) if baseline else None
+        for phase in columns:
+            cell = "%.1f" % times[phase]
+            if base is not None and base.get(phase, 0.0) > 0.0:
+                delta = (times[phase] / base[phase] - 1.0) * 100.0
+                cell += " (%+.1f%%)" % delta
+                if delta > args.threshold:
+                    regressions.append("%s/%s" % (source, phase))
+            cells.append("%12s" % cell)
+        print("  ".join(cells))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument(
+        "--swiftc-binary", default="swiftc",
+        help="the swiftc binary to measure")
+    parser.add_argument(
+        "--corpus", default=os.path.join(SCRIPT_DIR, "corpus"),
+        help="directory of corpus sources to compile")
+    parser.add_argument(
+        "--baseline", default=os.path.join(SCRIPT_DIR, "baseline.json"),
+        help="JSON file holding per-phase baseline times")
+    parser.add_argument(
+        "--set-baseline", action="store_true",
+        help="write the measured times to the baseline file and exit")
+    parser.add_argument(
+        "--iterations", type=int, default=3,
+        help="number of compilations per corpus file; minimum is reported")
+    parser.add_argument(
+        "--threshold", type=float, default=5.0,
+        help="per-phase regression threshold against baseline (%%)")
+    parser.add_argument(
+        "--optimize", action="store_true",
+        help="compile the corpus with -O")
+    parser.add_argument(
+        "--Xfrontend", action="append", default=[],
+        help="extra argument to pass to the frontend")
+    parser.add_argument(
+        "--tmpdir", type=str, default=None,
+        help="directory for stats output of individual compilations")
+    parser.add_argument(
+        "--verbose", action="store_true",
+        help="print the commands as they are run")
+    args = parser.parse_args()
+
+    results = measure_corpus(args)
+
+    if args.set_baseline:
+        with open(args.baseline, "w") as f:
+            json.dump(results, f, indent=2, sort_keys=True)
+            f.write("\n")
+        print("baseline written to " + args.baseline)
+        return 0
+
+    baseline = None
+    if os.path.exists(args.baseline):
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+    else:
+        print("warning: no baseline at %s; reporting absolute times only"
+              % args.baseline)
+
+    regressions = report_results(args, results, baseline)
+    if regressions:
+        print("\nregressions over %.1f%%: %s"
+              % (args.threshold, ", ".join(regressions)))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
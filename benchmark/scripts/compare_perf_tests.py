@@ -237,7 +237,10 @@ class PerformanceTestResult(object):
     `--quantile`parameter. In both cases, the last column, MAX_RSS is optional.
     """
 
-    def __init__(self, csv_row, quantiles=False, memory=False, delta=False, meta=False):
+    def __init__(
+        self, csv_row, quantiles=False, memory=False, delta=False, meta=False,
+        malloc=False
+    ):
         """Initialize from a row of multiple columns with benchmark summary.
 
         The row is an iterable, such as a row provided by the CSV parser.
@@ -245,9 +248,10 @@ class PerformanceTestResult(object):
         self.test_num = csv_row[0]  # Ordinal number of the test
         self.name = csv_row[1]  # Name of the performance test
         self.num_samples = int(csv_row[2])  # Number of measurements taken
+        meta_count = (5 if malloc else 3) if meta else 0
 
         if quantiles:  # Variable number of columns representing quantiles
-            mem_index = (-1 if memory else 0) + (-3 if meta else 0)
+            mem_index = (-1 if memory else 0) - meta_count
             runtimes = csv_row[3:mem_index] if memory or meta else csv_row[3:]
             if delta:
                 runtimes = [int(x) if x else 0 for x in runtimes]
@@ -293,11 +297,18 @@ class PerformanceTestResult(object):
             )
             self.samples = None
 
-        # Optional measurement metadata. The number of:
-        # memory pages used, involuntary context switches and voluntary yields
-        self.mem_pages, self.involuntary_cs, self.yield_count = (
-            [int(x) for x in csv_row[-3:]] if meta else (None, None, None)
-        )
+        # Optional measurement metadata. The number of: memory pages used,
+        # involuntary context switches, voluntary yields and (with malloc
+        # introspection) net allocated bytes and blocks
+        meta_columns = [int(x) for x in csv_row[-meta_count:]] if meta else []
+        meta_columns += [None] * (5 - len(meta_columns))
+        (
+            self.mem_pages,
+            self.involuntary_cs,
+            self.yield_count,
+            self.allocated_bytes,
+            self.allocated_blocks,
+        ) = meta_columns
         self.yields = None
         self.setup = None
 
@@ -386,7 +397,7 @@ class LogParser(object):
         """Create instance of `LogParser`."""
         self.results = []
         self.quantiles, self.delta, self.memory = False, False, False
-        self.meta = False
+        self.meta, self.malloc = False, False
         self._reset()
 
     def _reset(self):
@@ -394,14 +405,15 @@ class LogParser(object):
         self.samples, self.yields, self.num_iters = [], [], 1
         self.setup, self.max_rss, self.mem_pages = None, None, None
         self.voluntary_cs, self.involuntary_cs = None, None
+        self.allocated_bytes, self.allocated_blocks = None, None
 
     # Parse lines like this
     # #,TEST,SAMPLES,MIN(μs),MAX(μs),MEAN(μs),SD(μs),MEDIAN(μs)
     results_re = re.compile(
         r"( *\d+[, \t]+[\w.\-\?!]+[, \t]+"
         + r"[, \t]+".join([r"\d+"] * 2)  # #,TEST
-        + r"(?:[, \t]+\d*)*)"  # at least 2...
-    )  # ...or more numeric columns
+        + r"(?:[, \t]+-?\d*)*)"  # at least 2...
+    )  # ...or more numeric columns (negative for allocation deltas)
 
     def _append_result(self, result):
         columns = result.split(",") if "," in result else result.split()
@@ -411,12 +423,15 @@ class LogParser(object):
             memory=self.memory,
             delta=self.delta,
             meta=self.meta,
+            malloc=self.malloc,
         )
         r.setup = self.setup
         r.max_rss = r.max_rss or self.max_rss
         r.mem_pages = r.mem_pages or self.mem_pages
         r.voluntary_cs = self.voluntary_cs
         r.involuntary_cs = r.involuntary_cs or self.involuntary_cs
+        r.allocated_bytes = r.allocated_bytes or self.allocated_bytes
+        r.allocated_blocks = r.allocated_blocks or self.allocated_blocks
         if self.samples:
             r.samples = PerformanceTestSamples(r.name, self.samples)
             r.samples.exclude_outliers()
@@ -432,6 +447,7 @@ class LogParser(object):
         self.quantiles = "MEAN" not in header
         self.memory = "MAX_RSS" in header
         self.meta = "PAGES" in header
+        self.malloc = "ALLOCS" in header
         self.delta = "𝚫" in header
 
     # Regular expression and action to take when it matches the parsed line
@@ -466,6 +482,12 @@ class LogParser(object):
         re.compile(r"\s+ICS \d+ - \d+ = (\d+)"): (
             lambda self, ics: setattr(self, "involuntary_cs", int(ics))
         ),
+        re.compile(r"\s+ALLOC_B \d+ - \d+ = (-?\d+)"): (
+            lambda self, b: setattr(self, "allocated_bytes", int(b))
+        ),
+        re.compile(r"\s+ALLOCS \d+ - \d+ = (-?\d+)"): (
+            lambda self, blocks: setattr(self, "allocated_blocks", int(blocks))
+        ),
     }
 
     def parse_results(self, lines):
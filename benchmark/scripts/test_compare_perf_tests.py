@@ -359,6 +359,14 @@ class TestPerformanceTestResult(unittest.TestCase):
         )
         self.assertEqual(r.max_rss, 32768)
         self.assertEqual((r.mem_pages, r.involuntary_cs, r.yield_count), (8, 28, 15))
+        # #,TEST,SAMPLES,MIN(μs),MAX(μs),PAGES,ICS,YIELD,ALLOC_B,ALLOCS
+        log = "1,Ackermann,200,715,3548,8,31,15,5120,-3"
+        r = PerformanceTestResult(
+            log.split(","), quantiles=True, meta=True, malloc=True
+        )
+        self.assertEqual((r.num_samples, r.min, r.max), (200, 715, 3548))
+        self.assertEqual((r.mem_pages, r.involuntary_cs, r.yield_count), (8, 31, 15))
+        self.assertEqual((r.allocated_bytes, r.allocated_blocks), (5120, -3))
 
     def test_repr(self):
         log_line = "1,AngryPhonebook,20,10664,12933,11035,576,10884"
@@ -630,6 +638,15 @@ Total performance tests executed: 1
             (r.min, r.mem_pages, r.involuntary_cs, r.yield_count, r.max_rss),
             (5, 8, 28, 15, 32768),
         )
+        r = LogParser.results_from_string(
+            "#,TEST,SAMPLES,MIN(μs),MAX(μs),MAX_RSS(B),"
+            + "PAGES,ICS,YIELD,ALLOC_B,ALLOCS\n"
+            + "0,B,1,6,6,32768,8,28,15,5120,-3"
+        )["B"]
+        self.assertEqual(
+            (r.min, r.mem_pages, r.yield_count, r.max_rss), (6, 8, 15, 32768)
+        )
+        self.assertEqual((r.allocated_bytes, r.allocated_blocks), (5120, -3))
 
     def test_parse_results_verbose(self):
         """Parse multiple performance test results with 2 sample formats:
@@ -690,6 +707,8 @@ Totals,2"""
         verbose_log = """    MAX_RSS 8937472 - 8904704 = 32768 (8 pages)
     ICS 1338 - 229 = 1109
     VCS 2 - 1 = 1
+    ALLOC_B 1653760 - 1648640 = 5120
+    ALLOCS 2711 - 2714 = -3
 2,AngryPhonebook,3,11269,11884,11657,338,11820
 """
         parser = LogParser()
@@ -700,6 +719,8 @@ Totals,2"""
         self.assertEqual(r.mem_pages, 8)
         self.assertEqual(r.voluntary_cs, 1)
         self.assertEqual(r.involuntary_cs, 1109)
+        self.assertEqual(r.allocated_bytes, 5120)
+        self.assertEqual(r.allocated_blocks, -3)
 
     def test_results_from_merge(self):
         """Parsing concatenated log merges same PerformanceTestResults"""
@@ -21,12 +21,18 @@ import LibProc
 
 import TestsUtils
 
+#if canImport(LibPerf)
+import LibPerf
+#endif
+
 struct MeasurementMetadata {
   let maxRSS: Int /// Maximum Resident Set Size (B)
   let pages: Int /// Maximum Resident Set Size (pages)
   let ics: Int /// Involuntary Context Switches
   let vcs: Int /// Voluntary Context Switches
   let yields: Int /// Yield Count
+  let allocatedBytes: Int /// Net bytes allocated in malloc zones (B)
+  let allocatedBlocks: Int /// Net number of malloc blocks in use
 }
 
 struct BenchResults {
@@ -104,6 +110,12 @@ struct TestConfig {
   // Should we log the measurement metadata?
   let logMeta: Bool
 
+  /// Should we measure retired instructions instead of wall time?
+  ///
+  /// Counter measurements are far less sensitive to scheduler noise, so a
+  /// single sample usually gives a stable regression signal.
+  let measureInstructions: Bool
+
   /// After we run the tests, should the harness sleep to allow for utilities
   /// like leaks that require a PID to run on the test harness.
   let afterRunSleep: UInt32?
@@ -128,6 +140,7 @@ struct TestConfig {
       var verbose: Bool?
       var logMemory: Bool?
       var logMeta: Bool?
+      var measureInstructions: Bool?
       var action: TestAction?
       var tests: [String]?
     }
@@ -175,6 +188,10 @@ struct TestConfig {
                   help: "log the change in maximum resident set size (MAX_RSS)")
     p.addArgument("--meta", \.logMeta, defaultValue: true,
                   help: "log the metadata (memory usage, context switches)")
+    p.addArgument("--instructions", \.measureInstructions, defaultValue: true,
+                  help: "measure retired instructions instead of wall time\n" +
+                        "(Linux: perf_event, Darwin: rusage_info); samples\n" +
+                        "report instructions per iteration")
     p.addArgument("--delim", \.delim,
                   help:"value delimiter used for log output; default: ,",
                   parser: { $0 })
@@ -206,6 +223,7 @@ struct TestConfig {
     verbose = c.verbose ?? false
     logMemory = c.logMemory ?? false
     logMeta = c.logMeta ?? false
+    measureInstructions = c.measureInstructions ?? false
     afterRunSleep = c.afterRunSleep
     action = c.action ?? .run
     tests = TestConfig.filterTests(registeredBenchmarks,
@@ -233,6 +251,7 @@ struct TestConfig {
         Verbose: \(verbose)
         LogMemory: \(logMemory)
         LogMeta: \(logMeta)
+        MeasureInstructions: \(measureInstructions)
         SampleTime: \(sampleTime)
         NumIters: \(numIters ?? 0)
         Quantile: \(quantile ?? 0)
@@ -380,35 +399,46 @@ extension UInt64 {
   var microseconds: Int { return Int(self / 1000) }
 }
 
-/// Performance test runner that measures benchmarks and reports the results.
-final class TestRunner {
-  let c: TestConfig
-  let timer = Timer()
-  var start, end, lastYield: Timer.TimeT
-  let baseline = TestRunner.getResourceUtilization()
-  let schedulerQuantum = UInt64(10_000_000) // nanoseconds (== 10ms, macos)
-  var yieldCount = 0
+/// Counts the instructions retired by the current process.
+///
+/// Unlike wall time, the instruction count is nearly deterministic for a
+/// deterministic workload. Samples are still inflated by interrupts and
+/// involuntary context switches; those show up as high outliers and are
+/// rejected after sampling (see `TestRunner.rejectOutliers`).
+final class InstructionCounter {
+#if os(Linux) && canImport(LibPerf)
+  private let fd: CInt
+
+  /// Fails when performance monitoring is unavailable, e.g. when it is
+  /// restricted by /proc/sys/kernel/perf_event_paranoid.
+  init?() {
+    fd = swift_perf_open_instructions_counter()
+    if fd < 0 { return nil }
+  }
 
-  init(_ config: TestConfig) {
-    self.c = config
-    let now = timer.getTime()
-    (start, end, lastYield) = (now, now, now)
+  deinit {
+    swift_perf_close_counter(fd)
   }
 
-  /// Offer to yield CPU to other processes and return current time on resume.
-  func yield() -> Timer.TimeT {
-    sched_yield()
-    yieldCount += 1
-    return timer.getTime()
+  func start() {
+    _ = swift_perf_start_counter(fd)
   }
 
-#if os(Linux)
-  private static func getExecutedInstructions() -> UInt64 {
-    // FIXME: there is a Linux PMC API you can use to get this, but it's
-    // not quite so straightforward.
-    return 0
+  func stop() -> UInt64 {
+    let count = swift_perf_stop_counter(fd)
+    return count < 0 ? 0 : UInt64(count)
   }
+#elseif os(Linux) || os(Windows)
+  init?() { return nil }
+  func start() {}
+  func stop() -> UInt64 { return 0 }
 #else
+  private var startCount: UInt64 = 0
+
+  init?() {
+    guard #available(OSX 10.9, iOS 7.0, *) else { return nil }
+  }
+
   private static func getExecutedInstructions() -> UInt64 {
     if #available(OSX 10.9, iOS 7.0, *) {
       var u = rusage_info_v4()
@@ -422,7 +452,47 @@ final class TestRunner {
       return 0
     }
   }
+
+  func start() {
+    startCount = InstructionCounter.getExecutedInstructions()
+  }
+
+  func stop() -> UInt64 {
+    return InstructionCounter.getExecutedInstructions() - startCount
+  }
 #endif
+}
+
+/// Performance test runner that measures benchmarks and reports the results.
+final class TestRunner {
+  let c: TestConfig
+  let timer = Timer()
+  let instructionCounter: InstructionCounter?
+  var start, end, lastYield: Timer.TimeT
+  let baseline = TestRunner.getResourceUtilization()
+#if canImport(Darwin)
+  let baselineMalloc = TestRunner.getMallocStatistics()
+#endif
+  let schedulerQuantum = UInt64(10_000_000) // nanoseconds (== 10ms, macos)
+  var yieldCount = 0
+
+  init(_ config: TestConfig) {
+    self.c = config
+    instructionCounter = config.measureInstructions ? InstructionCounter() : nil
+    if config.measureInstructions && instructionCounter == nil {
+      print("warning: Instruction counting is unavailable on this system;" +
+            " falling back to wall time.")
+    }
+    let now = timer.getTime()
+    (start, end, lastYield) = (now, now, now)
+  }
+
+  /// Offer to yield CPU to other processes and return current time on resume.
+  func yield() -> Timer.TimeT {
+    sched_yield()
+    yieldCount += 1
+    return timer.getTime()
+  }
 
   private static func getResourceUtilization() -> rusage {
 #if canImport(Darwin)
@@ -433,6 +503,14 @@ final class TestRunner {
     var u = rusage(); getrusage(rusageSelf, &u); return u
   }
 
+#if canImport(Darwin)
+  private static func getMallocStatistics() -> malloc_statistics_t {
+    var stats = malloc_statistics_t()
+    malloc_zone_statistics(nil, &stats)
+    return stats
+  }
+#endif
+
   static let pageSize: Int = {
     #if canImport(Darwin)
         let pageSize = _SC_PAGESIZE
@@ -446,8 +524,8 @@ final class TestRunner {
   /// of context switches.
   ///
   /// This method of estimating memory usage is valid only for executing single
-  /// benchmark. That's why we don't worry about reseting the `baseline` in
-  /// `resetMeasurements`.
+  /// benchmark. That's why we don't worry about reseting the `baseline` and
+  /// `baselineMalloc` in `resetMeasurements`.
   ///
   /// FIXME: This current implementation doesn't work on Linux. It is disabled
   /// permanently to avoid linker errors. Feel free to fix.
@@ -465,19 +543,30 @@ final class TestRunner {
       let b = baseline[keyPath: stat], c = current[keyPath: stat]
       return "\(c) - \(b) = \(c - b)"
     }
+    let currentMalloc = TestRunner.getMallocStatistics()
+    let allocatedBytes =
+      Int(currentMalloc.size_in_use) - Int(baselineMalloc.size_in_use)
+    let allocatedBlocks =
+      Int(currentMalloc.blocks_in_use) - Int(baselineMalloc.blocks_in_use)
     logVerbose(
         """
             MAX_RSS \(deltaEquation(\rusage.ru_maxrss)) (\(pages) pages)
             ICS \(deltaEquation(\rusage.ru_nivcsw))
             VCS \(deltaEquation(\rusage.ru_nvcsw))
             yieldCount \(yieldCount)
+            ALLOC_B \(currentMalloc.size_in_use) - \
+        \(baselineMalloc.size_in_use) = \(allocatedBytes)
+            ALLOCS \(currentMalloc.blocks_in_use) - \
+        \(baselineMalloc.blocks_in_use) = \(allocatedBlocks)
         """)
     return MeasurementMetadata(
       maxRSS: maxRSS,
       pages: pages,
       ics: delta(\rusage.ru_nivcsw),
       vcs: delta(\rusage.ru_nvcsw),
-      yields: yieldCount
+      yields: yieldCount,
+      allocatedBytes: allocatedBytes,
+      allocatedBlocks: allocatedBlocks
     )
 #endif
   }
@@ -510,23 +599,52 @@ final class TestRunner {
     return timer.diffTimeInNanoSeconds(from: start, to: end)
   }
 
-  /// Measure the `fn` and return the average sample time per iteration (μs).
+  /// Measure the `fn` and return the average sample time per iteration (μs),
+  /// or the retired instructions per iteration in instruction-count mode.
   func measure(_ name: String, fn: (Int) -> Void, numIters: Int) -> Int {
 #if SWIFT_RUNTIME_ENABLE_LEAK_CHECKER
     name.withCString { p in startTrackingObjects(p) }
 #endif
 
     startMeasurement()
+    instructionCounter?.start()
     fn(numIters)
+    let instructions = instructionCounter?.stop()
     stopMeasurement()
 
 #if SWIFT_RUNTIME_ENABLE_LEAK_CHECKER
     name.withCString { p in stopTrackingObjects(p) }
 #endif
 
+    if let instructions = instructions {
+      return Int(instructions) / numIters
+    }
     return lastSampleTime.microseconds / numIters
   }
 
+  /// Reject samples inflated by interrupts and involuntary context switches.
+  ///
+  /// An instruction count has a hard lower bound — the instructions the
+  /// workload actually retires — so only high outliers (above Q3 + 1.5 IQR)
+  /// can be measurement noise and are rejected.
+  private func rejectOutliers(_ samples: [Int]) -> [Int] {
+    guard samples.count >= 4 else { return samples }
+    let sorted = samples.sorted()
+    func quantile(_ q: Double) -> Int {
+      let index = Swift.max(0,
+        Int((Double(sorted.count) * q).rounded(.up)) - 1)
+      return sorted[index]
+    }
+    let (q1, q3) = (quantile(0.25), quantile(0.75))
+    let limit = q3 + (q3 - q1) * 3 / 2
+    let filtered = samples.filter { $0 <= limit }
+    if filtered.count < samples.count {
+      logVerbose(
+        "    Rejected \(samples.count - filtered.count) outliers above \(limit).")
+    }
+    return filtered
+  }
+
   func logVerbose(_ msg: @autoclosure () -> String) {
     if c.verbose { print(msg()) }
   }
@@ -594,6 +712,10 @@ final class TestRunner {
       addSample(measure(test.name, fn: testFn, numIters: numIters))
     }
 
+    if instructionCounter != nil {
+      samples = rejectOutliers(samples)
+    }
+
     test.tearDownFunction?()
     if let lf = test.legacyFactor {
       logVerbose("    Applying legacy factor: \(lf)")
@@ -604,7 +726,8 @@ final class TestRunner {
   }
 
   var header: String {
-    let withUnit = {$0 + "(μs)"}
+    let unit = instructionCounter != nil ? "(#)" : "(μs)"
+    let withUnit = {$0 + unit}
     let withDelta = {"𝚫" + $0}
     func quantiles(q: Int) -> [String] {
       // See https://en.wikipedia.org/wiki/Quantile#Specialized_quantiles
@@ -623,7 +746,7 @@ final class TestRunner {
       (c.quantile.map(quantiles)
         ?? ["MIN", "MAX", "MEAN", "SD", "MEDIAN"].map(withUnit)) +
       (c.logMemory ? ["MAX_RSS(B)"] : []) +
-      (c.logMeta ? ["PAGES", "ICS", "YIELD"] : [])
+      (c.logMeta ? ["PAGES", "ICS", "YIELD", "ALLOC_B", "ALLOCS"] : [])
     ).joined(separator: c.delim)
   }
 
@@ -645,7 +768,8 @@ final class TestRunner {
             ?? [r.min,  r.max, r.mean, r.sd, r.median]) +
           (c.logMemory ? [r.meta?.maxRSS].compactMap { $0 } : []) +
           (c.logMeta ? r.meta.map {
-            [$0.pages, $0.ics, $0.yields] } ?? [] : [])
+            [$0.pages, $0.ics, $0.yields,
+             $0.allocatedBytes, $0.allocatedBlocks] } ?? [] : [])
         return values.map {
           (c.delta && $0 == 0) ? "" : String($0) } // drop 0s in deltas
       }
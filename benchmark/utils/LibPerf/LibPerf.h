@@ -0,0 +1,65 @@
+//===--- LibPerf.h --------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2020 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+// Thin wrappers around the Linux perf_event interface, for counting retired
+// instructions of the benchmark process. perf_event_open has no libc wrapper
+// and the raw syscall is variadic, so it cannot be called from Swift directly.
+
+#ifndef SWIFT_BENCHMARK_LIBPERF_H
+#define SWIFT_BENCHMARK_LIBPERF_H
+
+#if defined(__linux__)
+
+#include <linux/perf_event.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/// Open a counter of retired user-space instructions for the calling process.
+///
+/// Returns the perf file descriptor, or -1 if performance monitoring is
+/// unavailable (e.g. restricted by /proc/sys/kernel/perf_event_paranoid).
+static inline int swift_perf_open_instructions_counter(void) {
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.size = sizeof(attr);
+  attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+  attr.disabled = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  return (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+/// Reset and enable the counter. Returns 0 on success.
+static inline int swift_perf_start_counter(int fd) {
+  if (ioctl(fd, PERF_EVENT_IOC_RESET, 0) != 0)
+    return -1;
+  return ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+}
+
+/// Disable the counter and return its value, or -1 on failure.
+static inline long long swift_perf_stop_counter(int fd) {
+  long long count = 0;
+  if (ioctl(fd, PERF_EVENT_IOC_DISABLE, 0) != 0)
+    return -1;
+  if (read(fd, &count, sizeof(count)) != (ssize_t)sizeof(count))
+    return -1;
+  return count;
+}
+
+static inline void swift_perf_close_counter(int fd) { close(fd); }
+
+#endif // defined(__linux__)
+
+#endif // SWIFT_BENCHMARK_LIBPERF_H
@@ -878,6 +878,13 @@ public:
   /// module is loaded in full.
   bool canImportModule(ImportPath::Element ModulePath);
 
+  /// Hint to every module loader that the top-level modules with the given
+  /// names are about to be loaded, so loaders may overlap expensive discovery
+  /// work such as file system I/O.
+  ///
+  /// This is purely an optimization; it does not load any modules.
+  void prefetchModules(ArrayRef<Identifier> names);
+
   /// \returns a module with a given name that was already loaded.  If the
   /// module was not loaded, returns nullptr.
   ModuleDecl *getLoadedModule(
@@ -998,6 +1005,14 @@ public:
   InheritedProtocolConformance *
   getInheritedConformance(Type type, ProtocolConformance *inherited);
 
+  /// Retrieve the cached result of applying the given substitution map to
+  /// \p type, or a null type if no result has been recorded.
+  Type getCachedSubstitution(TypeBase *type, SubstitutionMap subMap) const;
+
+  /// Record the result of applying the given substitution map to \p type,
+  /// for reuse by later identical applications.
+  void cacheSubstitution(TypeBase *type, SubstitutionMap subMap, Type result);
+
   /// Get the lazy data for the given declaration.
   ///
   /// \param lazyLoader If non-null, the lazy loader to use when creating the
@@ -1028,6 +1043,33 @@ public:
   /// Returns memory used exclusively by constraint solver.
   size_t getSolverMemory() const;
 
+  /// Per-arena breakdown of this ASTContext's memory usage, for attributing
+  /// the memory consumption of large frontend jobs.
+  struct MemoryBreakdown {
+    /// Bytes in the permanent arena's bump allocator, which holds types,
+    /// decls, identifier strings and most other AST nodes.
+    size_t PermanentArena = 0;
+
+    /// Bytes in the type-uniquing side tables of the permanent arena.
+    size_t TypeTables = 0;
+
+    /// Bytes in the identifier table's buckets. The string data itself
+    /// lives in the permanent arena.
+    size_t IdentifierTable = 0;
+
+    /// Bytes currently allocated in the constraint solver arena, if one is
+    /// active.
+    size_t Solver = 0;
+
+    /// The largest constraint solver arena seen over the lifetime of this
+    /// context. Solver arenas are torn down after each type check, so
+    /// \c Solver understates their contribution to peak memory.
+    size_t SolverHighWater = 0;
+  };
+
+  /// Returns the per-arena breakdown of this ASTContext's memory usage.
+  MemoryBreakdown getMemoryBreakdown() const;
+
   /// Retrieve the Swift name for the given Foundation entity, where
   /// "NS" prefix stripping will apply under omit-needless-words.
   StringRef getSwiftName(KnownFoundationEntity kind);
@@ -1066,6 +1108,22 @@ public:
   GenericSignatureBuilder *getOrCreateGenericSignatureBuilder(
                                                      CanGenericSignature sig);
 
+  /// Retrieve the conformance access path previously recorded for an
+  /// explicit conformance requirement of the given canonical generic
+  /// signature, if any.
+  ///
+  /// Such paths are answered directly from the signature's minimized
+  /// requirements, without constructing a generic signature builder.
+  Optional<ConformanceAccessPath> getExplicitConformanceAccessPath(
+      GenericSignature sig, CanType subjectType, ProtocolDecl *proto);
+
+  /// Record the conformance access path for an explicit conformance
+  /// requirement of the given canonical generic signature.
+  void recordExplicitConformanceAccessPath(GenericSignature sig,
+                                           CanType subjectType,
+                                           ProtocolDecl *proto,
+                                           ConformanceAccessPath path);
+
   /// Retrieve a generic signature with a single unconstrained type parameter,
   /// like `<T>`.
   CanGenericSignature getSingleGenericParameterSignature() const;
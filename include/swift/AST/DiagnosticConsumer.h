@@ -26,6 +26,7 @@
 namespace swift {
   class DiagnosticArgument;
   class DiagnosticEngine;
+  class DiagnosticFormatCache;
   class SourceManager;
   enum class DiagID : uint32_t;
 
@@ -60,6 +61,10 @@ struct DiagnosticInfo {
   /// Paths to "educational note" diagnostic documentation in the toolchain.
   ArrayRef<std::string> EducationalNotePaths;
 
+  /// The emitting engine's memoization of rendered type arguments, to be
+  /// passed back to DiagnosticEngine::formatDiagnosticText. May be null.
+  DiagnosticFormatCache *FormatCache = nullptr;
+
   /// Represents a fix-it, a replacement of one range of text with another.
   class FixIt {
     CharSourceRange Range;
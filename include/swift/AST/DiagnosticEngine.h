@@ -301,6 +301,27 @@ namespace swift {
     }
   };
   
+  /// Memoizes the printed form of types appearing in diagnostic arguments.
+  ///
+  /// A failing build can emit thousands of diagnostics mentioning the same
+  /// handful of long generic types, and rendering each mention through the
+  /// ASTPrinter is a measurable share of emission time. Each DiagnosticEngine
+  /// owns one cache; the printed strings live in its bump allocator. Types
+  /// allocated in the constraint solver's arena are never cached, since
+  /// their pointers can be recycled once the arena is torn down.
+  class DiagnosticFormatCache {
+    llvm::BumpPtrAllocator Allocator;
+
+    /// Rendered types, keyed by the type pointer and whether it was printed
+    /// fully qualified.
+    llvm::DenseMap<std::pair<TypeBase *, bool>, StringRef> PrintedTypes;
+
+  public:
+    /// Print \p type the way diagnostic formatting does, reusing a
+    /// previously rendered string when possible.
+    std::string getPrintedType(Type type, bool fullyQualified);
+  };
+
   struct DiagnosticFormatOptions {
     const std::string OpeningQuotationMark;
     const std::string ClosingQuotationMark;
@@ -590,6 +611,19 @@ namespace swift {
     /// Track settable, per-diagnostic state that we store
     std::vector<Behavior> perDiagnosticBehavior;
 
+    /// The behavior each diagnostic resolves to from the per-diagnostic and
+    /// per-kind settings above, rebuilt lazily whenever those settings
+    /// change. This lets \c determineBehavior map a diagnostic to its
+    /// behavior with a single table load instead of re-running the rule
+    /// chain on every emission.
+    std::vector<Behavior> resolvedBehavior;
+
+    /// Whether \c resolvedBehavior is out of date with the settings above.
+    bool resolvedBehaviorIsStale = true;
+
+    /// Recompute \c resolvedBehavior from the current settings.
+    void rebuildResolvedBehavior();
+
   public:
     DiagnosticState();
 
@@ -608,11 +642,17 @@ namespace swift {
     }
 
     /// Whether to skip emitting warnings
-    void setSuppressWarnings(bool val) { suppressWarnings = val; }
+    void setSuppressWarnings(bool val) {
+      resolvedBehaviorIsStale |= suppressWarnings != val;
+      suppressWarnings = val;
+    }
     bool getSuppressWarnings() const { return suppressWarnings; }
 
     /// Whether to treat warnings as errors
-    void setWarningsAsErrors(bool val) { warningsAsErrors = val; }
+    void setWarningsAsErrors(bool val) {
+      resolvedBehaviorIsStale |= warningsAsErrors != val;
+      warningsAsErrors = val;
+    }
     bool getWarningsAsErrors() const { return warningsAsErrors; }
 
     void resetHadAnyError() {
@@ -622,6 +662,7 @@ namespace swift {
 
     /// Set per-diagnostic behavior
     void setDiagnosticBehavior(DiagID id, Behavior behavior) {
+      resolvedBehaviorIsStale |= perDiagnosticBehavior[(unsigned)id] != behavior;
       perDiagnosticBehavior[(unsigned)id] = behavior;
     }
 
@@ -667,6 +708,10 @@ namespace swift {
     /// but rather stored until all transactions complete.
     llvm::StringSet<llvm::BumpPtrAllocator &> TransactionStrings;
 
+    /// Memoized type rendering, shared with the consumers through
+    /// \c DiagnosticInfo.
+    DiagnosticFormatCache FormatCache;
+
     /// Diagnostic producer to handle the logic behind retrieving a localized
     /// diagnostic message.
     std::unique_ptr<diag::LocalizationProducer> localization;
@@ -959,10 +1004,15 @@ namespace swift {
 
     /// Format the given diagnostic text and place the result in the given
     /// buffer.
+    ///
+    /// \param Cache If non-null, memoizes the rendering of type arguments
+    /// across calls. Consumers receive the emitting engine's cache via
+    /// \c DiagnosticInfo::FormatCache.
     static void formatDiagnosticText(
         llvm::raw_ostream &Out, StringRef InText,
         ArrayRef<DiagnosticArgument> FormatArgs,
-        DiagnosticFormatOptions FormatOpts = DiagnosticFormatOptions());
+        DiagnosticFormatOptions FormatOpts = DiagnosticFormatOptions(),
+        DiagnosticFormatCache *Cache = nullptr);
 
   private:
     /// Called when tentative diagnostic is about to be flushed,
@@ -28,6 +28,7 @@
 #include "llvm/ADT/Optional.h"
 #include "llvm/ADT/SetVector.h"
 #include "llvm/Support/Error.h"
+#include "llvm/Support/Mutex.h"
 #include "llvm/Support/PrettyStackTrace.h"
 #include <string>
 #include <tuple>
@@ -211,8 +212,29 @@ class Evaluator {
   /// is treated as a stack and is used to detect cycles.
   llvm::SetVector<ActiveRequest> activeRequests;
 
-  /// A cache that stores the results of requests.
-  llvm::DenseMap<AnyRequest, AnyValue> cache;
+  /// A cache that stores the results of requests. Mutable so that cache
+  /// lookups, which promote entries out of the cold generation, can be
+  /// performed from const contexts.
+  mutable llvm::DenseMap<AnyRequest, AnyValue> cache;
+
+  /// The previous generation of cached results, kept while a cache
+  /// capacity is in effect. Entries re-requested from here are promoted
+  /// back into \c cache; the rest fall out on the next rotation,
+  /// giving LRU-like eviction without per-entry bookkeeping.
+  mutable llvm::DenseMap<AnyRequest, AnyValue> coldCache;
+
+  /// When nonzero, the number of entries in \c cache that triggers a
+  /// generation rotation. Zero (the default) leaves the cache unbounded.
+  size_t cacheCapacity = 0;
+
+  /// Guards \c cache when the thread-safe request cache is enabled.
+  mutable llvm::sys::Mutex cacheMutex;
+
+  /// Whether cached results may be read and written from multiple
+  /// threads. Clients that consult the evaluator concurrently (e.g. to
+  /// type-check independent function bodies) must enable this; request
+  /// evaluation itself still assumes a single mutating thread.
+  bool threadSafeCache = false;
 
   /// Track the dependencies of each request.
   ///
@@ -252,6 +274,23 @@ public:
   /// statistics will be recorded.
   void setStatsReporter(UnifiedStatsReporter *stats) { this->stats = stats; }
 
+  /// Make the evaluator's internal request cache safe to read and write
+  /// from multiple threads, as a prerequisite for checking independent
+  /// function bodies concurrently.
+  void enableThreadSafeRequestCache() { threadSafeCache = true; }
+
+  /// Bound the memory retained by the evaluator's internal request cache.
+  ///
+  /// The cache is segmented into a hot and a cold generation; once the
+  /// hot generation reaches \p capacity entries it becomes the cold one
+  /// and the previous cold generation is released. Entries hit in the
+  /// cold generation are promoted back, approximating LRU without
+  /// per-entry bookkeeping. Evicted results are recomputed on next use,
+  /// so a budget is only appropriate for long-lived sessions (e.g. IDE
+  /// services) where cached requests are idempotent. Zero disables the
+  /// bound again.
+  void setCacheCapacity(size_t capacity) { cacheCapacity = capacity; }
+
   /// Register the set of request functions for the given zone.
   ///
   /// These functions will be called to evaluate any requests within that
@@ -319,21 +358,31 @@ public:
            typename std::enable_if<!Request::hasExternalCache>::type* = nullptr>
   void cacheOutput(const Request &request,
                    typename Request::OutputType &&output) {
-    cache.insert({AnyRequest(request), std::move(output)});
+    insertCachedResult(request, std::move(output));
   }
 
   /// Do not introduce new callers of this function.
   template<typename Request,
            typename std::enable_if<!Request::hasExternalCache>::type* = nullptr>
   void clearCachedOutput(const Request &request) {
+    if (threadSafeCache) {
+      llvm::sys::ScopedLock guard(cacheMutex);
+      cache.erase(AnyRequest(request));
+      coldCache.erase(AnyRequest(request));
+      return;
+    }
     cache.erase(AnyRequest(request));
+    coldCache.erase(AnyRequest(request));
   }
 
   /// Clear the cache stored within this evaluator.
   ///
   /// Note that this does not clear the caches of requests that use external
   /// caching.
-  void clearCache() { cache.clear(); }
+  void clearCache() {
+    cache.clear();
+    coldCache.clear();
+  }
 
   /// Is the given request, or an equivalent, currently being evaluated?
   template <typename Request>
@@ -341,6 +390,19 @@ public:
     return activeRequests.count(ActiveRequest(request));
   }
 
+  /// Consult the evaluator's cache for a previously-computed result of the
+  /// given request, without computing the result on a cache miss.
+  ///
+  /// This lets clients build a result out of the results of related requests
+  /// that happen to be cached already, while falling back to a full
+  /// computation when they are not.
+  template<typename Request,
+           typename std::enable_if<!Request::hasExternalCache>::type* = nullptr>
+  Optional<typename Request::OutputType>
+  getCachedResult(const Request &request) const {
+    return lookupCachedResult(request);
+  }
+
 private:
   /// Diagnose a cycle detected in the evaluation of the given
   /// request.
@@ -423,11 +485,9 @@ private:
   llvm::Expected<typename Request::OutputType>
   getResultCached(const Request &request) {
     // If we already have an entry for this request in the cache, return it.
-    auto known = cache.find_as(request);
-    if (known != cache.end()) {
-      auto r = known->second.template castTo<typename Request::OutputType>();
-      reportEvaluatedResult<Request>(request, r);
-      return r;
+    if (auto cached = lookupCachedResult(request)) {
+      reportEvaluatedResult<Request>(request, *cached);
+      return *cached;
     }
 
     // Compute the result.
@@ -436,10 +496,61 @@ private:
       return result;
 
     // Cache the result.
-    cache.insert({AnyRequest(request), *result});
+    insertCachedResult(request, *result);
     return result;
   }
 
+  /// Look up a previously-computed result for the given request, copying
+  /// it out under the cache lock when the thread-safe cache is enabled.
+  template<typename Request>
+  Optional<typename Request::OutputType>
+  lookupCachedResult(const Request &request) const {
+    auto lookup = [&]() -> Optional<typename Request::OutputType> {
+      auto known = cache.find_as(request);
+      if (known != cache.end())
+        return known->second.template castTo<typename Request::OutputType>();
+
+      // Check the cold generation and promote hits back into the hot one.
+      auto cold = coldCache.find_as(request);
+      if (cold != coldCache.end()) {
+        auto result =
+            cold->second.template castTo<typename Request::OutputType>();
+        cache.insert({cold->first, cold->second});
+        coldCache.erase(cold);
+        return result;
+      }
+
+      return None;
+    };
+    if (!threadSafeCache)
+      return lookup();
+    llvm::sys::ScopedLock guard(cacheMutex);
+    return lookup();
+  }
+
+  /// Record a computed result for the given request in the cache.
+  template<typename Request>
+  void insertCachedResult(const Request &request,
+                          typename Request::OutputType result) {
+    auto insert = [&] {
+      cache.insert({AnyRequest(request), std::move(result)});
+
+      // If a capacity is in effect and the hot generation has reached it,
+      // rotate: the hot generation becomes the cold one, and whatever was
+      // not re-requested since the last rotation is released.
+      if (cacheCapacity != 0 && cache.size() >= cacheCapacity) {
+        coldCache = std::move(cache);
+        cache = llvm::DenseMap<AnyRequest, AnyValue>();
+      }
+    };
+    if (threadSafeCache) {
+      llvm::sys::ScopedLock guard(cacheMutex);
+      insert();
+      return;
+    }
+    insert();
+  }
+
 private:
   // Report the result of evaluating a request that is not a dependency sink.
   template <typename Request, typename std::enable_if<
@@ -28,6 +28,7 @@ namespace fine_grained_dependencies {
 
 class SourceFileDepGraph;
 
+using llvm::BCArray;
 using llvm::BCFixed;
 using llvm::BCVBR;
 using llvm::BCBlob;
@@ -64,6 +65,13 @@ namespace record_block {
     FINGERPRINT_NODE,
     DEPENDS_ON_DEFINITION_NODE,
     IDENTIFIER_NODE,
+
+    // The following records only appear in the driver's "priors" file, which
+    // persists the integrated ModuleDepGraph between driver invocations. They
+    // never occur in a swiftdeps file.
+    MODULE_DEP_GRAPH_NODE,
+    USES_OF_DEF_NODE,
+    EXTERNAL_DEP_NODE,
   };
 
   // Always the first record in the file.
@@ -111,6 +119,42 @@ namespace record_block {
     BCVBR<16> // The sequence number (starting from 0) of the referenced
               // SOURCE_FILE_DEP_GRAPH_NODE
   >;
+
+  // A node of the driver's integrated dependency graph. Nodes are implicitly
+  // sequence-numbered in order of appearance, starting from 0, and may be
+  // followed by a FINGERPRINT_NODE record. The swiftdeps path identifier is
+  // only meaningful for provides nodes; expats use the empty identifier.
+  using ModuleDepGraphNodeLayout = BCRecordLayout<
+    MODULE_DEP_GRAPH_NODE, // ID
+    // The next four fields correspond to the fields of the DependencyKey
+    // structure.
+    NodeKindField, // DependencyKey::kind
+    DeclAspectField, // DependencyKey::aspect
+    IdentifierIDField, // DependencyKey::context
+    IdentifierIDField, // DependencyKey::name
+    BCFixed<1>, // Is this a "provides" node, i.e. is there a swiftdeps file?
+    IdentifierIDField // The swiftdeps path of the providing job
+  >;
+
+  // One def-use entry of the driver's integrated dependency graph: the key of
+  // a definition, followed by the sequence numbers of the
+  // MODULE_DEP_GRAPH_NODE records that use it. Follows all of the
+  // MODULE_DEP_GRAPH_NODE records.
+  using UsesOfDefNodeLayout = BCRecordLayout<
+    USES_OF_DEF_NODE,
+    NodeKindField, // DependencyKey::kind of the def
+    DeclAspectField, // DependencyKey::aspect of the def
+    IdentifierIDField, // DependencyKey::context of the def
+    IdentifierIDField, // DependencyKey::name of the def
+    BCArray<BCVBR<16>> // Sequence numbers of the using nodes
+  >;
+
+  // An external dependency of the driver's integrated dependency graph.
+  using ExternalDepNodeLayout = BCRecordLayout<
+    EXTERNAL_DEP_NODE,
+    BCFixed<1>, // Is this an incremental external dependency?
+    BCBlob // The path of the external dependency
+  >;
 }
 
 /// Tries to read the dependency graph from the given buffer.
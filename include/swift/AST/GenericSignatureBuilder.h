@@ -509,6 +509,13 @@ public:
   /// Retrieve the AST context.
   ASTContext &getASTContext() const { return Context; }
 
+  /// Retrieve the memoization cache used by
+  /// \c GenericSignatureImpl::getCanonicalTypeInContext, which maps an
+  /// already-canonical type containing type parameters to its canonical form
+  /// relative to the signature this builder was created for. Only consulted
+  /// once the builder is finalized, so entries never go stale.
+  llvm::DenseMap<TypeBase *, CanType> &getCanonicalTypeInContextCache();
+
   /// Functor class suitable for use as a \c LookupConformanceFn to look up a
   /// conformance in a generic signature builder.
   class LookUpConformanceInBuilder {
@@ -221,6 +221,11 @@ public:
   /// Emit functions to separate sections.
   unsigned FunctionSections : 1;
 
+  /// Path to a file listing one mangled symbol per line. Function
+  /// definitions named in it are emitted first, in the listed order, so a
+  /// first-use trace can be turned into a startup-friendly text layout.
+  std::string FunctionOrderFile;
+
   /// The maximum number of bytes used on a stack frame for stack promotion
   /// (includes alloc_stack allocations).
   unsigned StackPromotionSizeLimit = 1024;
@@ -250,6 +255,11 @@ public:
   /// Emit names of struct stored properties and enum cases.
   unsigned EnableReflectionNames : 1;
 
+  /// In whole-module builds, skip the field descriptors of non-public types
+  /// when the module contains no reflective uses, unless the type is marked
+  /// @_alwaysEmitReflectionMetadata.
+  unsigned StripUnusedReflectionMetadata : 1;
+
   /// Emit mangled names of anonymous context descriptors.
   unsigned EnableAnonymousContextMangledNames : 1;
 
@@ -271,6 +281,11 @@ public:
   /// arguments.
   unsigned PrespecializeGenericMetadata : 1;
 
+  /// The path to a file listing mangled names of generic type specializations
+  /// for which metadata should be statically specialized, one per line.
+  /// Typically harvested from a runtime metadata-cache trace.
+  StringRef PrespecializeGenericMetadataListPath;
+
   /// The path to load legacy type layouts from.
   StringRef ReadLegacyTypeInfoPath;
 
@@ -334,6 +349,11 @@ public:
 
   JITDebugArtifact DumpJIT = JITDebugArtifact::None;
 
+  /// If non-empty, immediate mode keeps JITed objects in this directory,
+  /// keyed by a hash of the module contents, and reuses them on later runs
+  /// of unchanged code instead of recompiling.
+  std::string JITObjectCachePath;
+
   IRGenOptions()
       : DWARFVersion(2), OutputKind(IRGenOutputKind::LLVMAssembly),
         Verify(true), OptMode(OptimizationMode::NotSet),
@@ -348,7 +368,8 @@ public:
         PrintInlineTree(false), EmbedMode(IRGenEmbedMode::None),
         LLVMLTOKind(IRGenLLVMLTOKind::None), HasValueNamesSetting(false),
         ValueNames(false), EnableReflectionMetadata(true),
-        EnableReflectionNames(true), EnableAnonymousContextMangledNames(false),
+        EnableReflectionNames(true), StripUnusedReflectionMetadata(false),
+        EnableAnonymousContextMangledNames(false),
         ForcePublicLinkage(false), LazyInitializeClassMetadata(false),
         LazyInitializeProtocolConformances(false), DisableLegacyTypeInfo(false),
         PrespecializeGenericMetadata(false), UseIncrementalLLVMCodeGen(true),
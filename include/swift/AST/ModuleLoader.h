@@ -188,6 +188,13 @@ public:
   virtual
   ModuleDecl *loadModule(SourceLoc importLoc, ImportPath::Module path) = 0;
 
+  /// Hint that the top-level modules with the given names are about to be
+  /// loaded, so the loader may overlap any expensive discovery work it would
+  /// otherwise perform serially in \c loadModule, such as file system I/O.
+  ///
+  /// This is purely an optimization; loaders are free to ignore it.
+  virtual void prefetchModules(ArrayRef<Identifier> names) { }
+
   /// Load extensions to the given nominal type.
   ///
   /// \param nominal The nominal type whose extensions should be loaded.
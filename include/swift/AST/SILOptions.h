@@ -54,6 +54,19 @@ public:
   /// It is turned off by default.
   bool EnableSpeculativeDevirtualization = false;
 
+  /// Controls whether the SIL linker defers deserializing function bodies
+  /// which do not have to be emitted into the client until an optimization
+  /// inspects them. It is turned off by default.
+  bool EnableLazyLinking = false;
+
+  /// Controls whether SILGen omits the Objective-C entry points of @objc
+  /// members that can only be dispatched natively: non-public, non-dynamic
+  /// members whose @objc-ness was inferred (e.g. via @objcMembers) and that
+  /// neither override an Objective-C method nor satisfy an @objc protocol
+  /// requirement. Omitted entry points also lose their Objective-C method
+  /// list entries, so such members stop being visible to objc_msgSend.
+  bool LazyObjCThunks = false;
+
   /// Should we run any SIL performance optimizations
   ///
   /// Useful when you want to enable -O LLVM opts but not -O SIL opts.
@@ -506,6 +506,27 @@ public:
   bool isCached() const { return true; }
 };
 
+/// Generate the USR for the given storage accessor.
+class AccessorUSRGenerationRequest :
+    public SimpleRequest<AccessorUSRGenerationRequest,
+                         std::string(const AbstractStorageDecl*, AccessorKind),
+                         RequestFlags::Cached>
+{
+public:
+  using SimpleRequest::SimpleRequest;
+
+private:
+  friend SimpleRequest;
+
+  // Evaluation.
+  std::string evaluate(Evaluator &eval, const AbstractStorageDecl *d,
+                       AccessorKind kind) const;
+
+public:
+  // Caching
+  bool isCached() const { return true; }
+};
+
 /// Generate the mangling for the given local type declaration.
 class MangleLocalTypeDeclRequest :
     public SimpleRequest<MangleLocalTypeDeclRequest,
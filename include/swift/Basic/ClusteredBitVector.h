@@ -114,7 +114,17 @@ public:
 
   /// Add the low N bits from the given value to the vector.
   void add(size_t numBits, uint64_t value) {
-    append(fromAPInt(APInt(numBits, value)));
+    if (numBits == 0) {
+      return;
+    }
+    if (!Bits) {
+      Bits = APInt(numBits, value);
+      return;
+    }
+    APInt &v = Bits.getValue();
+    unsigned w = v.getBitWidth();
+    v = v.zext(w + numBits);
+    v.insertBits(APInt(numBits, value), w);
   }
 
   /// Append a number of clear bits to this vector.
@@ -248,9 +258,13 @@ public:
 
   /// Return this bit-vector as an APInt, with low indices becoming
   /// the least significant bits of the number.
-  APInt asAPInt() const {
-    // Return 1-bit wide zero APInt for a 0-bit vector.
-    return Bits ? Bits.getValue() : APInt();
+  ///
+  /// The reference is only valid until the vector is next mutated.
+  /// Returning a reference matters because the masks this class describes
+  /// are routinely wider than 64 bits, where copying an APInt allocates.
+  const APInt &asAPInt() const {
+    // Return the shared 1-bit wide zero APInt for a 0-bit vector.
+    return Bits ? Bits.getValue() : getEmptyAPInt();
   }
 
   /// Construct a bit-vector from an APInt.
@@ -278,6 +292,10 @@ public:
   /// Pretty-print the vector.
   void print(llvm::raw_ostream &out) const;
   SWIFT_DEBUG_DUMP;
+
+private:
+  /// Return the APInt that stands in for a zero-length vector in asAPInt().
+  static const APInt &getEmptyAPInt();
 };
 
 } // end namespace swift
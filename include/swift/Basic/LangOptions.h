@@ -489,10 +489,24 @@ namespace swift {
     /// dumped to llvm::errs().
     bool DebugTimeExpressions = false;
 
+    /// If true, emit a remark with constraint solver statistics (time,
+    /// scopes explored, search depth, disjunction fanout) for each
+    /// type-checked expression. Unlike the \c DebugTime options these are
+    /// regular diagnostics, so they can be collected from a serialized
+    /// diagnostics file and attributed back to source ranges.
+    bool ExpressionTypeCheckingRemarks = false;
+
     /// Indicate that the type checker should skip type-checking non-inlinable
     /// function bodies.
     bool SkipNonInlinableFunctionBodies = false;
 
+    /// Indicate that the type checker should skip type-checking all function
+    /// bodies, including inlinable ones. The emitted module contains only
+    /// interface-level declarations and no serialized SIL, so it can unblock
+    /// downstream type-checking but not downstream optimization. Implies
+    /// \c SkipNonInlinableFunctionBodies.
+    bool SkipAllFunctionBodies = false;
+
     ///
     /// Flags for developers
     ///
@@ -581,6 +595,14 @@ namespace swift {
     /// Disable validating the persistent PCH.
     bool PCHDisableValidation = false;
 
+    /// Don't verify input files for Clang modules if the module has been
+    /// successfully validated or loaded during this build session.
+    bool ValidateModulesOnce = false;
+
+    /// Use the last modification time of this file as the underlying Clang
+    /// build session timestamp.
+    std::string BuildSessionFilePath;
+
     /// \see Mode
     enum class Modes : uint8_t {
       /// Set up Clang for importing modules into Swift and generating IR from
@@ -19,6 +19,7 @@
 #include "llvm/ADT/Optional.h"
 #include "llvm/Support/SourceMgr.h"
 #include <map>
+#include <vector>
 
 namespace swift {
 
@@ -61,7 +62,28 @@ class SourceManager {
   std::map<const char *, VirtualFile> VirtualFiles;
   mutable std::pair<const char *, const VirtualFile*> CachedVFile = {nullptr, nullptr};
 
+  /// The result of the last buffer search: a pointer interval together with
+  /// the ID of the buffer which the search returns for every location in the
+  /// interval. Locations are typically queried in clusters (e.g. when
+  /// serializing diagnostics), so this avoids repeating the linear search
+  /// over all buffers. Invalidated whenever a buffer is added.
+  struct BufferLocCacheType {
+    const char *Start = nullptr;
+    const char *End = nullptr;
+    unsigned BufferID = 0;
+  };
+  mutable BufferLocCacheType BufferLocCache;
+
+  /// Per-buffer, lazily built arrays of the byte offset of every line start.
+  /// Line and column queries binary-search these instead of rescanning the
+  /// buffer, which matters for diagnostic-heavy and indexing workloads.
+  mutable llvm::DenseMap<unsigned, std::vector<unsigned>> LineStartOffsets;
+
   Optional<unsigned> findBufferContainingLocInternal(SourceLoc Loc) const;
+
+  /// Retrieves the sorted byte offsets of the line starts in \p BufferID,
+  /// building them on first use.
+  ArrayRef<unsigned> getLineStartOffsets(unsigned BufferID) const;
 public:
   SourceManager(llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> FS =
                     llvm::vfs::getRealFileSystem())
@@ -226,7 +248,7 @@ public:
     assert(Loc.isValid());
     int LineOffset = getLineOffset(Loc);
     int l, c;
-    std::tie(l, c) = LLVMSourceMgr.getLineAndColumn(Loc.Value, BufferID);
+    std::tie(l, c) = getLineAndColumnInBuffer(Loc, BufferID);
     assert(LineOffset+l > 0 && "bogus line offset");
     return { LineOffset + l, c };
   }
@@ -237,10 +259,7 @@ public:
   ///
   /// This does not respect \c #sourceLocation directives.
   std::pair<unsigned, unsigned>
-  getLineAndColumnInBuffer(SourceLoc Loc, unsigned BufferID = 0) const {
-    assert(Loc.isValid());
-    return LLVMSourceMgr.getLineAndColumn(Loc.Value, BufferID);
-  }
+  getLineAndColumnInBuffer(SourceLoc Loc, unsigned BufferID = 0) const;
 
   StringRef getEntireTextForBuffer(unsigned BufferID) const;
 
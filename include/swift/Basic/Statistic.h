@@ -123,6 +123,17 @@ public:
     const TraceFormatter *Formatter;
   };
 
+  // A stripped-down trace record used by -trace-stats-minimal: just a
+  // timestamp, the (static-storage) event name and the entry/exit bit. No
+  // counter snapshots, no entity formatting, no rusage sampling; cheap
+  // enough to leave on during ordinary compiles.
+  struct MinimalTraceRecord
+  {
+    uint64_t TimeNSec;
+    StringRef EventName;
+    bool IsEntry;
+  };
+
   // We only write fine-grained trace entries when the user passed
   // -trace-stats-events, but we recycle the same FrontendStatsTracers to give
   // us some free recursion-save phase timings whenever -trace-stats-dir is
@@ -144,6 +155,7 @@ private:
   SmallString<128> StatsFilename;
   SmallString<128> TraceFilename;
   SmallString<128> ProfileDirname;
+  SmallString<128> MinimalTraceFilename;
   llvm::TimeRecord StartedTime;
   std::thread::id MainThreadID;
 
@@ -157,6 +169,15 @@ private:
   Optional<AlwaysOnFrontendCounters> LastTracedFrontendCounters;
   Optional<std::vector<FrontendStatsEvent>> FrontendStatsEvents;
 
+  // Fixed-capacity ring buffer for -trace-stats-minimal. Once full, new
+  // records overwrite the oldest ones, so the memory cost is bounded and
+  // long compiles keep their most recent history. Stats events are only
+  // recorded on the main thread (see saveAnyFrontendStatsEvents), so no
+  // synchronization is needed.
+  Optional<std::vector<MinimalTraceRecord>> MinimalTrace;
+  size_t MinimalTraceNext = 0;
+  bool MinimalTraceWrapped = false;
+
   // These are unique_ptr so we can use incomplete types here.
   std::unique_ptr<RecursionSafeTimers> RecursiveTimers;
   std::unique_ptr<StatsProfilers> EventProfilers;
@@ -176,7 +197,8 @@ private:
                        clang::SourceManager *CSM,
                        bool TraceEvents,
                        bool ProfileEvents,
-                       bool ProfileEntities);
+                       bool ProfileEntities,
+                       bool MinimalTracing);
 public:
   UnifiedStatsReporter(StringRef ProgramName,
                        StringRef ModuleName,
@@ -189,7 +211,8 @@ public:
                        clang::SourceManager *CSM=nullptr,
                        bool TraceEvents=false,
                        bool ProfileEvents=false,
-                       bool ProfileEntities=false);
+                       bool ProfileEntities=false,
+                       bool MinimalTracing=false);
   ~UnifiedStatsReporter();
 
   AlwaysOnDriverCounters &getDriverCounters();
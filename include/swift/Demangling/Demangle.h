@@ -500,6 +500,12 @@ enum class OperatorKind {
 /// Remangle a demangled parse tree.
 std::string mangleNode(NodePointer root);
 
+/// Remangle a demangled parse tree.
+///
+/// The returned string is owned by \p Factory. This means \p Factory must stay
+/// alive as long as the returned string is used.
+llvm::StringRef mangleNode(NodePointer root, NodeFactory &Factory);
+
 using SymbolicResolver =
   llvm::function_ref<Demangle::NodePointer (SymbolicReferenceKind,
                                             const void *)>;
@@ -146,6 +146,10 @@ void mangleIdentifier(Mangler &M, StringRef ident) {
                              size_t FromWordIdx, size_t ToWordIdx) -> int {
         for (size_t Idx = FromWordIdx; Idx < ToWordIdx; ++Idx) {
           const SubstitutionWord &w = M.Words[Idx];
+          // Quickly reject words of a different length or first character
+          // before comparing the full text.
+          if (w.length != wordLen || Str[w.start] != Word[0])
+            continue;
           StringRef existingWord =  Str.substr(w.start, w.length);
           if (Word == existingWord)
             return (int)Idx;
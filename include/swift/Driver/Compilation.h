@@ -25,6 +25,7 @@
 #include "swift/Basic/Statistic.h"
 #include "swift/Driver/Driver.h"
 #include "swift/Driver/Job.h"
+#include "swift/Driver/ParseableOutput.h"
 #include "swift/Driver/Util.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Support/Chrono.h"
@@ -208,6 +209,13 @@ private:
   /// If unknown, this will be some time in the past.
   llvm::sys::TimePoint<> LastBuildTime = llvm::sys::TimePoint<>::min();
 
+  /// Wall-clock compile time in milliseconds for each input file, keyed by
+  /// input path. Seeded from the previous build record and updated with
+  /// measurements from this build; inputs that were skipped this time keep
+  /// their previous value. Used to start the slowest files first, and
+  /// written back to the build record for the next build.
+  llvm::StringMap<uint64_t> InputCompileTimes;
+
   /// Indicates whether this Compilation should continue execution of subtasks
   /// even if they returned an error status.
   bool ContinueBuildingAfterErrors = false;
@@ -250,6 +258,10 @@ private:
   /// detail than ShowIncrementalBuildDecisions.
   bool ShowJobLifecycle = false;
 
+  /// The wire format to use when Level is OutputLevel::Parseable.
+  parseable_output::Format ParseableOutputFormat =
+      parseable_output::Format::JSON;
+
   /// When true, some frontend job has requested permission to pass
   /// -emit-loaded-module-trace, so no other job needs to do it.
   bool PassedEmitLoadedModuleTraceToFrontendJob = false;
@@ -288,6 +300,11 @@ private:
   /// (experimental) Enable cross-module incremental build scheduling.
   const bool EnableCrossModuleIncrementalBuild;
 
+  /// (experimental) Persist the integrated dependency graph between driver
+  /// invocations and reload it instead of re-reading unchanged swiftdeps
+  /// files.
+  const bool EnableIncrementalPriors;
+
 public:
   /// Will contain a comparator if an argument demands it.
   Optional<IncrementalSchemeComparator> IncrementalComparator;
@@ -328,7 +345,8 @@ public:
               bool EnableSourceRangeDependencies = false,
               bool CompareIncrementalSchemes = false,
               StringRef CompareIncrementalSchemesPath = "",
-              bool EnableCrossModuleIncrementalBuild = false);
+              bool EnableCrossModuleIncrementalBuild = false,
+              bool EnableIncrementalPriors = false);
   // clang-format on
   ~Compilation();
 
@@ -423,6 +441,13 @@ public:
     ShowJobLifecycle = value;
   }
 
+  parseable_output::Format getParseableOutputFormat() const {
+    return ParseableOutputFormat;
+  }
+  void setParseableOutputFormat(parseable_output::Format value) {
+    ParseableOutputFormat = value;
+  }
+
   bool getShowDriverTimeCompilation() const {
     return ShowDriverTimeCompilation;
   }
@@ -431,10 +456,36 @@ public:
     return EnableCrossModuleIncrementalBuild;
   }
 
+  bool getEnableIncrementalPriors() const {
+    return EnableIncrementalPriors;
+  }
+
+  /// The file beside the build record that holds the persisted integrated
+  /// dependency graph.
+  std::string getIncrementalPriorsPath() const {
+    return CompilationRecordPath.empty() ? std::string()
+                                         : CompilationRecordPath + ".priors";
+  }
+
   size_t getFilelistThreshold() const {
     return FilelistThreshold;
   }
 
+  /// The compile time in milliseconds recorded for \p input by the previous
+  /// build, or 0 if there is no history for it (e.g. a newly-added file).
+  uint64_t getInputCompileTime(StringRef input) const {
+    return InputCompileTimes.lookup(input);
+  }
+  const llvm::StringMap<uint64_t> &getInputCompileTimes() const {
+    return InputCompileTimes;
+  }
+  void setInputCompileTimes(llvm::StringMap<uint64_t> &&times) {
+    InputCompileTimes = std::move(times);
+  }
+  void recordInputCompileTime(StringRef input, uint64_t millis) {
+    InputCompileTimes[input] = millis;
+  }
+
   /// Since every make-style dependency file contains
   /// the same information, incremental builds are sped up by only emitting one
   /// of those files. Since the build system expects to see the files existing,
@@ -332,6 +332,25 @@ public:
   Changes loadFromSwiftModuleBuffer(const driver::Job *, llvm::MemoryBuffer &,
                                     DiagnosticEngine &);
 
+  //============================================================================
+  // MARK: ModuleDepGraph - persisting and reloading the integrated graph
+  //============================================================================
+
+  /// Write out the integrated graph so that a later driver invocation can
+  /// reconstitute it with \ref readPriorsFromPath instead of re-reading and
+  /// re-integrating the swiftdeps file of every job.
+  /// \returns true if there was an error.
+  bool writePriorsToPath(DiagnosticEngine &diags, StringRef path) const;
+
+  /// Reconstitute a graph previously written with \ref writePriorsToPath.
+  /// Jobs are not part of the persisted graph; the caller must register them
+  /// separately, and must re-integrate the swiftdeps file of any job that has
+  /// changed since the priors were written.
+  /// \returns true if there was an error; the graph may then hold a partial
+  /// load, and the caller should fall back to integrating every swiftdeps
+  /// file, which overwrites any partially-loaded state.
+  bool readPriorsFromPath(StringRef path, DiagnosticEngine &diags);
+
 private:
   /// Read a SourceFileDepGraph belonging to \p job from \p buffer
   /// and integrate it into the ModuleDepGraph.
@@ -28,23 +28,40 @@ class Job;
 
 namespace parseable_output {
 
+/// The wire format used to frame parseable output messages.
+enum class Format {
+  /// Each message is its decimal byte count on one line, followed by the
+  /// JSON message itself and a trailing newline. This is the original
+  /// format and remains the default.
+  JSON,
+  /// Each message is a fixed 4-byte magic ('SWPM'), a little-endian 32-bit
+  /// payload byte count, and then the payload. The payload is the same JSON
+  /// object as in the textual format, so consumers share one message schema
+  /// and only the (much cheaper to scan) framing differs.
+  Binary,
+};
+
 /// Emits a "began" message to the given stream.
 void emitBeganMessage(raw_ostream &os, const Job &Cmd, int64_t Pid,
-                      sys::TaskProcessInformation ProcInfo);
+                      sys::TaskProcessInformation ProcInfo,
+                      Format Fmt = Format::JSON);
 
 /// Emits a "finished" message to the given stream.
 void emitFinishedMessage(raw_ostream &os, const Job &Cmd, int64_t Pid,
                          int ExitStatus, StringRef Output,
-                         sys::TaskProcessInformation ProcInfo);
+                         sys::TaskProcessInformation ProcInfo,
+                         Format Fmt = Format::JSON);
 
 /// Emits a "signalled" message to the given stream.
 void emitSignalledMessage(raw_ostream &os, const Job &Cmd, int64_t Pid,
                           StringRef ErrorMsg, StringRef Output,
                           Optional<int> Signal,
-                          sys::TaskProcessInformation ProcInfo);
+                          sys::TaskProcessInformation ProcInfo,
+                          Format Fmt = Format::JSON);
 
 /// Emits a "skipped" message to the given stream.
-void emitSkippedMessage(raw_ostream &os, const Job &Cmd);
+void emitSkippedMessage(raw_ostream &os, const Job &Cmd,
+                        Format Fmt = Format::JSON);
 
 } // end namespace parseable_output
 } // end namespace driver
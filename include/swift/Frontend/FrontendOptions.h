@@ -74,6 +74,24 @@ public:
   /// binary module has already been built for use by the compiler.
   std::string PrebuiltModuleCachePath;
 
+  /// The path to a shared, possibly read-only or network-mounted, cache of
+  /// binary modules built from module interfaces, keyed by the interface's
+  /// contents and the compiler version. Consulted before rebuilding a module
+  /// interface.
+  std::string SharedModuleCachePath;
+
+  /// The path to a local cache of previously-produced object files, keyed by
+  /// a hash of the canonical SIL module and the parts of the invocation that
+  /// affect code generation. When the key of a compilation is found in the
+  /// cache, the cached object is copied to the output and IRGen and the LLVM
+  /// backend are skipped entirely.
+  std::string ObjectFileCacheDir;
+
+  /// If non-empty, the path at which to write the frontend arguments as a
+  /// response file. Together with a .sib snapshot of the post-Sema module,
+  /// this lets another machine replay the invocation with @<path>.
+  std::string InvocationRecordPath;
+
   /// For these modules, we should prefer using Swift interface when importing them.
   std::vector<std::string> PreferInterfaceForModules;
 
@@ -183,6 +201,9 @@ public:
   /// entity.
   bool ProfileEntities = false;
 
+  /// Record a low-overhead binary event trace to a file in StatsOutputDir.
+  bool MinimalStatsTracing = false;
+
   /// Indicates whether or not an import statement can pick up a Swift source
   /// file (as opposed to a module file).
   bool EnableSourceImport = false;
@@ -216,6 +237,11 @@ public:
   /// by the Clang importer as part of semantic analysis.
   bool SerializeBridgingHeader = false;
 
+  /// If set, the module's TBD symbol set is serialized into the emitted
+  /// swiftmodule, so TBD files can be re-emitted from the swiftmodule
+  /// without visiting the module's AST.
+  bool SerializeModuleTBDSymbols = false;
+
   /// Indicates whether or not the frontend should print statistics upon
   /// termination.
   bool PrintStats = false;
@@ -224,6 +250,10 @@ public:
   /// termination.
   bool PrintClangStats = false;
 
+  /// Indicates whether the frontend should print the per-arena memory
+  /// breakdown of the ASTContext upon termination.
+  bool PrintASTArenaStats = false;
+
   /// Indicates whether standard help should be shown.
   bool PrintHelp = false;
 
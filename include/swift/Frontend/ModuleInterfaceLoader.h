@@ -316,15 +316,17 @@ class ModuleInterfaceCheckerImpl: public ModuleInterfaceChecker {
   ASTContext &Ctx;
   std::string CacheDir;
   std::string PrebuiltCacheDir;
+  std::string SharedCacheDir;
   ModuleInterfaceLoaderOptions Opts;
 
 public:
   explicit ModuleInterfaceCheckerImpl(ASTContext &Ctx,
                                       StringRef cacheDir,
                                       StringRef prebuiltCacheDir,
-                                      ModuleInterfaceLoaderOptions Opts)
+                                      ModuleInterfaceLoaderOptions Opts,
+                                      StringRef sharedCacheDir = StringRef())
   : Ctx(Ctx), CacheDir(cacheDir), PrebuiltCacheDir(prebuiltCacheDir),
-    Opts(Opts) {}
+    SharedCacheDir(sharedCacheDir), Opts(Opts) {}
 
   std::vector<std::string>
   getCompiledModuleCandidatesForInterface(StringRef moduleName,
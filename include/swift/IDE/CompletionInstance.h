@@ -40,20 +40,38 @@ class CompletionInstance {
   struct Options {
     unsigned MaxASTReuseCount = 100;
     unsigned DependencyCheckIntervalSecond = 5;
+    unsigned MaxCachedCompilerInstances = 4;
   } Opts;
 
   std::mutex mtx;
 
-  std::unique_ptr<CompilerInstance> CachedCI;
-  llvm::hash_code CachedArgHash;
-  llvm::sys::TimePoint<> DependencyCheckedTimestamp;
-  llvm::StringMap<llvm::hash_code> InMemoryDependencyHash;
-  unsigned CachedReuseCount = 0;
+  /// A compiler instance kept alive from a previous operation, along with
+  /// everything needed to decide whether it can be reused.
+  struct CachedInstance {
+    std::unique_ptr<CompilerInstance> CI;
+    llvm::hash_code ArgHash;
+    llvm::sys::TimePoint<> DependencyCheckedTimestamp;
+    llvm::StringMap<llvm::hash_code> InMemoryDependencyHash;
+    unsigned ReuseCount = 0;
+  };
+
+  /// Cached compiler instances, at most one per completion file, in
+  /// least-recently-used order with the most recently used at the back.
+  /// Bounded by \c Opts.MaxCachedCompilerInstances, so alternating between a
+  /// handful of files doesn't evict each file's AST in turn.
+  std::vector<std::unique_ptr<CachedInstance>> InstancePool;
 
   void cacheCompilerInstance(std::unique_ptr<CompilerInstance> CI,
                              llvm::hash_code ArgsHash);
 
-  bool shouldCheckDependencies() const;
+  /// Finds the cached instance whose completion file is \p bufferName, or
+  /// returns \c nullptr if there is none.
+  CachedInstance *findCachedInstance(llvm::StringRef bufferName);
+
+  /// Moves \p instance to the most-recently-used position in the pool.
+  void touchCachedInstance(const CachedInstance *instance);
+
+  bool shouldCheckDependencies(const CachedInstance &instance) const;
 
   /// Calls \p Callback with cached \c CompilerInstance if it's usable for the
   /// specified completion request.
@@ -86,13 +86,15 @@ public:
 // Input for RangeInfoRequest.
 // Putting the source file and location together allows us to print the request
 // input well e.g. file.swift:3:4
+// Both constructors normalize the range to the tokens it covers, so that
+// selections differing only in surrounding whitespace or comments share one
+// cache entry.
 struct RangeInfoOwner {
   SourceFile *File;
   SourceLoc StartLoc;
   SourceLoc EndLoc;
 
-  RangeInfoOwner(SourceFile *File, SourceLoc StartLoc, SourceLoc EndLoc):
-    File(File), StartLoc(StartLoc), EndLoc(EndLoc) {}
+  RangeInfoOwner(SourceFile *File, SourceLoc StartLoc, SourceLoc EndLoc);
   RangeInfoOwner(SourceFile *File, unsigned Offset, unsigned Length);
 
   friend llvm::hash_code hash_value(const RangeInfoOwner &CI) {
@@ -38,6 +38,7 @@ namespace clang {
 }
 
 namespace swift {
+  class AbstractFunctionDecl;
   class ModuleDecl;
   class ValueDecl;
   class ASTContext;
@@ -135,6 +136,25 @@ void getLocationInfoForClangNode(ClangNode ClangNode,
 
 Optional<std::pair<unsigned, unsigned>> parseLineCol(StringRef LineCol);
 
+/// If the contents of \p editedText differ from the contents of \p SF's buffer
+/// only within the body of a single function, mark that body to be re-parsed
+/// from \p editedText and return the affected function.
+///
+/// On success, a new buffer holding the edited body is registered in the
+/// source manager and the function's body is re-parsed from it on the next
+/// request, mirroring what fast code completion does for the body containing
+/// the completion token. Every other declaration, and every previously parsed
+/// or type-checked body, is left untouched, so the cost of bringing the AST
+/// back up to date tracks the size of the edited function rather than the
+/// size of the file.
+///
+/// Returns \c nullptr without modifying \p SF if there is no edit, or if the
+/// edit is not confined to one function body (including edits that change
+/// where the body ends, e.g. by inserting an unbalanced brace); in that case
+/// the caller must rebuild the AST.
+AbstractFunctionDecl *reparseFunctionBodyForEdit(SourceFile &SF,
+                                                 StringRef editedText);
+
 class XMLEscapingPrinter : public StreamPrinter {
   public:
   XMLEscapingPrinter(raw_ostream &OS) : StreamPrinter(OS){};
@@ -0,0 +1,145 @@
+//===--- CachingMemoryReader.h - Page cache over a MemoryReader -*- C++ -*-===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2021 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+//
+//  This file declares an implementation of MemoryReader that caches
+//  page-sized reads from an underlying reader. Walking reflection metadata
+//  issues many small neighboring reads (field descriptors, typeref strings,
+//  mangled names); reading whole pages turns those into a handful of bulk
+//  requests against the remote process.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef SWIFT_REMOTE_CACHINGMEMORYREADER_H
+#define SWIFT_REMOTE_CACHINGMEMORYREADER_H
+
+#include "swift/Remote/MemoryReader.h"
+#include "llvm/ADT/DenseMap.h"
+
+namespace swift {
+namespace remote {
+
+/// A MemoryReader decorator that rounds reads out to fixed-size pages and
+/// serves subsequent reads of the same page from a local cache.
+///
+/// Reads larger than a page, and reads of pages that cannot be fetched
+/// whole (for example at the end of a mapped region), are passed through
+/// to the underlying reader unmodified, so the set of addresses that can
+/// be read successfully is unchanged.
+class CachingMemoryReader final : public MemoryReader {
+  std::shared_ptr<MemoryReader> Base;
+
+  /// Granularity of cached reads. Small enough that a page never spans a
+  /// typical remote mapping boundary, large enough to batch the descriptor
+  /// and string reads of an entire metadata neighborhood.
+  static constexpr uint64_t PageSize = 4096;
+
+  /// Bound on cached pages (4MB with the page size above). The cache is
+  /// dropped wholesale when the bound is hit; walks are local enough that
+  /// the working set is rebuilt almost immediately.
+  static constexpr size_t MaxPages = 1024;
+
+  llvm::DenseMap<uint64_t, std::unique_ptr<uint8_t[]>> Pages;
+
+  /// Returns the cached contents of the page starting at \p pageBase,
+  /// fetching it from the underlying reader if necessary, or null if the
+  /// whole page cannot be read.
+  const uint8_t *getPage(uint64_t pageBase) {
+    auto cached = Pages.find(pageBase);
+    if (cached != Pages.end())
+      return cached->second.get();
+
+    auto page = std::make_unique<uint8_t[]>(PageSize);
+    if (!Base->readBytes(RemoteAddress(pageBase), page.get(), PageSize))
+      return nullptr;
+
+    if (Pages.size() >= MaxPages)
+      Pages.clear();
+    return (Pages[pageBase] = std::move(page)).get();
+  }
+
+public:
+  explicit CachingMemoryReader(std::shared_ptr<MemoryReader> base)
+      : Base(std::move(base)) {}
+
+  bool queryDataLayout(DataLayoutQueryType type, void *inBuffer,
+                       void *outBuffer) override {
+    return Base->queryDataLayout(type, inBuffer, outBuffer);
+  }
+
+  RemoteAddress getSymbolAddress(const std::string &name) override {
+    return Base->getSymbolAddress(name);
+  }
+
+  RemoteAbsolutePointer resolvePointer(RemoteAddress address,
+                                       uint64_t readValue) override {
+    return Base->resolvePointer(address, readValue);
+  }
+
+  bool readBytes(RemoteAddress address, uint8_t *dest,
+                 uint64_t size) override {
+    // Requests spanning many pages are already bulk reads; don't copy them
+    // through the cache.
+    if (size > PageSize)
+      return Base->readBytes(address, dest, size);
+
+    uint64_t addr = address.getAddressData();
+    while (size > 0) {
+      uint64_t pageBase = addr & ~(PageSize - 1);
+      uint64_t offsetInPage = addr - pageBase;
+      uint64_t bytesFromPage = std::min(size, PageSize - offsetInPage);
+
+      auto *page = getPage(pageBase);
+      if (!page) {
+        // The surrounding page is not fully readable; retry just the
+        // requested range.
+        return Base->readBytes(RemoteAddress(addr), dest, size);
+      }
+      memcpy(dest, page + offsetInPage, bytesFromPage);
+      dest += bytesFromPage;
+      addr += bytesFromPage;
+      size -= bytesFromPage;
+    }
+    return true;
+  }
+
+  bool readString(RemoteAddress address, std::string &dest) override {
+    // Scan for the terminator through the page cache; mangled name strings
+    // cluster on the same pages as the descriptors that reference them.
+    std::string result;
+    uint64_t addr = address.getAddressData();
+    while (true) {
+      uint64_t pageBase = addr & ~(PageSize - 1);
+      auto *page = getPage(pageBase);
+      if (!page) {
+        // Fall back to the underlying reader, which may be able to size the
+        // string without reading a whole page.
+        return Base->readString(address, dest);
+      }
+      uint64_t offsetInPage = addr - pageBase;
+      auto *begin = page + offsetInPage;
+      auto *end = static_cast<const uint8_t *>(
+          memchr(begin, 0, PageSize - offsetInPage));
+      if (end) {
+        result.append(begin, end);
+        dest = std::move(result);
+        return true;
+      }
+      result.append(begin, page + PageSize);
+      addr = pageBase + PageSize;
+    }
+  }
+};
+
+} // end namespace remote
+} // end namespace swift
+
+#endif // SWIFT_REMOTE_CACHINGMEMORYREADER_H
@@ -159,6 +159,22 @@ HeapObject *swift_nonatomic_retain(HeapObject *object);
 SWIFT_RUNTIME_EXPORT
 HeapObject* swift_nonatomic_retain_n(HeapObject *object, uint32_t n);
 
+/// Retains every object in an array of object references. Runs of references
+/// to the same object are coalesced into a single retain-by-n, so e.g. an
+/// array filled with repetitions of one element performs one atomic
+/// increment per run instead of one per element.
+///
+/// Null entries in the array are skipped.
+SWIFT_RUNTIME_EXPORT
+void swift_bulkRetain(HeapObject **objects, size_t count);
+
+/// Releases every object in an array of object references, coalescing runs
+/// of references to the same object into a single release-by-n.
+///
+/// Null entries in the array are skipped.
+SWIFT_RUNTIME_EXPORT
+void swift_bulkRelease(HeapObject **objects, size_t count);
+
 /// Atomically increments the reference count of an object, unless it has
 /// already been destroyed. Returns nil if the object is dead.
 SWIFT_RUNTIME_EXPORT
@@ -36,6 +36,15 @@ typedef long swift_once_t;
 // On Cygwin, std::once_flag can not be used because it is larger than the
 // platform word.
 typedef uintptr_t swift_once_t;
+
+#elif defined(__linux__)
+
+// On Linux, swift_once_t is a word-sized state machine driven directly by
+// the futex syscall; see Once.cpp. The "done" state is -1, matching the
+// compiler's barrier-free inline fast path
+// (SwiftTargetInfo.OnceDonePredicateValue).
+typedef intptr_t swift_once_t;
+
 #else
 
 // On other platforms swift_once_t is std::once_flag
@@ -150,6 +150,26 @@ private:
   /// Allocator that manages the memory of all the pieces of the SILModule.
   mutable llvm::BumpPtrAllocator BPA;
 
+  /// Allocator dedicated to SILInstruction storage. Keeping instructions out
+  /// of \c BPA means instructions created together - during SILGen of a
+  /// function or while inlining into it - end up contiguous in their own
+  /// slabs instead of interleaved with type lowering and other module
+  /// allocations, which matters for the memory-bound block traversals the
+  /// optimizer does.
+  mutable llvm::BumpPtrAllocator InstAllocator;
+
+  /// The number of size buckets used to recycle deleted instruction memory,
+  /// and the bucket granularity in bytes. Allocations larger than the
+  /// biggest bucket fall back to the C allocator.
+  enum : unsigned {
+    NumInstFreeListBuckets = 16,
+    InstFreeListGranularity = 64
+  };
+
+  /// Heads of singly-linked free lists of deleted instructions, by bucket.
+  /// The link pointer is stored in the first word of the dead instruction.
+  mutable void *InstFreeLists[NumInstFreeListBuckets] = {};
+
   /// The swift Module associated with this SILModule.
   ModuleDecl *TheSwiftModule;
 
@@ -181,6 +201,11 @@ private:
   llvm::DenseMap<std::pair<const SILVTable *, SILDeclRef>, SILVTable::Entry>
       VTableEntryCache;
 
+  /// Cache of mangled names for SILDeclRefs, so that repeatedly looking up
+  /// or re-creating a function for the same declaration does not re-run the
+  /// mangler each time.
+  llvm::DenseMap<SILDeclRef, std::string> MangledNameCache;
+
   /// Lookup table for SIL witness tables from conformances.
   llvm::DenseMap<const RootProtocolConformance *, SILWitnessTable *>
   WitnessTableMap;
@@ -551,6 +576,9 @@ public:
   /// \return null if this module has no such function
   SILFunction *lookUpFunction(SILDeclRef fnRef);
 
+  /// Return the mangled name of \p fnRef, memoized per module.
+  std::string getMangledName(SILDeclRef fnRef);
+
   /// Attempt to deserialize the SILFunction. Returns true if deserialization
   /// succeeded, false otherwise.
   bool loadFunction(SILFunction *F);
@@ -25,6 +25,7 @@ class SILDebugScope;
 class SILInstruction;
 class SILFunction;
 class SILBasicBlock;
+struct PrintOptions;
 
 /// Used as context for the SIL print functions.
 class SILPrintContext {
@@ -57,6 +58,11 @@ protected:
 
   llvm::DenseMap<const SILDebugScope *, unsigned> ScopeToIDMap;
 
+  /// Rendered AST type strings, keyed by canonical type. Textual SIL prints
+  /// the same types over and over; rendering each of them once makes dumping
+  /// large modules noticeably cheaper.
+  llvm::DenseMap<CanType, std::string> TypeStringCache;
+
   /// Dump more information in the SIL output.
   bool Verbose;
   
@@ -128,6 +134,10 @@ public:
     return ID;
   }
 
+  /// Returns \p Ty rendered with the print options \p PO, cached per
+  /// context. The returned string is only valid until the next call.
+  StringRef getTypeString(CanType Ty, const PrintOptions &PO);
+
   /// Callback which is invoked by the SILPrinter before the instruction \p I
   /// is written.
   virtual void printInstructionCallBack(const SILInstruction *I);
@@ -36,6 +36,10 @@ namespace {
     size_t V1, V2;
     // The TBAAType pair:
     void *T1, *T2;
+    // The generation of the values' function at the time of the query. An
+    // entry whose function has been invalidated since carries an old
+    // generation and can never match again.
+    size_t FnGen;
   };
 
   /// A key used for the MemoryBehavior Analysis cache.
@@ -127,6 +131,18 @@ private:
   /// because doing so could give rise to collisions in the other cache.
   ValueEnumerator<SILNode*> MemoryBehaviorNodeToIndex;
 
+  /// A generation number per function, bumped whenever a function is
+  /// invalidated. Cache keys embed the generation of the queried values'
+  /// function, so bumping it retires all cached queries into that function
+  /// without scanning the caches. Stale entries are dropped by the periodic
+  /// size-limit flushes of the caches.
+  llvm::DenseMap<SILFunction *, size_t> FunctionGenerations;
+
+  /// Returns the current generation number of \p F.
+  size_t getFunctionGeneration(SILFunction *F) {
+    return F ? FunctionGenerations.lookup(F) : 0;
+  }
+
   AliasResult aliasAddressProjection(SILValue V1, SILValue V2,
                                      SILValue O1, SILValue O2);
 
@@ -248,11 +264,19 @@ public:
   virtual void invalidate() override {
     AliasCache.clear();
     MemoryBehaviorCache.clear();
+    FunctionGenerations.clear();
   }
 
-  virtual void invalidate(SILFunction *,
+  virtual void invalidate(SILFunction *F,
                           SILAnalysis::InvalidationKind K) override {
-    invalidate();
+    // Retire the cached alias queries into \p F. An alias query only inspects
+    // values of its own function, so entries of other functions remain valid.
+    ++FunctionGenerations[F];
+
+    // Memory behavior results also depend on the effect summaries of called
+    // functions, which can change without the caller being invalidated, so
+    // this cache is still cleared wholesale.
+    MemoryBehaviorCache.clear();
   }
 
   /// Notify the analysis about a newly created function.
@@ -260,7 +284,9 @@ public:
 
   /// Notify the analysis about a function which will be deleted from the
   /// module.
-  virtual void notifyWillDeleteFunction(SILFunction *F) override {}
+  virtual void notifyWillDeleteFunction(SILFunction *F) override {
+    FunctionGenerations.erase(F);
+  }
 
   virtual void invalidateFunctionTables() override { }
 };
@@ -279,11 +305,11 @@ namespace llvm {
   template <> struct DenseMapInfo<AliasKeyTy> {
     static inline AliasKeyTy getEmptyKey() {
       auto Allone = std::numeric_limits<size_t>::max();
-      return {0, Allone, nullptr, nullptr};
+      return {0, Allone, nullptr, nullptr, 0};
     }
     static inline AliasKeyTy getTombstoneKey() {
       auto Allone = std::numeric_limits<size_t>::max();
-      return {Allone, 0, nullptr, nullptr};
+      return {Allone, 0, nullptr, nullptr, 0};
     }
     static unsigned getHashValue(const AliasKeyTy Val) {
       unsigned H = 0;
@@ -291,13 +317,15 @@ namespace llvm {
       H ^= DenseMapInfo<size_t>::getHashValue(Val.V2);
       H ^= DenseMapInfo<void *>::getHashValue(Val.T1);
       H ^= DenseMapInfo<void *>::getHashValue(Val.T2);
+      H ^= DenseMapInfo<size_t>::getHashValue(Val.FnGen);
       return H;
     }
     static bool isEqual(const AliasKeyTy LHS, const AliasKeyTy RHS) {
       return LHS.V1 == RHS.V1 &&
              LHS.V2 == RHS.V2 &&
              LHS.T1 == RHS.T1 &&
-             LHS.T2 == RHS.T2;
+             LHS.T2 == RHS.T2 &&
+             LHS.FnGen == RHS.FnGen;
     }
   };
 
@@ -1051,18 +1051,22 @@ private:
 
   // @_semantics("array.uninitialized") takes a reference to the storage and
   // returns an instantiated array struct and unsafe pointer to the elements.
+  // The @_semantics("array.uninitialized_intrinsic") variant allocates the
+  // storage itself and only takes the element count as argument.
   struct ArrayUninitCall {
     SILValue arrayStorageRef;
     TupleExtractInst *arrayStruct = nullptr;
     TupleExtractInst *arrayElementPtr = nullptr;
+    bool isIntrinsic = false;
 
     bool isValid() const {
-      return arrayStorageRef && arrayStruct && arrayElementPtr;
+      return (arrayStorageRef || isIntrinsic) && arrayStruct && arrayElementPtr;
     }
   };
 
-  /// If \p ai is an optimizable @_semantics("array.uninitialized") call, return
-  /// valid call information.
+  /// If \p ai is an optimizable @_semantics("array.uninitialized") or
+  /// @_semantics("array.uninitialized_intrinsic") call, return valid call
+  /// information.
   ArrayUninitCall
   canOptimizeArrayUninitializedCall(ApplyInst *ai);
 
@@ -1158,6 +1162,16 @@ public:
   /// Note that if \p RI is a retain-instruction always false is returned.
   bool canEscapeTo(SILValue V, RefCountingInst *RI);
 
+  /// Returns true if the value passed as the \p ParamIdx-th argument of the
+  /// apply site \p FAS can escape inside any of the functions which may be
+  /// called, i.e. the callee may store the value or let it escape in some
+  /// other way. The query is answered from the callees' summary graphs, so it
+  /// sees through chains of applies.
+  /// If \p checkContentOfIndirectParam is true, the check is performed for
+  /// the content of an indirect parameter instead of the parameter itself.
+  bool canParameterEscape(FullApplySite FAS, int ParamIdx,
+                          bool checkContentOfIndirectParam);
+
   /// Return true if \p releasedReference deinitialization may release memory
   /// pointed to by \p accessedAddress.
   bool mayReleaseContent(SILValue releasedReference, SILValue accessedAddress);
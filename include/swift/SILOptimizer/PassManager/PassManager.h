@@ -15,6 +15,7 @@
 #include "swift/SILOptimizer/PassManager/PassPipeline.h"
 #include "swift/SILOptimizer/PassManager/Passes.h"
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/Support/Casting.h"
 #include "llvm/Support/ErrorHandling.h"
@@ -68,6 +69,9 @@ class SILPassManager {
 
     /// How many times the pipeline was restarted for the function.
     unsigned NumRestarts = 0;
+
+    /// How many pipeline positions in a row did not change the function.
+    unsigned NumConsecutiveUnchanged = 0;
   };
 
   /// The worklist of functions to be processed by function passes.
@@ -97,6 +101,17 @@ class SILPassManager {
   /// Set to true when a pass invalidates an analysis.
   bool CurrentPassHasInvalidated = false;
 
+  /// Functions which changed since the last whole-module verification.
+  /// Only consulted under -sil-verify-incrementally; see
+  /// verifyChangedFunctions().
+  llvm::SmallPtrSet<SILFunction *, 16> ChangedFunctions;
+
+  /// Set to true when a pass reports a change which cannot be attributed to
+  /// individual functions, e.g. an update of the witness- or vtables. Such
+  /// a change forces the next verification to cover the whole module. Starts
+  /// out true so that the first verification establishes a verified baseline.
+  bool ModuleLevelChange = true;
+
   /// True if we need to stop running passes and restart again on the
   /// same function.
   bool RestartPipeline = false;
@@ -153,6 +168,7 @@ public:
         AP->invalidate();
 
     CurrentPassHasInvalidated = true;
+    ModuleLevelChange = true;
 
     // Assume that all functions have changed. Clear all masks of all functions.
     CompletedPassesMap.clear();
@@ -185,8 +201,9 @@ public:
     for (auto AP : Analyses)
       if (!AP->isLocked())
         AP->invalidate(F, K);
-    
+
     CurrentPassHasInvalidated = true;
+    ChangedFunctions.insert(F);
     // Any change let all passes run again.
     CompletedPassesMap[F].reset();
   }
@@ -200,6 +217,7 @@ public:
         AP->invalidateFunctionTables();
 
     CurrentPassHasInvalidated = true;
+    ModuleLevelChange = true;
 
     // Assume that all functions have changed. Clear all masks of all functions.
     CompletedPassesMap.clear();
@@ -213,6 +231,7 @@ public:
         AP->notifyWillDeleteFunction(F);
 
     CurrentPassHasInvalidated = true;
+    ChangedFunctions.erase(F);
     // Any change let all passes run again.
     CompletedPassesMap[F].reset();
   }
@@ -278,9 +297,20 @@ private:
   /// Run the \p TransIdx'th pass on the function \p F.
   void runPassOnFunction(unsigned TransIdx, SILFunction *F);
 
+  /// Verify the module proportionally to what changed since the last
+  /// verification: only functions in ChangedFunctions are verified, unless a
+  /// module-level change forces a whole-module verification.
+  void verifyChangedFunctions();
+
   /// Run the passes in Transform from \p FromTransIdx to \p ToTransIdx.
   void runFunctionPasses(unsigned FromTransIdx, unsigned ToTransIdx);
 
+  /// Returns true if every pass in [\p TransIdx, \p ToTransIdx) would be
+  /// skipped on \p F because it already ran without making any changes.
+  /// In this case \p F has converged and can leave the pipeline early.
+  bool allRemainingPassesWouldBeSkipped(SILFunction *F, unsigned TransIdx,
+                                        unsigned ToTransIdx);
+
   /// Helper function to check if the function pass should be run mandatorily
   /// All passes in mandatory pass pipeline and ownership model elimination are
   /// mandatory function passes.
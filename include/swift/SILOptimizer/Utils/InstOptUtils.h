@@ -236,9 +236,13 @@ void eraseUsesOfValue(SILValue value);
 /// Returns an invalid SILValue in case there are multiple stores or any unknown
 /// users of \p existentialBox.
 /// The \p ignoreUser is ignored in the user list of \p existentialBox.
+/// If \p lookThroughBranches is true, the box may also be passed verbatim to
+/// successor block arguments (e.g. from an inlined throw to the error block of
+/// the enclosing try_apply) and the arguments' users are checked as well.
 SILValue
 getConcreteValueOfExistentialBox(AllocExistentialBoxInst *existentialBox,
-                                 SILInstruction *ignoreUser);
+                                 SILInstruction *ignoreUser,
+                                 bool lookThroughBranches = false);
 
 /// Gets the concrete value which is stored in an existential box, which itself
 /// is stored in \p addr.
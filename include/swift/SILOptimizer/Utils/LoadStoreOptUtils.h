@@ -366,21 +366,29 @@ public:
   static void reduce(LSLocation Base, SILModule *Mod,
                      TypeExpansionContext context, LSLocationList &Locs);
 
-  /// Enumerate the given Mem LSLocation.
+  /// Enumerate the given Mem LSLocation. The expanded fields of the location
+  /// are only added to the vault if all of them fit within \p LocationLimit;
+  /// otherwise the location stays unenumerated and its accesses have to be
+  /// treated as unknown memory instructions.
   static void enumerateLSLocation(TypeExpansionContext context, SILModule *M,
                                   SILValue Mem,
                                   std::vector<LSLocation> &LSLocationVault,
                                   LSLocationIndexMap &LocToBit,
                                   LSLocationBaseMap &BaseToLoc,
-                                  TypeExpansionAnalysis *TE);
+                                  TypeExpansionAnalysis *TE,
+                                  unsigned LocationLimit);
 
-  /// Enumerate all the locations in the function.
+  /// Enumerate all the locations in the function, up to \p LocationLimit
+  /// locations. The limit keeps the location vault small enough for the
+  /// clients' bit-vector data flows on large functions; locations beyond the
+  /// limit are simply not enumerated.
   static void enumerateLSLocations(SILFunction &F,
                                    std::vector<LSLocation> &LSLocationVault,
                                    LSLocationIndexMap &LocToBit,
                                    LSLocationBaseMap &BaseToLoc,
                                    TypeExpansionAnalysis *TE,
-                                   std::pair<int, int> &LSCount);
+                                   std::pair<int, int> &LSCount,
+                                   unsigned LocationLimit);
 };
 
 static inline llvm::hash_code hash_value(const LSLocation &L) {
@@ -36,6 +36,11 @@ void updateSILModuleStatsAfterTransform(SILModule &M, SILTransform *Transform,
                                         SILPassManager &PM, int PassNumber,
                                         int Duration);
 
+/// Returns true if collection of SIL optimizer statistics is enabled,
+/// i.e. if updateSILModuleStatsAfterTransform will consume the pass
+/// duration it is given.
+bool shouldCollectSILModuleStats();
+
 } // end namespace swift
 
 #endif
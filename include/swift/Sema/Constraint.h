@@ -321,6 +321,13 @@ class Constraint final : public llvm::ilist_node<Constraint>,
   /// if any. 0 = None, 1 = Forward, 2 = Backward.
   unsigned trailingClosureMatching : 2;
 
+  /// The number of times the solver has failed after attempting this
+  /// constraint as a disjunction choice. Deliberately not rolled back
+  /// when solver scopes unwind, so later attempts of the same
+  /// disjunction under different outer decisions can explore
+  /// historically unproductive choices last. Saturates.
+  uint8_t NumFailures = 0;
+
   union {
     struct {
       /// The first type.
@@ -534,6 +541,17 @@ public:
   void setFavored(bool favored = true) { IsFavored = favored; }
   bool isFavored() const { return IsFavored; }
 
+  /// Note that the solver failed while exploring this constraint as a
+  /// disjunction choice.
+  void recordFailure() {
+    if (NumFailures != UINT8_MAX)
+      ++NumFailures;
+  }
+
+  /// The number of times the solver has failed while exploring this
+  /// constraint as a disjunction choice (saturating).
+  unsigned getNumFailures() const { return NumFailures; }
+
   /// Whether the solver should remember which choice was taken for
   /// this constraint.
   bool shouldRememberChoice() const { return RememberChoice; }
@@ -232,9 +232,7 @@ public:
     /// The set of components that this component depends on, such that
     /// the partial solutions of the those components need to be available
     /// before this component can be solved.
-    ///
-    /// FIXME: Use a TinyPtrVector here.
-    std::vector<unsigned> dependsOn;
+    SmallVector<unsigned, 2> dependsOn;
 
     Component(unsigned solutionIndex) : solutionIndex(solutionIndex) { }
 
@@ -337,7 +335,7 @@ private:
   ConstraintSystem &CS;
 
   /// The type variables in this graph, in stable order.
-  std::vector<TypeVariableType *> TypeVariables;
+  SmallVector<TypeVariableType *, 16> TypeVariables;
 
   /// Constraints that are "orphaned" because they contain no type variables.
   SmallVector<Constraint *, 4> OrphanedConstraints;
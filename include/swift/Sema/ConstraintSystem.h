@@ -45,6 +45,8 @@
 #include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/ilist.h"
 #include "llvm/Support/ErrorHandling.h"
+#include "llvm/Support/MathExtras.h"
+#include "llvm/Support/MemAlloc.h"
 #include "llvm/Support/Timer.h"
 #include "llvm/Support/raw_ostream.h"
 #include <cstddef>
@@ -219,6 +221,7 @@ public:
   unsigned getWarnLimit() const {
     return Context.TypeCheckerOpts.WarnLongExpressionTypeChecking;
   }
+  Expr *getExpr() const { return E; }
   llvm::TimeRecord startedAt() const { return StartTime; }
 
   /// Return the elapsed process time (including fractional seconds)
@@ -2010,6 +2013,114 @@ enum class SolutionApplicationToFunctionResult {
   Delay,
 };
 
+/// A bump-pointer arena that owns the memory of every \c Constraint
+/// created by a constraint system.
+///
+/// Unlike a plain \c llvm::BumpPtrAllocator, the arena's high-water mark
+/// can be snapshotted when a solver scope is entered and rolled back
+/// wholesale when that scope is abandoned, which releases all of the
+/// constraints generated while exploring the corresponding branch of the
+/// solution space without visiting them individually. Slabs released by
+/// a rollback are kept on a free list for reuse, so backtracking through
+/// a large disjunction does not churn malloc/free.
+class SolverAllocator {
+  /// The size of a standard slab. Requests larger than this get a
+  /// dedicated slab which is returned to malloc on rollback.
+  static const size_t SlabSize = 4096;
+
+  struct Slab {
+    void *Memory;
+    size_t Size;
+  };
+
+  /// The slabs currently holding live allocations, in allocation order.
+  SmallVector<Slab, 8> Slabs;
+
+  /// Standard-sized slabs released by a rollback, retained for reuse.
+  SmallVector<Slab, 8> FreeSlabs;
+
+  /// The bump pointer offset into the last element of \c Slabs.
+  size_t CurOffset = 0;
+
+  SolverAllocator(const SolverAllocator &) = delete;
+  SolverAllocator &operator=(const SolverAllocator &) = delete;
+
+public:
+  /// A snapshot of the arena's high-water mark.
+  struct Mark {
+    unsigned SlabIndex;
+    size_t Offset;
+  };
+
+  SolverAllocator() = default;
+
+  ~SolverAllocator() {
+    for (auto &slab : Slabs)
+      free(slab.Memory);
+    for (auto &slab : FreeSlabs)
+      free(slab.Memory);
+  }
+
+  void *Allocate(size_t bytes, size_t alignment) {
+    assert(alignment <= alignof(std::max_align_t) &&
+           "over-aligned constraint allocation?");
+    size_t offset = llvm::alignTo(CurOffset, alignment);
+    if (Slabs.empty() || offset + bytes > Slabs.back().Size) {
+      if (bytes > SlabSize) {
+        // Give over-sized requests their own slab; the next standard
+        // allocation starts a fresh slab.
+        void *memory = llvm::safe_malloc(bytes);
+        Slabs.push_back({memory, bytes});
+        CurOffset = bytes;
+        return memory;
+      }
+
+      if (FreeSlabs.empty()) {
+        Slabs.push_back({llvm::safe_malloc(SlabSize), SlabSize});
+      } else {
+        Slabs.push_back(FreeSlabs.pop_back_val());
+      }
+      offset = 0;
+    }
+    CurOffset = offset + bytes;
+    return static_cast<char *>(Slabs.back().Memory) + offset;
+  }
+
+  /// Snapshot the current high-water mark.
+  Mark getMark() const {
+    return {(unsigned)Slabs.size(), CurOffset};
+  }
+
+  /// Release everything allocated since the given mark was taken.
+  void rollbackToMark(const Mark &mark) {
+    while (Slabs.size() > mark.SlabIndex) {
+      Slab slab = Slabs.pop_back_val();
+      if (slab.Size == SlabSize)
+        FreeSlabs.push_back(slab);
+      else
+        free(slab.Memory);
+    }
+    CurOffset = mark.Offset;
+  }
+
+  /// Whether the given pointer lies within memory allocated since the
+  /// given mark was taken.
+  bool isAllocatedAfter(const Mark &mark, const void *ptr) const {
+    auto within = [&](const Slab &slab, size_t begin) {
+      auto base = reinterpret_cast<uintptr_t>(slab.Memory);
+      auto addr = reinterpret_cast<uintptr_t>(ptr);
+      return addr >= base + begin && addr < base + slab.Size;
+    };
+    if (mark.SlabIndex > 0 && mark.Offset < Slabs[mark.SlabIndex - 1].Size &&
+        within(Slabs[mark.SlabIndex - 1], mark.Offset))
+      return true;
+    for (unsigned i = mark.SlabIndex, n = Slabs.size(); i != n; ++i)
+      if (within(Slabs[i], 0))
+        return true;
+    return false;
+  }
+};
+
 /// Describes a system of constraints on type variables, the
 /// solution of which assigns concrete types to each of the type variables.
 /// Constraint systems are typically generated given an (untyped) expression.
@@ -2067,6 +2178,11 @@ private:
   /// Allocator used for all of the related constraint systems.
   llvm::BumpPtrAllocator Allocator;
 
+  /// Arena owning the memory of every constraint created by this system.
+  /// The solver rolls it back to the scope-entry high-water mark as
+  /// solver scopes are abandoned.
+  SolverAllocator ConstraintArena;
+
   /// Arena used for memory management of constraint-checker-related
   /// allocations.
   ConstraintCheckerArenaRAII Arena;
@@ -2700,6 +2816,25 @@ public:
     /// The scope number of this scope. Set when the scope is registered.
     unsigned scopeNumber = 0;
 
+    /// Rolls the constraint arena back to its high-water mark at scope
+    /// entry, releasing every constraint generated along this branch of
+    /// the solution space in one step.
+    class ConstraintArenaMark {
+      ConstraintSystem &cs;
+
+      /// The arena's high-water mark when this scope was entered.
+      SolverAllocator::Mark mark;
+
+    public:
+      explicit ConstraintArenaMark(ConstraintSystem &cs);
+      ~ConstraintArenaMark();
+    };
+
+    /// Declared before \c CGScope so that its destructor runs only after
+    /// the constraint graph has undone changes that may still refer to
+    /// constraints allocated within this scope.
+    ConstraintArenaMark ArenaMark;
+
     /// Constraint graph scope associated with this solver scope.
     ConstraintGraphScope CGScope;
 
@@ -3992,6 +4127,15 @@ public:
   /// Retrieve the allocator used by this constraint system.
   llvm::BumpPtrAllocator &getAllocator() { return Allocator; }
 
+  /// Retrieve the arena that owns constraint memory.
+  SolverAllocator &getConstraintArena() { return ConstraintArena; }
+
+  /// Allocate uninitialized memory for a constraint (including its
+  /// trailing objects) in the constraint arena.
+  void *allocateConstraint(size_t bytes) {
+    return ConstraintArena.Allocate(bytes, alignof(Constraint));
+  }
+
   template <typename It>
   ArrayRef<typename std::iterator_traits<It>::value_type>
   allocateCopy(It start, It end) {
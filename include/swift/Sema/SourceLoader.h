@@ -15,6 +15,8 @@
 
 #include "swift/AST/ModuleDependencies.h"
 #include "swift/AST/ModuleLoader.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/Support/MemoryBuffer.h"
 
 namespace swift {
 
@@ -27,6 +29,10 @@ private:
   ASTContext &Ctx;
   bool EnableLibraryEvolution;
 
+  /// Source files read ahead of time by \c prefetchModules, keyed by module
+  /// name and consumed by \c loadModule.
+  llvm::StringMap<std::unique_ptr<llvm::MemoryBuffer>> PrefetchedFiles;
+
   explicit SourceLoader(ASTContext &ctx,
                         bool enableResilience,
                         DependencyTracker *tracker)
@@ -72,6 +78,10 @@ public:
   loadModule(SourceLoc importLoc,
              ImportPath::Module path) override;
 
+  /// Read the source files for the named modules from disk in parallel, so
+  /// that subsequent calls to \c loadModule do not block on file I/O.
+  void prefetchModules(ArrayRef<Identifier> names) override;
+
   /// Load extensions to the given nominal type.
   ///
   /// \param nominal The nominal type whose extensions should be loaded.
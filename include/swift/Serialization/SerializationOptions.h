@@ -127,6 +127,12 @@ namespace swift {
     };
     ArrayRef<FileDependency> Dependencies;
 
+    /// The module's exported symbols, precomputed by TBDGen; each entry pairs
+    /// the raw \c llvm::MachO::SymbolKind with the mangled symbol name. When
+    /// non-empty, the list is serialized into the swiftmodule so TBD output
+    /// can later be re-emitted without visiting the module's AST.
+    ArrayRef<std::pair<uint8_t, std::string>> TBDSymbols;
+
     bool AutolinkForceLoad = false;
     bool SerializeAllSIL = false;
     bool SerializeOptionsForDebugging = false;
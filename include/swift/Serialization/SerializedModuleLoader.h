@@ -413,6 +413,13 @@ public:
 
   virtual void getDisplayDecls(SmallVectorImpl<Decl*> &results) const override;
 
+  /// Retrieves the TBD symbol table serialized when this module was built,
+  /// if any, as (raw \c llvm::MachO::SymbolKind, mangled name) pairs.
+  ///
+  /// \returns true if a symbol table was serialized into this module.
+  bool getExportedTBDSymbols(
+      SmallVectorImpl<std::pair<uint8_t, StringRef>> &symbols) const;
+
   virtual void
   getImportedModules(SmallVectorImpl<ImportedModule> &imports,
                      ModuleDecl::ImportFilter filter) const override;
@@ -35,6 +35,11 @@ struct SymbolGraphOptions {
   /// Emit members gotten through class inheritance or protocol default
   /// implementations with compound, "SYNTHESIZED" USRs.
   bool EmitSynthesizedMembers;
+
+  /// Skip emission entirely when the module's symbol graph files in
+  /// \c OutputDir are already newer than the serialized module file
+  /// they would be generated from.
+  bool SkipUpToDate;
 };
 
 } // end namespace symbolgraphgen
@@ -18,6 +18,7 @@
 #define SWIFT_SYNTAX_SYNTAXARENA_H
 
 #include "llvm/ADT/IntrusiveRefCntPtr.h"
+#include "llvm/ADT/StringRef.h"
 #include "llvm/Support/Allocator.h"
 
 namespace swift {
@@ -37,6 +38,17 @@ public:
   void *Allocate(size_t size, size_t alignment) {
     return Allocator.Allocate(size, alignment);
   }
+
+  /// Copy \p Str into the arena and return a reference to the copy. The copy
+  /// lives exactly as long as the nodes allocated here, so it is safe to
+  /// reference from an unowned \c OwnedString stored in one of those nodes.
+  llvm::StringRef copyString(llvm::StringRef Str) {
+    if (Str.empty())
+      return llvm::StringRef();
+    char *data = static_cast<char *>(Allocate(Str.size(), alignof(char)));
+    memcpy(data, Str.data(), Str.size());
+    return llvm::StringRef(data, Str.size());
+  }
 };
 
 } // namespace syntax
@@ -96,6 +96,13 @@ struct TBDGenOptions {
 
 std::vector<std::string> getPublicSymbols(TBDGenDescriptor desc);
 
+/// Collects the symbols of \p desc in the form serialized into swiftmodules:
+/// pairs of the raw \c llvm::MachO::SymbolKind and the mangled name. A module
+/// built with this list serialized can have its TBD contribution re-emitted
+/// without visiting its AST.
+std::vector<std::pair<uint8_t, std::string>>
+getTBDSymbolsForSerialization(TBDGenDescriptor desc);
+
 void writeTBDFile(ModuleDecl *M, llvm::raw_ostream &os,
                   const TBDGenOptions &opts);
 
@@ -349,6 +349,11 @@ struct ASTContext::Implementation {
   /// is populated if the body is reparsed from other source buffers.
   llvm::DenseMap<const AbstractFunctionDecl *, SourceRange> OriginalBodySourceRanges;
 
+  /// Cached results of applying a substitution map to an interface type.
+  /// Only permanent-arena types and substitution maps are recorded here.
+  llvm::DenseMap<std::pair<TypeBase *, SubstitutionMap>, Type>
+    SubstitutionApplications;
+
   /// Structure that captures data that is segregated into different
   /// arenas.
   struct Arena {
@@ -391,6 +396,14 @@ struct ASTContext::Implementation {
     llvm::DenseMap<GenericSignature, std::unique_ptr<GenericSignatureBuilder>>
       GenericSignatureBuilders;
 
+    /// Conformance access paths that correspond to explicit conformance
+    /// requirements of canonical generic signatures. These are answered
+    /// from the minimized requirements themselves, without constructing a
+    /// generic signature builder for the signature.
+    llvm::DenseMap<std::tuple<GenericSignature, CanType, ProtocolDecl *>,
+                   ConformanceAccessPath>
+      ExplicitConformanceAccessPaths;
+
     /// The set of function types.
     llvm::FoldingSet<FunctionType> FunctionTypes;
 
@@ -474,6 +487,11 @@ struct ASTContext::Implementation {
   /// The current constraint solver arena, if any.
   std::unique_ptr<ConstraintSolverArena> CurrentConstraintSolverArena;
 
+  /// The largest constraint solver arena seen so far, in bytes. Updated
+  /// whenever a solver arena is torn down, since the current arena's size
+  /// alone understates the solver's contribution to peak memory.
+  size_t ConstraintSolverMemoryHighWater = 0;
+
   Arena &getArena(AllocationArena arena) {
     switch (arena) {
     case AllocationArena::Permanent:
@@ -504,7 +522,10 @@ struct ASTContext::Implementation {
 };
 
 ASTContext::Implementation::Implementation()
-    : IdentifierTable(Allocator),
+    // Size the identifier table for a typical module up front: StringMap
+    // does not cache hashes, so every growth rehashes (and re-hashes the
+    // text of) all interned identifiers.
+    : IdentifierTable(4096, Allocator),
       TheSyntaxArena(new syntax::SyntaxArena())
 #if !SWIFT_BUILD_ONLY_SYNTAXPARSERLIB
       , IntrinsicScratchContext(new llvm::LLVMContext())
@@ -524,7 +545,10 @@ ConstraintCheckerArenaRAII(ASTContext &self, llvm::BumpPtrAllocator &allocator)
 }
 
 ConstraintCheckerArenaRAII::~ConstraintCheckerArenaRAII() {
-  Self.getImpl().CurrentConstraintSolverArena.reset(
+  auto &impl = Self.getImpl();
+  impl.ConstraintSolverMemoryHighWater = std::max(
+      impl.ConstraintSolverMemoryHighWater, Self.getSolverMemory());
+  impl.CurrentConstraintSolverArena.reset(
     (ASTContext::Implementation::ConstraintSolverArena *)Data);
 }
 
@@ -1760,6 +1784,28 @@ GenericSignatureBuilder *ASTContext::getOrCreateGenericSignatureBuilder(
   return builder;
 }
 
+Optional<ConformanceAccessPath>
+ASTContext::getExplicitConformanceAccessPath(GenericSignature sig,
+                                             CanType subjectType,
+                                             ProtocolDecl *proto) {
+  auto arena = getArena(sig);
+  auto &paths = getImpl().getArena(arena).ExplicitConformanceAccessPaths;
+  auto known = paths.find(std::make_tuple(sig, subjectType, proto));
+  if (known != paths.end())
+    return known->second;
+
+  return None;
+}
+
+void ASTContext::recordExplicitConformanceAccessPath(GenericSignature sig,
+                                                     CanType subjectType,
+                                                     ProtocolDecl *proto,
+                                                     ConformanceAccessPath path) {
+  auto arena = getArena(sig);
+  auto &paths = getImpl().getArena(arena).ExplicitConformanceAccessPaths;
+  paths.insert({std::make_tuple(sig, subjectType, proto), path});
+}
+
 Optional<llvm::TinyPtrVector<ValueDecl *>>
 OverriddenDeclsRequest::getCachedResult() const {
   auto decl = std::get<0>(getStorage());
@@ -1910,6 +1956,11 @@ bool ASTContext::canImportModule(ImportPath::Element ModuleName) {
   return false;
 }
 
+void ASTContext::prefetchModules(ArrayRef<Identifier> names) {
+  for (auto &loader : getImpl().ModuleLoaders)
+    loader->prefetchModules(names);
+}
+
 ModuleDecl *
 ASTContext::getModule(ImportPath::Module ModulePath) {
   assert(!ModulePath.empty());
@@ -2101,6 +2152,40 @@ ASTContext::getInheritedConformance(Type type, ProtocolConformance *inherited) {
   return result;
 }
 
+Type ASTContext::getCachedSubstitution(TypeBase *type,
+                                       SubstitutionMap subMap) const {
+  const auto &cache = getImpl().SubstitutionApplications;
+  auto known = cache.find({type, subMap});
+  if (known == cache.end())
+    return Type();
+  return known->second;
+}
+
+void ASTContext::cacheSubstitution(TypeBase *type, SubstitutionMap subMap,
+                                   Type result) {
+  if (subMap.empty())
+    return;
+
+  // Only cache applications whose keys and result live in the permanent
+  // arena; the constraint solver's types and substitution maps are torn
+  // down when its scope ends.
+  if (type->hasTypeVariable() || result->hasTypeVariable())
+    return;
+  auto *storage =
+      static_cast<const SubstitutionMap::Storage *>(subMap.getOpaqueValue());
+  for (auto replacement : storage->getReplacementTypes()) {
+    if (replacement && replacement->hasTypeVariable())
+      return;
+  }
+
+  // Don't pin error results; they can become well-formed once the
+  // conformances involved finish checking.
+  if (result->hasError())
+    return;
+
+  getImpl().SubstitutionApplications.insert({{type, subMap}, result});
+}
+
 LazyContextData *ASTContext::getOrCreateLazyContextData(
                                                 const DeclContext *dc,
                                                 LazyMemberLoader *lazyLoader) {
@@ -2218,15 +2303,33 @@ size_t ASTContext::getTotalMemory() const {
 
 size_t ASTContext::getSolverMemory() const {
   size_t Size = 0;
-  
+
   if (getImpl().CurrentConstraintSolverArena) {
     Size += getImpl().CurrentConstraintSolverArena->getTotalMemory();
     Size += getImpl().CurrentConstraintSolverArena->Allocator.getBytesAllocated();
   }
-  
+
   return Size;
 }
 
+ASTContext::MemoryBreakdown ASTContext::getMemoryBreakdown() const {
+  MemoryBreakdown BD;
+  BD.PermanentArena = getImpl().Allocator.getTotalMemory();
+  BD.TypeTables = getImpl().Permanent.getTotalMemory() +
+    llvm::capacity_in_bytes(getImpl().ModuleTypes) +
+    llvm::capacity_in_bytes(getImpl().GenericParamTypes) +
+    llvm::capacity_in_bytes(getImpl().SILBlockStorageTypes) +
+    llvm::capacity_in_bytes(getImpl().IntegerTypes);
+  // The identifier strings themselves are allocated from the permanent
+  // arena and accounted for there; this is only the bucket storage.
+  BD.IdentifierTable = getImpl().IdentifierTable.getNumBuckets() *
+    (sizeof(llvm::StringMapEntryBase *) + sizeof(unsigned));
+  BD.Solver = getSolverMemory();
+  BD.SolverHighWater =
+      std::max(getImpl().ConstraintSolverMemoryHighWater, BD.Solver);
+  return BD;
+}
+
 size_t ASTContext::Implementation::Arena::getTotalMemory() const {
   return sizeof(*this) +
     // TupleTypes ?
@@ -245,7 +245,9 @@ Type ASTBuilder::resolveOpaqueType(NodePointer opaqueDescriptor,
     auto definingDecl = opaqueDescriptor->getChild(0);
     auto definingGlobal = Factory.createNode(Node::Kind::Global);
     definingGlobal->addChild(definingDecl, Factory);
-    auto mangledName = mangleNode(definingGlobal);
+    // Mangle the name into the builder's factory so repeated round trips
+    // reuse one allocation arena.
+    auto mangledName = mangleNode(definingGlobal, Factory);
     
     auto moduleNode = findModuleNode(definingDecl);
     if (!moduleNode)
@@ -968,7 +970,7 @@ ASTBuilder::findDeclContext(NodePointer node) {
       if (!module) return nullptr;
 
       // Look up the local type by its mangling.
-      auto mangledName = Demangle::mangleNode(node);
+      auto mangledName = Demangle::mangleNode(node, Factory);
       auto decl = module->lookupLocalType(mangledName);
       if (!decl) return nullptr;
 
@@ -457,6 +457,9 @@ bool ConformanceLookupTable::addProtocol(ProtocolDecl *protocol, SourceLoc loc,
   ConformanceEntry *entry = new (ctx) ConformanceEntry(loc, protocol, source);
   conformanceEntries.push_back(entry);
 
+  // The new entry has not been compared against the existing ones yet.
+  ResolvedProtocols.erase(protocol);
+
   // Record this as a conformance within the given declaration
   // context.
   AllConformances[dc].push_back(entry);
@@ -676,6 +679,14 @@ ConformanceLookupTable::Ordering ConformanceLookupTable::compareConformances(
 }
 
 bool ConformanceLookupTable::resolveConformances(ProtocolDecl *protocol) {
+  // If no entry has been added for this protocol since the last resolution,
+  // the entries are already consistent with one another and nothing can be
+  // newly superseded. This keeps repeated (type, protocol) lookups from
+  // re-comparing the same entries on every query. Should resolution below
+  // recursively add an entry, it removes the protocol from the set again.
+  if (!ResolvedProtocols.insert(protocol).second)
+    return false;
+
   // Find any entries that are superseded by other entries.
   ConformanceEntries &entries = Conformances[protocol];
   llvm::SmallPtrSet<DeclContext *, 4> knownConformances;
@@ -914,8 +925,10 @@ void ConformanceLookupTable::registerProtocolConformance(
                                                        source);
   entry->Conformance = conformance;
 
-  // Record that this type conforms to the given protocol.
+  // Record that this type conforms to the given protocol. The new entry has
+  // not been compared against the existing ones yet.
   Conformances[protocol].push_back(entry);
+  ResolvedProtocols.erase(protocol);
 
   // Record this as a conformance within the given declaration
   // context.
@@ -27,6 +27,7 @@
 #include "llvm/ADT/MapVector.h"
 #include "llvm/ADT/PointerUnion.h"
 #include "llvm/ADT/SetVector.h"
+#include "llvm/ADT/SmallPtrSet.h"
 #include <unordered_map>
 
 namespace swift {
@@ -302,6 +303,12 @@ class ConformanceLookupTable {
   /// The conformance table.
   ConformanceTable Conformances;
 
+  /// The set of protocols whose conformance entries have been resolved
+  /// against one another since an entry was last added for them, allowing
+  /// \c resolveConformances() to return immediately for repeated queries
+  /// of the same protocol.
+  llvm::SmallPtrSet<ProtocolDecl *, 4> ResolvedProtocols;
+
   typedef llvm::SmallVector<ProtocolDecl *, 2> ProtocolList;
 
   /// List of all of the protocols to which a given context declares
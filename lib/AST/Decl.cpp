@@ -6754,9 +6754,10 @@ void AbstractFunctionDecl::setBodyToBeReparsed(SourceRange bodyRange) {
   assert(getBodyKind() == BodyKind::Unparsed ||
          getBodyKind() == BodyKind::Parsed ||
          getBodyKind() == BodyKind::TypeChecked);
-  assert(getASTContext().SourceMgr.rangeContainsTokenLoc(
-             bodyRange, getASTContext().SourceMgr.getCodeCompletionLoc()) &&
-         "This function is only intended to be used for code completion");
+  assert((getASTContext().SourceMgr.getCodeCompletionLoc().isInvalid() ||
+          getASTContext().SourceMgr.rangeContainsTokenLoc(
+              bodyRange, getASTContext().SourceMgr.getCodeCompletionLoc())) &&
+         "a code completion location must stay within the new body range");
 
   keepOriginalBodySourceRange();
   BodyRange = bodyRange;
@@ -256,7 +256,9 @@ void NullDiagnosticConsumer::handleDiagnostic(SourceManager &SM,
   LLVM_DEBUG({
     llvm::dbgs() << "NullDiagnosticConsumer received diagnostic: ";
     DiagnosticEngine::formatDiagnosticText(llvm::dbgs(), Info.FormatString,
-                                           Info.FormatArgs);
+                                           Info.FormatArgs,
+                                           DiagnosticFormatOptions(),
+                                           Info.FormatCache);
     llvm::dbgs() << "\n";
   });
 }
@@ -269,7 +271,9 @@ void ForwardingDiagnosticConsumer::handleDiagnostic(
   LLVM_DEBUG({
     llvm::dbgs() << "ForwardingDiagnosticConsumer received diagnostic: ";
     DiagnosticEngine::formatDiagnosticText(llvm::dbgs(), Info.FormatString,
-                                           Info.FormatArgs);
+                                           Info.FormatArgs,
+                                           DiagnosticFormatOptions(),
+                                           Info.FormatCache);
     llvm::dbgs() << "\n";
   });
   for (auto *C : TargetEngine.getConsumers()) {
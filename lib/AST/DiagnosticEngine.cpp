@@ -35,6 +35,8 @@
 #include "llvm/Support/Format.h"
 #include "llvm/Support/raw_ostream.h"
 
+#include <cstring>
+
 using namespace swift;
 
 namespace {
@@ -144,6 +146,41 @@ static constexpr auto educationalNotes = _EducationalNotes.value;
 DiagnosticState::DiagnosticState() {
   // Initialize our per-diagnostic state to default
   perDiagnosticBehavior.resize(LocalDiagID::NumDiags, Behavior::Unspecified);
+  resolvedBehavior.resize(LocalDiagID::NumDiags, Behavior::Unspecified);
+}
+
+void DiagnosticState::rebuildResolvedBehavior() {
+  for (unsigned i = 0, e = resolvedBehavior.size(); i != e; ++i) {
+    // A behavior the user provided for this specific diagnostic wins over
+    // any per-kind setting.
+    if (perDiagnosticBehavior[i] != Behavior::Unspecified) {
+      resolvedBehavior[i] = perDiagnosticBehavior[i];
+      continue;
+    }
+
+    auto diagInfo = storedDiagnosticInfos[i];
+    switch (diagInfo.kind) {
+    case DiagnosticKind::Note:
+      resolvedBehavior[i] = Behavior::Note;
+      break;
+    case DiagnosticKind::Error:
+      resolvedBehavior[i] = diagInfo.isFatal ? Behavior::Fatal
+                                             : Behavior::Error;
+      break;
+    case DiagnosticKind::Warning:
+      if (suppressWarnings)
+        resolvedBehavior[i] = Behavior::Ignore;
+      else if (warningsAsErrors)
+        resolvedBehavior[i] = Behavior::Error;
+      else
+        resolvedBehavior[i] = Behavior::Warning;
+      break;
+    case DiagnosticKind::Remark:
+      resolvedBehavior[i] = Behavior::Remark;
+      break;
+    }
+  }
+  resolvedBehaviorIsStale = false;
 }
 
 static CharSourceRange toCharSourceRange(SourceManager &SM, SourceRange SR) {
@@ -376,19 +413,21 @@ static void formatSelectionArgument(StringRef ModifierArguments,
                                     ArrayRef<DiagnosticArgument> Args,
                                     unsigned SelectedIndex,
                                     DiagnosticFormatOptions FormatOpts,
-                                    llvm::raw_ostream &Out) {
+                                    llvm::raw_ostream &Out,
+                                    DiagnosticFormatCache *Cache) {
   bool foundPipe = false;
   do {
     assert((!ModifierArguments.empty() || foundPipe) &&
            "Index beyond bounds in %select modifier");
     StringRef Text = skipToDelimiter(ModifierArguments, '|', &foundPipe);
     if (SelectedIndex == 0) {
-      DiagnosticEngine::formatDiagnosticText(Out, Text, Args, FormatOpts);
+      DiagnosticEngine::formatDiagnosticText(Out, Text, Args, FormatOpts,
+                                             Cache);
       break;
     }
     --SelectedIndex;
   } while (true);
-  
+
 }
 
 static bool isInterestingTypealias(Type type) {
@@ -448,16 +487,52 @@ static bool shouldShowAKA(Type type, StringRef typeName) {
   return true;
 }
 
+std::string DiagnosticFormatCache::getPrintedType(
+    Type type, bool fullyQualified) {
+  PrintOptions printOptions;
+  printOptions.FullyQualifiedTypes = fullyQualified;
+
+  // Types allocated in the constraint solver's arena can be recycled once
+  // the arena is torn down; their pointers must not be used as cache keys.
+  if (type->hasTypeVariable() || type->hasHole())
+    return type.getString(printOptions);
+
+  auto key = std::make_pair(type.getPointer(), fullyQualified);
+  auto known = PrintedTypes.find(key);
+  if (known == PrintedTypes.end()) {
+    std::string printed = type.getString(printOptions);
+    char *memory = static_cast<char *>(Allocator.Allocate(printed.size(), 1));
+    std::memcpy(memory, printed.data(), printed.size());
+    known = PrintedTypes
+                .insert({key, StringRef(memory, printed.size())})
+                .first;
+  }
+  return known->second.str();
+}
+
+/// Print \p type for a diagnostic, through \p Cache when one is available.
+static std::string getTypeString(Type type, bool fullyQualified,
+                                 DiagnosticFormatCache *Cache) {
+  if (Cache)
+    return Cache->getPrintedType(type, fullyQualified);
+  PrintOptions printOptions;
+  printOptions.FullyQualifiedTypes = fullyQualified;
+  return type.getString(printOptions);
+}
+
 /// If a type is part of an argument list which includes another, distinct type
 /// with the same string representation, it should be qualified during
 /// formatting.
 static bool typeSpellingIsAmbiguous(Type type,
-                                    ArrayRef<DiagnosticArgument> Args) {
+                                    ArrayRef<DiagnosticArgument> Args,
+                                    DiagnosticFormatCache *Cache) {
   for (auto arg : Args) {
     if (arg.getKind() == DiagnosticArgumentKind::Type) {
       auto argType = arg.getAsType();
       if (argType && !argType->isEqual(type) &&
-          argType->getWithoutParens().getString() == type.getString()) {
+          getTypeString(argType->getWithoutParens(), /*fullyQualified=*/false,
+                        Cache) ==
+              getTypeString(type, /*fullyQualified=*/false, Cache)) {
         return true;
       }
     }
@@ -467,19 +542,20 @@ static bool typeSpellingIsAmbiguous(Type type,
 
 /// Format a single diagnostic argument and write it to the given
 /// stream.
-static void formatDiagnosticArgument(StringRef Modifier, 
+static void formatDiagnosticArgument(StringRef Modifier,
                                      StringRef ModifierArguments,
                                      ArrayRef<DiagnosticArgument> Args,
                                      unsigned ArgIndex,
                                      DiagnosticFormatOptions FormatOpts,
-                                     llvm::raw_ostream &Out) {
+                                     llvm::raw_ostream &Out,
+                                     DiagnosticFormatCache *Cache) {
   const DiagnosticArgument &Arg = Args[ArgIndex];
   switch (Arg.getKind()) {
   case DiagnosticArgumentKind::Integer:
     if (Modifier == "select") {
       assert(Arg.getAsInteger() >= 0 && "Negative selection index");
       formatSelectionArgument(ModifierArguments, Args, Arg.getAsInteger(),
-                              FormatOpts, Out);
+                              FormatOpts, Out, Cache);
     } else if (Modifier == "s") {
       if (Arg.getAsInteger() != 1)
         Out << 's';
@@ -492,7 +568,7 @@ static void formatDiagnosticArgument(StringRef Modifier,
   case DiagnosticArgumentKind::Unsigned:
     if (Modifier == "select") {
       formatSelectionArgument(ModifierArguments, Args, Arg.getAsUnsigned(),
-                              FormatOpts, Out);
+                              FormatOpts, Out, Cache);
     } else if (Modifier == "s") {
       if (Arg.getAsUnsigned() != 1)
         Out << 's';
@@ -506,7 +582,7 @@ static void formatDiagnosticArgument(StringRef Modifier,
     if (Modifier == "select") {
       formatSelectionArgument(ModifierArguments, Args,
                               Arg.getAsString().empty() ? 0 : 1, FormatOpts,
-                              Out);
+                              Out, Cache);
     } else {
       assert(Modifier.empty() && "Improper modifier for string argument");
       Out << Arg.getAsString();
@@ -544,7 +620,7 @@ static void formatDiagnosticArgument(StringRef Modifier,
       type = type->getWithoutSyntaxSugar();
     }
 
-    bool isAmbiguous = typeSpellingIsAmbiguous(type, Args);
+    bool isAmbiguous = typeSpellingIsAmbiguous(type, Args, Cache);
 
     if (isAmbiguous && isa<OpaqueTypeArchetypeType>(type.getPointer())) {
       auto opaqueTypeDecl = type->castTo<OpaqueTypeArchetypeType>()->getDecl();
@@ -567,9 +643,7 @@ static void formatDiagnosticArgument(StringRef Modifier,
                           NamingDeclText.c_str());
 
     } else {
-      auto printOptions = PrintOptions();
-      printOptions.FullyQualifiedTypes = isAmbiguous;
-      std::string typeName = type->getString(printOptions);
+      std::string typeName = getTypeString(type, isAmbiguous, Cache);
 
       if (shouldShowAKA(type, typeName)) {
         llvm::SmallString<256> AkaText;
@@ -601,7 +675,7 @@ static void formatDiagnosticArgument(StringRef Modifier,
     if (Modifier == "select") {
       formatSelectionArgument(ModifierArguments, Args,
                               unsigned(Arg.getAsSelfAccessKind()),
-                              FormatOpts, Out);
+                              FormatOpts, Out, Cache);
     } else {
       assert(Modifier.empty() &&
              "Improper modifier for SelfAccessKind argument");
@@ -613,7 +687,7 @@ static void formatDiagnosticArgument(StringRef Modifier,
     if (Modifier == "select") {
       formatSelectionArgument(ModifierArguments, Args,
                               unsigned(Arg.getAsReferenceOwnership()),
-                              FormatOpts, Out);
+                              FormatOpts, Out, Cache);
     } else {
       assert(Modifier.empty() &&
              "Improper modifier for ReferenceOwnership argument");
@@ -625,7 +699,7 @@ static void formatDiagnosticArgument(StringRef Modifier,
     if (Modifier == "select") {
       formatSelectionArgument(ModifierArguments, Args,
                               unsigned(Arg.getAsStaticSpellingKind()),
-                              FormatOpts, Out);
+                              FormatOpts, Out, Cache);
     } else {
       assert(Modifier.empty() &&
              "Improper modifier for StaticSpellingKind argument");
@@ -667,7 +741,7 @@ static void formatDiagnosticArgument(StringRef Modifier,
 /// buffer.
 void DiagnosticEngine::formatDiagnosticText(
     llvm::raw_ostream &Out, StringRef InText, ArrayRef<DiagnosticArgument> Args,
-    DiagnosticFormatOptions FormatOpts) {
+    DiagnosticFormatOptions FormatOpts, DiagnosticFormatCache *Cache) {
   while (!InText.empty()) {
     size_t Percent = InText.find('%');
     if (Percent == StringRef::npos) {
@@ -727,7 +801,7 @@ void DiagnosticEngine::formatDiagnosticText(
 
     // Convert the argument to a string.
     formatDiagnosticArgument(Modifier, ModifierArguments, Args, ArgIndex,
-                             FormatOpts, Out);
+                             FormatOpts, Out, Cache);
   }
 }
 
@@ -778,14 +852,12 @@ DiagnosticState::Behavior DiagnosticState::determineBehavior(DiagID id) {
 
   // We determine how to handle a diagnostic based on the following rules
   //   1) If current state dictates a certain behavior, follow that
-  //   2) If the user provided a behavior for this specific diagnostic, follow
-  //      that
-  //   3) If the user provided a behavior for this diagnostic's kind, follow
-  //      that
-  //   4) Otherwise remap the diagnostic kind
+  //   2) Otherwise use the behavior the diagnostic resolves to from the
+  //      per-diagnostic and per-kind settings, which is precomputed in
+  //      \c resolvedBehavior whenever those settings change.
 
-  auto diagInfo = storedDiagnosticInfos[(unsigned)id];
-  bool isNote = diagInfo.kind == DiagnosticKind::Note;
+  bool isNote =
+      storedDiagnosticInfos[(unsigned)id].kind == DiagnosticKind::Note;
 
   //   1) If current state dictates a certain behavior, follow that
 
@@ -798,34 +870,10 @@ DiagnosticState::Behavior DiagnosticState::determineBehavior(DiagID id) {
     if (!showDiagnosticsAfterFatalError && !isNote)
       return set(Behavior::Ignore);
 
-  //   2) If the user provided a behavior for this specific diagnostic, follow
-  //      that
-
-  if (perDiagnosticBehavior[(unsigned)id] != Behavior::Unspecified)
-    return set(perDiagnosticBehavior[(unsigned)id]);
-
-  //   3) If the user provided a behavior for this diagnostic's kind, follow
-  //      that
-  if (diagInfo.kind == DiagnosticKind::Warning) {
-    if (suppressWarnings)
-      return set(Behavior::Ignore);
-    if (warningsAsErrors)
-      return set(Behavior::Error);
-  }
-
-  //   4) Otherwise remap the diagnostic kind
-  switch (diagInfo.kind) {
-  case DiagnosticKind::Note:
-    return set(Behavior::Note);
-  case DiagnosticKind::Error:
-    return set(diagInfo.isFatal ? Behavior::Fatal : Behavior::Error);
-  case DiagnosticKind::Warning:
-    return set(Behavior::Warning);
-  case DiagnosticKind::Remark:
-    return set(Behavior::Remark);
-  }
-
-  llvm_unreachable("Unhandled DiagnosticKind in switch.");
+  //   2) Use the precomputed behavior for this diagnostic.
+  if (resolvedBehaviorIsStale)
+    rebuildResolvedBehavior();
+  return set(resolvedBehavior[(unsigned)id]);
 }
 
 void DiagnosticEngine::flushActiveDiagnostic() {
@@ -1002,14 +1050,31 @@ DiagnosticEngine::diagnosticInfoForDiagnostic(const Diagnostic &diagnostic) {
     }
   }
 
-  return DiagnosticInfo(
+  DiagnosticInfo info(
       diagnostic.getID(), loc, toDiagnosticKind(behavior),
       diagnosticStringFor(diagnostic.getID(), getPrintDiagnosticNames()),
       diagnostic.getArgs(), getDefaultDiagnosticLoc(), /*child note info*/ {},
       diagnostic.getRanges(), diagnostic.getFixIts(), diagnostic.isChildNote());
+  // Hand the consumers the engine's printed-type memoization so repeated
+  // type arguments are only rendered once per compilation.
+  info.FormatCache = &FormatCache;
+  return info;
 }
 
 void DiagnosticEngine::emitDiagnostic(const Diagnostic &diagnostic) {
+  // Message rendering is deferred to the consumers: DiagnosticInfo carries
+  // the format string and unformatted arguments. With no consumer attached
+  // there is no reason to build DiagnosticInfo at all -- in particular not
+  // to run the pretty-printed declaration fallback below, which invokes the
+  // ASTPrinter. The diagnostic state still has to observe the diagnostic so
+  // that error counting and behavior escalation work as usual.
+  if (Consumers.empty()) {
+    state.determineBehavior(diagnostic.getID());
+    for (auto &childNote : diagnostic.getChildNotes())
+      state.determineBehavior(childNote.getID());
+    return;
+  }
+
   if (auto info = diagnosticInfoForDiagnostic(diagnostic)) {
     SmallVector<DiagnosticInfo, 1> childInfo;
     TinyPtrVector<DiagnosticInfo *> childInfoPtrs;
@@ -149,6 +149,18 @@ Type GenericEnvironment::mapTypeIntoContext(
   assert(!type->hasOpenedExistential() &&
          "Opened existentials are special and so are you");
 
+  // Types without type parameters map to themselves; don't spin up the
+  // substitution machinery for them.
+  if (!type->hasTypeParameter())
+    return type;
+
+  // A bare generic parameter needs no substitution traversal at all; answer
+  // it directly from the context type array.
+  if (auto *gp = type->getAs<GenericTypeParamType>()) {
+    if (Type contextType = QueryInterfaceTypeSubstitutions(this)(gp))
+      return contextType;
+  }
+
   Type result = type.subst(QueryInterfaceTypeSubstitutions(this),
                            lookupConformance,
                            SubstFlags::AllowLoweredTypes);
@@ -718,7 +718,19 @@ CanType GenericSignatureImpl::getCanonicalTypeInContext(Type type) const {
     return CanType(type);
 
   auto &builder = *getGenericSignatureBuilder();
-  return getCanonicalTypeInContext(type, builder);
+
+  // Resolving the same dependent components through the builder over and
+  // over gets expensive for deeply nested generic types, so memoize complete
+  // results on the signature's builder. The key is already canonical, so
+  // every sugared spelling of the type shares one entry.
+  auto &cache = builder.getCanonicalTypeInContextCache();
+  auto known = cache.find(type.getPointer());
+  if (known != cache.end())
+    return known->second;
+
+  auto result = getCanonicalTypeInContext(type, builder);
+  cache.insert({type.getPointer(), result});
+  return result;
 }
 
 ArrayRef<CanTypeWrapper<GenericTypeParamType>>
@@ -978,6 +990,29 @@ GenericSignatureImpl::getConformanceAccessPath(Type type,
                                                ProtocolDecl *protocol) const {
   assert(type->isTypeParameter() && "not a type parameter");
 
+  // An explicit conformance requirement of a canonical signature is its own
+  // one-element access path. Answer such queries from the minimized
+  // requirements themselves so that they never force the construction of a
+  // generic signature builder; for signatures deserialized from another
+  // module this avoids re-deriving a requirement closure that was already
+  // solved when that module was built.
+  if (isCanonical()) {
+    CanType canType = type->getCanonicalType();
+    if (hasConformanceInSignature(getRequirements(), canType, protocol)) {
+      auto &ctx = getASTContext();
+      GenericSignature sig(this);
+      if (auto path =
+              ctx.getExplicitConformanceAccessPath(sig, canType, protocol))
+        return *path;
+
+      ConformanceAccessPath::Entry root(canType, protocol);
+      ConformanceAccessPath result(
+          ctx.AllocateCopy(llvm::makeArrayRef(root)));
+      ctx.recordExplicitConformanceAccessPath(sig, canType, protocol, result);
+      return result;
+    }
+  }
+
   // Resolve this type to a potential archetype.
   auto &builder = *getGenericSignatureBuilder();
   auto equivClass =
@@ -479,6 +479,10 @@ struct GenericSignatureBuilder::Implementation {
   bool finalized = false;
 #endif
 
+  /// Memoized results of GenericSignatureImpl::getCanonicalTypeInContext
+  /// for the signature this builder was created for.
+  llvm::DenseMap<TypeBase *, CanType> CanonicalTypeInContextCache;
+
   /// Tear down an implementation.
   ~Implementation();
 
@@ -513,6 +517,11 @@ private:
 };
 
 #pragma mark Memory management
+llvm::DenseMap<TypeBase *, CanType> &
+GenericSignatureBuilder::getCanonicalTypeInContextCache() {
+  return Impl->CanonicalTypeInContextCache;
+}
+
 GenericSignatureBuilder::Implementation::~Implementation() {
   for (auto pa : PotentialArchetypes)
     pa->~PotentialArchetype();
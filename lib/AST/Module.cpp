@@ -149,6 +149,12 @@ class swift::SourceLookupCache {
       Members.shrink_and_clear();
     }
 
+    /// Pre-size the map for an expected number of entries, so that bulk
+    /// population doesn't rehash repeatedly.
+    void reserve(unsigned expectedSize) {
+      Members.reserve(expectedSize);
+    }
+
     decltype(Members)::const_iterator begin() const { return Members.begin(); }
     decltype(Members)::const_iterator end() const { return Members.end(); }
     decltype(Members)::const_iterator find(DeclName Name) const {
@@ -309,6 +315,8 @@ void SourceLookupCache::addToMemberCache(Range decls) {
 SourceLookupCache::SourceLookupCache(const SourceFile &SF) {
   FrontendStatsTracer tracer(SF.getASTContext().Stats,
                              "source-file-populate-cache");
+  // Most top-level decls contribute at least one entry.
+  TopLevelValues.reserve(SF.getTopLevelDecls().size());
   addToUnqualifiedLookupCache(SF.getTopLevelDecls(), false);
   addToUnqualifiedLookupCache(SF.getHoistedDecls(), false);
 }
@@ -316,6 +324,12 @@ SourceLookupCache::SourceLookupCache(const SourceFile &SF) {
 SourceLookupCache::SourceLookupCache(const ModuleDecl &M) {
   FrontendStatsTracer tracer(M.getASTContext().Stats,
                              "module-populate-cache");
+  unsigned numTopLevelDecls = 0;
+  for (const FileUnit *file : M.getFiles()) {
+    if (auto *SF = dyn_cast<SourceFile>(file))
+      numTopLevelDecls += SF->getTopLevelDecls().size();
+  }
+  TopLevelValues.reserve(numTopLevelDecls);
   for (const FileUnit *file : M.getFiles()) {
     if (auto *SFU = dyn_cast<SynthesizedFileUnit>(file)) {
       addToUnqualifiedLookupCache(SFU->getTopLevelDecls(), false);
@@ -984,10 +984,16 @@ class swift::MemberLookupTable {
   /// Lookup table mapping names to the set of declarations with that name.
   LookupTable Lookup;
 
-  /// The set of names of lazily-loaded members that the lookup table has a
-  /// complete accounting of with respect to all known extensions of its
-  /// parent nominal type.
-  llvm::DenseSet<DeclBaseName> LazilyCompleteNames;
+  /// The names of lazily-loaded members that the lookup table has a complete
+  /// accounting of, together with the number of entries in \c LazyExtensions
+  /// at the time the accounting was made. A name whose recorded count is
+  /// smaller than the current size of \c LazyExtensions only needs to consult
+  /// the extensions registered after it was completed.
+  llvm::DenseMap<DeclBaseName, unsigned> LazilyCompleteNames;
+
+  /// The extensions with lazily-loaded members that were registered after the
+  /// lookup table was created, in registration order.
+  llvm::SmallVector<ExtensionDecl *, 2> LazyExtensions;
 
 public:
   /// Create a new member lookup table.
@@ -1005,19 +1011,36 @@ public:
   /// Returns \c true if the lookup table has a complete accounting of the
   /// given name.
   bool isLazilyComplete(DeclBaseName name) const {
-    return LazilyCompleteNames.find(name) != LazilyCompleteNames.end();
+    auto known = LazilyCompleteNames.find(name);
+    return known != LazilyCompleteNames.end() &&
+           known->second == LazyExtensions.size();
   }
 
-  /// Mark a given lazily-loaded name as being complete.
+  /// Mark a given lazily-loaded name as being complete with respect to all
+  /// extensions registered so far.
   void markLazilyComplete(DeclBaseName name) {
-    LazilyCompleteNames.insert(name);
+    LazilyCompleteNames[name] = LazyExtensions.size();
+  }
+
+  /// Register a newly-added extension whose members are loaded lazily.
+  ///
+  /// This does not invalidate names that already have a complete accounting;
+  /// instead, such names consult just the newly-registered extensions the
+  /// next time they are looked up.
+  void addedLazyExtension(ExtensionDecl *ext) {
+    LazyExtensions.push_back(ext);
   }
 
-  /// Clears the cache of lazily-complete names.  This _must_ be called when
-  /// new extensions with lazy members are added to the type, or direct lookup
-  /// will return inconsistent or stale results.
-  void clearLazilyCompleteCache() {
-    LazilyCompleteNames.clear();
+  /// Retrieve the extensions with lazily-loaded members that have been
+  /// registered since the given name was last marked complete, or \c None if
+  /// the name has never had a complete accounting and the nominal type and
+  /// all of its extensions must be consulted.
+  Optional<ArrayRef<ExtensionDecl *>>
+  getExtensionsPendingForName(DeclBaseName name) const {
+    auto known = LazilyCompleteNames.find(name);
+    if (known == LazilyCompleteNames.end())
+      return None;
+    return llvm::makeArrayRef(LazyExtensions).slice(known->second);
   }
 
   /// Iterator into the lookup table.
@@ -1164,7 +1187,7 @@ void NominalTypeDecl::addedExtension(ExtensionDecl *ext) {
 
   if (ext->hasLazyMembers()) {
     LookupTable->addMembers(ext->getCurrentMembersWithoutLoading());
-    LookupTable->clearLazilyCompleteCache();
+    LookupTable->addedLazyExtension(ext);
   } else {
     LookupTable->addMembers(ext->getMembers());
   }
@@ -1396,10 +1419,35 @@ DirectLookupRequest::evaluate(Evaluator &evaluator,
     // was registered since the last time we searched. Ask the loaders to give
     // us a hand.
     DeclBaseName baseName(name.getBaseName());
-    populateLookupTableEntryFromLazyIDCLoader(ctx, Table, baseName, decl);
+    auto pendingExtensions = Table.getExtensionsPendingForName(baseName);
+    if (!pendingExtensions) {
+      // We have never seen this name before; consult the nominal type itself
+      // and every extension with lazy members.
+      populateLookupTableEntryFromLazyIDCLoader(ctx, Table, baseName, decl);
+
+      if (!disableAdditionalExtensionLoading) {
+        populateLookupTableEntryFromExtensions(ctx, Table, baseName, decl);
+      }
+    } else if (!disableAdditionalExtensionLoading) {
+      // The accounting of this name is complete except for the extensions
+      // registered since it was made; only those need to be consulted.
+      // Deserializing their members can register yet more extensions, so
+      // keep going until none remain. Note that the pending list has to be
+      // copied before loading anything from it for the same reason.
+      while (!pendingExtensions->empty()) {
+        SmallVector<ExtensionDecl *, 2> pending(pendingExtensions->begin(),
+                                                pendingExtensions->end());
+        Table.markLazilyComplete(baseName);
+
+        for (auto e : pending) {
+          if (!e->hasLazyMembers())
+            continue;
 
-    if (!disableAdditionalExtensionLoading) {
-      populateLookupTableEntryFromExtensions(ctx, Table, baseName, decl);
+          populateLookupTableEntryFromLazyIDCLoader(ctx, Table, baseName, e);
+        }
+
+        pendingExtensions = Table.getExtensionsPendingForName(baseName);
+      }
     }
 
     // FIXME: If disableAdditionalExtensionLoading is true, we should
@@ -3867,6 +3867,26 @@ static Type substType(Type derivedType,
 
 Type Type::subst(SubstitutionMap substitutions,
                  SubstOptions options) const {
+  // Substitution maps are uniqued in the ASTContext, so identical
+  // applications recur constantly during conformance checking. Reuse cached
+  // results when the substitution has no options or callbacks that could
+  // change the outcome.
+  const bool isCacheable = !substitutions.empty() &&
+      options.toRaw() == 0 && !options.getTentativeTypeWitness;
+  if (isCacheable) {
+    auto &ctx = getPointer()->getASTContext();
+    if (Type cached = ctx.getCachedSubstitution(getPointer(), substitutions))
+      return cached;
+
+    Type result = substType(*this,
+                            QuerySubstitutionMap{substitutions},
+                            LookUpConformanceInSubstitutionMap(substitutions),
+                            options);
+    if (result)
+      ctx.cacheSubstitution(getPointer(), substitutions, result);
+    return result;
+  }
+
   return substType(*this,
                    QuerySubstitutionMap{substitutions},
                    LookUpConformanceInSubstitutionMap(substitutions),
@@ -286,6 +286,24 @@ bool ide::printValueDeclUSR(const ValueDecl *D, raw_ostream &OS) {
   return false;
 }
 
+std::string
+swift::AccessorUSRGenerationRequest::evaluate(Evaluator &evaluator,
+                                              const AbstractStorageDecl *D,
+                                              AccessorKind AccKind) const {
+  AbstractStorageDecl *SD = const_cast<AbstractStorageDecl*>(D);
+  if (shouldUseObjCUSR(SD)) {
+    llvm::SmallString<128> Buffer;
+    llvm::raw_svector_ostream OS(Buffer);
+    if (printObjCUSRForAccessor(SD, AccKind, OS))
+      return std::string();
+    return std::string(OS.str());
+  }
+
+  Mangle::ASTMangler NewMangler;
+  return NewMangler.mangleAccessorEntityAsUSR(AccKind, SD, getUSRSpacePrefix(),
+                                              SD->isStatic());
+}
+
 bool ide::printAccessorUSR(const AbstractStorageDecl *D, AccessorKind AccKind,
                            llvm::raw_ostream &OS) {
   // AccKind should always be either IsGetter or IsSetter here, based
@@ -300,17 +318,12 @@ bool ide::printAccessorUSR(const AbstractStorageDecl *D, AccessorKind AccKind,
   // addressed variable should have its "getter" point at the
   // addressor.
 
-  AbstractStorageDecl *SD = const_cast<AbstractStorageDecl*>(D);
-  if (shouldUseObjCUSR(SD)) {
-    return printObjCUSRForAccessor(SD, AccKind, OS);
-  }
-
-  Mangle::ASTMangler NewMangler;
-  std::string Mangled = NewMangler.mangleAccessorEntityAsUSR(AccKind,
-                          SD, getUSRSpacePrefix(), SD->isStatic());
-
-  OS << Mangled;
-
+  auto result = evaluateOrDefault(D->getASTContext().evaluator,
+                                  AccessorUSRGenerationRequest { D, AccKind },
+                                  std::string());
+  if (result.empty())
+    return true;
+  OS << result;
   return false;
 }
 
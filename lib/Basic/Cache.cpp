@@ -14,12 +14,18 @@
 #include "Darwin/Cache-Mac.cpp"
 #else
 
-//  This file implements a default caching implementation that never evicts
-//  its entries.
+//  This file implements a default caching implementation that evicts
+//  least-recently-used entries when the total cost of the cached values
+//  exceeds a budget. Unlike the Darwin implementation it cannot react to
+//  memory pressure, so the budget is the only thing keeping long-lived
+//  processes (e.g. sourcekitd sessions) from growing without bound.
 
 #include "swift/Basic/Cache.h"
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/StringRef.h"
 #include "llvm/Support/Mutex.h"
+#include <cstdlib>
+#include <list>
 
 using namespace swift::sys;
 using llvm::StringRef;
@@ -33,12 +39,38 @@ struct DefaultCacheKey {
   DefaultCacheKey(void *Key, CacheImpl::CallBacks *CBs) : Key(Key), CBs(CBs) {}
 };
 
+struct DefaultCacheEntry {
+  void *Value = nullptr;
+  size_t Cost = 0;
+  /// Position in the cache's LRU list; most recently used entries are at
+  /// the front.
+  std::list<DefaultCacheKey>::iterator LRUPos;
+};
+
+/// The maximum total cost of entries kept in a cache before the least
+/// recently used ones are evicted. Zero disables eviction entirely.
+static size_t getCostLimit() {
+  if (const char *envValue = ::getenv("SWIFT_GENERIC_CACHE_COST_LIMIT")) {
+    size_t limit;
+    if (!StringRef(envValue).getAsInteger(10, limit))
+      return limit;
+  }
+  // Most caches report a zero or sizeof-sized cost and are unaffected by
+  // this; the budget exists for caches of whole ASTs, whose cost is their
+  // reported memory usage in bytes.
+  return 1024 * 1024 * 1024;
+}
+
 struct DefaultCache {
   llvm::sys::Mutex Mux;
   CacheImpl::CallBacks CBs;
-  llvm::DenseMap<DefaultCacheKey, void *> Entries;
+  size_t TotalCost = 0;
+  size_t CostLimit;
+  std::list<DefaultCacheKey> LRU;
+  llvm::DenseMap<DefaultCacheKey, DefaultCacheEntry> Entries;
 
-  explicit DefaultCache(CacheImpl::CallBacks CBs) : CBs(std::move(CBs)) { }
+  explicit DefaultCache(CacheImpl::CallBacks CBs)
+      : CBs(std::move(CBs)), CostLimit(getCostLimit()) {}
 };
 } // end anonymous namespace
 
@@ -71,6 +103,24 @@ CacheImpl::ImplTy CacheImpl::create(StringRef Name, const CallBacks &CBs) {
   return new DefaultCache(CBs);
 }
 
+/// Evicts least-recently-used entries until the cache fits its cost budget
+/// again. The most recent entry is never evicted, so an oversized value can
+/// still be stored and retrieved once. Called with the cache lock held.
+static void evictIfOverBudget(DefaultCache &DCache) {
+  while (DCache.CostLimit != 0 && DCache.TotalCost > DCache.CostLimit &&
+         DCache.Entries.size() > 1) {
+    auto Entry = DCache.Entries.find(DCache.LRU.back());
+    assert(Entry != DCache.Entries.end() && "LRU list out of sync with map");
+    void *EvictedKey = Entry->first.Key;
+    void *EvictedValue = Entry->second.Value;
+    DCache.TotalCost -= Entry->second.Cost;
+    DCache.LRU.pop_back();
+    DCache.Entries.erase(Entry);
+    DCache.CBs.keyDestroyCB(EvictedKey, nullptr);
+    DCache.CBs.valueReleaseCB(EvictedValue, nullptr);
+  }
+}
+
 void CacheImpl::setAndRetain(void *Key, void *Value, size_t Cost) {
   DefaultCache &DCache = *static_cast<DefaultCache*>(Impl);
   llvm::sys::ScopedLock L(DCache.Mux);
@@ -81,7 +131,10 @@ void CacheImpl::setAndRetain(void *Key, void *Value, size_t Cost) {
   // If there is no existing entry, retain the value and insert the entry.
   if (Entry == DCache.Entries.end()) {
     DCache.CBs.valueRetainCB(Value, nullptr);
-    DCache.Entries[CKey] = Value;
+    DCache.LRU.push_front(CKey);
+    DCache.Entries[CKey] = DefaultCacheEntry{Value, Cost, DCache.LRU.begin()};
+    DCache.TotalCost += Cost;
+    evictIfOverBudget(DCache);
     return;
   }
 
@@ -90,12 +143,21 @@ void CacheImpl::setAndRetain(void *Key, void *Value, size_t Cost) {
   std::swap(Entry->first.Key, Key);
   DCache.CBs.keyDestroyCB(Key, nullptr);
 
+  // The LRU list holds a copy of the key; keep it pointing at the live one
+  // and move the entry to the front, since it was just (re-)stored.
+  *Entry->second.LRUPos = Entry->first;
+  DCache.LRU.splice(DCache.LRU.begin(), DCache.LRU, Entry->second.LRUPos);
+
   // Replace the value, if necessary.
-  if (Entry->second != Value) {
+  if (Entry->second.Value != Value) {
     DCache.CBs.valueRetainCB(Value, nullptr);
-    std::swap(Entry->second, Value);
+    std::swap(Entry->second.Value, Value);
     DCache.CBs.valueReleaseCB(Value, nullptr);
   }
+  DCache.TotalCost += Cost;
+  DCache.TotalCost -= Entry->second.Cost;
+  Entry->second.Cost = Cost;
+  evictIfOverBudget(DCache);
 
   // FIXME: Not thread-safe! It should avoid deleting the value until
   // 'releaseValue is called on it.
@@ -108,9 +170,10 @@ bool CacheImpl::getAndRetain(const void *Key, void **Value_out) {
   DefaultCacheKey CKey(const_cast<void*>(Key), &DCache.CBs);
   auto Entry = DCache.Entries.find(CKey);
   if (Entry != DCache.Entries.end()) {
+    DCache.LRU.splice(DCache.LRU.begin(), DCache.LRU, Entry->second.LRUPos);
     // FIXME: Not thread-safe! It should avoid deleting the value until
     // 'releaseValue is called on it.
-    *Value_out = Entry->second;
+    *Value_out = Entry->second.Value;
     return true;
   }
   return false;
@@ -127,8 +190,10 @@ bool CacheImpl::remove(const void *Key) {
   DefaultCacheKey CKey(const_cast<void*>(Key), &DCache.CBs);
   auto Entry = DCache.Entries.find(CKey);
   if (Entry != DCache.Entries.end()) {
+    DCache.TotalCost -= Entry->second.Cost;
+    DCache.LRU.erase(Entry->second.LRUPos);
     DCache.CBs.keyDestroyCB(Entry->first.Key, nullptr);
-    DCache.CBs.valueReleaseCB(Entry->second, nullptr);
+    DCache.CBs.valueReleaseCB(Entry->second.Value, nullptr);
     DCache.Entries.erase(Entry);
     return true;
   }
@@ -139,11 +204,13 @@ void CacheImpl::removeAll() {
   DefaultCache &DCache = *static_cast<DefaultCache*>(Impl);
   llvm::sys::ScopedLock L(DCache.Mux);
 
-  for (auto Entry : DCache.Entries) {
+  for (auto &Entry : DCache.Entries) {
     DCache.CBs.keyDestroyCB(Entry.first.Key, nullptr);
-    DCache.CBs.valueReleaseCB(Entry.second, nullptr);
+    DCache.CBs.valueReleaseCB(Entry.second.Value, nullptr);
   }
   DCache.Entries.clear();
+  DCache.LRU.clear();
+  DCache.TotalCost = 0;
 }
 
 void CacheImpl::destroy() {
@@ -20,6 +20,11 @@
 
 using namespace swift;
 
+const llvm::APInt &ClusteredBitVector::getEmptyAPInt() {
+  static const llvm::APInt empty;
+  return empty;
+}
+
 void ClusteredBitVector::dump() const {
   print(llvm::errs());
 }
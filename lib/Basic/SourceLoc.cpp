@@ -15,6 +15,7 @@
 #include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/PrettyStackTrace.h"
 #include "llvm/Support/raw_ostream.h"
+#include <algorithm>
 
 using namespace swift;
 
@@ -69,6 +70,9 @@ SourceManager::addNewSourceBuffer(std::unique_ptr<llvm::MemoryBuffer> Buffer) {
   StringRef BufIdentifier = Buffer->getBufferIdentifier();
   auto ID = LLVMSourceMgr.AddNewSourceBuffer(std::move(Buffer), llvm::SMLoc());
   BufIdentIDMap[BufIdentifier] = ID;
+  // A new buffer can shadow parts of existing buffers (alias buffers), so the
+  // cached search result may no longer be the right answer.
+  BufferLocCache = BufferLocCacheType();
   return ID;
 }
 
@@ -215,16 +219,49 @@ StringRef SourceManager::extractText(CharSourceRange Range,
 Optional<unsigned>
 SourceManager::findBufferContainingLocInternal(SourceLoc Loc) const {
   assert(Loc.isValid());
+  auto less_equal = std::less_equal<const char *>();
+  const char *ptr = Loc.Value.getPointer();
+
+  // Check the interval the last search resolved before scanning all buffers.
+  if (BufferLocCache.BufferID && less_equal(BufferLocCache.Start, ptr) &&
+      less_equal(ptr, BufferLocCache.End))
+    return BufferLocCache.BufferID;
+
   // Search the buffers back-to front, so later alias buffers are
   // visited first.
-  auto less_equal = std::less_equal<const char *>();
+  //
+  // While searching, narrow [lo, hi] to the largest interval around the
+  // location which is not overlapped by any later buffer. The search returns
+  // the same buffer for every location in that interval, so it can be cached
+  // for the next query.
+  const char *lo = nullptr;
+  const char *hi = nullptr;
   for (unsigned i = LLVMSourceMgr.getNumBuffers(), e = 1; i >= e; --i) {
     auto Buf = LLVMSourceMgr.getMemoryBuffer(i);
-    if (less_equal(Buf->getBufferStart(), Loc.Value.getPointer()) &&
+    if (less_equal(Buf->getBufferStart(), ptr) &&
         // Use <= here so that a pointer to the null at the end of the buffer
         // is included as part of the buffer.
-        less_equal(Loc.Value.getPointer(), Buf->getBufferEnd()))
+        less_equal(ptr, Buf->getBufferEnd())) {
+      if (!lo || less_equal(lo, Buf->getBufferStart()))
+        lo = Buf->getBufferStart();
+      if (!hi || less_equal(Buf->getBufferEnd(), hi))
+        hi = Buf->getBufferEnd();
+      BufferLocCache.Start = lo;
+      BufferLocCache.End = hi;
+      BufferLocCache.BufferID = i;
       return i;
+    }
+    // The buffer lies entirely below or above the location; the cacheable
+    // interval must not extend into it.
+    if (less_equal(Buf->getBufferEnd(), ptr)) {
+      const char *cand = Buf->getBufferEnd() + 1;
+      if (!lo || less_equal(lo, cand))
+        lo = cand;
+    } else {
+      const char *cand = Buf->getBufferStart() - 1;
+      if (!hi || less_equal(cand, hi))
+        hi = cand;
+    }
   }
   return None;
 }
@@ -236,6 +273,37 @@ unsigned SourceManager::findBufferContainingLoc(SourceLoc Loc) const {
   llvm_unreachable("no buffer containing location found");
 }
 
+ArrayRef<unsigned> SourceManager::getLineStartOffsets(unsigned BufferID) const {
+  auto known = LineStartOffsets.find(BufferID);
+  if (known == LineStartOffsets.end()) {
+    StringRef buffer = LLVMSourceMgr.getMemoryBuffer(BufferID)->getBuffer();
+    std::vector<unsigned> offsets;
+    offsets.push_back(0);
+    for (size_t i = 0, e = buffer.size(); i != e; ++i) {
+      if (buffer[i] == '\n')
+        offsets.push_back(i + 1);
+    }
+    known = LineStartOffsets.insert({BufferID, std::move(offsets)}).first;
+  }
+  return known->second;
+}
+
+std::pair<unsigned, unsigned>
+SourceManager::getLineAndColumnInBuffer(SourceLoc Loc,
+                                        unsigned BufferID) const {
+  assert(Loc.isValid());
+  if (!BufferID)
+    BufferID = findBufferContainingLoc(Loc);
+  unsigned Offset = getLocOffsetInBuffer(Loc, BufferID);
+  auto LineStarts = getLineStartOffsets(BufferID);
+  // The index of the last line start not past the location is the (1-based)
+  // line number; the line always exists since offset 0 is a line start.
+  unsigned Line =
+      std::upper_bound(LineStarts.begin(), LineStarts.end(), Offset) -
+      LineStarts.begin();
+  return { Line, Offset - LineStarts[Line - 1] + 1 };
+}
+
 bool SourceManager::isOwning(SourceLoc Loc) const {
   return findBufferContainingLocInternal(Loc).hasValue();
 }
@@ -347,21 +415,13 @@ llvm::Optional<unsigned> SourceManager::resolveFromLineCol(unsigned BufferId,
     return None;
   }
   const bool LineEnd = Col == ~0u;
-  auto InputBuf = getLLVMSourceMgr().getMemoryBuffer(BufferId);
-  const char *Ptr = InputBuf->getBufferStart();
-  const char *End = InputBuf->getBufferEnd();
-  const char *LineStart = Ptr;
-  --Line;
-  for (; Line && (Ptr < End); ++Ptr) {
-    if (*Ptr == '\n') {
-      --Line;
-      LineStart = Ptr+1;
-    }
-  }
-  if (Line != 0) {
+  auto LineStarts = getLineStartOffsets(BufferId);
+  if (Line > LineStarts.size()) {
     return None;
   }
-  Ptr = LineStart;
+  auto InputBuf = getLLVMSourceMgr().getMemoryBuffer(BufferId);
+  const char *End = InputBuf->getBufferEnd();
+  const char *Ptr = InputBuf->getBufferStart() + LineStarts[Line - 1];
   if (Col == 0)   {
       return Ptr - InputBuf->getBufferStart();
   }
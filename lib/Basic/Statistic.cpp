@@ -18,6 +18,7 @@
 #include "swift/AST/Expr.h"
 #include "llvm/ADT/DenseMap.h"
 #include "llvm/Config/config.h"
+#include "llvm/Support/EndianStream.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/Process.h"
@@ -96,6 +97,17 @@ makeProfileDirName(StringRef ProgramName,
   return makeFileName("profile", ProgramName, AuxName, "dir");
 }
 
+static std::string
+makeMinimalTraceFileName(StringRef ProgramName,
+                         StringRef AuxName) {
+  return makeFileName("minimal-trace", ProgramName, AuxName, "bin");
+}
+
+// Capacity of the -trace-stats-minimal ring buffer: once this many records
+// have been written, new records overwrite the oldest. 64k records is ~2MB
+// and covers the tail end of even very large frontend jobs.
+static const size_t MinimalTraceCapacity = 1 << 16;
+
 // LLVM's statistics-reporting machinery is sensitive to filenames containing
 // YAML-quote-requiring characters, which occur surprisingly often in the wild;
 // we only need a recognizable and likely-unique name for a target here, not an
@@ -312,7 +324,8 @@ UnifiedStatsReporter::UnifiedStatsReporter(StringRef ProgramName,
                                            clang::SourceManager *CSM,
                                            bool TraceEvents,
                                            bool ProfileEvents,
-                                           bool ProfileEntities)
+                                           bool ProfileEntities,
+                                           bool MinimalTracing)
   : UnifiedStatsReporter(ProgramName,
                          auxName(ModuleName,
                                  InputName,
@@ -321,7 +334,8 @@ UnifiedStatsReporter::UnifiedStatsReporter(StringRef ProgramName,
                                  OptType),
                          Directory,
                          SM, CSM,
-                         TraceEvents, ProfileEvents, ProfileEntities)
+                         TraceEvents, ProfileEvents, ProfileEntities,
+                         MinimalTracing)
 {
 }
 
@@ -332,12 +346,14 @@ UnifiedStatsReporter::UnifiedStatsReporter(StringRef ProgramName,
                                            clang::SourceManager *CSM,
                                            bool TraceEvents,
                                            bool ProfileEvents,
-                                           bool ProfileEntities)
+                                           bool ProfileEntities,
+                                           bool MinimalTracing)
   : currentProcessExitStatusSet(false),
     currentProcessExitStatus(EXIT_FAILURE),
     StatsFilename(Directory),
     TraceFilename(Directory),
     ProfileDirname(Directory),
+    MinimalTraceFilename(Directory),
     StartedTime(llvm::TimeRecord::getCurrentTime()),
     MainThreadID(std::this_thread::get_id()),
     Timer(std::make_unique<NamedRegionTimer>(AuxName,
@@ -351,6 +367,8 @@ UnifiedStatsReporter::UnifiedStatsReporter(StringRef ProgramName,
   path::append(StatsFilename, makeStatsFileName(ProgramName, AuxName));
   path::append(TraceFilename, makeTraceFileName(ProgramName, AuxName));
   path::append(ProfileDirname, makeProfileDirName(ProgramName, AuxName));
+  path::append(MinimalTraceFilename,
+               makeMinimalTraceFileName(ProgramName, AuxName));
   EnableStatistics(/*PrintOnExit=*/false);
   if (TraceEvents || ProfileEvents || ProfileEntities)
     LastTracedFrontendCounters.emplace();
@@ -360,6 +378,10 @@ UnifiedStatsReporter::UnifiedStatsReporter(StringRef ProgramName,
     EventProfilers =std::make_unique<StatsProfilers>();
   if (ProfileEntities)
     EntityProfilers =std::make_unique<StatsProfilers>();
+  if (MinimalTracing) {
+    MinimalTrace.emplace();
+    MinimalTrace->reserve(MinimalTraceCapacity);
+  }
 }
 
 void UnifiedStatsReporter::recordJobMaxRSS(long rss) {
@@ -561,6 +583,25 @@ UnifiedStatsReporter::saveAnyFrontendStatsEvents(
   if (IsFlushingTracesAndProfiles)
     return;
 
+  // In minimal-tracing mode we only append a timestamped record to the ring
+  // buffer and return, skipping the timers, counter snapshots and profilers
+  // below: those are what make full tracing expensive. EventName always has
+  // static storage duration (see FrontendStatsTracer), so keeping the
+  // StringRef past this call is safe.
+  if (MinimalTrace) {
+    auto NowNS = uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+    MinimalTraceRecord Rec{NowNS, T.EventName, IsEntry};
+    if (MinimalTrace->size() < MinimalTraceCapacity) {
+      MinimalTrace->push_back(Rec);
+    } else {
+      (*MinimalTrace)[MinimalTraceNext] = Rec;
+      MinimalTraceWrapped = true;
+    }
+    MinimalTraceNext = (MinimalTraceNext + 1) % MinimalTraceCapacity;
+    return;
+  }
+
   // First make a note in the recursion-safe timers; these
   // are active anytime UnifiedStatsReporter is active.
   if (IsEntry) {
@@ -780,10 +821,52 @@ UnifiedStatsReporter::flushTracesAndProfiles() {
 #undef FRONTEND_STATISTIC
     }
   }
+  if (MinimalTrace && !MinimalTrace->empty()) {
+    std::error_code EC;
+    raw_fd_ostream tstream(MinimalTraceFilename, EC, fs::F_None);
+    if (EC) {
+      llvm::errs() << "Error opening -trace-stats-minimal file '"
+                   << MinimalTraceFilename << "' for writing\n";
+      return;
+    }
+    // Compact binary format: an 8-byte magic-and-version header, an interned
+    // table of event names, then one 13-byte record per event. All integers
+    // are little-endian.
+    //
+    //   u32 magic 'SMT0', u32 record count
+    //   u32 name count, then per name: u32 length, bytes (no terminator)
+    //   per record: u64 time-nsec, u32 name index, u8 is-entry
+    llvm::DenseMap<const char *, uint32_t> nameIndices;
+    std::vector<StringRef> names;
+    for (auto const &R : *MinimalTrace) {
+      auto it = nameIndices.insert({R.EventName.data(),
+                                    uint32_t(names.size())});
+      if (it.second)
+        names.push_back(R.EventName);
+    }
+    support::endian::Writer W(tstream, support::little);
+    W.write<uint32_t>(0x30544d53); // 'SMT0'
+    W.write<uint32_t>(uint32_t(MinimalTrace->size()));
+    W.write<uint32_t>(uint32_t(names.size()));
+    for (auto N : names) {
+      W.write<uint32_t>(uint32_t(N.size()));
+      tstream << N;
+    }
+    // If the ring buffer wrapped, the oldest record is at MinimalTraceNext;
+    // emit in chronological order.
+    size_t Start = MinimalTraceWrapped ? MinimalTraceNext : 0;
+    for (size_t i = 0, e = MinimalTrace->size(); i != e; ++i) {
+      auto const &R = (*MinimalTrace)[(Start + i) % MinimalTrace->size()];
+      W.write<uint64_t>(R.TimeNSec);
+      W.write<uint32_t>(nameIndices[R.EventName.data()]);
+      W.write<uint8_t>(R.IsEntry ? 1 : 0);
+    }
+  }
   LastTracedFrontendCounters.reset();
   FrontendStatsEvents.reset();
   EventProfilers.reset();
   EntityProfilers.reset();
+  MinimalTrace.reset();
 }
 
 } // namespace swift
@@ -662,6 +662,15 @@ importer::getNormalInvocationArguments(
     invocationArgStrs.push_back("-fmodules-validate-system-headers");
   }
 
+  if (importerOpts.ValidateModulesOnce) {
+    // Within one build session, the first job to touch a PCM validates it and
+    // records that fact in the module cache; every later job (including the
+    // other frontends of a batch compilation) skips revalidation entirely.
+    invocationArgStrs.push_back("-fmodules-validate-once-per-build-session");
+    invocationArgStrs.push_back("-fbuild-session-file=" +
+                                importerOpts.BuildSessionFilePath);
+  }
+
   if (importerOpts.DetailedPreprocessingRecord) {
     invocationArgStrs.insert(invocationArgStrs.end(), {
       "-Xclang", "-detailed-preprocessing-record",
@@ -3700,8 +3709,11 @@ void ClangImporter::Implementation::lookupValue(
     }
 
     // If we have a declaration and nothing matched so far, try the names used
-    // in other versions of Swift.
-    if (auto clangDecl = entry.dyn_cast<clang::NamedDecl *>()) {
+    // in other versions of Swift. This is the slow path: each candidate
+    // version re-runs name importing, so don't enter it at all when the
+    // current-version name already matched.
+    if (clang::NamedDecl *clangDecl =
+            anyMatching ? nullptr : entry.dyn_cast<clang::NamedDecl *>()) {
       const clang::NamedDecl *recentClangDecl =
           clangDecl->getMostRecentDecl();
 
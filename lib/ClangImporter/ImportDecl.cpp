@@ -3086,25 +3086,22 @@ namespace {
         llvm_unreachable("unhandled kind");
       };
 
+      // If the enumerators are not members of the imported type, there is no
+      // need to import them now: they surface in the enclosing context and
+      // are found through the lookup tables, which import them individually
+      // on demand. Importing them here would eagerly pull in every constant
+      // of a constant-like enum the first time its type is referenced, which
+      // gets expensive in large generated headers.
+      if (!addEnumeratorsAsMembers)
+        return result;
+
       for (auto constant : decl->enumerators()) {
         Decl *enumeratorDecl = nullptr;
         TinyPtrVector<Decl *> variantDecls;
         switch (enumKind) {
         case EnumKind::Constants:
         case EnumKind::Unknown:
-          Impl.forEachDistinctName(constant,
-                                   [&](ImportedName newName,
-                                       ImportNameVersion nameVersion) -> bool {
-            Decl *imported = Impl.importDecl(constant, nameVersion);
-            if (!imported)
-              return false;
-            if (nameVersion == getActiveSwiftVersion())
-              enumeratorDecl = imported;
-            else
-              variantDecls.push_back(imported);
-            return true;
-          });
-          break;
+          llvm_unreachable("enumerators of these kinds are imported lazily");
         case EnumKind::Options:
           Impl.forEachDistinctName(constant,
                                    [&](ImportedName newName,
@@ -35,6 +35,7 @@
 #include "llvm/Bitstream/BitstreamReader.h"
 #include "llvm/Bitstream/BitstreamWriter.h"
 #include "llvm/Support/DJB.h"
+#include "llvm/Support/MathExtras.h"
 #include "llvm/Support/OnDiskHashTable.h"
 
 using namespace swift;
@@ -105,6 +106,12 @@ class SwiftLookupTableReader : public clang::ModuleFileExtensionReader {
   std::unique_ptr<SerializedGlobalsAsMembersTable> GlobalsAsMembersTable;
   std::unique_ptr<SerializedGlobalsAsMembersIndex> GlobalsAsMembersIndex;
 
+  /// Bloom filter over the base names in \c SerializedTable, stored as
+  /// little-endian 64-bit words; empty if the module file predates the
+  /// filter.
+  StringRef BloomFilterData;
+  uint64_t BloomFilterNumBits;
+
   SwiftLookupTableReader(clang::ModuleFileExtension *extension,
                          clang::ASTReader &reader,
                          clang::serialization::ModuleFile &moduleFile,
@@ -115,12 +122,20 @@ class SwiftLookupTableReader : public clang::ModuleFileExtensionReader {
                          std::unique_ptr<SerializedGlobalsAsMembersTable>
                              globalsAsMembersTable,
                          std::unique_ptr<SerializedGlobalsAsMembersIndex>
-                            globalsAsMembersIndex)
+                            globalsAsMembersIndex,
+                         StringRef bloomFilterData,
+                         uint64_t bloomFilterNumBits)
       : ModuleFileExtensionReader(extension), Reader(reader),
         ModuleFile(moduleFile), OnRemove(onRemove),
         SerializedTable(std::move(serializedTable)), Categories(categories),
         GlobalsAsMembersTable(std::move(globalsAsMembersTable)),
-        GlobalsAsMembersIndex(std::move(globalsAsMembersIndex)) {}
+        GlobalsAsMembersIndex(std::move(globalsAsMembersIndex)),
+        BloomFilterData(bloomFilterData),
+        BloomFilterNumBits(bloomFilterNumBits) {}
+
+  /// Returns false if the Bloom filter proves that \p baseName has no entry
+  /// in the serialized table, without touching the table itself.
+  bool mayContain(SerializedSwiftName baseName) const;
 
 public:
   /// Create a new lookup table reader for the given AST reader and stream
@@ -1081,6 +1096,10 @@ namespace {
     /// Record that contains the mapping from contexts to the list of
     /// globals that will be injected as members into those contexts.
     GLOBALS_AS_MEMBERS_INDEX_RECORD_ID,
+
+    /// Record that contains a Bloom filter over the base names in the
+    /// base name -> entities table.
+    BLOOM_FILTER_RECORD_ID,
   };
 
   using BaseNameToEntitiesTableRecordLayout
@@ -1095,6 +1114,9 @@ namespace {
   using GlobalsAsMembersIndexRecordLayout
     = BCRecordLayout<GLOBALS_AS_MEMBERS_INDEX_RECORD_ID, BCVBR<16>, BCBlob>;
 
+  using BloomFilterRecordLayout
+    = BCRecordLayout<BLOOM_FILTER_RECORD_ID, BCVBR<16>, BCBlob>;
+
   /// Trait used to write the on-disk hash table for the base name -> entities
   /// mapping.
   class BaseNameToEntitiesTableWriterInfo {
@@ -1325,6 +1347,33 @@ void SwiftLookupTableWriter::writeExtensionContents(
     layout.emit(ScratchRecord, tableOffset, hashTableBlob);
   }
 
+  // Write a Bloom filter over the base names, so that readers can reject
+  // names this module does not define at all without deserializing any part
+  // of the table. ~16 bits and two probes per key keeps the false-positive
+  // rate around 1.5% at a fraction of the size of the table itself.
+  if (!baseNames.empty()) {
+    uint64_t numBits =
+        std::max<uint64_t>(64, llvm::PowerOf2Ceil(baseNames.size() * 16));
+    SmallVector<uint64_t, 16> words(numBits / 64, 0);
+    for (auto baseName : baseNames) {
+      uint32_t hash =
+          llvm::DenseMapInfo<SerializedSwiftName>::getHashValue(baseName);
+      auto bits = getBloomFilterBits(hash, numBits);
+      words[bits.first / 64] |= uint64_t(1) << (bits.first % 64);
+      words[bits.second / 64] |= uint64_t(1) << (bits.second % 64);
+    }
+
+    llvm::SmallString<256> filterBlob;
+    {
+      llvm::raw_svector_ostream blobStream(filterBlob);
+      for (uint64_t word : words)
+        endian::write<uint64_t>(blobStream, word, little);
+    }
+
+    BloomFilterRecordLayout layout(stream);
+    layout.emit(ScratchRecord, numBits, filterBlob);
+  }
+
   // Write the categories, if there are any.
   if (!table.Categories.empty()) {
     SmallVector<clang::serialization::DeclID, 4> categoryIDs;
@@ -1651,6 +1700,8 @@ SwiftLookupTableReader::create(clang::ModuleFileExtension *extension,
   std::unique_ptr<SerializedGlobalsAsMembersIndex> globalsAsMembersIndex;
   std::unique_ptr<SerializedGlobalsAsMembersTable> globalsAsMembersTable;
   ArrayRef<clang::serialization::DeclID> categories;
+  StringRef bloomFilterData;
+  uint64_t bloomFilterNumBits = 0;
   while (next.Kind != llvm::BitstreamEntry::EndBlock) {
     if (next.Kind == llvm::BitstreamEntry::Error)
       return nullptr;
@@ -1726,6 +1777,16 @@ SwiftLookupTableReader::create(clang::ModuleFileExtension *extension,
       break;
     }
 
+    case BLOOM_FILTER_RECORD_ID: {
+      // Already saw the Bloom filter.
+      if (bloomFilterNumBits != 0)
+        return nullptr;
+
+      BloomFilterRecordLayout::readRecord(scratch, bloomFilterNumBits);
+      bloomFilterData = blobData;
+      break;
+    }
+
     case GLOBALS_AS_MEMBERS_RECORD_ID: {
       // Already saw globals-as-members table.
       if (globalsAsMembersTable)
@@ -1766,7 +1827,8 @@ SwiftLookupTableReader::create(clang::ModuleFileExtension *extension,
            new SwiftLookupTableReader(extension, reader, moduleFile, onRemove,
                                       std::move(serializedTable), categories,
                                       std::move(globalsAsMembersTable),
-                                      std::move(globalsAsMembersIndex)));
+                                      std::move(globalsAsMembersIndex),
+                                      bloomFilterData, bloomFilterNumBits));
 
 }
 
@@ -1778,9 +1840,31 @@ SmallVector<SerializedSwiftName, 4> SwiftLookupTableReader::getBaseNames() {
   return results;
 }
 
+bool SwiftLookupTableReader::mayContain(SerializedSwiftName baseName) const {
+  if (BloomFilterNumBits == 0)
+    return true; // The module file predates the filter.
+
+  uint32_t hash =
+      llvm::DenseMapInfo<SerializedSwiftName>::getHashValue(baseName);
+  auto bits = getBloomFilterBits(hash, BloomFilterNumBits);
+  auto testBit = [this](uint64_t bit) -> bool {
+    auto *wordPtr = reinterpret_cast<const uint8_t *>(BloomFilterData.data()) +
+                    (bit / 64) * sizeof(uint64_t);
+    uint64_t word = endian::read<uint64_t, little, unaligned>(wordPtr);
+    return word & (uint64_t(1) << (bit % 64));
+  };
+  return testBit(bits.first) && testBit(bits.second);
+}
+
 bool SwiftLookupTableReader::lookup(
     SerializedSwiftName baseName,
     SmallVectorImpl<SwiftLookupTable::FullTableEntry> &entries) {
+  // The common case across a large import graph is that a module has no
+  // entry for the name at all; let the Bloom filter answer that without
+  // touching the table pages.
+  if (!mayContain(baseName))
+    return false;
+
   // Look for an entry with this base name.
   auto known = SerializedTable->find(baseName);
   if (known == SerializedTable->end()) return false;
@@ -276,7 +276,7 @@ const uint16_t SWIFT_LOOKUP_TABLE_VERSION_MAJOR = 1;
 /// Lookup table minor version number.
 ///
 /// When the format changes IN ANY WAY, this number should be incremented.
-const uint16_t SWIFT_LOOKUP_TABLE_VERSION_MINOR = 16; // Lazy Member Loading Index
+const uint16_t SWIFT_LOOKUP_TABLE_VERSION_MINOR = 17; // Base name Bloom filter
 
 /// A lookup table that maps Swift names to the set of Clang
 /// declarations with that particular name.
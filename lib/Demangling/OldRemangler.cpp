@@ -220,7 +220,7 @@ bool Remangler::trySubstitution(Node *node, SubstitutionEntry &entry) {
     return true;
 
   // Go ahead and initialize the substitution entry.
-  entry.setNode(node, /*treatAsIdentifier=*/ false);
+  entry.setNode(node, /*treatAsIdentifier=*/ false, SubtreeHashes);
 
   int Idx = findSubstitution(entry);
   if (Idx < 0)
@@ -94,6 +94,26 @@ void SubstitutionEntry::deepHash(Node *node) {
   }
 }
 
+size_t SubstitutionEntry::hashNode(Node *node, SubtreeHashCache &cache) {
+  auto cached = cache.find(node);
+  if (cached != cache.end())
+    return cached->second;
+
+  size_t hash = (size_t)node->getKind();
+  if (node->hasIndex()) {
+    hash = 33 * hash + node->getIndex();
+  } else if (node->hasText()) {
+    for (char c : node->getText()) {
+      hash = 33 * hash + (unsigned char)c;
+    }
+  }
+  for (Node *child : *node) {
+    hash = 33 * hash + hashNode(child, cache);
+  }
+  cache.emplace(node, hash);
+  return hash;
+}
+
 bool SubstitutionEntry::deepEquals(Node *lhs, Node *rhs) const {
   if (lhs->getKind() != rhs->getKind())
     return false;
@@ -336,7 +356,7 @@ bool Remangler::trySubstitution(Node *node, SubstitutionEntry &entry,
     return true;
 
   // Go ahead and initialize the substitution entry.
-  entry.setNode(node, treatAsIdentifier);
+  entry.setNode(node, treatAsIdentifier, SubtreeHashes);
 
   int Idx = findSubstitution(entry);
   if (Idx < 0)
@@ -2600,6 +2620,16 @@ std::string Demangle::mangleNode(NodePointer node) {
   });
 }
 
+llvm::StringRef Demangle::mangleNode(NodePointer node, NodeFactory &Factory) {
+  return mangleNode(
+      node,
+      [](SymbolicReferenceKind, const void *) -> NodePointer {
+        unreachable("should not try to mangle a symbolic reference; "
+                    "resolve it to a non-symbolic demangling tree instead");
+      },
+      Factory);
+}
+
 std::string
 Demangle::mangleNode(NodePointer node, SymbolicResolver resolver) {
   if (!node) return "";
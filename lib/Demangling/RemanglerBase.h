@@ -35,10 +35,26 @@ class SubstitutionEntry {
   bool treatAsIdentifier = false;
 
 public:
-  void setNode(Node *node, bool treatAsIdentifier) {
+  /// Hashes of subtrees that have already been hashed, keyed by node.
+  ///
+  /// Structurally repeated subtrees are shared in the demangle tree (the
+  /// demangler resolves substitutions to the node of the first occurrence),
+  /// so memoizing by node pointer avoids re-walking a repeated subtree every
+  /// time another substitution candidate containing it is hashed.
+  using SubtreeHashCache = std::unordered_map<Node *, size_t>;
+
+  void setNode(Node *node, bool treatAsIdentifier, SubtreeHashCache &cache) {
     this->treatAsIdentifier = treatAsIdentifier;
     TheNode = node;
-    deepHash(node);
+    if (treatAsIdentifier) {
+      // The hash of an identifier depends on how the node is treated, not
+      // just on the node itself, so it cannot use the cache. Identifiers are
+      // leaf nodes, so there is nothing to memoize anyway.
+      StoredHash = 0;
+      deepHash(node);
+    } else {
+      StoredHash = hashNode(node, cache);
+    }
   }
 
   struct Hasher {
@@ -68,6 +84,8 @@ private:
 
   void deepHash(Node *node);
 
+  static size_t hashNode(Node *node, SubtreeHashCache &cache);
+
   bool deepEquals(Node *lhs, Node *rhs) const;
 };
 
@@ -138,6 +156,11 @@ protected:
   std::unordered_map<SubstitutionEntry, unsigned, SubstitutionEntry::Hasher>
     OverflowSubstitutions;
 
+  // Memoized hashes for subtrees that substitution entries have already
+  // visited. Lives as long as the remangling, so a subtree is deep-hashed at
+  // most once no matter how often it recurs in the symbol.
+  SubstitutionEntry::SubtreeHashCache SubtreeHashes;
+
   RemanglerBuffer Buffer;
 
 protected:
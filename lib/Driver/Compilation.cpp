@@ -126,7 +126,8 @@ Compilation::Compilation(DiagnosticEngine &Diags,
                          bool EnableSourceRangeDependencies,
                          bool CompareIncrementalSchemes,
                          StringRef CompareIncrementalSchemesPath,
-                         bool EnableCrossModuleIncrementalBuild)
+                         bool EnableCrossModuleIncrementalBuild,
+                         bool EnableIncrementalPriors)
   : Diags(Diags), TheToolChain(TC),
     TheOutputInfo(OI),
     Level(Level),
@@ -152,7 +153,8 @@ Compilation::Compilation(DiagnosticEngine &Diags,
     EmitFineGrainedDependencyDotFileAfterEveryImport(
       EmitFineGrainedDependencyDotFileAfterEveryImport),
     EnableSourceRangeDependencies(EnableSourceRangeDependencies),
-    EnableCrossModuleIncrementalBuild(EnableCrossModuleIncrementalBuild)
+    EnableCrossModuleIncrementalBuild(EnableCrossModuleIncrementalBuild),
+    EnableIncrementalPriors(EnableIncrementalPriors)
     {
     if (CompareIncrementalSchemes)
       IncrementalComparator.emplace(
@@ -223,6 +225,15 @@ namespace driver {
 
     /// Jobs that incremental-mode has decided it can skip.
     CommandSet DeferredCommands;
+
+    /// True if the integrated dependency graph was reconstituted from the
+    /// priors file. Swiftdeps files that have not changed since the priors
+    /// were written are then already integrated and need not be re-read.
+    bool PriorsLoaded = false;
+
+    /// The modification time of the priors file that was loaded.
+    llvm::sys::TimePoint<> PriorsModTime = llvm::sys::TimePoint<>::min();
+
   public:
     /// Why are we keeping two dependency graphs?
     ///
@@ -254,6 +265,11 @@ namespace driver {
     llvm::SmallDenseMap<const Job *, std::unique_ptr<llvm::Timer>, 16>
     DriverTimers;
 
+    /// When each subprocess began executing, so that its wall-clock duration
+    /// can be recorded in the build record when it finishes.
+    llvm::SmallDenseMap<const Job *, std::chrono::steady_clock::time_point, 16>
+    JobExecStartTimes;
+
     void noteBuilding(const Job *cmd, const bool willBeBuilding,
                       const bool isTentative, const bool forRanges,
                       StringRef reason) const {
@@ -394,6 +410,8 @@ namespace driver {
       // TODO: properly handle task began.
       const Job *BeganCmd = (const Job *)Context;
 
+      JobExecStartTimes[BeganCmd] = std::chrono::steady_clock::now();
+
       if (Comp.getShowDriverTimeCompilation()) {
         llvm::SmallString<128> TimerName;
         llvm::raw_svector_ostream OS(TimerName);
@@ -420,7 +438,8 @@ namespace driver {
       case OutputLevel::Parseable:
         BeganCmd->forEachContainedJobAndPID(Pid, [&](const Job *J, Job::PID P) {
           parseable_output::emitBeganMessage(llvm::errs(), *J, P,
-                                             TaskProcessInformation(Pid));
+                                             TaskProcessInformation(Pid),
+                                             Comp.getParseableOutputFormat());
         });
         break;
       }
@@ -611,14 +630,60 @@ namespace driver {
           // own.
           parseable_output::emitSignalledMessage(llvm::errs(), *J, P,
                                                  "cancelled batch constituent",
-                                                 "", SIGINT, ProcInfo);
+                                                 "", SIGINT, ProcInfo,
+                                                 Comp.getParseableOutputFormat());
         } else {
           parseable_output::emitFinishedMessage(llvm::errs(), *J, P, ReturnCode,
-                                                Output, ProcInfo);
+                                                Output, ProcInfo,
+                                                Comp.getParseableOutputFormat());
         }
       });
     }
 
+    /// Record how long the subprocess for \p FinishedCmd ran, attributing the
+    /// time to each source input so the next build can schedule the slowest
+    /// files first. A \c BatchJob's duration is split evenly across its
+    /// constituents; non-compile jobs have no \c InputAction inputs and so
+    /// record nothing.
+    void recordCompileTimeOfFinishedProcess(const Job *FinishedCmd) {
+      auto iter = JobExecStartTimes.find(FinishedCmd);
+      if (iter == JobExecStartTimes.end())
+        return;
+      auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(
+                        std::chrono::steady_clock::now() - iter->second)
+                        .count();
+      SmallVector<const Job *, 4> constituents;
+      if (isBatchJob(FinishedCmd)) {
+        auto combined =
+            static_cast<const BatchJob *>(FinishedCmd)->getCombinedJobs();
+        constituents.append(combined.begin(), combined.end());
+        millis /= constituents.size();
+      } else {
+        constituents.push_back(FinishedCmd);
+      }
+      for (const Job *Cmd : constituents)
+        for (const Action *A : Cmd->getSource().getInputs())
+          if (const auto *IA = dyn_cast<InputAction>(A))
+            Comp.recordInputCompileTime(IA->getInputArg().getValue(), millis);
+    }
+
+    /// An estimate, in milliseconds, of how long \p Cmd will run, based on the
+    /// compile times recorded in the previous build record. Jobs with no
+    /// history (newly added files, non-compile jobs) estimate to zero.
+    uint64_t getEstimatedDuration(const Job *Cmd) const {
+      uint64_t millis = 0;
+      if (isBatchJob(Cmd)) {
+        for (const Job *J :
+             static_cast<const BatchJob *>(Cmd)->getCombinedJobs())
+          millis += getEstimatedDuration(J);
+        return millis;
+      }
+      for (const Action *A : Cmd->getSource().getInputs())
+        if (const auto *IA = dyn_cast<InputAction>(A))
+          millis += Comp.getInputCompileTime(IA->getInputArg().getValue());
+      return millis;
+    }
+
     /// Callback which will be called immediately after a task has finished
     /// execution. Determines if execution should continue, and also schedule
     /// any additional Jobs which we now know we need to run.
@@ -633,6 +698,8 @@ namespace driver {
         if (Comp.getShowDriverTimeCompilation()) {
           DriverTimers[FinishedCmd]->stopTimer();
         }
+        if (ReturnCode == EXIT_SUCCESS)
+          recordCompileTimeOfFinishedProcess(FinishedCmd);
         processOutputOfFinishedProcess(Pid, ReturnCode, FinishedCmd, Output,
                                        ProcInfo);
       }
@@ -783,7 +850,8 @@ namespace driver {
         SignalledCmd->forEachContainedJobAndPID(Pid, [&](const Job *J,
                                                          Job::PID P) {
           parseable_output::emitSignalledMessage(llvm::errs(), *J, P, ErrorMsg,
-                                                 Output, Signal, ProcInfo);
+                                                 Output, Signal, ProcInfo,
+                                                 Comp.getParseableOutputFormat());
         });
       } else {
         // Otherwise, send the buffered output to stderr, though only if we
@@ -857,6 +925,8 @@ namespace driver {
 
     void scheduleFirstRoundJobsForIncrementalCompilation() {
 
+      loadPriorsIfPossible();
+
       CommandSet compileJobsToSchedule =
           computeFirstRoundCompileJobsForIncrementalCompilation();
 
@@ -874,6 +944,52 @@ namespace driver {
       }
     }
 
+    /// If enabled, reconstitute the integrated dependency graph persisted by
+    /// the previous driver invocation, so that only the swiftdeps files that
+    /// have changed since then need to be re-read and re-integrated.
+    void loadPriorsIfPossible() {
+      if (!Comp.getEnableIncrementalPriors())
+        return;
+      const std::string path = Comp.getIncrementalPriorsPath();
+      if (path.empty())
+        return;
+      llvm::sys::fs::file_status priorsStatus;
+      if (llvm::sys::fs::status(path, priorsStatus))
+        return;
+      // On a failed read, fall back to reading every swiftdeps file; the
+      // ensuing integrations supersede anything a partial read added.
+      // The ranges graph keeps reading every swiftdeps file; priors only
+      // serve the dependency-based scheme.
+      if (getFineGrainedDepGraph(/*forRanges=*/false)
+              .readPriorsFromPath(path, Comp.getDiags()))
+        return;
+      PriorsLoaded = true;
+      PriorsModTime = priorsStatus.getLastModificationTime();
+    }
+
+    /// Is this job's swiftdeps file already integrated into the graph loaded
+    /// from the priors, i.e. was it part of the priors and unchanged since
+    /// they were written?
+    bool isSwiftDepsCoveredByPriors(StringRef DependenciesFile) const {
+      if (!PriorsLoaded)
+        return false;
+      llvm::sys::fs::file_status status;
+      if (llvm::sys::fs::status(DependenciesFile, status))
+        return false;
+      if (status.getLastModificationTime() > PriorsModTime)
+        return false;
+      // Guard against a priors file that predates this swiftdeps file
+      // entirely, e.g. because a previous priors write failed.
+      bool graphHasFile = false;
+      getFineGrainedDepGraph(/*forRanges=*/false)
+          .forEachNodeInJob(
+              DependenciesFile,
+              [&](fine_grained_dependencies::ModuleDepGraphNode *) {
+                graphHasFile = true;
+              });
+      return graphHasFile;
+    }
+
     /// Figure out the best strategy and return those jobs. May return
     /// duplicates.
     CommandSet computeFirstRoundCompileJobsForIncrementalCompilation() {
@@ -1068,6 +1184,12 @@ namespace driver {
         registerJobToDepGraph(Cmd, forRanges);
         return std::make_pair(Job::Condition::NewlyAdded, true);
       }
+      // If the priors already cover this job's unchanged swiftdeps file, the
+      // graph is up to date for this job; just register it.
+      if (!forRanges && isSwiftDepsCoveredByPriors(DependenciesFile)) {
+        registerJobToDepGraph(Cmd, forRanges);
+        return std::make_pair(Cmd->getCondition(), true);
+      }
       const bool depGraphLoadError =
           loadDepGraphFromPath(Cmd, DependenciesFile, forRanges);
       if (depGraphLoadError) {
@@ -1238,9 +1360,22 @@ namespace driver {
 
     /// Insert all jobs in \p Cmds (of descriptive name \p Kind) to the \c
     /// TaskQueue, and clear \p Cmds.
+    ///
+    /// The \c TaskQueue runs entries in insertion order across its parallel
+    /// workers, so enqueueing the jobs with the longest recorded compile
+    /// times first approximates longest-processing-time-first scheduling and
+    /// keeps a slow outlier file from serializing the tail of the build.
+    /// Ties (including all jobs with no history) keep their existing order,
+    /// preserving the old behavior when no build record exists.
     template <typename Container>
     void transferJobsToTaskQueue(Container &Cmds, StringRef Kind) {
-      for (const Job *Cmd : Cmds) {
+      llvm::SmallVector<const Job *, 16> SortedCmds(Cmds.begin(), Cmds.end());
+      std::stable_sort(SortedCmds.begin(), SortedCmds.end(),
+                       [this](const Job *A, const Job *B) {
+                         return getEstimatedDuration(A) >
+                                getEstimatedDuration(B);
+                       });
+      for (const Job *Cmd : SortedCmds) {
         if (Comp.getShowJobLifecycle())
           llvm::outs() << "Adding " << Kind
                        << " job to task queue: "
@@ -1551,7 +1686,8 @@ namespace driver {
           if (Comp.getOutputLevel() == OutputLevel::Parseable) {
             // Provide output indicating this command was skipped if parseable
             // output was requested.
-            parseable_output::emitSkippedMessage(llvm::errs(), *Cmd);
+            parseable_output::emitSkippedMessage(
+                llvm::errs(), *Cmd, Comp.getParseableOutputFormat());
           }
           ScheduledCommands.insert(Cmd);
           markFinished(Cmd, /*Skipped=*/true);
@@ -1779,7 +1915,8 @@ static void checkForOutOfDateInputs(DiagnosticEngine &diags,
 
 static void writeCompilationRecord(StringRef path, StringRef argsHash,
                                    llvm::sys::TimePoint<> buildTime,
-                                   const InputInfoMap &inputs) {
+                                   const InputInfoMap &inputs,
+                                   const llvm::StringMap<uint64_t> &compileTimes) {
   // Before writing to the dependencies file path, preserve any previous file
   // that may have been there. No error handling -- this is just a nicety, it
   // doesn't matter if it fails.
@@ -1829,6 +1966,23 @@ static void writeCompilationRecord(StringRef path, StringRef argsHash,
     writeTimeValue(out, entry.second.previousModTime);
     out << "\n";
   }
+
+  // Record the measured compile time of each input, in milliseconds, so the
+  // next build can start the slowest files first. Inputs skipped this time
+  // keep the value carried over from the previous record. Old drivers ignore
+  // this key.
+  if (!compileTimes.empty()) {
+    SmallVector<StringRef, 16> sortedInputs;
+    for (const auto &entry : compileTimes)
+      sortedInputs.push_back(entry.getKey());
+    llvm::sort(sortedInputs);
+
+    out << compilation_record::getName(TopLevelKey::CompileTimes) << ":\n";
+    for (StringRef input : sortedInputs) {
+      out << "  \"" << llvm::yaml::escape(input)
+          << "\": " << compileTimes.lookup(input) << "\n";
+    }
+  }
 }
 
 static void writeInputJobsToFilelist(llvm::raw_fd_ostream &out, const Job *job,
@@ -1927,7 +2081,15 @@ int Compilation::performJobsImpl(bool &abnormalExit,
     State.populateInputInfoMap(InputInfo);
     checkForOutOfDateInputs(Diags, InputInfo);
     writeCompilationRecord(CompilationRecordPath, ArgsHash, BuildStartTime,
-                           InputInfo);
+                           InputInfo, InputCompileTimes);
+    // Persist the integrated dependency graph so that the next invocation
+    // can reconstitute it instead of re-reading every swiftdeps file. If the
+    // incremental build was disabled along the way the graph is incomplete,
+    // so don't write it out; the stale priors then predate the swiftdeps
+    // files and will be ignored.
+    if (EnableIncrementalPriors && EnableIncrementalBuild)
+      State.FineGrainedDepGraph.writePriorsToPath(Diags,
+                                                  getIncrementalPriorsPath());
   }
   abnormalExit = State.hadAnyAbnormalExit();
   return State.getResult();
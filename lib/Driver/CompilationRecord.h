@@ -34,6 +34,10 @@ enum class TopLevelKey {
   /// The key for the list of inputs to the compilation that produced the
   /// compilation record.
   Inputs,
+  /// The key for the map of measured per-input compile times, used to
+  /// schedule the slowest files first on the next build. Purely advisory;
+  /// drivers that predate it ignore it.
+  CompileTimes,
 };
 
 /// \returns A string representation of the given key.
@@ -43,6 +47,7 @@ inline static StringRef getName(TopLevelKey Key) {
   case TopLevelKey::Options: return "options";
   case TopLevelKey::BuildTime: return "build_time";
   case TopLevelKey::Inputs: return "inputs";
+  case TopLevelKey::CompileTimes: return "compile_times";
   }
 
   // Work around MSVC warning: not all control paths return a value
@@ -455,6 +455,7 @@ static void dealWithRemovedInputs(ArrayRef<StringRef> removedInputs,
 /// Returns why ignore incrementality
 static std::string
 populateOutOfDateMap(InputInfoMap &map, llvm::sys::TimePoint<> &LastBuildTime,
+                     llvm::StringMap<uint64_t> &compileTimes,
                      StringRef argsHashStr, const InputFileList &inputs,
                      StringRef buildRecordPath,
                      const bool EnableSourceRangeDependencies,
@@ -603,6 +604,30 @@ populateOutOfDateMap(InputInfoMap &map, llvm::sys::TimePoint<> &LastBuildTime,
         auto inputName = key->getValue(scratch);
         previousInputs[inputName] = { *previousBuildState, timeValue };
       }
+
+    } else if (keyStr ==
+               compilation_record::getName(TopLevelKey::CompileTimes)) {
+      // Purely advisory scheduling hints; skip anything malformed rather than
+      // giving up on incrementality.
+      auto *timesMap = dyn_cast<yaml::MappingNode>(i->getValue());
+      if (!timesMap)
+        continue;
+
+      // FIXME: LLVM's YAML support does incremental parsing in such a way that
+      // for-range loops break.
+      for (auto i = timesMap->begin(), e = timesMap->end(); i != e; ++i) {
+        auto *key = dyn_cast<yaml::ScalarNode>(i->getKey());
+        auto *value = dyn_cast<yaml::ScalarNode>(i->getValue());
+        if (!key || !value)
+          continue;
+
+        uint64_t millis;
+        SmallString<64> valueScratch;
+        if (value->getValue(valueScratch).getAsInteger(10, millis))
+          continue;
+
+        compileTimes[key->getValue(scratch)] = millis;
+      }
     }
   }
 
@@ -953,12 +978,14 @@ Driver::buildCompilation(const ToolChain &TC,
   computeArgsHash(ArgsHash, *TranslatedArgList);
   llvm::sys::TimePoint<> LastBuildTime = llvm::sys::TimePoint<>::min();
   InputInfoMap outOfDateMap;
+  llvm::StringMap<uint64_t> priorCompileTimes;
   std::string whyIgnoreIncrementallity =
       !Incremental
           ? ""
           : buildRecordPath.empty()
                 ? "no build record path"
-                : populateOutOfDateMap(outOfDateMap, LastBuildTime, ArgsHash,
+                : populateOutOfDateMap(outOfDateMap, LastBuildTime,
+                                       priorCompileTimes, ArgsHash,
                                        Inputs, buildRecordPath,
                                        EnableSourceRangeDependencies,
                                        ShowIncrementalBuildDecisions);
@@ -994,6 +1021,21 @@ Driver::buildCompilation(const ToolChain &TC,
   const bool ShowJobLifecycle =
       ArgList->hasArg(options::OPT_driver_show_job_lifecycle);
 
+  auto ParseableOutputFormat = parseable_output::Format::JSON;
+  if (const Arg *A =
+          ArgList->getLastArg(options::OPT_parseable_output_format)) {
+    auto Fmt = llvm::StringSwitch<Optional<parseable_output::Format>>(
+                   A->getValue())
+                   .Case("json", parseable_output::Format::JSON)
+                   .Case("binary", parseable_output::Format::Binary)
+                   .Default(llvm::None);
+    if (Fmt)
+      ParseableOutputFormat = Fmt.getValue();
+    else
+      Diags.diagnose(SourceLoc(), diag::error_invalid_arg_value,
+                     A->getAsString(*ArgList), A->getValue());
+  }
+
   // In order to confine the values below, while still moving the argument
   // list, and preserving the interface to Compilation, enclose the call to the
   // constructor in a block:
@@ -1022,6 +1064,8 @@ Driver::buildCompilation(const ToolChain &TC,
             OPT_driver_emit_fine_grained_dependency_dot_file_after_every_import);
     const bool EnableCrossModuleDependencies = ArgList->hasArg(
         options::OPT_enable_experimental_cross_module_incremental_build);
+    const bool EnableIncrementalPriors =
+        ArgList->hasArg(options::OPT_enable_incremental_priors);
 
     // clang-format off
     C = std::make_unique<Compilation>(
@@ -1048,10 +1092,15 @@ Driver::buildCompilation(const ToolChain &TC,
         EnableSourceRangeDependencies,
         CompareIncrementalSchemes,
         CompareIncrementalSchemesPath,
-        EnableCrossModuleDependencies);
+        EnableCrossModuleDependencies,
+        EnableIncrementalPriors);
     // clang-format on
   }
 
+  // Seed the per-input compile times from the previous build record so that
+  // job scheduling can start the slowest files first.
+  C->setInputCompileTimes(std::move(priorCompileTimes));
+
   // Construct the graph of Actions.
   SmallVector<const Action *, 8> TopLevelActions;
   buildActions(TopLevelActions, TC, OI,
@@ -1084,6 +1133,8 @@ Driver::buildCompilation(const ToolChain &TC,
   if (ShowJobLifecycle)
     C->setShowJobLifecycle();
 
+  C->setParseableOutputFormat(ParseableOutputFormat);
+
   // This has to happen after building jobs, because otherwise we won't even
   // emit .swiftdeps files for the next build.
   if (!whyIgnoreIncrementallity.empty())
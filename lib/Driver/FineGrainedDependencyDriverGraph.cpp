@@ -15,10 +15,12 @@
 #include "swift/AST/DiagnosticEngine.h"
 #include "swift/AST/DiagnosticsFrontend.h"
 #include "swift/AST/FileSystem.h"
+#include "swift/AST/FineGrainedDependencyFormat.h"
 #include "swift/Basic/PrettyStackTrace.h"
 #include "swift/Basic/ReferenceDependencyKeys.h"
 #include "swift/Basic/SourceManager.h"
 #include "swift/Basic/Statistic.h"
+#include "swift/Basic/Version.h"
 #include "swift/Demangling/Demangle.h"
 #include "swift/Driver/Job.h"
 #include "llvm/ADT/STLExtras.h"
@@ -26,6 +28,8 @@
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/StringSet.h"
 #include "llvm/ADT/StringSwitch.h"
+#include "llvm/Bitstream/BitstreamReader.h"
+#include "llvm/Bitstream/BitstreamWriter.h"
 #include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/SourceMgr.h"
@@ -803,3 +807,558 @@ void ModuleDepGraph::printOneNodeOfPath(raw_ostream &out,
     llvm_unreachable("unknown NodeKind");
   }
 }
+
+//==============================================================================
+// MARK: Persisting and reloading the integrated graph ("priors")
+//==============================================================================
+
+// The priors file uses the same bitstream container as a swiftdeps file
+// (see FineGrainedDependencyFormat.h), but holds MODULE_DEP_GRAPH_NODE,
+// USES_OF_DEF_NODE and EXTERNAL_DEP_NODE records describing the driver's
+// integrated graph rather than one frontend job's SourceFileDepGraph.
+
+static llvm::Optional<NodeKind> getNodeKind(unsigned nodeKind) {
+  if (nodeKind < unsigned(NodeKind::kindCount))
+    return NodeKind(nodeKind);
+  return None;
+}
+
+static llvm::Optional<DeclAspect> getDeclAspect(unsigned declAspect) {
+  if (declAspect < unsigned(DeclAspect::aspectCount))
+    return DeclAspect(declAspect);
+  return None;
+}
+
+namespace {
+
+using UsesByDef =
+    std::unordered_map<DependencyKey, std::unordered_set<ModuleDepGraphNode *>>;
+
+class PriorsSerializer {
+  llvm::StringMap<unsigned, llvm::BumpPtrAllocator> IdentifierIDs;
+  unsigned LastIdentifierID = 0;
+  std::vector<StringRef> IdentifiersToWrite;
+
+  llvm::BitstreamWriter &Out;
+
+  /// A reusable buffer for emitting records.
+  SmallVector<uint64_t, 64> ScratchRecord;
+
+  std::array<unsigned, 256> AbbrCodes;
+
+  void addIdentifier(StringRef str);
+  unsigned getIdentifier(StringRef str);
+
+  void addIdentifiersOfKey(const DependencyKey &key) {
+    addIdentifier(key.getContext());
+    addIdentifier(key.getName());
+  }
+
+  template <typename Layout>
+  void registerRecordAbbr() {
+    using AbbrArrayTy = decltype(AbbrCodes);
+    static_assert(Layout::Code <= std::tuple_size<AbbrArrayTy>::value,
+                  "layout has invalid record code");
+    AbbrCodes[Layout::Code] = Layout::emitAbbrev(Out);
+  }
+
+  void emitBlockID(unsigned ID, StringRef name,
+                   SmallVectorImpl<unsigned char> &nameBuffer);
+
+  void emitRecordID(unsigned ID, StringRef name,
+                    SmallVectorImpl<unsigned char> &nameBuffer);
+
+  void writeSignature();
+  void writeBlockInfoBlock();
+  void writeMetadata();
+
+public:
+  PriorsSerializer(llvm::BitstreamWriter &ExistingOut) : Out(ExistingOut) {}
+
+  void writePriors(const ModuleDepGraph &g, const UsesByDef &usesByDef,
+                   const std::unordered_set<std::string> &externals,
+                   const std::unordered_set<std::string> &incrementalExternals);
+};
+
+} // end namespace
+
+/// Record the name of a block.
+void PriorsSerializer::emitBlockID(unsigned ID, StringRef name,
+                                   SmallVectorImpl<unsigned char> &nameBuffer) {
+  SmallVector<unsigned, 1> idBuffer;
+  idBuffer.push_back(ID);
+  Out.EmitRecord(llvm::bitc::BLOCKINFO_CODE_SETBID, idBuffer);
+
+  // Emit the block name if present.
+  if (name.empty())
+    return;
+  nameBuffer.resize(name.size());
+  memcpy(nameBuffer.data(), name.data(), name.size());
+  Out.EmitRecord(llvm::bitc::BLOCKINFO_CODE_BLOCKNAME, nameBuffer);
+}
+
+void PriorsSerializer::emitRecordID(unsigned ID, StringRef name,
+                                    SmallVectorImpl<unsigned char> &nameBuffer) {
+  assert(ID < 256 && "can't fit record ID in next to name");
+  nameBuffer.resize(name.size()+1);
+  nameBuffer[0] = ID;
+  memcpy(nameBuffer.data()+1, name.data(), name.size());
+  Out.EmitRecord(llvm::bitc::BLOCKINFO_CODE_SETRECORDNAME, nameBuffer);
+}
+
+void PriorsSerializer::writeSignature() {
+  for (auto c : FINE_GRAINED_DEPDENENCY_FORMAT_SIGNATURE)
+    Out.Emit((unsigned) c, 8);
+}
+
+void PriorsSerializer::writeBlockInfoBlock() {
+  llvm::BCBlockRAII restoreBlock(Out, llvm::bitc::BLOCKINFO_BLOCK_ID, 2);
+
+  SmallVector<unsigned char, 64> nameBuffer;
+#define BLOCK(X) emitBlockID(X ## _ID, #X, nameBuffer)
+#define BLOCK_RECORD(K, X) emitRecordID(K::X, #X, nameBuffer)
+
+  BLOCK(RECORD_BLOCK);
+  BLOCK_RECORD(record_block, METADATA);
+  BLOCK_RECORD(record_block, MODULE_DEP_GRAPH_NODE);
+  BLOCK_RECORD(record_block, FINGERPRINT_NODE);
+  BLOCK_RECORD(record_block, USES_OF_DEF_NODE);
+  BLOCK_RECORD(record_block, EXTERNAL_DEP_NODE);
+  BLOCK_RECORD(record_block, IDENTIFIER_NODE);
+
+#undef BLOCK
+#undef BLOCK_RECORD
+}
+
+void PriorsSerializer::writeMetadata() {
+  using namespace record_block;
+
+  MetadataLayout::emitRecord(Out, ScratchRecord,
+                             AbbrCodes[MetadataLayout::Code],
+                             FINE_GRAINED_DEPENDENCY_FORMAT_VERSION_MAJOR,
+                             FINE_GRAINED_DEPENDENCY_FORMAT_VERSION_MINOR,
+                             version::getSwiftFullVersion());
+}
+
+void PriorsSerializer::writePriors(
+    const ModuleDepGraph &g, const UsesByDef &usesByDef,
+    const std::unordered_set<std::string> &externals,
+    const std::unordered_set<std::string> &incrementalExternals) {
+  writeSignature();
+  writeBlockInfoBlock();
+
+  llvm::BCBlockRAII restoreBlock(Out, RECORD_BLOCK_ID, 8);
+
+  using namespace record_block;
+
+  registerRecordAbbr<MetadataLayout>();
+  registerRecordAbbr<ModuleDepGraphNodeLayout>();
+  registerRecordAbbr<FingerprintNodeLayout>();
+  registerRecordAbbr<UsesOfDefNodeLayout>();
+  registerRecordAbbr<ExternalDepNodeLayout>();
+  registerRecordAbbr<IdentifierNodeLayout>();
+
+  writeMetadata();
+
+  // Assign sequence numbers to the nodes so that arcs can refer to them.
+  std::vector<const ModuleDepGraphNode *> nodesBySequenceNumber;
+  std::unordered_map<const ModuleDepGraphNode *, size_t> sequenceNumbers;
+  g.forEachNode([&](const ModuleDepGraphNode *node) {
+    sequenceNumbers.insert({node, nodesBySequenceNumber.size()});
+    nodesBySequenceNumber.push_back(node);
+  });
+
+  // Make a pass to collect all unique strings.
+  for (const ModuleDepGraphNode *node : nodesBySequenceNumber) {
+    addIdentifiersOfKey(node->getKey());
+    addIdentifier(node->getSwiftDepsOrEmpty());
+  }
+  for (const auto &defAndUses : usesByDef)
+    addIdentifiersOfKey(defAndUses.first);
+
+  // Write the strings.
+  for (auto str : IdentifiersToWrite) {
+    IdentifierNodeLayout::emitRecord(Out, ScratchRecord,
+                                     AbbrCodes[IdentifierNodeLayout::Code],
+                                     str);
+  }
+
+  // Now write each graph node, in sequence-number order.
+  for (const ModuleDepGraphNode *node : nodesBySequenceNumber) {
+    ModuleDepGraphNodeLayout::emitRecord(
+        Out, ScratchRecord, AbbrCodes[ModuleDepGraphNodeLayout::Code],
+        unsigned(node->getKey().getKind()),
+        unsigned(node->getKey().getAspect()),
+        getIdentifier(node->getKey().getContext()),
+        getIdentifier(node->getKey().getName()),
+        node->getIsProvides() ? 1 : 0,
+        getIdentifier(node->getSwiftDepsOrEmpty()));
+
+    if (auto fingerprint = node->getFingerprint()) {
+      FingerprintNodeLayout::emitRecord(Out, ScratchRecord,
+                                        AbbrCodes[FingerprintNodeLayout::Code],
+                                        *fingerprint);
+    }
+  }
+
+  // Write the def-use arcs.
+  for (const auto &defAndUses : usesByDef) {
+    SmallVector<uint64_t, 16> useIDs;
+    for (const ModuleDepGraphNode *use : defAndUses.second)
+      useIDs.push_back(sequenceNumbers.at(use));
+    UsesOfDefNodeLayout::emitRecord(
+        Out, ScratchRecord, AbbrCodes[UsesOfDefNodeLayout::Code],
+        unsigned(defAndUses.first.getKind()),
+        unsigned(defAndUses.first.getAspect()),
+        getIdentifier(defAndUses.first.getContext()),
+        getIdentifier(defAndUses.first.getName()), useIDs);
+  }
+
+  // And finally the external dependencies.
+  for (const std::string &external : externals) {
+    ExternalDepNodeLayout::emitRecord(Out, ScratchRecord,
+                                      AbbrCodes[ExternalDepNodeLayout::Code],
+                                      0, external);
+  }
+  for (const std::string &external : incrementalExternals) {
+    ExternalDepNodeLayout::emitRecord(Out, ScratchRecord,
+                                      AbbrCodes[ExternalDepNodeLayout::Code],
+                                      1, external);
+  }
+}
+
+void PriorsSerializer::addIdentifier(StringRef str) {
+  if (str.empty())
+    return;
+
+  decltype(IdentifierIDs)::iterator iter;
+  bool isNew;
+  std::tie(iter, isNew) =
+      IdentifierIDs.insert({str, LastIdentifierID + 1});
+
+  if (!isNew)
+    return;
+
+  ++LastIdentifierID;
+  // Note that we use the string data stored in the StringMap.
+  IdentifiersToWrite.push_back(iter->getKey());
+}
+
+unsigned PriorsSerializer::getIdentifier(StringRef str) {
+  if (str.empty())
+    return 0;
+
+  auto iter = IdentifierIDs.find(str);
+  assert(iter != IdentifierIDs.end());
+  assert(iter->second != 0);
+  return iter->second;
+}
+
+bool ModuleDepGraph::writePriorsToPath(DiagnosticEngine &diags,
+                                       StringRef path) const {
+  FrontendStatsTracer tracer(stats, "fine-grained-dependencies-writePriors");
+  PrettyStackTraceStringAction stackTrace("saving driver dependency graph",
+                                          path);
+  return withOutputFile(diags, path, [&](llvm::raw_ostream &out) {
+    SmallVector<char, 0> buffer;
+    llvm::BitstreamWriter writer{buffer};
+    PriorsSerializer serializer(writer);
+    serializer.writePriors(*this, usesByDef, externalDependencies,
+                           incrementalExternalDependencies);
+    out.write(buffer.data(), buffer.size());
+    out.flush();
+    return false;
+  });
+}
+
+namespace {
+
+class PriorsDeserializer {
+  std::vector<std::string> Identifiers;
+
+  llvm::BitstreamCursor Cursor;
+
+  SmallVector<uint64_t, 64> Scratch;
+  StringRef BlobData;
+
+  // These all return true if there was an error.
+  bool readSignature();
+  bool enterTopLevelBlock();
+  bool readMetadata();
+
+  llvm::Optional<std::string> getIdentifier(unsigned n);
+  llvm::Optional<DependencyKey> getKey(unsigned nodeKindID,
+                                       unsigned declAspectID,
+                                       unsigned contextID, unsigned nameID);
+
+public:
+  PriorsDeserializer(llvm::MemoryBufferRef Data) : Cursor(Data) {}
+
+  bool readPriors(llvm::function_ref<void(ModuleDepGraphNode *)> addNode,
+                  UsesByDef &usesByDef,
+                  std::unordered_set<std::string> &externals,
+                  std::unordered_set<std::string> &incrementalExternals);
+};
+
+} // end namespace
+
+bool PriorsDeserializer::readSignature() {
+  for (unsigned char byte : FINE_GRAINED_DEPDENENCY_FORMAT_SIGNATURE) {
+    if (Cursor.AtEndOfStream())
+      return true;
+    if (auto maybeRead = Cursor.Read(8)) {
+      if (maybeRead.get() != byte)
+        return true;
+    } else {
+      consumeError(maybeRead.takeError());
+      return true;
+    }
+  }
+  return false;
+}
+
+bool PriorsDeserializer::enterTopLevelBlock() {
+  // Read the BLOCKINFO_BLOCK, which contains metadata used when dumping
+  // the binary data with llvm-bcanalyzer.
+  {
+    auto next = Cursor.advance();
+    if (!next) {
+      consumeError(next.takeError());
+      return true;
+    }
+
+    if (next->Kind != llvm::BitstreamEntry::SubBlock)
+      return true;
+
+    if (next->ID != llvm::bitc::BLOCKINFO_BLOCK_ID)
+      return true;
+
+    if (!Cursor.ReadBlockInfoBlock())
+      return true;
+  }
+
+  // Enters our subblock, which contains the actual dependency information.
+  {
+    auto next = Cursor.advance();
+    if (!next) {
+      consumeError(next.takeError());
+      return true;
+    }
+
+    if (next->Kind != llvm::BitstreamEntry::SubBlock)
+      return true;
+
+    if (next->ID != RECORD_BLOCK_ID)
+      return true;
+
+    if (auto err = Cursor.EnterSubBlock(RECORD_BLOCK_ID)) {
+      consumeError(std::move(err));
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool PriorsDeserializer::readMetadata() {
+  using namespace record_block;
+
+  auto entry = Cursor.advance();
+  if (!entry) {
+    consumeError(entry.takeError());
+    return true;
+  }
+
+  if (entry->Kind != llvm::BitstreamEntry::Record)
+    return true;
+
+  auto recordID = Cursor.readRecord(entry->ID, Scratch, &BlobData);
+  if (!recordID) {
+    consumeError(recordID.takeError());
+    return true;
+  }
+
+  if (*recordID != METADATA)
+    return true;
+
+  unsigned majorVersion, minorVersion;
+
+  MetadataLayout::readRecord(Scratch, majorVersion, minorVersion);
+  if (majorVersion != FINE_GRAINED_DEPENDENCY_FORMAT_VERSION_MAJOR ||
+      minorVersion != FINE_GRAINED_DEPENDENCY_FORMAT_VERSION_MINOR) {
+    return true;
+  }
+
+  return false;
+}
+
+llvm::Optional<std::string> PriorsDeserializer::getIdentifier(unsigned n) {
+  if (n == 0)
+    return std::string();
+
+  --n;
+  if (n >= Identifiers.size())
+    return None;
+
+  return Identifiers[n];
+}
+
+llvm::Optional<DependencyKey>
+PriorsDeserializer::getKey(unsigned nodeKindID, unsigned declAspectID,
+                           unsigned contextID, unsigned nameID) {
+  auto nodeKind = getNodeKind(nodeKindID);
+  if (!nodeKind)
+    return None;
+  auto declAspect = getDeclAspect(declAspectID);
+  if (!declAspect)
+    return None;
+  auto context = getIdentifier(contextID);
+  if (!context)
+    return None;
+  auto name = getIdentifier(nameID);
+  if (!name)
+    return None;
+  return DependencyKey(*nodeKind, *declAspect, *context, *name);
+}
+
+// Unlike a swiftdeps file, whose malformation disables the whole incremental
+// build, the priors file is just a cache of work the driver could redo from
+// the swiftdeps files. So unexpected contents are reported as errors for the
+// caller to recover from, never as fatal errors.
+bool PriorsDeserializer::readPriors(
+    llvm::function_ref<void(ModuleDepGraphNode *)> addNode,
+    UsesByDef &usesByDef, std::unordered_set<std::string> &externals,
+    std::unordered_set<std::string> &incrementalExternals) {
+  using namespace record_block;
+
+  if (readSignature())
+    return true;
+
+  if (enterTopLevelBlock())
+    return true;
+
+  if (readMetadata())
+    return true;
+
+  ModuleDepGraphNode *node = nullptr;
+  std::vector<ModuleDepGraphNode *> nodesBySequenceNumber;
+
+  while (!Cursor.AtEndOfStream()) {
+    auto maybeEntry = Cursor.advance();
+    if (!maybeEntry) {
+      consumeError(maybeEntry.takeError());
+      return true;
+    }
+    auto entry = maybeEntry.get();
+
+    if (entry.Kind == llvm::BitstreamEntry::EndBlock) {
+      Cursor.ReadBlockEnd();
+      break;
+    }
+
+    if (entry.Kind != llvm::BitstreamEntry::Record)
+      return true;
+
+    Scratch.clear();
+    auto maybeRecordID = Cursor.readRecord(entry.ID, Scratch, &BlobData);
+    if (!maybeRecordID) {
+      consumeError(maybeRecordID.takeError());
+      return true;
+    }
+
+    switch (*maybeRecordID) {
+    case MODULE_DEP_GRAPH_NODE: {
+      unsigned nodeKindID, declAspectID, contextID, nameID, isProvides,
+          swiftDepsID;
+      ModuleDepGraphNodeLayout::readRecord(Scratch, nodeKindID, declAspectID,
+                                           contextID, nameID, isProvides,
+                                           swiftDepsID);
+      auto key = getKey(nodeKindID, declAspectID, contextID, nameID);
+      if (!key)
+        return true;
+      auto swiftDeps = getIdentifier(swiftDepsID);
+      if (!swiftDeps)
+        return true;
+
+      node = new ModuleDepGraphNode(
+          *key, None,
+          isProvides ? Optional<std::string>(*swiftDeps) : None);
+      addNode(node);
+      nodesBySequenceNumber.push_back(node);
+      break;
+    }
+
+    case FINGERPRINT_NODE: {
+      // FINGERPRINT_NODE must follow a MODULE_DEP_GRAPH_NODE.
+      if (node == nullptr)
+        return true;
+
+      node->setFingerprint(BlobData);
+      break;
+    }
+
+    case USES_OF_DEF_NODE: {
+      unsigned nodeKindID, declAspectID, contextID, nameID;
+      ArrayRef<uint64_t> useIDs;
+      UsesOfDefNodeLayout::readRecord(Scratch, nodeKindID, declAspectID,
+                                      contextID, nameID, useIDs);
+      auto key = getKey(nodeKindID, declAspectID, contextID, nameID);
+      if (!key)
+        return true;
+
+      auto &uses = usesByDef[*key];
+      for (uint64_t useID : useIDs) {
+        if (useID >= nodesBySequenceNumber.size())
+          return true;
+        uses.insert(nodesBySequenceNumber[useID]);
+      }
+      break;
+    }
+
+    case EXTERNAL_DEP_NODE: {
+      unsigned isIncremental;
+      ExternalDepNodeLayout::readRecord(Scratch, isIncremental);
+      (isIncremental ? incrementalExternals : externals)
+          .insert(BlobData.str());
+      break;
+    }
+
+    case IDENTIFIER_NODE: {
+      // IDENTIFIER_NODE must come before any MODULE_DEP_GRAPH_NODE.
+      if (node != nullptr)
+        return true;
+
+      IdentifierNodeLayout::readRecord(Scratch);
+      Identifiers.push_back(BlobData.str());
+      break;
+    }
+
+    default:
+      // Unknown record, e.g. from a different compiler version.
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool ModuleDepGraph::readPriorsFromPath(StringRef path,
+                                        DiagnosticEngine &diags) {
+  FrontendStatsTracer tracer(stats, "fine-grained-dependencies-readPriors");
+  PrettyStackTraceStringAction stackTrace("reading driver dependency graph",
+                                          path);
+
+  auto buffer = llvm::MemoryBuffer::getFile(path);
+  if (!buffer)
+    return true;
+
+  PriorsDeserializer deserializer((*buffer)->getMemBufferRef());
+  if (deserializer.readPriors(
+          [&](ModuleDepGraphNode *node) { addToMap(node); }, usesByDef,
+          externalDependencies, incrementalExternalDependencies))
+    return true;
+
+  if (verifyFineGrainedDependencyGraphAfterEveryImport)
+    verify();
+  return false;
+}
@@ -18,6 +18,7 @@
 #include "swift/Driver/Action.h"
 #include "swift/Driver/Job.h"
 #include "llvm/Option/Arg.h"
+#include "llvm/Support/Endian.h"
 #include "llvm/Support/raw_ostream.h"
 
 using namespace swift::driver::parseable_output;
@@ -252,41 +253,59 @@ struct ObjectTraits<Message> {
 } // namespace json
 } // namespace swift
 
-static void emitMessage(raw_ostream &os, Message &msg) {
+static void emitMessage(raw_ostream &os, Message &msg,
+                        parseable_output::Format Fmt) {
   std::string JSONString;
   llvm::raw_string_ostream BufferStream(JSONString);
   json::Output yout(BufferStream);
   yout << msg;
   BufferStream.flush();
-  os << JSONString.length() << '\n';
-  os << JSONString << '\n';
+  switch (Fmt) {
+  case parseable_output::Format::JSON:
+    os << JSONString.length() << '\n';
+    os << JSONString << '\n';
+    break;
+  case parseable_output::Format::Binary: {
+    // A fixed-size header lets consumers read each frame with exactly two
+    // reads instead of scanning for newlines.
+    char header[8] = {'S', 'W', 'P', 'M'};
+    llvm::support::endian::write32le(header + 4, JSONString.length());
+    os.write(header, sizeof(header));
+    os << JSONString;
+    break;
+  }
+  }
 }
 
 void parseable_output::emitBeganMessage(raw_ostream &os, const Job &Cmd,
                                         int64_t Pid,
-                                        TaskProcessInformation ProcInfo) {
+                                        TaskProcessInformation ProcInfo,
+                                        Format Fmt) {
   BeganMessage msg(Cmd, Pid, ProcInfo);
-  emitMessage(os, msg);
+  emitMessage(os, msg, Fmt);
 }
 
 void parseable_output::emitFinishedMessage(raw_ostream &os, const Job &Cmd,
                                            int64_t Pid, int ExitStatus,
                                            StringRef Output,
-                                           TaskProcessInformation ProcInfo) {
+                                           TaskProcessInformation ProcInfo,
+                                           Format Fmt) {
   FinishedMessage msg(Cmd, Pid, Output, ProcInfo, ExitStatus);
-  emitMessage(os, msg);
+  emitMessage(os, msg, Fmt);
 }
 
 void parseable_output::emitSignalledMessage(raw_ostream &os, const Job &Cmd,
                                             int64_t Pid, StringRef ErrorMsg,
                                             StringRef Output,
                                             Optional<int> Signal,
-                                            TaskProcessInformation ProcInfo) {
+                                            TaskProcessInformation ProcInfo,
+                                            Format Fmt) {
   SignalledMessage msg(Cmd, Pid, Output, ErrorMsg, Signal, ProcInfo);
-  emitMessage(os, msg);
+  emitMessage(os, msg, Fmt);
 }
 
-void parseable_output::emitSkippedMessage(raw_ostream &os, const Job &Cmd) {
+void parseable_output::emitSkippedMessage(raw_ostream &os, const Job &Cmd,
+                                          Format Fmt) {
   SkippedMessage msg(Cmd);
-  emitMessage(os, msg);
+  emitMessage(os, msg, Fmt);
 }
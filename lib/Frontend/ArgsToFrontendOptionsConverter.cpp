@@ -63,6 +63,15 @@ bool ArgsToFrontendOptionsConverter::convert(
   if (const Arg *A = Args.getLastArg(OPT_prebuilt_module_cache_path)) {
     Opts.PrebuiltModuleCachePath = A->getValue();
   }
+  if (const Arg *A = Args.getLastArg(OPT_shared_module_cache_path)) {
+    Opts.SharedModuleCachePath = A->getValue();
+  }
+  if (const Arg *A = Args.getLastArg(OPT_object_file_cache_dir)) {
+    Opts.ObjectFileCacheDir = A->getValue();
+  }
+  if (const Arg *A = Args.getLastArg(OPT_save_invocation_record)) {
+    Opts.InvocationRecordPath = A->getValue();
+  }
   if (const Arg *A = Args.getLastArg(OPT_bridging_header_directory_for_print)) {
     Opts.BridgingHeaderDirForPrint = A->getValue();
   }
@@ -106,6 +115,9 @@ bool ArgsToFrontendOptionsConverter::convert(
   Opts.SerializeModuleInterfaceDependencyHashes |=
     Args.hasArg(OPT_serialize_module_interface_dependency_hashes);
 
+  Opts.SerializeModuleTBDSymbols |=
+    Args.hasArg(OPT_serialize_module_tbd_symbols);
+
   Opts.RemarkOnRebuildFromModuleInterface |=
     Args.hasArg(OPT_Rmodule_interface_rebuild);
 
@@ -193,8 +205,9 @@ bool ArgsToFrontendOptionsConverter::convert(
   if (checkUnusedSupplementaryOutputPaths())
     return true;
 
-  if (FrontendOptions::doesActionGenerateIR(Opts.RequestedAction)
-      && Args.hasArg(OPT_experimental_skip_non_inlinable_function_bodies)) {
+  if (FrontendOptions::doesActionGenerateIR(Opts.RequestedAction) &&
+      (Args.hasArg(OPT_experimental_skip_non_inlinable_function_bodies) ||
+       Args.hasArg(OPT_experimental_skip_all_function_bodies))) {
     Diags.diagnose(SourceLoc(), diag::cannot_emit_ir_skipping_function_bodies);
     return true;
   }
@@ -247,6 +260,9 @@ void ArgsToFrontendOptionsConverter::computePrintStatsOptions() {
   using namespace options;
   Opts.PrintStats |= Args.hasArg(OPT_print_stats);
   Opts.PrintClangStats |= Args.hasArg(OPT_print_clang_stats);
+  // Arena accounting is always compiled in; no need for the stats_disabled
+  // diagnostic below.
+  Opts.PrintASTArenaStats |= Args.hasArg(OPT_print_ast_arena_stats);
 #if defined(NDEBUG) && !defined(LLVM_ENABLE_STATS)
   if (Opts.PrintStats || Opts.PrintClangStats)
     Diags.diagnose(SourceLoc(), diag::stats_disabled);
@@ -266,6 +282,9 @@ void ArgsToFrontendOptionsConverter::computeDebugTimeOptions() {
     if (Args.getLastArg(OPT_profile_stats_entities)) {
       Opts.ProfileEntities = true;
     }
+    if (Args.getLastArg(OPT_trace_stats_minimal)) {
+      Opts.MinimalStatsTracing = true;
+    }
   }
 }
 
@@ -715,6 +715,8 @@ static bool ParseTypeCheckerArgs(TypeCheckerOptions &Opts, ArgList &Args,
   Opts.DebugTimeFunctionBodies |= Args.hasArg(OPT_debug_time_function_bodies);
   Opts.DebugTimeExpressions |=
       Args.hasArg(OPT_debug_time_expression_type_checking);
+  Opts.ExpressionTypeCheckingRemarks |=
+      Args.hasArg(OPT_remark_expression_type_checking);
   Opts.SkipNonInlinableFunctionBodies |=
       Args.hasArg(OPT_experimental_skip_non_inlinable_function_bodies);
 
@@ -722,12 +724,18 @@ static bool ParseTypeCheckerArgs(TypeCheckerOptions &Opts, ArgList &Args,
   // body skipping.
   Opts.SkipNonInlinableFunctionBodies |= Args.hasArg(OPT_tbd_is_installapi);
 
+  // Skipping all bodies is a superset of skipping the non-inlinable ones.
+  Opts.SkipAllFunctionBodies |=
+      Args.hasArg(OPT_experimental_skip_all_function_bodies);
+  Opts.SkipNonInlinableFunctionBodies |= Opts.SkipAllFunctionBodies;
+
   if (Opts.SkipNonInlinableFunctionBodies &&
       FrontendOpts.ModuleName == SWIFT_ONONE_SUPPORT) {
     // Disable this optimization if we're compiling SwiftOnoneSupport, because
     // we _definitely_ need to look inside every declaration to figure out
     // what gets prespecialized.
     Opts.SkipNonInlinableFunctionBodies = false;
+    Opts.SkipAllFunctionBodies = false;
     Diags.diagnose(SourceLoc(),
                    diag::module_incompatible_with_skip_function_bodies,
                    SWIFT_ONONE_SUPPORT);
@@ -831,6 +839,15 @@ static bool ParseClangImporterArgs(ClangImporterOptions &Opts,
     Opts.PCHDisableValidation |= Args.hasArg(OPT_pch_disable_validation);
   }
 
+  Opts.ValidateModulesOnce |= Args.hasArg(OPT_validate_clang_modules_once);
+  if (auto *A = Args.getLastArg(OPT_clang_build_session_file))
+    Opts.BuildSessionFilePath = A->getValue();
+  if (Opts.ValidateModulesOnce && Opts.BuildSessionFilePath.empty()) {
+    Diags.diagnose(SourceLoc(), diag::error_option_requires_option,
+                   "-validate-clang-modules-once", "-clang-build-session-file");
+    return true;
+  }
+
   if (Args.hasFlag(options::OPT_warnings_as_errors,
                    options::OPT_no_warnings_as_errors, false))
     Opts.ExtraArgs.push_back("-Werror");
@@ -1132,6 +1149,8 @@ static bool ParseSILArgs(SILOptions &Opts, ArgList &Args,
   Opts.EnableARCOptimizations &= !Args.hasArg(OPT_disable_arc_opts);
   Opts.EnableOSSAOptimizations &= !Args.hasArg(OPT_disable_ossa_opts);
   Opts.EnableSpeculativeDevirtualization |= Args.hasArg(OPT_enable_spec_devirt);
+  Opts.EnableLazyLinking |= Args.hasArg(OPT_enable_lazy_sil_linking);
+  Opts.LazyObjCThunks |= Args.hasArg(OPT_enable_lazy_objc_thunks);
   Opts.DisableSILPerfOptimizations |= Args.hasArg(OPT_disable_sil_perf_optzns);
   Opts.CrossModuleOptimization |= Args.hasArg(OPT_CrossModuleOptimization);
   Opts.VerifyAll |= Args.hasArg(OPT_sil_verify_all);
@@ -1412,6 +1431,10 @@ static bool ParseIRGenArgs(IRGenOptions &Opts, ArgList &Args,
 
   Opts.FunctionSections = Args.hasArg(OPT_function_sections);
 
+  if (const Arg *A = Args.getLastArg(OPT_function_order_file)) {
+    Opts.FunctionOrderFile = A->getValue();
+  }
+
   if (Args.hasArg(OPT_autolink_force_load))
     Opts.ForceLoadSymbolName = Args.getLastArgValue(OPT_module_link_name).str();
 
@@ -1441,6 +1464,8 @@ static bool ParseIRGenArgs(IRGenOptions &Opts, ArgList &Args,
       }
       Opts.DumpJIT = *artifact;
     }
+    if (const Arg *A = Args.getLastArg(OPT_jit_object_cache_path))
+      Opts.JITObjectCachePath = A->getValue();
   }
 
   for (const Arg *A : Args.filtered(OPT_verify_type_layout)) {
@@ -1546,6 +1571,10 @@ static bool ParseIRGenArgs(IRGenOptions &Opts, ArgList &Args,
     Opts.EnableReflectionNames = false;
   }
 
+  if (Args.hasArg(OPT_strip_unused_reflection_metadata)) {
+    Opts.StripUnusedReflectionMetadata = true;
+  }
+
   if (Args.hasArg(OPT_force_public_linkage)) {
     Opts.ForcePublicLinkage = true;
   }
@@ -1563,11 +1592,19 @@ static bool ParseIRGenArgs(IRGenOptions &Opts, ArgList &Args,
     Opts.DisableLegacyTypeInfo = true;
   }
 
-  if (Args.hasArg(OPT_prespecialize_generic_metadata) && 
+  if (Args.hasArg(OPT_prespecialize_generic_metadata) &&
       !Args.hasArg(OPT_disable_generic_metadata_prespecialization)) {
     Opts.PrespecializeGenericMetadata = true;
   }
 
+  if (const Arg *A =
+          Args.getLastArg(OPT_prespecialize_generic_metadata_list_EQ)) {
+    if (!Args.hasArg(OPT_disable_generic_metadata_prespecialization)) {
+      Opts.PrespecializeGenericMetadata = true;
+      Opts.PrespecializeGenericMetadataListPath = A->getValue();
+    }
+  }
+
   if (const Arg *A = Args.getLastArg(OPT_read_legacy_type_info_path_EQ)) {
     Opts.ReadLegacyTypeInfoPath = A->getValue();
   }
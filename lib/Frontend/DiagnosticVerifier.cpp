@@ -959,7 +959,9 @@ void DiagnosticVerifier::handleDiagnostic(SourceManager &SM,
   {
     llvm::raw_svector_ostream Out(message);
     DiagnosticEngine::formatDiagnosticText(Out, Info.FormatString,
-                                           Info.FormatArgs);
+                                           Info.FormatArgs,
+                                           DiagnosticFormatOptions(),
+                                           Info.FormatCache);
   }
 
   if (Info.Loc.isValid()) {
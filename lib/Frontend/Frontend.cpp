@@ -278,7 +278,8 @@ void CompilerInstance::setupStatsReporter() {
       getClangSourceManager(getASTContext()),
       Invok.getFrontendOptions().TraceStats,
       Invok.getFrontendOptions().ProfileEvents,
-      Invok.getFrontendOptions().ProfileEntities);
+      Invok.getFrontendOptions().ProfileEntities,
+      Invok.getFrontendOptions().MinimalStatsTracing);
   // Hand the stats reporter down to the ASTContext so the rest of the compiler
   // can use it.
   getASTContext().setStatsReporter(Reporter.get());
@@ -500,7 +501,8 @@ bool CompilerInstance::setUpModuleLoaders() {
   ModuleInterfaceLoaderOptions LoaderOpts(FEOpts);
   Context->addModuleInterfaceChecker(
     std::make_unique<ModuleInterfaceCheckerImpl>(*Context, ModuleCachePath,
-      FEOpts.PrebuiltModuleCachePath, LoaderOpts));
+      FEOpts.PrebuiltModuleCachePath, LoaderOpts,
+      FEOpts.SharedModuleCachePath));
   // If implicit modules are disabled, we need to install an explicit module
   // loader.
   bool ExplicitModuleBuild = Invocation.getFrontendOptions().DisableImplicitModules;
@@ -344,6 +344,7 @@ class ModuleInterfaceLoaderImpl {
   const std::string interfacePath;
   const StringRef moduleName;
   const StringRef prebuiltCacheDir;
+  const StringRef sharedCacheDir;
   const StringRef cacheDir;
   const SourceLoc diagnosticLoc;
   DependencyTracker *const dependencyTracker;
@@ -353,13 +354,14 @@ class ModuleInterfaceLoaderImpl {
   ModuleInterfaceLoaderImpl(
     ASTContext &ctx, StringRef modulePath, StringRef interfacePath,
     StringRef moduleName, StringRef cacheDir, StringRef prebuiltCacheDir,
-    SourceLoc diagLoc, ModuleInterfaceLoaderOptions Opts,
+    StringRef sharedCacheDir, SourceLoc diagLoc,
+    ModuleInterfaceLoaderOptions Opts,
     DependencyTracker *dependencyTracker = nullptr,
     ModuleLoadingMode loadMode = ModuleLoadingMode::PreferSerialized)
   : ctx(ctx), fs(*ctx.SourceMgr.getFileSystem()), diags(ctx.Diags),
     modulePath(modulePath), interfacePath(interfacePath),
     moduleName(moduleName), prebuiltCacheDir(prebuiltCacheDir),
-    cacheDir(cacheDir), diagnosticLoc(diagLoc),
+    sharedCacheDir(sharedCacheDir), cacheDir(cacheDir), diagnosticLoc(diagLoc),
     dependencyTracker(dependencyTracker), loadMode(loadMode), Opts(Opts) {}
 
   /// Constructs the full path of the dependency \p dep by prepending the SDK
@@ -592,14 +594,57 @@ class ModuleInterfaceLoaderImpl {
     return scratch.str();
   }
 
+  /// Assembles the path of the module in the shared cache that was built from
+  /// this exact interface: $SHARED_CACHE/Foo-<hash>.swiftmodule, where the
+  /// hash covers the interface's contents, the compiler version, and the
+  /// target. Unlike the prebuilt cache, the key already identifies the
+  /// interface by content, so a stale module can never be found under it; the
+  /// interface's own path and timestamp are irrelevant.
+  Optional<StringRef>
+  computeSharedModuleCachePath(llvm::SmallString<256> &scratch) {
+    namespace path = llvm::sys::path;
+
+    auto interfaceBuf = fs.getBufferForFile(interfacePath);
+    if (!interfaceBuf)
+      return None;
+
+    llvm::hash_code H = hash_combine(
+        // Modules in the shared cache are only reusable by the exact compiler
+        // version that produced them.
+        version::getSwiftFullVersion(),
+
+        // The interface's contents rather than its path, so that checkouts of
+        // the same sources in different locations (e.g. across a CI fleet)
+        // share entries.
+        (*interfaceBuf)->getBuffer(),
+
+        // Guard against reusing a module across targets, as the local cache
+        // key does.
+        getTargetSpecificModuleTriple(ctx.LangOpts.Target).str());
+
+    scratch = sharedCacheDir;
+    path::append(scratch, moduleName);
+    scratch += "-";
+    scratch += llvm::APInt(64, H).toString(36, /*Signed=*/false);
+    scratch += ".";
+    scratch += file_types::getExtension(file_types::TY_SwiftModuleFile);
+
+    // If there isn't a file at this location, skip returning a path.
+    if (!fs.exists(scratch))
+      return None;
+
+    return scratch.str();
+  }
+
   bool isInResourceDir(StringRef path) {
     StringRef resourceDir = ctx.SearchPathOpts.RuntimeResourcePath;
     if (resourceDir.empty()) return false;
     return path.startswith(resourceDir);
   }
 
-  std::pair<std::string, std::string> getCompiledModuleCandidates() {
-    std::pair<std::string, std::string> result;
+  std::tuple<std::string, std::string, std::string>
+  getCompiledModuleCandidates() {
+    std::tuple<std::string, std::string, std::string> result;
     // Keep track of whether we should attempt to load a .swiftmodule adjacent
     // to the .swiftinterface.
     bool shouldLoadAdjacentModule = true;
@@ -632,7 +677,7 @@ class ModuleInterfaceLoaderImpl {
 
     if (shouldLoadAdjacentModule) {
       if (fs.exists(modulePath)) {
-        result.first = modulePath.str();
+        std::get<0>(result) = modulePath.str();
       }
     }
 
@@ -649,19 +694,29 @@ class ModuleInterfaceLoaderImpl {
       }
       if (path) {
         if (fs.exists(*path)) {
-          result.second = path->str();
+          std::get<1>(result) = path->str();
         }
       }
     }
 
+    // If we have a shared cache path, look for a module built from an
+    // interface with identical contents by this compiler version.
+    if (!sharedCacheDir.empty()) {
+      llvm::SmallString<256> scratch;
+      if (Optional<StringRef> path = computeSharedModuleCachePath(scratch)) {
+        std::get<2>(result) = path->str();
+      }
+    }
+
     return result;
   }
 
   llvm::ErrorOr<DiscoveredModule>
   discoverUpToDateCompiledModuleForInterface(SmallVectorImpl<FileDependency> &deps,
                                              std::string &UsableModulePath) {
-    std::string adjacentMod, prebuiltMod;
-    std::tie(adjacentMod, prebuiltMod) = getCompiledModuleCandidates();
+    std::string adjacentMod, prebuiltMod, sharedMod;
+    std::tie(adjacentMod, prebuiltMod, sharedMod) =
+        getCompiledModuleCandidates();
     if (!adjacentMod.empty()) {
       auto adjacentModuleBuffer = fs.getBufferForFile(adjacentMod);
       if (adjacentModuleBuffer) {
@@ -715,6 +770,25 @@ class ModuleInterfaceLoaderImpl {
                                   ModuleRebuildInfo::ModuleKind::Prebuilt);
       }
     }
+
+    // Finally, consult the shared cache. Its key already covers the
+    // interface's contents and the compiler version, but validate the
+    // module's recorded dependencies like any other prebuilt module, since
+    // the other modules it was built against may differ locally.
+    if (!sharedMod.empty()) {
+      std::unique_ptr<llvm::MemoryBuffer> moduleBuffer;
+      if (swiftModuleIsUpToDate(sharedMod, deps, moduleBuffer)) {
+        LLVM_DEBUG(llvm::dbgs() << "Found up-to-date shared module at "
+                                << sharedMod << "\n");
+        UsableModulePath = sharedMod;
+        return DiscoveredModule::prebuilt(sharedMod, std::move(moduleBuffer));
+      } else {
+        LLVM_DEBUG(llvm::dbgs() << "Found out-of-date shared module at "
+                                << sharedMod << "\n");
+        rebuildInfo.setModuleKind(sharedMod,
+                                  ModuleRebuildInfo::ModuleKind::Prebuilt);
+      }
+    }
     // We cannot find any proper compiled module to use.
     return std::make_error_code(std::errc::no_such_file_or_directory);
   }
@@ -947,6 +1021,8 @@ class ModuleInterfaceLoaderImpl {
 bool ModuleInterfaceCheckerImpl::isCached(StringRef DepPath) {
   if (!CacheDir.empty() && DepPath.startswith(CacheDir))
     return true;
+  if (!SharedCacheDir.empty() && DepPath.startswith(SharedCacheDir))
+    return true;
   return !PrebuiltCacheDir.empty() && DepPath.startswith(PrebuiltCacheDir);
 }
 
@@ -997,6 +1073,7 @@ std::error_code ModuleInterfaceLoader::findModuleFilesInDirectory(
   ModuleInterfaceLoaderImpl Impl(
                 Ctx, ModPath, InPath, ModuleName,
                 InterfaceChecker.CacheDir, InterfaceChecker.PrebuiltCacheDir,
+                InterfaceChecker.SharedCacheDir,
                 ModuleID.Loc, InterfaceChecker.Opts,
                 dependencyTracker,
                 llvm::is_contained(PreferInterfaceForModules,
@@ -1038,17 +1115,19 @@ ModuleInterfaceCheckerImpl::getCompiledModuleCandidatesForInterface(
   llvm::sys::path::replace_extension(modulePath, newExt);
   ModuleInterfaceLoaderImpl Impl(
                 Ctx, modulePath, interfacePath, moduleName,
-                CacheDir, PrebuiltCacheDir, SourceLoc(),
+                CacheDir, PrebuiltCacheDir, SharedCacheDir, SourceLoc(),
                 Opts,
                 nullptr,
                 ModuleLoadingMode::PreferSerialized);
   std::vector<std::string> results;
-  auto pair = Impl.getCompiledModuleCandidates();
+  auto candidates = Impl.getCompiledModuleCandidates();
   // Add compiled module candidates only when they are non-empty.
-  if (!pair.first.empty())
-    results.push_back(pair.first);
-  if (!pair.second.empty())
-    results.push_back(pair.second);
+  if (!std::get<0>(candidates).empty())
+    results.push_back(std::get<0>(candidates));
+  if (!std::get<1>(candidates).empty())
+    results.push_back(std::get<1>(candidates));
+  if (!std::get<2>(candidates).empty())
+    results.push_back(std::get<2>(candidates));
   return results;
 }
 
@@ -1062,7 +1141,7 @@ bool ModuleInterfaceCheckerImpl::tryEmitForwardingModule(StringRef moduleName,
   llvm::sys::path::replace_extension(modulePath, newExt);
   ModuleInterfaceLoaderImpl Impl(
                 Ctx, modulePath, interfacePath, moduleName,
-                CacheDir, PrebuiltCacheDir, SourceLoc(),
+                CacheDir, PrebuiltCacheDir, SharedCacheDir, SourceLoc(),
                 Opts,
                 nullptr,
                 ModuleLoadingMode::PreferSerialized);
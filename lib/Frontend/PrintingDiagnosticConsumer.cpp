@@ -890,7 +890,9 @@ static void annotateSnippetWithInfo(SourceManager &SM,
   {
     llvm::raw_svector_ostream Out(Text);
     DiagnosticEngine::formatDiagnosticText(Out, Info.FormatString,
-                                           Info.FormatArgs);
+                                           Info.FormatArgs,
+                                           DiagnosticFormatOptions(),
+                                           Info.FormatCache);
     // Show associated fix-its as part of the message. This is a
     // better experience when notes offer a choice of fix-its. It's redundant
     // for fix-its which are also displayed inline, but helps improve
@@ -1047,7 +1049,9 @@ void PrintingDiagnosticConsumer::printDiagnostic(SourceManager &SM,
   {
     llvm::raw_svector_ostream Out(Text);
     DiagnosticEngine::formatDiagnosticText(Out, Info.FormatString,
-                                           Info.FormatArgs);
+                                           Info.FormatArgs,
+                                           DiagnosticFormatOptions(),
+                                           Info.FormatCache);
   }
 
   auto Msg = SM.GetMessage(Info.Loc, SMKind, Text, Ranges, FixIts);
@@ -250,7 +250,7 @@ void SerializedDiagnosticConsumer::addLocToRecord(SourceLoc Loc,
 
   auto bufferId = SM.findBufferContainingLoc(Loc);
   unsigned line, col;
-  std::tie(line, col) = SM.getPresumedLineAndColumnForLoc(Loc);
+  std::tie(line, col) = SM.getPresumedLineAndColumnForLoc(Loc, bufferId);
 
   Record.push_back(getEmitFile(Filename));
   Record.push_back(line);
@@ -532,7 +532,9 @@ void SerializedDiagnosticConsumer::handleDiagnostic(
   {
     llvm::raw_svector_ostream Out(Text);
     DiagnosticEngine::formatDiagnosticText(Out, Info.FormatString,
-                                           Info.FormatArgs);
+                                           Info.FormatArgs,
+                                           DiagnosticFormatOptions(),
+                                           Info.FormatCache);
   }
 
   emitDiagnosticMessage(SM, Info.Loc, Info.Kind, Text, Info);
@@ -80,6 +80,8 @@
 #include "llvm/Remarks/RemarkSerializer.h"
 #include "llvm/Support/Error.h"
 #include "llvm/Support/ErrorHandling.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MD5.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Support/TargetSelect.h"
@@ -88,9 +90,13 @@
 #include "llvm/Target/TargetMachine.h"
 
 #include <algorithm>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #if !defined(_MSC_VER) && !defined(__MINGW32__)
 #include <unistd.h>
@@ -169,24 +175,121 @@ reversePathSortedFilenames(const ArrayRef<std::string> elts) {
   return tmp;
 }
 
+namespace {
+/// Writes pre-rendered supplementary output buffers on a background thread,
+/// overlapping the file I/O with the rest of the end-of-pipeline work.
+/// Content is always rendered on the thread that owns the AST; only raw
+/// bytes cross the thread boundary. Failures are diagnosed when the writer
+/// is flushed, which must happen before the owning scope ends.
+class BackgroundOutputWriter {
+public:
+  enum class Mode {
+    /// Replace the file's contents atomically.
+    Overwrite,
+    /// Append to the file; used for outputs shared by multiple processes,
+    /// such as the loaded module trace.
+    Append,
+  };
+
+private:
+  struct PendingWrite {
+    std::string path;
+    std::string contents;
+    Mode mode;
+  };
+
+  std::mutex mutex;
+  std::condition_variable hasWork;
+  std::vector<PendingWrite> queue;
+  /// Pairs of (output path, error message) for writes that failed.
+  std::vector<std::pair<std::string, std::string>> failures;
+  bool finished = false;
+  std::thread worker;
+
+  void performWrite(const PendingWrite &write) {
+    std::error_code EC;
+    switch (write.mode) {
+    case Mode::Overwrite:
+      EC = swift::atomicallyWritingToFile(
+          write.path,
+          [&](llvm::raw_pwrite_stream &out) { out << write.contents; });
+      break;
+    case Mode::Append: {
+      llvm::raw_fd_ostream out(write.path, EC, llvm::sys::fs::F_Append);
+      if (!EC && !out.has_error())
+        out << write.contents;
+      out.clear_error();
+      break;
+    }
+    }
+    if (EC) {
+      std::lock_guard<std::mutex> lock(mutex);
+      failures.emplace_back(write.path, EC.message());
+    }
+  }
+
+  void run() {
+    while (true) {
+      PendingWrite write;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        hasWork.wait(lock, [&] { return finished || !queue.empty(); });
+        if (queue.empty())
+          return;
+        write = std::move(queue.back());
+        queue.pop_back();
+      }
+      performWrite(write);
+    }
+  }
+
+public:
+  ~BackgroundOutputWriter() {
+    assert(!worker.joinable() && "writer destroyed without being flushed");
+  }
+
+  void enqueue(StringRef path, std::string contents, Mode mode) {
+    assert(!path.empty());
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      assert(!finished && "enqueued a write after flushing");
+      queue.push_back({path.str(), std::move(contents), mode});
+    }
+    if (!worker.joinable())
+      worker = std::thread([this] { run(); });
+    hasWork.notify_one();
+  }
+
+  /// Waits for all pending writes and diagnoses any failures.
+  ///
+  /// \returns true if any write failed.
+  bool flush(DiagnosticEngine &diags) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      finished = true;
+    }
+    hasWork.notify_one();
+    if (worker.joinable())
+      worker.join();
+    for (const auto &failure : failures)
+      diags.diagnose(SourceLoc(), diag::error_opening_output, failure.first,
+                     failure.second);
+    return !failures.empty();
+  }
+};
+} // end anonymous namespace
+
 /// Emits a Make-style dependencies file.
-static bool emitMakeDependenciesIfNeeded(DiagnosticEngine &diags,
-                                         DependencyTracker *depTracker,
+static bool emitMakeDependenciesIfNeeded(DependencyTracker *depTracker,
                                          const FrontendOptions &opts,
-                                         const InputFile &input) {
+                                         const InputFile &input,
+                                         BackgroundOutputWriter &writer) {
   const std::string &dependenciesFilePath = input.dependenciesFilePath();
   if (dependenciesFilePath.empty())
     return false;
 
-  std::error_code EC;
-  llvm::raw_fd_ostream out(dependenciesFilePath, EC, llvm::sys::fs::F_None);
-
-  if (out.has_error() || EC) {
-    diags.diagnose(SourceLoc(), diag::error_opening_output,
-                   dependenciesFilePath, EC.message());
-    out.clear_error();
-    return true;
-  }
+  std::string fileContents;
+  llvm::raw_string_ostream out(fileContents);
 
   llvm::SmallString<256> buffer;
 
@@ -223,15 +326,17 @@ static bool emitMakeDependenciesIfNeeded(DiagnosticEngine &diags,
     out << targetNameEscaped << " :" << dependencyString << '\n';
   });
 
+  writer.enqueue(dependenciesFilePath, std::move(out.str()),
+                 BackgroundOutputWriter::Mode::Overwrite);
   return false;
 }
 
-static void emitMakeDependenciesIfNeeded(DiagnosticEngine &diags,
-                                         DependencyTracker *depTracker,
-                                         const FrontendOptions &opts) {
+static void emitMakeDependenciesIfNeeded(DependencyTracker *depTracker,
+                                         const FrontendOptions &opts,
+                                         BackgroundOutputWriter &writer) {
   opts.InputsAndOutputs.forEachInputProducingSupplementaryOutput(
       [&](const InputFile &f) -> bool {
-        return emitMakeDependenciesIfNeeded(diags, depTracker, opts, f);
+        return emitMakeDependenciesIfNeeded(depTracker, opts, f, writer);
       });
 }
 
@@ -898,22 +1003,14 @@ static void computeSwiftModuleTraceInfo(
 static bool emitLoadedModuleTraceIfNeeded(ModuleDecl *mainModule,
                                           DependencyTracker *depTracker,
                                           StringRef prebuiltCachePath,
-                                          StringRef loadedModuleTracePath) {
+                                          StringRef loadedModuleTracePath,
+                                          BackgroundOutputWriter &writer) {
   ASTContext &ctxt = mainModule->getASTContext();
   assert(!ctxt.hadError()
          && "We should've already exited earlier if there was an error.");
 
   if (loadedModuleTracePath.empty())
     return false;
-  std::error_code EC;
-  llvm::raw_fd_ostream out(loadedModuleTracePath, EC, llvm::sys::fs::F_Append);
-
-  if (out.has_error() || EC) {
-    ctxt.Diags.diagnose(SourceLoc(), diag::error_opening_output,
-                        loadedModuleTracePath, EC.message());
-    out.clear_error();
-    return true;
-  }
 
   SmallPtrSet<ModuleDecl *, 32> abiDependencies;
   {
@@ -963,7 +1060,8 @@ static bool emitLoadedModuleTraceIfNeeded(ModuleDecl *mainModule,
     json::jsonize(jsonOutput, trace, /*Required=*/true);
   }
   stringBuffer += "\n";
-  out << stringBuffer;
+  writer.enqueue(loadedModuleTracePath, std::move(stringBuffer),
+                 BackgroundOutputWriter::Mode::Append);
 
   return true;
 }
@@ -971,12 +1069,13 @@ static bool emitLoadedModuleTraceIfNeeded(ModuleDecl *mainModule,
 static void
 emitLoadedModuleTraceForAllPrimariesIfNeeded(ModuleDecl *mainModule,
                                              DependencyTracker *depTracker,
-                                             const FrontendOptions &opts) {
+                                             const FrontendOptions &opts,
+                                             BackgroundOutputWriter &writer) {
   opts.InputsAndOutputs.forEachInputProducingSupplementaryOutput(
       [&](const InputFile &input) -> bool {
         return emitLoadedModuleTraceIfNeeded(
           mainModule, depTracker, opts.PrebuiltModuleCachePath,
-          input.loadedModuleTracePath());
+          input.loadedModuleTracePath(), writer);
       });
 }
 
@@ -1180,6 +1279,12 @@ static void countASTStats(UnifiedStatsReporter &Stats,
   auto const &AST = Instance.getASTContext();
   C.NumLoadedModules = AST.getNumLoadedModules();
 
+  auto breakdown = AST.getMemoryBreakdown();
+  C.NumASTBytesPermanentArena = breakdown.PermanentArena;
+  C.NumASTBytesTypeTables = breakdown.TypeTables;
+  C.NumASTBytesIdentifierTable = breakdown.IdentifierTable;
+  C.NumASTBytesSolverHighWater = breakdown.SolverHighWater;
+
   if (auto *D = Instance.getDependencyTracker()) {
     C.NumDependencies = D->getDependencies().size();
     C.NumIncrementalDependencies = D->getIncrementalDependencies().size();
@@ -1767,6 +1872,20 @@ static void performEndOfPipelineActions(CompilerInstance &Instance) {
   if (opts.PrintClangStats && ctx.getClangModuleLoader())
     ctx.getClangModuleLoader()->printStatistics();
 
+  // If we were asked to print the ASTContext's arena sizes, do so.
+  if (opts.PrintASTArenaStats) {
+    auto breakdown = ctx.getMemoryBreakdown();
+    llvm::errs() << "=== ASTContext arenas (bytes) ===\n"
+                 << "permanent arena:       " << breakdown.PermanentArena
+                 << '\n'
+                 << "type tables:           " << breakdown.TypeTables << '\n'
+                 << "identifier table:      " << breakdown.IdentifierTable
+                 << '\n'
+                 << "solver arena:          " << breakdown.Solver << '\n'
+                 << "solver high-water:     " << breakdown.SolverHighWater
+                 << '\n';
+  }
+
   // Report AST stats if needed.
   if (auto *stats = ctx.Stats)
     countASTStats(*stats, Instance);
@@ -1792,12 +1911,18 @@ static void performEndOfPipelineActions(CompilerInstance &Instance) {
   // Verify generic signatures if we've been asked to.
   verifyGenericSignaturesIfNeeded(Invocation, ctx);
 
+  // Supplementary outputs whose contents are rendered here but written on a
+  // background thread, overlapping the file I/O with the remaining
+  // end-of-pipeline work. Flushed (and any failures diagnosed) below.
+  BackgroundOutputWriter backgroundWriter;
+
   // Emit any additional outputs that we only need for a successful compilation.
   // We don't want to unnecessarily delay getting any errors back to the user.
   if (!ctx.hadError()) {
     emitLoadedModuleTraceForAllPrimariesIfNeeded(
-        Instance.getMainModule(), Instance.getDependencyTracker(), opts);
-    
+        Instance.getMainModule(), Instance.getDependencyTracker(), opts,
+        backgroundWriter);
+
     emitAnyWholeModulePostTypeCheckSupplementaryOutputs(Instance);
 
     dumpAPIIfNeeded(Instance);
@@ -1825,12 +1950,14 @@ static void performEndOfPipelineActions(CompilerInstance &Instance) {
 
   // Emit dependencies.
   emitReferenceDependenciesForAllPrimaryInputsIfNeeded(Instance);
-  emitMakeDependenciesIfNeeded(Instance.getDiags(),
-                               Instance.getDependencyTracker(), opts);
+  emitMakeDependenciesIfNeeded(Instance.getDependencyTracker(), opts,
+                               backgroundWriter);
 
   // Emit information about the parsed primaries.
   emitSwiftRangesForAllPrimaryInputsIfNeeded(Instance);
   emitCompiledSourceForAllPrimaryInputsIfNeeded(Instance);
+
+  backgroundWriter.flush(Instance.getDiags());
 }
 
 static bool printSwiftVersion(const CompilerInvocation &Invocation) {
@@ -2244,6 +2371,77 @@ static bool generateCode(CompilerInstance &Instance, StringRef OutputFilename,
                      Instance.getStatsReporter());
 }
 
+/// Compute the key under which the object file produced from \p SM would be
+/// stored in the object file cache: a hash of the canonical SIL together
+/// with the parts of the invocation that affect code generation.
+static std::string computeObjectCacheKey(const CompilerInvocation &Invocation,
+                                         SILModule &SM, ModuleDecl *Mod) {
+  llvm::MD5 hash;
+
+  // Identical SIL only produces an identical object for the same compiler,
+  // target, and codegen-relevant option set. The PCH hash folds in the
+  // language, clang-importer, and search-path state.
+  SmallString<128> invocationState;
+  {
+    llvm::raw_svector_ostream OS(invocationState);
+    OS << version::getSwiftFullVersion() << '\n'
+       << Invocation.getTargetTriple() << '\n'
+       << Invocation.getPCHHash() << '\n'
+       << 'g' << (unsigned)Invocation.getIRGenOptions().DebugInfoLevel;
+    Invocation.getIRGenOptions().writeLLVMCodeGenOptionsTo(OS);
+  }
+  hash.update(invocationState);
+
+  // Hash the canonical SIL, printed verbosely so that source locations (and
+  // with them, the emitted line tables) participate in the key.
+  SmallString<0> silText;
+  {
+    llvm::raw_svector_ostream OS(silText);
+    SILOptions printOpts = Invocation.getSILOptions();
+    printOpts.EmitVerboseSIL = true;
+    SM.print(OS, Mod, printOpts);
+  }
+  hash.update(silText);
+
+  llvm::MD5::MD5Result result;
+  hash.final(result);
+  SmallString<32> key;
+  llvm::MD5::stringifyResult(result, key);
+  return std::string(key.str());
+}
+
+/// Return the path at which the object with the given cache key lives, if
+/// the object file cache is enabled.
+static Optional<std::string>
+getCachedObjectFilePath(const FrontendOptions &opts, StringRef cacheKey) {
+  if (opts.ObjectFileCacheDir.empty() || cacheKey.empty())
+    return None;
+  SmallString<128> path(opts.ObjectFileCacheDir);
+  llvm::sys::path::append(path, cacheKey + ".o");
+  return std::string(path.str());
+}
+
+/// Copy the object produced at \p OutputFilename into the object file cache
+/// under \p cacheKey. Failures are ignored; the cache is an optimization.
+static void populateObjectFileCache(const FrontendOptions &opts,
+                                    StringRef cacheKey,
+                                    StringRef OutputFilename) {
+  auto cachedPath = getCachedObjectFilePath(opts, cacheKey);
+  if (!cachedPath)
+    return;
+  if (llvm::sys::fs::create_directories(opts.ObjectFileCacheDir))
+    return;
+
+  // Copy to a unique temporary and rename it into place so that concurrent
+  // frontends racing on the same key never observe a partial object.
+  SmallString<128> tmpPath;
+  if (llvm::sys::fs::createUniqueFile(*cachedPath + ".tmp-%%%%%%", tmpPath))
+    return;
+  if (llvm::sys::fs::copy_file(OutputFilename, tmpPath) ||
+      llvm::sys::fs::rename(tmpPath, *cachedPath))
+    llvm::sys::fs::remove(tmpPath);
+}
+
 static bool performCompileStepsPostSILGen(CompilerInstance &Instance,
                                           std::unique_ptr<SILModule> SM,
                                           ModuleOrSourceFile MSF,
@@ -2292,6 +2490,16 @@ static bool performCompileStepsPostSILGen(CompilerInstance &Instance,
 
     SerializationOptions serializationOpts =
         Invocation.computeSerializationOptions(outs, Instance.getMainModule());
+
+    // When requested, precompute the module's TBD symbol set so it can be
+    // serialized into the swiftmodule alongside the AST.
+    std::vector<std::pair<uint8_t, std::string>> tbdSymbols;
+    if (opts.SerializeModuleTBDSymbols && MSF.is<ModuleDecl *>()) {
+      tbdSymbols = getTBDSymbolsForSerialization(TBDGenDescriptor::forModule(
+          MSF.get<ModuleDecl *>(), Invocation.getTBDGenOptions()));
+      serializationOpts.TBDSymbols = tbdSymbols;
+    }
+
     if (serializationOpts.ExperimentalCrossModuleIncrementalInfo) {
       const auto alsoEmitDotFile =
           Instance.getInvocation()
@@ -2376,6 +2584,24 @@ static bool performCompileStepsPostSILGen(CompilerInstance &Instance,
   StringRef OutputFilename = PSPs.OutputFilename;
   std::vector<std::string> ParallelOutputFilenames =
       opts.InputsAndOutputs.copyOutputFilenames();
+
+  // If an object file cache is configured, see whether this compilation's
+  // object was already produced by an earlier invocation before paying for
+  // IRGen and the LLVM backend. Multi-threaded compilations produce several
+  // objects per SIL module and are left to the normal path.
+  std::string objectCacheKey;
+  if (!opts.ObjectFileCacheDir.empty() &&
+      Action == FrontendOptions::ActionType::EmitObject &&
+      !OutputFilename.empty() && OutputFilename != "-" &&
+      ParallelOutputFilenames.size() <= 1) {
+    objectCacheKey =
+        computeObjectCacheKey(Invocation, *SM, Instance.getMainModule());
+    if (auto cachedPath = getCachedObjectFilePath(opts, objectCacheKey)) {
+      if (!llvm::sys::fs::copy_file(*cachedPath, OutputFilename))
+        return Context.hadError();
+    }
+  }
+
   llvm::GlobalVariable *HashGlobal;
   auto IRModule = generateIR(
       IRGenOpts, Invocation.getTBDGenOptions(), std::move(SM), PSPs,
@@ -2390,8 +2616,11 @@ static bool performCompileStepsPostSILGen(CompilerInstance &Instance,
   if (validateTBDIfNeeded(Invocation, MSF, *IRModule.getModule()))
     return true;
 
-  return generateCode(Instance, OutputFilename, IRModule.getModule(),
-                      HashGlobal);
+  if (generateCode(Instance, OutputFilename, IRModule.getModule(), HashGlobal))
+    return true;
+
+  populateObjectFileCache(opts, objectCacheKey, OutputFilename);
+  return false;
 }
 
 static void emitIndexDataForSourceFile(SourceFile *PrimarySourceFile,
@@ -2667,6 +2896,48 @@ static void printTargetInfo(const CompilerInvocation &invocation,
   out << "}\n";
 }
 
+/// Write the frontend arguments to the requested invocation-record path as a
+/// response file, one shell-quoted argument per line, so that a remote
+/// worker can replay this compilation with 'swift-frontend @<path>' (plus a
+/// .sib snapshot of the post-Sema module in place of the source inputs).
+///
+/// The record flag itself is dropped from the record so that replaying it
+/// doesn't clobber the original.
+static void saveInvocationRecord(StringRef recordPath,
+                                 ArrayRef<const char *> Args,
+                                 DiagnosticEngine &Diags) {
+  std::error_code EC;
+  llvm::raw_fd_ostream OS(recordPath, EC, llvm::sys::fs::F_None);
+  if (EC) {
+    Diags.diagnose(SourceLoc(), diag::error_opening_output, recordPath,
+                   EC.message());
+    return;
+  }
+
+  for (unsigned i = 0, e = Args.size(); i != e; ++i) {
+    StringRef arg = Args[i];
+    if (arg == "-save-invocation-record") {
+      ++i; // Skip the path operand too.
+      continue;
+    }
+    // Quote anything the response-file tokenizer would otherwise split or
+    // reinterpret.
+    if (arg.empty() ||
+        arg.find_first_of(" \t\n\"\\") != StringRef::npos) {
+      OS << '"';
+      for (char c : arg) {
+        if (c == '"' || c == '\\')
+          OS << '\\';
+        OS << c;
+      }
+      OS << '"';
+    } else {
+      OS << arg;
+    }
+    OS << '\n';
+  }
+}
+
 int swift::performFrontend(ArrayRef<const char *> Args,
                            const char *Argv0, void *MainAddr,
                            FrontendObserver *observer) {
@@ -2757,6 +3028,12 @@ int swift::performFrontend(ArrayRef<const char *> Args,
     return finishDiagProcessing(1, /*verifierEnabled*/ false);
   }
 
+  // Record the invocation for replay elsewhere, if asked to.
+  const std::string &invocationRecordPath =
+      Invocation.getFrontendOptions().InvocationRecordPath;
+  if (!invocationRecordPath.empty())
+    saveInvocationRecord(invocationRecordPath, Args, Instance->getDiags());
+
   // Make an array of PrettyStackTrace objects to dump the configuration files
   // we used to parse the arguments. These are RAII objects, so they and the
   // buffers they refer to must be kept alive in order to be useful. (That is,
@@ -672,7 +672,8 @@ static bool diagnoseCycle(CompilerInstance &instance,
 static bool scanModuleDependencies(CompilerInstance &instance,
                                    StringRef moduleName,
                                    bool isClang,
-                                   StringRef outputPath) {
+                                   StringRef outputPath,
+                                   ModuleDependenciesCache &cache) {
   ASTContext &ctx = instance.getASTContext();
   auto &FEOpts = instance.getInvocation().getFrontendOptions();
   ModuleInterfaceLoaderOptions LoaderOpts(FEOpts);
@@ -681,8 +682,6 @@ static bool scanModuleDependencies(CompilerInstance &instance,
 
   llvm::SetVector<ModuleDependencyID, std::vector<ModuleDependencyID>,
                   std::set<ModuleDependencyID>> allModules;
-  // Create the module dependency cache.
-  ModuleDependenciesCache cache;
   InterfaceSubContextDelegateImpl ASTDelegate(ctx.SourceMgr, ctx.Diags,
                                               ctx.SearchPathOpts, ctx.LangOpts,
                                               ctx.ClangImporterOpts,
@@ -733,11 +732,13 @@ static bool scanModuleDependencies(CompilerInstance &instance,
 }
 
 bool swift::scanClangDependencies(CompilerInstance &instance) {
+  ModuleDependenciesCache cache;
   return scanModuleDependencies(instance,
                                 instance.getMainModule()->getNameStr(),
                                 /*isClang*/true,
                                 instance.getInvocation().getFrontendOptions()
-                                  .InputsAndOutputs.getSingleOutputFilename());
+                                  .InputsAndOutputs.getSingleOutputFilename(),
+                                cache);
 }
 
 bool swift::batchScanModuleDependencies(CompilerInstance &instance,
@@ -753,20 +754,38 @@ bool swift::batchScanModuleDependencies(CompilerInstance &instance,
     return true;
   auto &diags = instance.getDiags();
   ForwardingDiagnosticConsumer FDC(diags);
-  // Keep track of all compiler instances we have created.
-  llvm::StringMap<std::unique_ptr<CompilerInstance>> subInstanceMap;
+  // Keep track of all compiler instances we have created, each with the
+  // module dependency cache for its configuration. Sharing a cache across
+  // every entry scanned with the same configuration means the transitive
+  // closure common to the batch — the standard library and other widely
+  // imported modules — is only discovered once per configuration rather
+  // than once per entry.
+  using ScanInstance = std::pair<std::unique_ptr<CompilerInstance>,
+                                 std::unique_ptr<ModuleDependenciesCache>>;
+  llvm::StringMap<ScanInstance> subInstanceMap;
+  ModuleDependenciesCache mainInstanceCache;
   for (auto &entry: *results) {
     CompilerInstance *pInstance = nullptr;
+    ModuleDependenciesCache *pCache = nullptr;
     if (entry.arguments.empty()) {
       // Use the compiler's instance if no arguments are specified.
       pInstance = &instance;
+      pCache = &mainInstanceCache;
     } else if (subInstanceMap.count(entry.arguments)) {
-      // Use the previously created instance if we've seen the arguments before.
-      pInstance = subInstanceMap[entry.arguments].get();
+      // Use the previously created instance if we've seen the arguments
+      // before.
+      auto &entryPair = subInstanceMap[entry.arguments];
+      pInstance = entryPair.first.get();
+      pCache = entryPair.second.get();
     } else {
       // Create a new instance by the arguments and save it in the map.
-      pInstance = subInstanceMap.insert({entry.arguments,
-        std::make_unique<CompilerInstance>()}).first->getValue().get();
+      auto &entryPair = subInstanceMap.insert(
+        {entry.arguments,
+         ScanInstance(std::make_unique<CompilerInstance>(),
+                      std::make_unique<ModuleDependenciesCache>())})
+        .first->getValue();
+      pInstance = entryPair.first.get();
+      pCache = entryPair.second.get();
       SmallVector<const char*, 4> args;
       llvm::cl::TokenizeGNUCommandLine(entry.arguments, saver, args);
       CompilerInvocation subInvok = invok;
@@ -783,9 +802,10 @@ bool swift::batchScanModuleDependencies(CompilerInstance &instance,
       }
     }
     assert(pInstance);
+    assert(pCache);
     // Scan using the chosen compiler instance.
     if (scanModuleDependencies(*pInstance, entry.moduleName, !entry.isSwift,
-                               entry.outputPath)) {
+                               entry.outputPath, *pCache)) {
       return true;
     }
   }
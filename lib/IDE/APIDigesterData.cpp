@@ -576,7 +576,13 @@ getDiffItems(StringRef Key) const {
     llvm::outs() << Key << "\n";
     Impl.PrintedUsrs.insert(Key);
   }
-  return Impl.Data[Key];
+  // Use a non-mutating lookup; almost all keys the migrator asks about have
+  // no diff items, and inserting an empty bag for each of them would grow the
+  // map with every query.
+  auto It = Impl.Data.find(Key);
+  if (It == Impl.Data.end())
+    return {};
+  return It->second;
 }
 
 ArrayRef<APIDiffItem*> swift::ide::api::APIDiffItemStore::
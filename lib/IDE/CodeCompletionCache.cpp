@@ -102,15 +102,37 @@ CodeCompletionCache::~CodeCompletionCache() {}
 /// cached results. This isn't expected to change very often.
 static constexpr uint32_t onDiskCompletionCacheVersion = 1;
 
-/// Deserializes CodeCompletionResults from \p in and stores them in \p V.
+namespace {
+/// A bump allocator that also owns the memory buffer its strings point into.
+///
+/// Deserialized results reference string data in the cache file's buffer
+/// directly instead of copying it, so the buffer has to stay alive exactly as
+/// long as the sink's allocator: anything keeping the results alive (e.g. a
+/// sink's ForeignAllocators list) holds the allocator, and through it, the
+/// buffer.
+struct BufferBackedAllocator {
+  llvm::BumpPtrAllocator allocator;
+  std::unique_ptr<llvm::MemoryBuffer> buffer;
+};
+} // end anonymous namespace
+
+/// Deserializes CodeCompletionResults from \p in and stores them in \p V,
+/// taking ownership of the buffer, which the results point into.
 /// \see writeCacheModule.
-static bool readCachedModule(llvm::MemoryBuffer *in,
+static bool readCachedModule(std::unique_ptr<llvm::MemoryBuffer> in,
                              const CodeCompletionCache::Key &K,
                              CodeCompletionCache::Value &V,
                              bool allowOutOfDate = false) {
   const char *cursor = in->getBufferStart();
   const char *end = in->getBufferEnd();
 
+  // Make the sink's allocator own the buffer, and allocate everything else
+  // (results, chunk lists) in it. Do this before any allocation below.
+  auto storage = std::make_shared<BufferBackedAllocator>();
+  storage->buffer = std::move(in);
+  V.Sink.Allocator = std::shared_ptr<llvm::BumpPtrAllocator>(
+      storage, &storage->allocator);
+
   auto read32le = [end](const char *&cursor) {
     auto result = llvm::support::endian::read32le(cursor);
     cursor += sizeof(result);
@@ -159,7 +181,9 @@ static bool readCachedModule(llvm::MemoryBuffer *in,
 
     const char *p = strings + index;
     auto size = read32le(p);
-    return copyString(*V.Sink.Allocator, StringRef(p, size));
+    // The string data lives in the buffer owned by the sink's allocator, so
+    // it can be referenced without copying.
+    return StringRef(p, size);
   };
 
   // CHUNKS
@@ -425,14 +449,18 @@ static std::string getName(StringRef cacheDirectory,
 
 Optional<CodeCompletionCache::ValueRefCntPtr>
 OnDiskCodeCompletionCache::get(const Key &K) {
-  // Try to find the cached file.
-  auto bufferOrErr = llvm::MemoryBuffer::getFile(getName(cacheDirectory, K));
+  // Try to find the cached file. Don't require a null terminator so the
+  // buffer can be memory-mapped instead of read into memory; results point
+  // straight into it.
+  auto bufferOrErr = llvm::MemoryBuffer::getFile(getName(cacheDirectory, K),
+                                                 /*FileSize=*/-1,
+                                                 /*RequiresNullTerminator=*/false);
   if (!bufferOrErr)
     return None;
 
   // Read the cached results, failing if they are out of date.
   auto V = CodeCompletionCache::createValue();
-  if (!readCachedModule(bufferOrErr.get().get(), K, *V))
+  if (!readCachedModule(std::move(bufferOrErr.get()), K, *V))
     return None;
 
   return V;
@@ -468,7 +496,8 @@ std::error_code OnDiskCodeCompletionCache::set(const Key &K, ValueRefCntPtr V) {
 Optional<CodeCompletionCache::ValueRefCntPtr>
 OnDiskCodeCompletionCache::getFromFile(StringRef filename) {
   // Try to find the cached file.
-  auto bufferOrErr = llvm::MemoryBuffer::getFile(filename);
+  auto bufferOrErr = llvm::MemoryBuffer::getFile(filename, /*FileSize=*/-1,
+                                                 /*RequiresNullTerminator=*/false);
   if (!bufferOrErr)
     return None;
 
@@ -478,7 +507,7 @@ OnDiskCodeCompletionCache::getFromFile(StringRef filename) {
 
   // Read the cached results.
   auto V = CodeCompletionCache::createValue();
-  if (!readCachedModule(bufferOrErr.get().get(), K, *V,
+  if (!readCachedModule(std::move(bufferOrErr.get()), K, *V,
                         /*allowOutOfDate*/ true))
     return None;
 
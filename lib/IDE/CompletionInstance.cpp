@@ -321,6 +321,13 @@ void getInterfaceHashIncludingTypeMembers(SourceFile *SF,
   str = result.digest();
 }
 
+/// Returns the identifier of the completion file's buffer in \p CI.
+static StringRef getCompletionBufferName(CompilerInstance &CI) {
+  auto *SF = CI.getCodeCompletionFile();
+  assert(SF->getBufferID());
+  return CI.getSourceMgr().getIdentifierForBuffer(*SF->getBufferID());
+}
+
 } // namespace
 
 bool CompletionInstance::performCachedOperationIfPossible(
@@ -332,14 +339,16 @@ bool CompletionInstance::performCachedOperationIfPossible(
   llvm::PrettyStackTraceString trace(
       "While performing cached completion if possible");
 
-  if (!CachedCI)
+  auto bufferName = completionBuffer->getBufferIdentifier();
+  auto *instance = findCachedInstance(bufferName);
+  if (!instance)
     return false;
-  if (CachedReuseCount >= Opts.MaxASTReuseCount)
+  if (instance->ReuseCount >= Opts.MaxASTReuseCount)
     return false;
-  if (CachedArgHash != ArgsHash)
+  if (instance->ArgHash != ArgsHash)
     return false;
 
-  auto &CI = *CachedCI;
+  auto &CI = *instance->CI;
   auto *oldSF = CI.getCodeCompletionFile();
   assert(oldSF->getBufferID());
 
@@ -348,16 +357,14 @@ bool CompletionInstance::performCachedOperationIfPossible(
   auto &oldInfo = oldState->getCodeCompletionDelayedDeclState();
 
   auto &SM = CI.getSourceMgr();
-  auto bufferName = completionBuffer->getBufferIdentifier();
-  if (SM.getIdentifierForBuffer(*oldSF->getBufferID()) != bufferName)
-    return false;
 
-  if (shouldCheckDependencies()) {
+  if (shouldCheckDependencies(*instance)) {
     if (areAnyDependentFilesInvalidated(
             CI, *FileSystem, *oldSF->getBufferID(),
-            DependencyCheckedTimestamp, InMemoryDependencyHash))
+            instance->DependencyCheckedTimestamp,
+            instance->InMemoryDependencyHash))
       return false;
-    DependencyCheckedTimestamp = std::chrono::system_clock::now();
+    instance->DependencyCheckedTimestamp = std::chrono::system_clock::now();
   }
 
   // Parse the new buffer into temporary SourceFile.
@@ -537,7 +544,8 @@ bool CompletionInstance::performCachedOperationIfPossible(
       CI.removeDiagnosticConsumer(DiagC);
   }
 
-  CachedReuseCount += 1;
+  instance->ReuseCount += 1;
+  touchCachedInstance(instance);
 
   return true;
 }
@@ -605,23 +613,51 @@ bool CompletionInstance::performNewOperation(
 
 void CompletionInstance::cacheCompilerInstance(
     std::unique_ptr<CompilerInstance> CI, llvm::hash_code ArgsHash) {
-  CachedCI = std::move(CI);
-  CachedArgHash = ArgsHash;
-  auto now = std::chrono::system_clock::now();
-  DependencyCheckedTimestamp = now;
-  CachedReuseCount = 0;
-  InMemoryDependencyHash.clear();
+  auto instance = std::make_unique<CachedInstance>();
+  instance->CI = std::move(CI);
+  instance->ArgHash = ArgsHash;
+  instance->DependencyCheckedTimestamp = std::chrono::system_clock::now();
   cacheDependencyHashIfNeeded(
-      *CachedCI,
-      CachedCI->getASTContext().SourceMgr.getCodeCompletionBufferID(),
-      InMemoryDependencyHash);
+      *instance->CI,
+      instance->CI->getASTContext().SourceMgr.getCodeCompletionBufferID(),
+      instance->InMemoryDependencyHash);
+
+  // Replace any instance already cached for the same file, then evict the
+  // least recently used instances until the pool fits the budget.
+  auto bufferName = getCompletionBufferName(*instance->CI);
+  InstancePool.erase(
+      std::remove_if(InstancePool.begin(), InstancePool.end(),
+                     [&](const std::unique_ptr<CachedInstance> &entry) {
+                       return getCompletionBufferName(*entry->CI) == bufferName;
+                     }),
+      InstancePool.end());
+  InstancePool.push_back(std::move(instance));
+  while (InstancePool.size() > Opts.MaxCachedCompilerInstances)
+    InstancePool.erase(InstancePool.begin());
+}
+
+CompletionInstance::CachedInstance *
+CompletionInstance::findCachedInstance(llvm::StringRef bufferName) {
+  for (auto &entry : InstancePool)
+    if (getCompletionBufferName(*entry->CI) == bufferName)
+      return entry.get();
+  return nullptr;
+}
+
+void CompletionInstance::touchCachedInstance(const CachedInstance *instance) {
+  auto it = std::find_if(InstancePool.begin(), InstancePool.end(),
+                         [&](const std::unique_ptr<CachedInstance> &entry) {
+                           return entry.get() == instance;
+                         });
+  assert(it != InstancePool.end() && "instance is not in the pool");
+  std::rotate(it, std::next(it), InstancePool.end());
 }
 
-bool CompletionInstance::shouldCheckDependencies() const {
-  assert(CachedCI);
+bool CompletionInstance::shouldCheckDependencies(
+    const CachedInstance &instance) const {
   using namespace std::chrono;
   auto now = system_clock::now();
-  auto threshold = DependencyCheckedTimestamp +
+  auto threshold = instance.DependencyCheckedTimestamp +
                    seconds(Opts.DependencyCheckIntervalSecond);
   return threshold < now;
 }
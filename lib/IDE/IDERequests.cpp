@@ -357,6 +357,47 @@ public:
   ResolvedRangeInfo resolve();
 };
 
+/// Compute the tokens that a range-info request over [Start, End] covers.
+/// Comments on either side of the selection do not participate in range
+/// resolution and are sliced away. Returns an empty array for an erroneous
+/// range.
+static ArrayRef<Token> getTokensInRange(SourceFile &File, SourceLoc Start,
+                                        SourceLoc End) {
+  if (Start.isInvalid() || End.isInvalid())
+    return ArrayRef<Token>();
+  auto AllTokens = File.getAllTokens();
+  // This points to the first token after or on the start loc.
+  auto StartIt = token_lower_bound(AllTokens, Start);
+
+  // Skip all the comments.
+  while(StartIt != AllTokens.end()) {
+    if (StartIt->getKind() != tok::comment)
+      break;
+    ++StartIt;
+  }
+
+  // Erroneous case.
+  if (StartIt == AllTokens.end())
+    return ArrayRef<Token>();
+
+  // This points to the first token after or on the end loc;
+  auto EndIt = token_lower_bound(AllTokens, End);
+
+  // Adjust end token to skip comments.
+  while (EndIt != AllTokens.begin()) {
+    EndIt --;
+    if (EndIt->getKind() != tok::comment)
+      break;
+  }
+
+  // Erroneous case.
+  if (EndIt < StartIt)
+    return ArrayRef<Token>();
+
+  unsigned StartIdx = StartIt - AllTokens.begin();
+  return AllTokens.slice(StartIdx, EndIt - StartIt + 1);
+}
+
 static bool hasUnhandledError(ArrayRef<ASTNode> Nodes) {
   class ThrowingEntityAnalyzer : public SourceEntityWalker {
     bool Throwing;
@@ -637,39 +678,11 @@ public:
 
   static std::unique_ptr<Implementation>
   createInstance(SourceFile &File, SourceLoc Start, SourceLoc End) {
-    if (Start.isInvalid() || End.isInvalid())
-      return nullptr;
-    auto AllTokens = File.getAllTokens();
-    // This points to the first token after or on the start loc.
-    auto StartIt = token_lower_bound(AllTokens, Start);
-
-    // Skip all the comments.
-    while(StartIt != AllTokens.end()) {
-      if (StartIt->getKind() != tok::comment)
-        break;
-      ++StartIt;
-    }
-
-    // Erroneous case.
-    if (StartIt == AllTokens.end())
-      return nullptr;
-
-    // This points to the first token after or on the end loc;
-    auto EndIt = token_lower_bound(AllTokens, End);
-
-    // Adjust end token to skip comments.
-    while (EndIt != AllTokens.begin()) {
-      EndIt --;
-      if (EndIt->getKind() != tok::comment)
-        break;
-    }
-
-    // Erroneous case.
-    if (EndIt < StartIt)
+    auto TokensInRange = getTokensInRange(File, Start, End);
+    if (TokensInRange.empty())
       return nullptr;
-    unsigned StartIdx = StartIt - AllTokens.begin();
     return std::unique_ptr<Implementation>(new Implementation(File,
-      AllTokens.slice(StartIdx, EndIt - StartIt + 1)));
+                                                              TokensInRange));
   }
 
   void analyzeDecl(Decl *D) {
@@ -1058,18 +1071,290 @@ void swift::simple_display(llvm::raw_ostream &out,
     << ELC.first << ":" << ELC.second << ")";
 }
 
+RangeInfoOwner::RangeInfoOwner(SourceFile *File, SourceLoc StartLoc,
+                               SourceLoc EndLoc):
+    File(File), StartLoc(StartLoc), EndLoc(EndLoc) {
+  // Normalize the range to the tokens it covers so that selections differing
+  // only in surrounding whitespace or comments share one cache entry.
+  if (!File || !File->shouldCollectTokens())
+    return;
+  auto Tokens = getTokensInRange(*File, StartLoc, EndLoc);
+  if (Tokens.empty())
+    return;
+  SourceManager &SM = File->getASTContext().SourceMgr;
+  this->StartLoc = Tokens.front().getLoc();
+  this->EndLoc = Lexer::getLocForEndOfToken(SM, Tokens.back().getLoc());
+}
+
 RangeInfoOwner::RangeInfoOwner(SourceFile *File, unsigned Offset,
-                               unsigned Length): File(File) {
+                               unsigned Length) {
   SourceManager &SM = File->getASTContext().SourceMgr;
   unsigned BufferId = File->getBufferID().getValue();
-  StartLoc = SM.getLocForOffset(BufferId, Offset);
-  EndLoc = SM.getLocForOffset(BufferId, Offset + Length);
+  *this = RangeInfoOwner(File, SM.getLocForOffset(BufferId, Offset),
+                         SM.getLocForOffset(BufferId, Offset + Length));
+}
+
+/// Walks down the path of nodes enclosing the given selection and returns
+/// the innermost brace statement containing both of its endpoints.
+class EnclosingBraceFinder : public SourceEntityWalker {
+  SourceManager &SM;
+  SourceLoc Start, End;
+  BraceStmt *InnermostBrace = nullptr;
+
+  bool containsSelection(SourceRange Range) {
+    if (Range.isInvalid())
+      return false;
+    return !SM.isBeforeInBuffer(Start, Range.Start) &&
+           !SM.isBeforeInBuffer(Range.End, End);
+  }
+
+  bool walkToExprPre(Expr *E) override {
+    return containsSelection(E->getSourceRange());
+  }
+  bool walkToStmtPre(Stmt *S) override {
+    if (!containsSelection(S->getSourceRange()))
+      return false;
+    if (auto *BS = dyn_cast<BraceStmt>(S))
+      InnermostBrace = BS;
+    return true;
+  }
+  bool walkToDeclPre(Decl *D, CharSourceRange Range) override {
+    return containsSelection(D->getSourceRange());
+  }
+
+public:
+  EnclosingBraceFinder(SourceManager &SM, SourceLoc Start, SourceLoc End):
+    SM(SM), Start(Start), End(End) {}
+
+  BraceStmt *getInnermostBrace() { return InnermostBrace; }
+};
+
+/// Collect the elements of \p Brace that the selection [Start, End] covers.
+/// Returns false unless the selection is exactly a sequence of two or more
+/// sibling elements, which is the shape whose analysis can be assembled from
+/// the analyses of its parts.
+static bool collectSelectedSiblings(SourceManager &SM, BraceStmt *Brace,
+                                    SourceLoc Start, SourceLoc End,
+                                    SmallVectorImpl<ASTNode> &Selected) {
+  for (ASTNode Node : Brace->getElements()) {
+    if (Node.isImplicit())
+      continue;
+    auto Range = Node.getSourceRange();
+    if (Range.isInvalid())
+      continue;
+    // Skip nodes entirely before or after the selection.
+    if (SM.isBeforeInBuffer(Range.End, Start) ||
+        SM.isBeforeInBuffer(End, Range.Start))
+      continue;
+    // The node overlaps the selection; it must be entirely inside it.
+    if (SM.isBeforeInBuffer(Range.Start, Start) ||
+        SM.isBeforeInBuffer(End, Range.End))
+      return false;
+    // A declaration's attributes take part in range matching; stay away from
+    // attributed declarations so that reuse agrees with full resolution.
+    if (auto *D = Node.dyn_cast<Decl*>())
+      if (D->getSourceRangeIncludingAttrs().Start != Range.Start)
+        return false;
+    // Skip nodes nested inside the previously collected one, e.g. the
+    // VarDecls belonging to a collected PatternBindingDecl.
+    if (!Selected.empty() &&
+        SM.rangeContains(Selected.back().getSourceRange(), Range))
+      continue;
+    Selected.push_back(Node);
+  }
+  if (Selected.size() < 2)
+    return false;
+  return Selected.front().getStartLoc() == Start &&
+         Selected.back().getEndLoc() == End;
+}
+
+/// Recompute which of \p Decls are referenced after \p End by walking the
+/// given decl context, mirroring what FurtherReferenceWalker does during full
+/// resolution.
+static void markReferencesAfterRange(std::vector<DeclaredDecl> &Decls,
+                                     DeclContext *DC, SourceManager &SM,
+                                     SourceLoc End) {
+  class AfterRangeReferenceWalker : public SourceEntityWalker {
+    std::vector<DeclaredDecl> &Decls;
+    SourceManager &SM;
+    SourceLoc End;
+    bool visitDeclReference(ValueDecl *D, CharSourceRange Range,
+                            TypeDecl *CtorTyRef, ExtensionDecl *ExtTyRef,
+                            Type T, ReferenceMetaData Data) override {
+      if (!SM.isBeforeInBuffer(End, Range.getStart()))
+        return true;
+      auto It = std::find(Decls.begin(), Decls.end(), D);
+      if (It != Decls.end())
+        It->ReferredAfterRange = true;
+      return true;
+    }
+  public:
+    AfterRangeReferenceWalker(std::vector<DeclaredDecl> &Decls,
+                              SourceManager &SM, SourceLoc End):
+      Decls(Decls), SM(SM), End(End) {}
+  };
+  AfterRangeReferenceWalker(Decls, SM, End).walk(DC);
+}
+
+/// Try to answer a range-info request by extending a previously computed
+/// result for a leading subrange of the selection.
+///
+/// Interactive clients commonly grow a selection one statement at a time,
+/// e.g. while previewing an extract-function refactoring, and each step used
+/// to re-analyze the whole selection from scratch. When the evaluator has
+/// already cached the result for a leading run of the selected statements,
+/// only the newly added trailing statements are resolved and the two results
+/// are merged.
+static Optional<ResolvedRangeInfo>
+tryReuseContainedRangeInfo(Evaluator &Eval, RangeInfoOwner CI) {
+  SourceFile *File = CI.File;
+  ASTContext &Ctx = File->getASTContext();
+  SourceManager &SM = Ctx.SourceMgr;
+  if (!File->shouldCollectTokens())
+    return None;
+
+  auto Tokens = getTokensInRange(*File, CI.StartLoc, CI.EndLoc);
+  if (Tokens.size() < 2)
+    return None;
+  SourceLoc Start = Tokens.front().getLoc();
+  SourceLoc End = Tokens.back().getLoc();
+
+  EnclosingBraceFinder Finder(SM, Start, End);
+  Finder.walk(*File);
+  BraceStmt *Brace = Finder.getInnermostBrace();
+  if (!Brace)
+    return None;
+
+  SmallVector<ASTNode, 8> Selected;
+  if (!collectSelectedSiblings(SM, Brace, Start, End, Selected))
+    return None;
+
+  // Find the longest leading subrange whose result is already cached.
+  Optional<ResolvedRangeInfo> Prefix;
+  unsigned NumPrefixNodes = 0;
+  for (unsigned i = Selected.size() - 1; i > 0; --i) {
+    SourceLoc PrefixEnd =
+        Lexer::getLocForEndOfToken(SM, Selected[i - 1].getEndLoc());
+    RangeInfoRequest Request(RangeInfoOwner(File, Start, PrefixEnd));
+    if (auto Cached = Eval.getCachedResult(Request)) {
+      Prefix = std::move(Cached);
+      NumPrefixNodes = i;
+      break;
+    }
+  }
+  if (!Prefix || !Prefix->RangeContext)
+    return None;
+  switch (Prefix->Kind) {
+  case RangeKind::SingleExpression:
+  case RangeKind::SingleStatement:
+  case RangeKind::SingleDecl:
+  case RangeKind::MultiStatement:
+    break;
+  case RangeKind::Invalid:
+  case RangeKind::PartOfExpression:
+  case RangeKind::MultiTypeMemberDecl:
+    return None;
+  }
+
+  // The cached result must describe exactly the leading statements.
+  if (Prefix->ContainedNodes.size() != NumPrefixNodes)
+    return None;
+  for (unsigned i = 0; i < NumPrefixNodes; ++i) {
+    if (Prefix->ContainedNodes[i].getOpaqueValue() !=
+        Selected[i].getOpaqueValue())
+      return None;
+  }
+
+  // Resolve the newly selected trailing statements. This request is cached
+  // in turn, so a sweep over a statement list analyzes each statement once.
+  SourceLoc SuffixStart = Selected[NumPrefixNodes].getStartLoc();
+  SourceLoc SuffixEnd = Lexer::getLocForEndOfToken(SM, End);
+  auto Suffix = evaluateOrDefault(Eval,
+    RangeInfoRequest(RangeInfoOwner(File, SuffixStart, SuffixEnd)),
+    ResolvedRangeInfo());
+  switch (Suffix.Kind) {
+  case RangeKind::SingleExpression:
+  case RangeKind::SingleStatement:
+  case RangeKind::SingleDecl:
+  case RangeKind::MultiStatement:
+    break;
+  case RangeKind::Invalid:
+  case RangeKind::PartOfExpression:
+  case RangeKind::MultiTypeMemberDecl:
+    return None;
+  }
+  if (Suffix.RangeContext != Prefix->RangeContext)
+    return None;
+  if (Suffix.ContainedNodes.size() != Selected.size() - NumPrefixNodes)
+    return None;
+  for (unsigned i = NumPrefixNodes; i < Selected.size(); ++i) {
+    if (Suffix.ContainedNodes[i - NumPrefixNodes].getOpaqueValue() !=
+        Selected[i].getOpaqueValue())
+      return None;
+  }
+
+  // The merged selection has the type of its last node. A trailing
+  // declaration or expression does not yield a value in a multi-statement
+  // selection.
+  ReturnInfo Exit = Suffix.ExitInfo;
+  if (Suffix.Kind == RangeKind::SingleExpression ||
+      Suffix.Kind == RangeKind::SingleDecl)
+    Exit = ReturnInfo(Ctx.getVoidDecl()->getDeclaredInterfaceType().getPointer(),
+                      ExitState::Negative);
+
+  std::vector<ASTNode> ContainedNodes(Prefix->ContainedNodes.begin(),
+                                      Prefix->ContainedNodes.end());
+  ContainedNodes.insert(ContainedNodes.end(), Suffix.ContainedNodes.begin(),
+                        Suffix.ContainedNodes.end());
+
+  // References to declarations in the leading statements may now resolve
+  // inside the extended range; recompute the referenced-after-range flags.
+  std::vector<DeclaredDecl> DeclaredDecls(Prefix->DeclaredDecls.begin(),
+                                          Prefix->DeclaredDecls.end());
+  for (auto D : Suffix.DeclaredDecls) {
+    if (std::find(DeclaredDecls.begin(), DeclaredDecls.end(), D) ==
+        DeclaredDecls.end())
+      DeclaredDecls.push_back(D);
+  }
+  for (auto &D : DeclaredDecls)
+    D.ReferredAfterRange = false;
+  markReferencesAfterRange(DeclaredDecls, Prefix->RangeContext, SM, End);
+
+  std::vector<ReferencedDecl> ReferencedDecls(Prefix->ReferencedDecls.begin(),
+                                              Prefix->ReferencedDecls.end());
+  for (auto &R : Suffix.ReferencedDecls) {
+    auto It = llvm::find_if(ReferencedDecls,
+                            [&](ReferencedDecl D) { return D.VD == R.VD; });
+    if (It == ReferencedDecls.end()) {
+      ReferencedDecls.push_back(R);
+    } else {
+      // LValue type should take precedence.
+      if (!It->Ty->hasLValueType() && R.Ty->hasLValueType()) {
+        It->Ty = R.Ty;
+      }
+    }
+  }
+
+  return ResolvedRangeInfo(RangeKind::MultiStatement, Exit, Tokens,
+                           Prefix->RangeContext,
+                           /*Common Parent Expr*/nullptr,
+                           Prefix->HasSingleEntry && Suffix.HasSingleEntry,
+                           Prefix->ThrowingUnhandledError ||
+                             Suffix.ThrowingUnhandledError,
+                           Prefix->Orphan != OrphanKind::None ? Prefix->Orphan
+                                                              : Suffix.Orphan,
+                           copyToContext(Ctx, llvm::makeArrayRef(ContainedNodes)),
+                           copyToContext(Ctx, llvm::makeArrayRef(DeclaredDecls)),
+                           copyToContext(Ctx,
+                                         llvm::makeArrayRef(ReferencedDecls)));
 }
 
 ide::ResolvedRangeInfo
 RangeInfoRequest::evaluate(Evaluator &eval, RangeInfoOwner CI) const {
   if (!CI.isValid())
     return ResolvedRangeInfo();
+  if (auto Reused = tryReuseContainedRangeInfo(eval, CI))
+    return Reused.getValue();
   return RangeResolver(*CI.File, CI.StartLoc, CI.EndLoc).resolve();
 }
 
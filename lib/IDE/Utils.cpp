@@ -11,12 +11,14 @@
 //===----------------------------------------------------------------------===//
 
 #include "swift/IDE/Utils.h"
+#include "swift/AST/SourceFile.h"
 #include "swift/Basic/Edit.h"
 #include "swift/Basic/SourceManager.h"
 #include "swift/Basic/Platform.h"
 #include "swift/ClangImporter/ClangModule.h"
 #include "swift/Driver/FrontendUtil.h"
 #include "swift/Frontend/Frontend.h"
+#include "swift/Parse/Lexer.h"
 #include "swift/Parse/Parser.h"
 #include "swift/Subsystems.h"
 #include "clang/AST/ASTContext.h"
@@ -265,7 +267,9 @@ public:
       break;
     }
     DiagnosticEngine::formatDiagnosticText(OS, Info.FormatString,
-                                           Info.FormatArgs);
+                                           Info.FormatArgs,
+                                           DiagnosticFormatOptions(),
+                                           Info.FormatCache);
   }
 };
 } // end anonymous namespace
@@ -1156,3 +1160,147 @@ std::pair<Type, ConcreteDeclRef> swift::ide::getReferencedDecl(Expr *expr) {
 
   return std::make_pair(exprTy, refDecl);
 }
+
+/// Returns true if re-lexing \p bodyText (the text from the opening '{' of a
+/// function body through its closing '}') still forms a single balanced
+/// braced block, i.e. the closing brace at the end still matches the opening
+/// brace. An edit that inserts an extra '}' closes the body early, and one
+/// that opens a string literal or comment over the closing brace extends it;
+/// either way the text following the body would parse differently.
+static bool isSingleBalancedBracedBlock(StringRef bodyText,
+                                        const LangOptions &langOpts) {
+  SourceManager tmpSM;
+  unsigned tmpBufferID = tmpSM.addMemBufferCopy(bodyText);
+  Lexer L(langOpts, tmpSM, tmpBufferID, /*Diags=*/nullptr, LexerMode::Swift);
+  Token Tok;
+  L.lex(Tok);
+  if (Tok.isNot(tok::l_brace))
+    return false;
+  unsigned depth = 1;
+  while (depth > 0) {
+    L.lex(Tok);
+    if (Tok.is(tok::eof))
+      return false;
+    if (Tok.is(tok::l_brace))
+      ++depth;
+    else if (Tok.is(tok::r_brace))
+      --depth;
+  }
+  L.lex(Tok);
+  return Tok.is(tok::eof);
+}
+
+/// Returns the outermost non-implicit function in \p D whose brace-enclosed
+/// body range contains the half-open offset range [\p editStart, \p editEnd)
+/// of \p bufferID, or \c nullptr if there is none. Only the outermost such
+/// function matters; any local function it contains is re-created when the
+/// containing body is re-parsed.
+static AbstractFunctionDecl *findEditedFunction(Decl *D, SourceManager &SM,
+                                                unsigned bufferID,
+                                                unsigned editStart,
+                                                unsigned editEnd) {
+  if (D->isImplicit())
+    return nullptr;
+
+  if (auto *AFD = dyn_cast<AbstractFunctionDecl>(D)) {
+    auto bodyRange = AFD->getBodySourceRange();
+    if (bodyRange.isInvalid() ||
+        SM.findBufferContainingLoc(bodyRange.Start) != bufferID)
+      return nullptr;
+    auto bodyStart = SM.getLocOffsetInBuffer(bodyRange.Start, bufferID);
+    auto bodyEnd = SM.getLocOffsetInBuffer(bodyRange.End, bufferID);
+    // The edit must lie strictly between the braces so that the body's own
+    // delimiters are untouched.
+    if (editStart > bodyStart && editEnd <= bodyEnd)
+      return AFD;
+    return nullptr;
+  }
+
+  if (auto *ASD = dyn_cast<AbstractStorageDecl>(D)) {
+    for (auto *accessor : ASD->getAllAccessors())
+      if (auto *found =
+              findEditedFunction(accessor, SM, bufferID, editStart, editEnd))
+        return found;
+    return nullptr;
+  }
+
+  if (auto *IDC = dyn_cast<IterableDeclContext>(D)) {
+    for (auto *member : IDC->getParsedMembers())
+      if (auto *found =
+              findEditedFunction(member, SM, bufferID, editStart, editEnd))
+        return found;
+  }
+
+  return nullptr;
+}
+
+AbstractFunctionDecl *
+swift::ide::reparseFunctionBodyForEdit(SourceFile &SF, StringRef editedText) {
+  auto bufferID = SF.getBufferID();
+  if (!bufferID)
+    return nullptr;
+  auto &Ctx = SF.getASTContext();
+  auto &SM = Ctx.SourceMgr;
+  StringRef oldText = SM.getEntireTextForBuffer(*bufferID);
+  if (oldText == editedText)
+    return nullptr;
+
+  // Locate the contiguous region that changed by trimming the common prefix
+  // and suffix. Offsets are relative to the old text; the half-open region
+  // may be empty for a pure insertion.
+  size_t minLen = std::min(oldText.size(), editedText.size());
+  size_t prefix = 0;
+  while (prefix < minLen && oldText[prefix] == editedText[prefix])
+    ++prefix;
+  size_t suffix = 0;
+  while (suffix < minLen - prefix &&
+         oldText[oldText.size() - 1 - suffix] ==
+             editedText[editedText.size() - 1 - suffix])
+    ++suffix;
+  unsigned editStart = prefix;
+  unsigned editEnd = oldText.size() - suffix;
+
+  AbstractFunctionDecl *AFD = nullptr;
+  for (auto *D : SF.getTopLevelDecls()) {
+    if ((AFD = findEditedFunction(D, SM, *bufferID, editStart, editEnd)))
+      break;
+  }
+  if (!AFD)
+    return nullptr;
+
+  auto bodyRange = AFD->getBodySourceRange();
+  auto bodyStart = SM.getLocOffsetInBuffer(bodyRange.Start, *bufferID);
+  auto bodyEnd = SM.getLocOffsetInBuffer(bodyRange.End, *bufferID);
+
+  // Everything from the end of the edit to the end of the buffer is common
+  // suffix, so the closing brace sits at the same distance from the end of
+  // the edited text.
+  unsigned newBodyEnd = bodyEnd + editedText.size() - oldText.size();
+  if (!isSingleBalancedBracedBlock(
+          editedText.slice(bodyStart, newBodyEnd + 1), Ctx.LangOpts))
+    return nullptr;
+
+  // Register a buffer holding the new body in the source manager. Slice it to
+  // the lines covering the body, and set the presumed file name and line
+  // offset so that diagnostic locations in the re-parsed body are reported
+  // against the original file.
+  auto sliceStartLoc = Lexer::getLocForStartOfLine(SM, bodyRange.Start);
+  auto sliceStart = SM.getLocOffsetInBuffer(sliceStartLoc, *bufferID);
+  auto sourceText = editedText.slice(sliceStart, newBodyEnd + 1);
+  unsigned newBufferID =
+      SM.addMemBufferCopy(sourceText, SM.getIdentifierForBuffer(*bufferID));
+  SM.openVirtualFile(SM.getLocForBufferStart(newBufferID),
+                     SM.getDisplayNameForLoc(sliceStartLoc),
+                     SM.getPresumedLineAndColumnForLoc(sliceStartLoc).first -
+                         1);
+
+  auto newBufferStart = SM.getRangeForBuffer(newBufferID).getStart();
+  SourceRange newBodyRange(
+      newBufferStart.getAdvancedLoc(bodyStart - sliceStart),
+      newBufferStart.getAdvancedLoc(newBodyEnd - sliceStart));
+  AFD->setBodyToBeReparsed(newBodyRange);
+  SM.setReplacedRange({AFD->getOriginalBodySourceRange(), newBodyRange});
+  SF.clearScope();
+
+  return AFD;
+}
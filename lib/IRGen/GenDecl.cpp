@@ -16,8 +16,10 @@
 //===----------------------------------------------------------------------===//
 
 #include "swift/AST/ASTContext.h"
+#include "swift/AST/ASTDemangler.h"
 #include "swift/AST/Decl.h"
 #include "swift/AST/DiagnosticEngine.h"
+#include "swift/AST/DiagnosticsIRGen.h"
 #include "swift/AST/GenericEnvironment.h"
 #include "swift/AST/GenericSignature.h"
 #include "swift/AST/IRGenOptions.h"
@@ -46,6 +48,7 @@
 #include "llvm/IR/Value.h"
 #include "llvm/Support/Compiler.h"
 #include "llvm/Support/ConvertUTF.h"
+#include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/SaveAndRestore.h"
 #include "llvm/Target/TargetMachine.h"
@@ -153,7 +156,9 @@ public:
 
     auto descriptor = emitObjCMethodDescriptorParts(IGM, method,
                                                     /*concrete*/true);
-    
+    // SILGen may have omitted the entry point under -enable-lazy-objc-thunks.
+    if (!descriptor.impl) return;
+
     // When generating JIT'd code, we need to call sel_registerName() to force
     // the runtime to unique the selector.
     llvm::Value *sel = Builder.CreateCall(IGM.getObjCSelRegisterNameFn(),
@@ -176,6 +181,7 @@ public:
     if (!requiresObjCMethodDescriptor(constructor)) return;
     auto descriptor = emitObjCMethodDescriptorParts(IGM, constructor,
                                                     /*concrete*/true);
+    if (!descriptor.impl) return;
 
     // When generating JIT'd code, we need to call sel_registerName() to force
     // the runtime to unique the selector.
@@ -208,6 +214,7 @@ public:
       return;
 
     auto descriptor = emitObjCGetterDescriptorParts(IGM, prop);
+    if (!descriptor.impl) return;
     // When generating JIT'd code, we need to call sel_registerName() to force
     // the runtime to unique the selector.
     llvm::Value *sel = Builder.CreateCall(IGM.getObjCSelRegisterNameFn(),
@@ -233,6 +240,7 @@ public:
     if (!requiresObjCSubscriptDescriptor(IGM, subscript)) return;
     
     auto descriptor = emitObjCGetterDescriptorParts(IGM, subscript);
+    if (!descriptor.impl) return;
     // When generating JIT'd code, we need to call sel_registerName() to force
     // the runtime to unique the selector.
     llvm::Value *sel = Builder.CreateCall(IGM.getObjCSelRegisterNameFn(),
@@ -1114,6 +1122,11 @@ void IRGenerator::emitGlobalTopLevel(
     IGM->emitSILDifferentiabilityWitness(&dw);
   }
 
+  // Enqueue metadata records for the specializations listed on the command
+  // line, so that emitLazyDefinitions picks them up along with the
+  // specializations noted during emission.
+  notePrespecializedGenericMetadataUses();
+
   // Emit code coverage mapping data for all modules
   for (auto Iter : *this) {
     IRGenModule *IGM = Iter.second;
@@ -1499,6 +1512,71 @@ void IRGenerator::noteUseOfSpecializedGenericTypeMetadata(
   }
 }
 
+void IRGenerator::notePrespecializedGenericMetadataUses() {
+  StringRef path = Opts.PrespecializeGenericMetadataListPath;
+  if (path.empty())
+    return;
+
+  auto &Ctx = SIL.getASTContext();
+  auto bufferOrErr = llvm::MemoryBuffer::getFile(path);
+  if (!bufferOrErr) {
+    Ctx.Diags.diagnose(SourceLoc(),
+                       diag::unable_to_load_prespecialization_list, path,
+                       bufferOrErr.getError().message());
+    return;
+  }
+
+  SmallVector<StringRef, 16> lines;
+  (*bufferOrErr)->getBuffer().split(lines, '\n', /*MaxSplit=*/-1,
+                                    /*KeepEmpty=*/false);
+  for (StringRef line : lines) {
+    auto name = line.trim();
+    if (name.empty() || name.startswith("#"))
+      continue;
+
+    auto type = Demangle::getTypeForMangling(Ctx, name);
+    if (!type) {
+      Ctx.Diags.diagnose(SourceLoc(), diag::type_to_prespecialize_not_found,
+                         name);
+      continue;
+    }
+
+    auto theType = type->getCanonicalType();
+    auto *nominal = theType->getAnyNominal();
+    if (!nominal || !nominal->isGenericContext() ||
+        !typeKindCanBePrespecialized(theType->getKind()) ||
+        theType->hasUnboundGenericType() || theType->hasArchetype() ||
+        theType->hasTypeParameter()) {
+      Ctx.Diags.diagnose(SourceLoc(), diag::type_cannot_be_prespecialized,
+                         name);
+      continue;
+    }
+
+    // A specialization of a type defined in this module can be emitted as the
+    // canonical metadata record for that specialization; any other must be
+    // emitted as a noncanonical record which the runtime uniques on first use.
+    CurrentIGMPtr IGM = getGenModule(nominal->getDeclContext());
+    TypeMetadataCanonicality canonicality;
+    bool addressable;
+    if (nominal->getModuleContext() == SIL.getSwiftModule()) {
+      canonicality = TypeMetadataCanonicality::Canonical;
+      addressable = isCanonicalInitializableTypeMetadataStaticallyAddressable(
+          *IGM.get(), theType);
+    } else {
+      canonicality = TypeMetadataCanonicality::Noncanonical;
+      addressable = isNoncanonicalCompleteTypeMetadataStaticallyAddressable(
+          *IGM.get(), theType);
+    }
+    if (!addressable) {
+      Ctx.Diags.diagnose(SourceLoc(), diag::type_cannot_be_prespecialized,
+                         name);
+      continue;
+    }
+
+    noteUseOfSpecializedGenericTypeMetadata(*IGM.get(), theType, canonicality);
+  }
+}
+
 void IRGenerator::noteUseOfOpaqueTypeDescriptor(OpaqueTypeDecl *opaque) {
   if (!opaque)
     return;
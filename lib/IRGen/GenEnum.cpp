@@ -6644,6 +6644,40 @@ MultiPayloadEnumImplStrategy::completeFixedLayout(TypeConverter &TC,
                                                   SILType Type,
                                                   EnumDecl *theEnum,
                                                   llvm::StructType *enumTy) {
+  // The layout computed here depends only on the lowered payload types, not
+  // on the IRGenModule performing the computation. In multi-threaded
+  // compilation each IGM lowers the enums it references itself, so share the
+  // result of the analysis across the IGMs instead of repeating it per LLVM
+  // module. Only the normal lowering mode is shared; the legacy and
+  // completely-fragile modes can produce different layouts for the same type.
+  bool shareLayout = TC.IGM.IRGen.hasMultipleIGMs() &&
+                     TC.getLoweringMode() == TypeConverter::Mode::Normal;
+  if (shareLayout) {
+    if (auto *cached = TC.IGM.IRGen.getFixedEnumLayout(Type.getASTType())) {
+      CommonSpareBits = cached->CommonSpareBits;
+      PayloadTagBits = cached->PayloadTagBits;
+      PayloadSize = cached->PayloadSizeInBytes;
+      NumEmptyElementTags = cached->NumEmptyElementTags;
+      ExtraTagBitCount = cached->ExtraTagBitCount;
+      NumExtraTagValues = cached->NumExtraTagValues;
+
+      // The LLVM type and the TypeInfo still have to be created per IGM.
+      setTaggedEnumBody(TC.IGM, enumTy, CommonSpareBits.size(),
+                        ExtraTagBitCount);
+      getFixedEnumTypeInfo(enumTy, cached->SizeWithTag, cached->SpareBits,
+                           cached->WorstAlignment,
+                           cached->POD ? IsPOD : IsNotPOD,
+                           cached->BT ? IsBitwiseTakable
+                                      : IsNotBitwiseTakable);
+      if (TIK >= Loadable &&
+          (CopyDestroyKind == Normal || CopyDestroyKind == BitwiseTakable)) {
+        computePayloadTypesAndTagType(TC.IGM, *TI, PayloadTypesAndTagType);
+        loweredType = Type;
+      }
+      return const_cast<TypeInfo *>(TI);
+    }
+  }
+
   // We need tags for each of the payload types, which we may be able to form
   // using spare bits, plus a minimal number of tags with which we can
   // represent the empty cases.
@@ -6794,6 +6828,23 @@ MultiPayloadEnumImplStrategy::completeFixedLayout(TypeConverter &TC,
   
   applyLayoutAttributes(TC.IGM, theEnum, /*fixed*/ true, worstAlignment);
 
+  // Record the layout for reuse by the other IGMs.
+  if (shareLayout) {
+    IRGenerator::FixedEnumLayout cached;
+    cached.CommonSpareBits = CommonSpareBits;
+    cached.PayloadTagBits = PayloadTagBits;
+    cached.SpareBits = spareBits;
+    cached.SizeWithTag = Size(sizeWithTag);
+    cached.WorstAlignment = worstAlignment;
+    cached.PayloadSizeInBytes = PayloadSize;
+    cached.NumEmptyElementTags = NumEmptyElementTags;
+    cached.ExtraTagBitCount = ExtraTagBitCount;
+    cached.NumExtraTagValues = NumExtraTagValues;
+    cached.POD = isPOD == IsPOD;
+    cached.BT = isBT == IsBitwiseTakable;
+    TC.IGM.IRGen.addFixedEnumLayout(Type.getASTType(), std::move(cached));
+  }
+
   getFixedEnumTypeInfo(enumTy, Size(sizeWithTag), std::move(spareBits),
                        worstAlignment, isPOD, isBT);
   if (TIK >= Loadable &&
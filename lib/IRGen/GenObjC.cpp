@@ -929,7 +929,14 @@ void irgen::emitObjCPartialApplication(IRGenFunction &IGF,
 static llvm::Constant *findSwiftAsObjCThunk(IRGenModule &IGM, SILDeclRef ref,
                                             SILFunction *&SILFn) {
   SILFn = IGM.getSILModule().lookUpFunction(ref);
-  assert(SILFn && "no IR function for swift-as-objc thunk");
+  if (!SILFn) {
+    // Under -enable-lazy-objc-thunks, SILGen omits the entry points of
+    // members it can show are only dispatched natively; the caller drops the
+    // corresponding method list entry.
+    assert(IGM.getSILModule().getOptions().LazyObjCThunks &&
+           "no IR function for swift-as-objc thunk");
+    return nullptr;
+  }
   auto fn = IGM.getAddrOfSILFunction(SILFn, NotForDefinition);
   ApplyIRLinkage(IRLinkage::Internal).to(fn);
   // Don't add the unnamed_addr attribute: in some places Foundation is
@@ -1373,6 +1380,10 @@ void irgen::emitObjCMethodDescriptor(IRGenModule &IGM,
                                      AbstractFunctionDecl *method) {
   ObjCMethodDescriptor descriptor(
     emitObjCMethodDescriptorParts(IGM, method, /*concrete*/ true));
+  // SILGen may have omitted the entry point under -enable-lazy-objc-thunks;
+  // if so, leave the method out of the list entirely.
+  if (!descriptor.impl)
+    return;
   emitObjCDescriptor(IGM, descriptors, descriptor);
 }
 
@@ -1429,6 +1440,8 @@ void irgen::emitObjCGetterDescriptor(IRGenModule &IGM,
                                      ConstantArrayBuilder &descriptors,
                                      AbstractStorageDecl *storage) {
   ObjCMethodDescriptor descriptor(emitObjCGetterDescriptorParts(IGM, storage));
+  if (!descriptor.impl)
+    return;
   emitObjCDescriptor(IGM, descriptors, descriptor);
 }
 
@@ -1436,6 +1449,8 @@ void irgen::emitObjCSetterDescriptor(IRGenModule &IGM,
                                      ConstantArrayBuilder &descriptors,
                                      AbstractStorageDecl *storage) {
   ObjCMethodDescriptor descriptor(emitObjCSetterDescriptorParts(IGM, storage));
+  if (!descriptor.impl)
+    return;
   emitObjCDescriptor(IGM, descriptors, descriptor);
 }
 
@@ -660,17 +660,58 @@ void irgen::emitInitializeArrayWithTakeBackToFrontCall(IRGenFunction &IGF,
                          {dest, src, count, metadata});
 }
 
+/// Emit a call to a copy-style value witness, preceded by an inline fast
+/// path for trivially-copyable values.
+///
+/// Unspecialized generic code frequently moves Int-like payloads through
+/// these witnesses, paying for an indirect call whose body is a small
+/// memcpy. Branching on the flags word and copying inline keeps trivial
+/// values out of the witness entirely; everything else falls back to the
+/// call. All four copy/take witnesses degenerate to a memcpy of 'size'
+/// bytes when the value is POD, so the one fast path serves each of them.
+static void emitCopyLikeCall(IRGenFunction &IGF, SILType T,
+                             Address destObject, Address srcObject,
+                             ValueWitness witness) {
+  llvm::Value *metadata;
+  auto copyFn = IGF.emitValueWitnessFunctionRef(T, metadata, witness);
+  auto dest = emitCastToOpaquePtr(IGF, destObject);
+  auto src = emitCastToOpaquePtr(IGF, srcObject);
+
+  if (IGF.optimizeForSize()) {
+    IGF.Builder.CreateCall(copyFn, {dest, src, metadata});
+    return;
+  }
+
+  auto *isPOD = emitLoadOfIsPOD(IGF, T);
+  auto *podBB = IGF.createBasicBlock("pod.copy");
+  auto *witnessBB = IGF.createBasicBlock("witness.copy");
+  auto *doneBB = IGF.createBasicBlock("done");
+  IGF.Builder.CreateCondBr(isPOD, podBB, witnessBB);
+
+  IGF.Builder.emitBlock(podBB);
+  {
+    auto *size = emitLoadOfSize(IGF, T);
+    IGF.Builder.CreateMemCpy(dest, llvm::MaybeAlign(1), src,
+                             llvm::MaybeAlign(1), size);
+    IGF.Builder.CreateBr(doneBB);
+  }
+
+  IGF.Builder.emitBlock(witnessBB);
+  {
+    IGF.Builder.CreateCall(copyFn, {dest, src, metadata});
+    IGF.Builder.CreateBr(doneBB);
+  }
+
+  IGF.Builder.emitBlock(doneBB);
+}
+
 /// Emit a call to do an 'assignWithCopy' operation.
 void irgen::emitAssignWithCopyCall(IRGenFunction &IGF,
                                    SILType T,
                                    Address destObject,
                                    Address srcObject) {
-  llvm::Value *metadata;
-  auto copyFn = IGF.emitValueWitnessFunctionRef(T, metadata,
-                                                ValueWitness::AssignWithCopy);
-  auto dest = emitCastToOpaquePtr(IGF, destObject);
-  auto src = emitCastToOpaquePtr(IGF, srcObject);
-  IGF.Builder.CreateCall(copyFn, {dest, src, metadata});
+  emitCopyLikeCall(IGF, T, destObject, srcObject,
+                   ValueWitness::AssignWithCopy);
 }
 
 /// Emit a call to do an 'assignWithCopy' operation.
@@ -727,12 +768,8 @@ void irgen::emitAssignWithTakeCall(IRGenFunction &IGF,
                                    SILType T,
                                    Address destObject,
                                    Address srcObject) {
-  llvm::Value *metadata;
-  auto copyFn = IGF.emitValueWitnessFunctionRef(T, metadata,
-                                                ValueWitness::AssignWithTake);
-  auto dest = emitCastToOpaquePtr(IGF, destObject);
-  auto src = emitCastToOpaquePtr(IGF, srcObject);
-  IGF.Builder.CreateCall(copyFn, {dest, src, metadata});
+  emitCopyLikeCall(IGF, T, destObject, srcObject,
+                   ValueWitness::AssignWithTake);
 }
 
 /// Emit a call to do an 'arrayAssignWithTake' operation.
@@ -984,12 +1021,7 @@ void irgen::emitInitializeWithCopyCall(IRGenFunction &IGF,
                                        SILType T,
                                        Address dest,
                                        Address src) {
-  llvm::Value *metadata;
-  auto fn = IGF.emitValueWitnessFunctionRef(T, metadata,
-                                            ValueWitness::InitializeWithCopy);
-  auto destPtr = emitCastToOpaquePtr(IGF, dest);
-  auto srcPtr = emitCastToOpaquePtr(IGF, src);
-  IGF.Builder.CreateCall(fn, {destPtr, srcPtr, metadata});
+  emitCopyLikeCall(IGF, T, dest, src, ValueWitness::InitializeWithCopy);
 }
 
 llvm::Value *irgen::emitInitializeWithCopyCall(IRGenFunction &IGF,
@@ -1010,12 +1042,7 @@ void irgen::emitInitializeWithTakeCall(IRGenFunction &IGF,
                                        SILType T,
                                        Address dest,
                                        Address src) {
-  llvm::Value *metadata;
-  auto fn = IGF.emitValueWitnessFunctionRef(T, metadata,
-                                            ValueWitness::InitializeWithTake);
-  auto destPtr = emitCastToOpaquePtr(IGF, dest);
-  auto srcPtr = emitCastToOpaquePtr(IGF, src);
-  IGF.Builder.CreateCall(fn, {destPtr, srcPtr, metadata});
+  emitCopyLikeCall(IGF, T, dest, src, ValueWitness::InitializeWithTake);
 }
 
 llvm::Value *irgen::emitInitializeWithTakeCall(IRGenFunction &IGF,
@@ -1042,7 +1069,24 @@ void irgen::emitDestroyCall(IRGenFunction &IGF,
   auto fn = IGF.emitValueWitnessFunctionRef(T, metadata,
                                             ValueWitness::Destroy);
   auto objectPtr = emitCastToOpaquePtr(IGF, object);
+
+  if (IGF.optimizeForSize()) {
+    IGF.Builder.CreateCall(fn, {objectPtr, metadata});
+    return;
+  }
+
+  // Dynamically-POD values (Int behind an archetype, say) have nothing to
+  // destroy; skip the witness call for them.
+  auto *isPOD = emitLoadOfIsPOD(IGF, T);
+  auto *witnessBB = IGF.createBasicBlock("witness.destroy");
+  auto *doneBB = IGF.createBasicBlock("done");
+  IGF.Builder.CreateCondBr(isPOD, doneBB, witnessBB);
+
+  IGF.Builder.emitBlock(witnessBB);
   IGF.Builder.CreateCall(fn, {objectPtr, metadata});
+  IGF.Builder.CreateBr(doneBB);
+
+  IGF.Builder.emitBlock(doneBB);
 }
 
 void irgen::emitDestroyCall(IRGenFunction &IGF, llvm::Value *metadata,
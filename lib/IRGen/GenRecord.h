@@ -209,6 +209,36 @@ public:
     }
   }
 
+  /// Should a copy of this record into uninitialized memory be emitted as a
+  /// single memcpy of the whole record, followed by fixups of just the
+  /// non-trivial fields? This pays off for large records whose bytes are
+  /// mostly trivial: the memcpy moves the trivial fields (and any padding) in
+  /// bulk, and only the non-trivial fields are visited individually. The
+  /// bytes of the non-trivial fields are copied twice, so require that the
+  /// trivial fields make up at least half of the record.
+  bool shouldCopyAsMemcpyWithFixups() const {
+    auto *fixedTI = dyn_cast<FixedTypeInfo>(this);
+    if (!fixedTI)
+      return false;
+
+    Size trivialBytes(0);
+    bool hasNonPODField = false;
+    for (auto &field : getFields()) {
+      if (field.isEmpty())
+        continue;
+      if (!field.isPOD()) {
+        hasNonPODField = true;
+        continue;
+      }
+      trivialBytes += cast<FixedTypeInfo>(field.getTypeInfo()).getFixedSize();
+    }
+    // All-POD records take the memcpy fast path anyway, and all-non-POD
+    // records would just copy every byte twice.
+    if (!hasNonPODField)
+      return false;
+    return trivialBytes.getValue() * 2 >= fixedTI->getFixedSize().getValue();
+  }
+
   void initializeWithCopy(IRGenFunction &IGF, Address dest, Address src,
                           SILType T, bool isOutlined) const override {
     // If we're POD, use the generic routine.
@@ -224,9 +254,19 @@ public:
     }
 
     if (isOutlined || T.hasOpenedExistential()) {
+      // For a mostly-trivial record, copy all the bytes in bulk and then
+      // initialize just the non-trivial fields on top of their bits.
+      bool bulkCopied = shouldCopyAsMemcpyWithFixups();
+      if (bulkCopied) {
+        IGF.Builder.CreateMemCpy(
+            dest.getAddress(), llvm::MaybeAlign(dest.getAlignment().getValue()),
+            src.getAddress(), llvm::MaybeAlign(src.getAlignment().getValue()),
+            asImpl().Impl::getSize(IGF, T));
+      }
+
       auto offsets = asImpl().getNonFixedOffsets(IGF, T);
       for (auto &field : getFields()) {
-        if (field.isEmpty())
+        if (field.isEmpty() || (bulkCopied && field.isPOD()))
           continue;
 
         Address destField = field.projectAddress(IGF, dest, offsets);
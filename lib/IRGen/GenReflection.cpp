@@ -1349,10 +1349,44 @@ void IRGenerator::emitBuiltinReflectionMetadata() {
   }
 }
 
+bool IRGenerator::hasReflectiveUses() {
+  if (!SILHasReflectiveUses.hasValue()) {
+    // The in-process consumers of field descriptors all funnel through a
+    // small set of standard library entry points. If the module never
+    // references Mirror, dump(_:), or String(reflecting:), field descriptors
+    // of its non-public types cannot be read at run time.
+    auto isReflective = [](StringRef name) {
+      return name.contains("s6MirrorV") || name.contains("s4dump") ||
+             name.contains("SS10reflecting");
+    };
+    bool found = false;
+    for (SILFunction &fn : SIL) {
+      if (isReflective(fn.getName())) {
+        found = true;
+        break;
+      }
+    }
+    SILHasReflectiveUses = found;
+  }
+  return *SILHasReflectiveUses;
+}
+
 void IRGenModule::emitFieldDescriptor(const NominalTypeDecl *D) {
   if (!IRGen.Opts.EnableReflectionMetadata)
     return;
 
+  // Under -strip-unused-reflection-metadata, skip the descriptors of types
+  // that no reflective operation can reach: non-public types, without the
+  // @_alwaysEmitReflectionMetadata opt-out, in a whole-module build that
+  // never calls into the reflection machinery. Remote reflection of such a
+  // process sees the affected types as opaque.
+  if (IRGen.Opts.StripUnusedReflectionMetadata &&
+      getSILModule().isWholeModule() &&
+      D->getEffectiveAccess() < AccessLevel::Public &&
+      !D->getAttrs().hasAttribute<AlwaysEmitReflectionMetadataAttr>() &&
+      !IRGen.hasReflectiveUses())
+    return;
+
   auto T = D->getDeclaredTypeInContext()->getCanonicalType();
 
   bool needsOpaqueDescriptor = false;
@@ -46,6 +46,7 @@
 #include "../Serialization/ModuleFormat.h"
 #include "clang/Basic/TargetInfo.h"
 #include "clang/Frontend/CompilerInstance.h"
+#include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/StringSet.h"
 #include "llvm/Analysis/AliasAnalysis.h"
 #include "llvm/Bitcode/BitcodeWriter.h"
@@ -69,6 +70,7 @@
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/FormattedStream.h"
 #include "llvm/Support/MD5.h"
+#include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Mutex.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/TargetRegistry.h"
@@ -481,6 +483,68 @@ diagnoseSync(DiagnosticEngine &Diags, llvm::sys::Mutex *DiagMutex,
     DiagMutex->unlock();
 }
 
+/// Reorder the module's function list according to the order file named by
+/// \c Opts.FunctionOrderFile, if any.
+///
+/// The order file lists one mangled symbol per line; blank lines and lines
+/// starting with '#' are ignored. Functions named in the file are moved to
+/// the front of the function list in the listed order, which is the order the
+/// backend emits them in, so a first-use trace recorded at runtime can be
+/// replayed as a startup-friendly text layout. Symbols that don't name a
+/// definition in this module are silently ignored; with multi-threaded
+/// compilation each partition picks out its own subset of the order.
+///
+/// Returns true on error.
+static bool applyFunctionOrder(const IRGenOptions &Opts,
+                               DiagnosticEngine &Diags,
+                               llvm::sys::Mutex *DiagMutex,
+                               llvm::Module &Module) {
+  if (Opts.FunctionOrderFile.empty())
+    return false;
+
+  auto orderFileOrErr = llvm::MemoryBuffer::getFile(Opts.FunctionOrderFile);
+  if (!orderFileOrErr) {
+    diagnoseSync(Diags, DiagMutex, SourceLoc(),
+                 diag::unable_to_load_function_order_file,
+                 Opts.FunctionOrderFile, orderFileOrErr.getError().message());
+    return true;
+  }
+
+  llvm::StringMap<unsigned> rank;
+  SmallVector<StringRef, 64> lines;
+  (*orderFileOrErr)->getBuffer().split(lines, '\n', /*MaxSplit=*/-1,
+                                       /*KeepEmpty=*/false);
+  for (StringRef line : lines) {
+    line = line.trim();
+    if (line.empty() || line.startswith("#"))
+      continue;
+    // The first occurrence of a symbol wins.
+    rank.try_emplace(line, rank.size());
+  }
+  if (rank.empty())
+    return false;
+
+  std::vector<llvm::Function *> ordered(rank.size(), nullptr);
+  for (llvm::Function &F : Module) {
+    if (F.isDeclaration())
+      continue;
+    auto entry = rank.find(F.getName());
+    if (entry != rank.end())
+      ordered[entry->second] = &F;
+  }
+
+  // Splice the matched functions to the front, last first, so that the
+  // resulting list starts with the functions in order-file order and the
+  // relative order of everything else is untouched.
+  for (llvm::Function *F : llvm::reverse(ordered)) {
+    if (!F)
+      continue;
+    F->removeFromParent();
+    Module.getFunctionList().push_front(F);
+  }
+  return false;
+}
+
 /// Run the LLVM passes. In multi-threaded compilation this will be done for
 /// multiple LLVM modules in parallel.
 bool swift::performLLVM(const IRGenOptions &Opts,
@@ -541,6 +605,11 @@ bool swift::performLLVM(const IRGenOptions &Opts,
 
   performLLVMOptimizations(Opts, Module, TargetMachine);
 
+  // Apply any requested function order after the optimizer so that the
+  // layout it establishes is the one the backend actually emits.
+  if (applyFunctionOrder(Opts, Diags, DiagMutex, *Module))
+    return true;
+
   if (Stats) {
     if (DiagMutex)
       DiagMutex->lock();
@@ -1596,9 +1596,21 @@ IRGenModule *IRGenerator::getGenModule(SILFunction *f) {
     return found->second;
 
   if (auto *dc = f->getDeclContext())
-    return getGenModule(dc);
-
-  return getPrimaryIGM();
+    if (dc->getParentSourceFile())
+      return getGenModule(dc);
+
+  // The function is not anchored to any source file, so any IGM can host it.
+  // This is the case for e.g. deserialized inlinable functions and
+  // specializations of them. Distribute such functions round-robin over all
+  // IGMs instead of lumping them into the primary one: each IGM is compiled
+  // on its own thread, and the primary module would otherwise dominate the
+  // critical path of a multi-threaded compilation.
+  // The assignment is remembered so that all references to the function
+  // agree on its home module.
+  IRGenModule *IGM = Queue[NextRoundRobinIGM];
+  NextRoundRobinIGM = (NextRoundRobinIGM + 1) % Queue.size();
+  DefaultIGMForFunction.insert(std::make_pair(f, IGM));
+  return IGM;
 }
 
 uint32_t swift::irgen::getSwiftABIVersion() {
@@ -225,6 +225,33 @@ private:
   // chances of function merging.
   llvm::DenseMap<const SILFunction *, IRGenModule *> IGMForSpecializations;
 
+public:
+  /// The IGM-independent result of laying out a fixed multi-payload enum:
+  /// the spare-bit analysis over the payloads and the tag assignment derived
+  /// from it. None of these values refer to an LLVMContext, so a layout
+  /// computed by one IGM can be reused by all others.
+  struct FixedEnumLayout {
+    ClusteredBitVector CommonSpareBits;
+    ClusteredBitVector PayloadTagBits;
+    SpareBitVector SpareBits;
+    Size SizeWithTag = Size(0);
+    Alignment WorstAlignment = Alignment(1);
+    unsigned PayloadSizeInBytes = 0;
+    unsigned NumEmptyElementTags = 0;
+    unsigned ExtraTagBitCount = 0;
+    unsigned NumExtraTagValues = 0;
+    bool POD = false;
+    bool BT = false;
+  };
+
+private:
+  /// Multi-payload enum layouts computed in the normal lowering mode, keyed
+  /// by the enum's canonical type. Each IGM lowers the types it references
+  /// itself, so without this cache the (potentially expensive) spare-bit
+  /// analysis for an enum would be repeated once per LLVM module in
+  /// multi-threaded compilation.
+  llvm::DenseMap<TypeBase *, FixedEnumLayout> FixedEnumLayouts;
+
   // The IGM of the first source file.
   IRGenModule *PrimaryIGM = nullptr;
 
@@ -326,7 +353,16 @@ private:
   SmallVector<IRGenModule *, 8> Queue;
 
   std::atomic<int> QueueIndex;
-  
+
+  /// The next IGM to use when a function has no anchor that determines its
+  /// placement. Used to spread such functions evenly over all LLVM modules.
+  unsigned NextRoundRobinIGM = 0;
+
+  /// Lazily computed by hasReflectiveUses(): whether the SIL module
+  /// references any standard library entry point that consumes field
+  /// descriptors at run time.
+  Optional<bool> SILHasReflectiveUses;
+
   friend class CurrentIGMPtr;  
 public:
   explicit IRGenerator(const IRGenOptions &opts, SILModule &module);
@@ -375,7 +411,28 @@ public:
   }
   
   bool hasMultipleIGMs() const { return GenModules.size() >= 2; }
-  
+
+  /// Returns true if the SIL module references any standard library entry
+  /// point that consumes field descriptors at run time, such as Mirror,
+  /// dump(_:), or String(reflecting:). The answer is computed once and
+  /// cached; it drives -strip-unused-reflection-metadata.
+  bool hasReflectiveUses();
+
+  /// Return the cached layout for the fixed multi-payload enum \p type, or
+  /// null if no IGM has computed it yet.
+  const FixedEnumLayout *getFixedEnumLayout(CanType type) const {
+    auto found = FixedEnumLayouts.find(type.getPointer());
+    if (found == FixedEnumLayouts.end())
+      return nullptr;
+    return &found->second;
+  }
+
+  /// Record the layout of the fixed multi-payload enum \p type so that other
+  /// IGMs can reuse it.
+  void addFixedEnumLayout(CanType type, FixedEnumLayout layout) {
+    FixedEnumLayouts.insert({type.getPointer(), std::move(layout)});
+  }
+
   llvm::DenseMap<SourceFile *, IRGenModule *>::iterator begin() {
     return GenModules.begin();
   }
@@ -388,6 +445,13 @@ public:
   /// they are externally visible.
   void emitGlobalTopLevel(const std::vector<std::string> &LinkerDirectives);
 
+  /// Enqueue prespecialized metadata records for the generic type
+  /// specializations listed in the file given by
+  /// -prespecialize-generic-metadata-list=, so that requests for their
+  /// metadata can be answered from constant records instead of populating
+  /// the runtime's metadata cache on first use.
+  void notePrespecializedGenericMetadataUses();
+
   /// Emit references to each of the protocol descriptors defined in this
   /// IR module.
   void emitSwiftProtocols();
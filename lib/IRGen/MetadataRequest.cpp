@@ -1008,6 +1008,30 @@ bool irgen::shouldCacheTypeMetadataAccess(IRGenModule &IGM, CanType type) {
   return true;
 }
 
+/// Is the given class's complete metadata available at a fixed address, with
+/// no realization step on first access?
+///
+/// Fixed-strategy class metadata is emitted statically complete; the only
+/// work left for the accessor is idempotent realization with the Objective-C
+/// runtime. Without ObjC interop there is no such step, so a direct
+/// reference to the metadata symbol is as good as a call to the accessor.
+static bool isFixedClassMetadataDirectlyAddressable(IRGenModule &IGM,
+                                                    CanType type) {
+  auto classType = dyn_cast<ClassType>(type);
+  if (!classType)
+    return false;
+
+  if (IGM.ObjCInterop)
+    return false;
+
+  auto *classDecl = classType->getDecl();
+  if (!hasKnownSwiftMetadata(IGM, classDecl))
+    return false;
+
+  return IGM.getClassMetadataStrategy(classDecl) ==
+         ClassMetadataStrategy::Fixed;
+}
+
 /// Should requests for the given type's metadata go through an accessor?
 static bool shouldTypeMetadataAccessUseAccessor(IRGenModule &IGM, CanType type){
   // Anything that requires caching should go through an accessor to outline
@@ -1015,12 +1039,12 @@ static bool shouldTypeMetadataAccessUseAccessor(IRGenModule &IGM, CanType type){
   if (shouldCacheTypeMetadataAccess(IGM, type))
     return true;
   
-  // Fixed-metadata classes don't require caching, but we still want to go
-  // through the accessor to outline the ObjC realization.
-  // TODO: On non-Apple platforms, fixed classes should not need any
-  // initialization so should be directly addressable.
+  // Fixed-metadata classes don't require caching, but with ObjC interop we
+  // still want to go through the accessor to outline the ObjC realization.
+  // Elsewhere fixed classes need no initialization at all and are directly
+  // addressable.
   if (isa<ClassType>(type)) {
-    return true;
+    return !isFixedClassMetadataDirectlyAddressable(IGM, type);
   }
   
   return false;
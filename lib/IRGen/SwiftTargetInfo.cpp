@@ -167,6 +167,10 @@ SwiftTargetInfo SwiftTargetInfo::get(IRGenModule &IGM) {
   // which exposes a barrier-free inline path with -1 as the "done" value.
   if (triple.isOSDarwin())
     target.OnceDonePredicateValue = -1L;
+  // On Linux, the runtime's futex-based swift_once publishes the same -1
+  // "done" value, so the inline fast path applies there as well.
+  else if (triple.isOSLinux())
+    target.OnceDonePredicateValue = -1L;
   // Other platforms use std::call_once() and we don't
   // assume that they have a barrier-free inline fast path.
   
@@ -25,17 +25,23 @@
 #include "swift/AST/IRGenRequests.h"
 #include "swift/AST/Module.h"
 #include "swift/Basic/LLVM.h"
+#include "swift/Basic/Version.h"
 #include "swift/Frontend/Frontend.h"
 #include "swift/IRGen/IRGenPublic.h"
 #include "swift/SILOptimizer/PassManager/Passes.h"
 #include "llvm/ADT/SmallString.h"
+#include "llvm/Bitcode/BitcodeWriter.h"
 #include "llvm/Config/config.h"
+#include "llvm/ExecutionEngine/ObjectCache.h"
+#include "llvm/ExecutionEngine/Orc/CompileUtils.h"
 #include "llvm/ExecutionEngine/Orc/DebugUtils.h"
 #include "llvm/ExecutionEngine/Orc/JITTargetMachineBuilder.h"
 #include "llvm/ExecutionEngine/Orc/LLJIT.h"
 #include "llvm/IR/LLVMContext.h"
 #include "llvm/Transforms/IPO.h"
 #include "llvm/Transforms/IPO/PassManagerBuilder.h"
+#include "llvm/Support/FileUtilities.h"
+#include "llvm/Support/MD5.h"
 #include "llvm/Support/Path.h"
 
 #define DEBUG_TYPE "swift-immediate"
@@ -76,6 +82,67 @@ static void *loadRuntimeLib(StringRef sharedLibName,
   return nullptr;
 }
 
+namespace {
+/// An object cache that persists JITed objects on disk across runs.
+///
+/// Objects are keyed by a hash of the module's bitcode, the target
+/// configuration and the compiler version, so any change to the script, the
+/// compilation options or the compiler falls back to normal compilation.
+/// Cache misses and I/O failures are not errors; they only cost the
+/// compilation that would have happened anyway.
+class PersistentJITObjectCache : public llvm::ObjectCache {
+  std::string CacheDir;
+  std::string TargetConfig;
+
+  std::string getCachePath(const llvm::Module &M) {
+    llvm::MD5 Hash;
+    {
+      llvm::SmallVector<char, 0> Bitcode;
+      llvm::raw_svector_ostream OS(Bitcode);
+      llvm::WriteBitcodeToFile(M, OS);
+      Hash.update(StringRef(Bitcode.data(), Bitcode.size()));
+    }
+    Hash.update(TargetConfig);
+    Hash.update(version::getSwiftFullVersion());
+    llvm::MD5::MD5Result Result;
+    Hash.final(Result);
+    llvm::SmallString<32> Digest;
+    llvm::MD5::stringifyResult(Result, Digest);
+
+    llvm::SmallString<128> Path(CacheDir);
+    llvm::sys::path::append(Path, llvm::Twine(M.getName()) + "-" + Digest +
+                                      ".o");
+    return std::string(Path.str());
+  }
+
+public:
+  PersistentJITObjectCache(StringRef CacheDir, StringRef TargetConfig)
+      : CacheDir(CacheDir), TargetConfig(TargetConfig) {}
+
+  void notifyObjectCompiled(const llvm::Module *M,
+                            llvm::MemoryBufferRef Obj) override {
+    if (llvm::sys::fs::create_directories(CacheDir))
+      return;
+    auto Path = getCachePath(*M);
+    // Write atomically; concurrent runs of the same script race to produce
+    // identical objects and either one may win.
+    if (auto Err = llvm::writeFileAtomically(Path + "-%%%%%%%%", Path,
+                                             Obj.getBuffer()))
+      llvm::consumeError(std::move(Err));
+  }
+
+  std::unique_ptr<llvm::MemoryBuffer>
+  getObject(const llvm::Module *M) override {
+    auto BufOrErr = llvm::MemoryBuffer::getFile(getCachePath(*M));
+    if (!BufOrErr)
+      return nullptr;
+    LLVM_DEBUG(llvm::dbgs() << "Loading cached object for module "
+                            << M->getName() << "\n");
+    return std::move(*BufOrErr);
+  }
+};
+} // end anonymous namespace
+
 static void DumpLLVMIR(const llvm::Module &M) {
   std::string path = (M.getName() + ".ll").str();
   for (size_t count = 0; llvm::sys::fs::exists(path); )
@@ -281,19 +348,43 @@ int swift::RunImmediately(CompilerInstance &CI,
   std::tie(TargetOpt, CPU, Features, Triple)
     = getIRTargetOptions(IRGenOpts, swiftModule->getASTContext());
 
+  // Set up the on-disk object cache if one was requested. It must outlive
+  // the JIT, which holds a pointer to it.
+  std::unique_ptr<PersistentJITObjectCache> ObjCache;
+  if (!IRGenOpts.JITObjectCachePath.empty()) {
+    std::string TargetConfig = Triple + ";" + CPU;
+    for (auto &Feature : Features) {
+      TargetConfig += ";";
+      TargetConfig += Feature;
+    }
+    ObjCache = std::make_unique<PersistentJITObjectCache>(
+        IRGenOpts.JITObjectCachePath, TargetConfig);
+  }
+
   std::unique_ptr<llvm::orc::LLJIT> JIT;
 
   {
-    auto JITOrErr =
-      llvm::orc::LLJITBuilder()
-        .setJITTargetMachineBuilder(
-            llvm::orc::JITTargetMachineBuilder(llvm::Triple(Triple))
-              .setRelocationModel(llvm::Reloc::PIC_)
-              .setOptions(std::move(TargetOpt))
-              .setCPU(std::move(CPU))
-              .addFeatures(Features)
-              .setCodeGenOptLevel(llvm::CodeGenOpt::Default))
-        .create();
+    llvm::orc::LLJITBuilder Builder;
+    Builder.setJITTargetMachineBuilder(
+        llvm::orc::JITTargetMachineBuilder(llvm::Triple(Triple))
+          .setRelocationModel(llvm::Reloc::PIC_)
+          .setOptions(std::move(TargetOpt))
+          .setCPU(std::move(CPU))
+          .addFeatures(Features)
+          .setCodeGenOptLevel(llvm::CodeGenOpt::Default));
+    if (ObjCache) {
+      Builder.setCompileFunctionCreator(
+          [&ObjCache](llvm::orc::JITTargetMachineBuilder JTMB)
+              -> llvm::Expected<
+                  std::unique_ptr<llvm::orc::IRCompileLayer::IRCompiler>> {
+            auto TM = JTMB.createTargetMachine();
+            if (!TM)
+              return TM.takeError();
+            return std::make_unique<llvm::orc::TMOwningSimpleCompiler>(
+                std::move(*TM), ObjCache.get());
+          });
+    }
+    auto JITOrErr = Builder.create();
 
     if (!JITOrErr) {
       llvm::logAllUnhandledErrors(JITOrErr.takeError(), llvm::errs(), "");
@@ -608,6 +608,18 @@ private:
   }
 
   bool shouldIndex(ValueDecl *D, bool IsRef) const {
+    // The classification below walks the decl's context and name and is
+    // queried once per occurrence; memoize it since a popular symbol is
+    // referenced many times within a file.
+    auto cached = shouldIndexCache.find({D, IsRef});
+    if (cached != shouldIndexCache.end())
+      return cached->second;
+    bool result = shouldIndexImpl(D, IsRef);
+    shouldIndexCache[{D, IsRef}] = result;
+    return result;
+  }
+
+  bool shouldIndexImpl(ValueDecl *D, bool IsRef) const {
     if (D->isImplicit() && isa<VarDecl>(D) && IsRef) {
       // Bypass the implicit VarDecls introduced in CaseStmt bodies by using the
       // canonical VarDecl for these checks instead.
@@ -657,6 +669,10 @@ private:
 
   // This maps a module to all its imports, recursively.
   llvm::DenseMap<ModuleDecl *, llvm::SmallVector<ModuleDecl *, 4>> ImportsMap;
+
+  // Memoized results of \c shouldIndex, keyed by (decl, isRef).
+  mutable llvm::DenseMap<llvm::PointerIntPair<ValueDecl *, 1, bool>, bool>
+      shouldIndexCache;
 };
 } // anonymous namespace
 
@@ -34,6 +34,7 @@
 #include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/DenseSet.h"
 #include "llvm/ADT/SetVector.h"
+#include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/Statistic.h"
 #include "llvm/ADT/StringSwitch.h"
 #include "llvm/ADT/TinyPtrVector.h"
@@ -67,6 +68,15 @@ DisableARCOpts("disable-llvm-arc-opts", llvm::cl::init(false));
 //                          Input Function Canonicalizer
 //===----------------------------------------------------------------------===//
 
+/// isKnownImmortal - Returns true if the object is known to never be
+/// deallocated because it is statically allocated. The runtime initializes
+/// the reference count of statically-allocated objects with the immortal bit
+/// set (see swift_initStaticObject), so retaining or releasing them is a
+/// no-op. At the IR level such objects are addresses of global variables.
+static bool isKnownImmortal(Value *V) {
+  return isa<GlobalVariable>(V->stripPointerCasts());
+}
+
 /// canonicalizeInputFunction - Functions like swift_retain return an
 /// argument as a low-level performance optimization.  This makes it difficult
 /// to reason about pointer equality though, so undo it as an initial
@@ -109,8 +119,8 @@ static bool canonicalizeInputFunction(Function &F, ARCEntryPointBuilder &B,
       case RT_Retain: {
         CallInst &CI = cast<CallInst>(Inst);
         Value *ArgVal = RC->getSwiftRCIdentityRoot(CI.getArgOperand(0));
-        // retain(null) is a no-op.
-        if (isa<ConstantPointerNull>(ArgVal)) {
+        // retain(null) is a no-op, and so is a retain of an immortal object.
+        if (isa<ConstantPointerNull>(ArgVal) || isKnownImmortal(ArgVal)) {
           CI.eraseFromParent();
           Changed = true;
           ++NumNoopDeleted;
@@ -131,8 +141,9 @@ static bool canonicalizeInputFunction(Function &F, ARCEntryPointBuilder &B,
       case RT_UnknownObjectRetain: {
         CallInst &CI = cast<CallInst>(Inst);
         Value *ArgVal = RC->getSwiftRCIdentityRoot(CI.getArgOperand(0));
-        // unknownObjectRetain(null) is a no-op.
-        if (isa<ConstantPointerNull>(ArgVal)) {
+        // unknownObjectRetain(null) is a no-op, and so is an
+        // unknownObjectRetain of an immortal object.
+        if (isa<ConstantPointerNull>(ArgVal) || isKnownImmortal(ArgVal)) {
           CI.eraseFromParent();
           Changed = true;
           ++NumNoopDeleted;
@@ -156,8 +167,9 @@ static bool canonicalizeInputFunction(Function &F, ARCEntryPointBuilder &B,
       case RT_Release: {
         CallInst &CI = cast<CallInst>(Inst);
         Value *ArgVal = RC->getSwiftRCIdentityRoot(CI.getArgOperand(0));
-        // release(null) is a no-op.
-        if (isa<ConstantPointerNull>(ArgVal)) {
+        // release(null) is a no-op, and so is a release of an immortal
+        // object.
+        if (isa<ConstantPointerNull>(ArgVal) || isKnownImmortal(ArgVal)) {
           CI.eraseFromParent();
           Changed = true;
           ++NumNoopDeleted;
@@ -178,8 +190,9 @@ static bool canonicalizeInputFunction(Function &F, ARCEntryPointBuilder &B,
       case RT_UnknownObjectRelease: {
         CallInst &CI = cast<CallInst>(Inst);
         Value *ArgVal = RC->getSwiftRCIdentityRoot(CI.getArgOperand(0));
-        // unknownObjectRelease(null) is a no-op.
-        if (isa<ConstantPointerNull>(ArgVal)) {
+        // unknownObjectRelease(null) is a no-op, and so is an
+        // unknownObjectRelease of an immortal object.
+        if (isa<ConstantPointerNull>(ArgVal) || isKnownImmortal(ArgVal)) {
           CI.eraseFromParent();
           Changed = true;
           ++NumNoopDeleted;
@@ -203,8 +216,9 @@ static bool canonicalizeInputFunction(Function &F, ARCEntryPointBuilder &B,
       case RT_ObjCRelease: {
         CallInst &CI = cast<CallInst>(Inst);
         Value *ArgVal = RC->getSwiftRCIdentityRoot(CI.getArgOperand(0));
-        // objc_release(null) is a noop, zap it.
-        if (isa<ConstantPointerNull>(ArgVal)) {
+        // objc_release(null) is a noop, zap it. So is an objc_release of a
+        // statically-allocated object, such as a constant string.
+        if (isa<ConstantPointerNull>(ArgVal) || isKnownImmortal(ArgVal)) {
           CI.eraseFromParent();
           Changed = true;
           ++NumNoopDeleted;
@@ -228,7 +242,8 @@ static bool canonicalizeInputFunction(Function &F, ARCEntryPointBuilder &B,
         }
 
         // {objc_retain,swift_unknownObjectRetain}(null) is a noop, delete it.
-        if (isa<ConstantPointerNull>(ArgVal)) {
+        // Retains of immortal objects are no-ops as well.
+        if (isa<ConstantPointerNull>(ArgVal) || isKnownImmortal(ArgVal)) {
           CI.eraseFromParent();
           Changed = true;
           ++NumNoopDeleted;
@@ -251,8 +266,16 @@ static bool canonicalizeInputFunction(Function &F, ARCEntryPointBuilder &B,
 /// moving it earlier in the function if possible, over instructions that do not
 /// access the released object.  If we get to a retain or allocation of the
 /// object, zap both.
+///
+/// If the scan reaches the top of the block and the block has a unique
+/// predecessor that unconditionally branches to it, the release is hoisted
+/// into the predecessor and the scan continues there. LLVM inlining commonly
+/// leaves a retain and its release in different blocks of such chains, which
+/// the SIL optimizer never saw together. \p VisitedBBs prevents the scan from
+/// cycling through a loop.
 static bool performLocalReleaseMotion(CallInst &Release, BasicBlock &BB,
-                                      SwiftRCIdentity *RC) {
+                                      SwiftRCIdentity *RC,
+                                      SmallPtrSetImpl<BasicBlock *> &VisitedBBs) {
   // FIXME: Call classifier should identify the object for us.  Too bad C++
   // doesn't have nice Swift-style enums.
   Value *ReleasedObject = RC->getSwiftRCIdentityRoot(Release.getArgOperand(0));
@@ -381,6 +404,20 @@ static bool performLocalReleaseMotion(CallInst &Release, BasicBlock &BB,
   }
 OutOfLoop:
 
+  // If the scan reached the top of the block without being stopped and the
+  // block has a unique predecessor that unconditionally branches here, the
+  // release runs on exactly the executions that run the predecessor's
+  // terminator, so the scan can continue there.
+  if (BBI == BB.begin()) {
+    if (auto *Pred = BB.getUniquePredecessor()) {
+      auto *Br = dyn_cast<BranchInst>(Pred->getTerminator());
+      if (Br && Br->isUnconditional() && VisitedBBs.insert(Pred).second) {
+        Release.moveBefore(Br);
+        performLocalReleaseMotion(Release, *Pred, RC, VisitedBBs);
+        return true;
+      }
+    }
+  }
 
   // If we got to the top of the block, (and if the instruction didn't start
   // there) move the release to the top of the block.
@@ -404,8 +441,14 @@ OutOfLoop:
 ///
 /// NOTE: this handles both objc_retain and swift_retain.
 ///
+/// If the scan reaches the terminator and it unconditionally branches to a
+/// block with no other predecessors, the retain is sunk into that block and
+/// the scan continues there, mirroring the cross-block hoisting done by
+/// performLocalReleaseMotion. \p VisitedBBs prevents the scan from cycling
+/// through a loop.
 static bool performLocalRetainMotion(CallInst &Retain, BasicBlock &BB,
-                                     SwiftRCIdentity *RC) {
+                                     SwiftRCIdentity *RC,
+                                     SmallPtrSetImpl<BasicBlock *> &VisitedBBs) {
   // FIXME: Call classifier should identify the object for us.  Too bad C++
   // doesn't have nice Swift-style enums.
   Value *RetainedObject = RC->getSwiftRCIdentityRoot(Retain.getArgOperand(0));
@@ -506,6 +549,23 @@ static bool performLocalRetainMotion(CallInst &Retain, BasicBlock &BB,
   }
 OutOfLoop:
 
+  // If the scan reached the terminator without being stopped and control
+  // unconditionally transfers to a block that is only reachable from here,
+  // the retain runs on exactly the executions that run that block, so the
+  // scan can continue there.
+  if (BBI == BBE) {
+    auto *Br = dyn_cast<BranchInst>(BB.getTerminator());
+    if (Br && Br->isUnconditional()) {
+      BasicBlock *Succ = Br->getSuccessor(0);
+      if (Succ->getUniquePredecessor() == &BB &&
+          VisitedBBs.insert(Succ).second) {
+        Retain.moveBefore(&*Succ->getFirstInsertionPt());
+        performLocalRetainMotion(Retain, *Succ, RC, VisitedBBs);
+        return true;
+      }
+    }
+  }
+
   // If we were able to move the retain down, move it now.
   // TODO: This is where we'd plug in some global algorithms someday.
   if (MadeProgress) {
@@ -934,9 +994,12 @@ static bool performGeneralOptimizations(Function &F, ARCEntryPointBuilder &B,
       case RT_BridgeRelease:
       case RT_ObjCRelease:
       case RT_UnknownObjectRelease:
-      case RT_Release:
-        Changed |= performLocalReleaseMotion(cast<CallInst>(I), BB, RC);
+      case RT_Release: {
+        SmallPtrSet<BasicBlock *, 4> VisitedBBs;
+        Changed |= performLocalReleaseMotion(cast<CallInst>(I), BB, RC,
+                                             VisitedBBs);
         break;
+      }
       case RT_BridgeRetain:
       case RT_Retain:
       case RT_UnknownObjectRetain:
@@ -945,7 +1008,8 @@ static bool performGeneralOptimizations(Function &F, ARCEntryPointBuilder &B,
         // invalidate our iterators by parking it on the instruction before I.
         BasicBlock::iterator Safe = I.getIterator();
         Safe = Safe != BB.begin() ? std::prev(Safe) : BB.end();
-        if (performLocalRetainMotion(cast<CallInst>(I), BB, RC)) {
+        SmallPtrSet<BasicBlock *, 4> VisitedBBs;
+        if (performLocalRetainMotion(cast<CallInst>(I), BB, RC, VisitedBBs)) {
           // If we zapped or moved the retain, reset the iterator on the
           // instruction *newly* after the prev instruction.
           BBI = Safe != BB.end() ? std::next(Safe) : BB.begin();
@@ -243,6 +243,11 @@ struct APIDiffMigratorPass : public ASTMigratorPass, public SourceEntityWalker {
 
   APIDiffItemStore DiffStore;
 
+  /// Memoized results of \c getRelatedDiffItems. Each reference to a
+  /// declaration queries the same USRs, so compute them only once per
+  /// declaration.
+  llvm::DenseMap<ValueDecl*, std::vector<APIDiffItem*>> RelatedDiffItems;
+
   bool isNilExpr(Expr *E) {
     auto Range = E->getSourceRange();
     return Range.isValid() && Lexer::getCharSourceRangeFromSourceRange(
@@ -268,6 +273,9 @@ struct APIDiffMigratorPass : public ASTMigratorPass, public SourceEntityWalker {
     std::vector<APIDiffItem*> results;
     if (!VD)
       return results;
+    auto Known = RelatedDiffItems.find(VD);
+    if (Known != RelatedDiffItems.end())
+      return Known->second;
     auto addDiffItems = [&](ValueDecl *VD) {
       llvm::SmallString<64> Buffer;
       llvm::raw_svector_ostream OS(Buffer);
@@ -283,6 +291,7 @@ struct APIDiffMigratorPass : public ASTMigratorPass, public SourceEntityWalker {
                                                      /*Transitive=*/true)) {
       addDiffItems(Overridden);
     }
+    RelatedDiffItems[VD] = results;
     return results;
   }
 
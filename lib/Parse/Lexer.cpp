@@ -22,6 +22,7 @@
 #include "swift/Basic/SourceManager.h"
 #include "swift/Syntax/Trivia.h"
 #include "llvm/Support/Compiler.h"
+#include "llvm/Support/Endian.h"
 #include "llvm/Support/MathExtras.h"
 #include "llvm/Support/MemoryBuffer.h"
 #include "llvm/ADT/SmallString.h"
@@ -374,12 +375,48 @@ static void diagnoseEmbeddedNul(DiagnosticEngine *Diags, const char *Ptr) {
       .fixItRemoveChars(NulLoc, NulEndLoc);
 }
 
+/// Returns a nonzero value if any byte of \p word equals \p Byte. The
+/// high bit of each matching byte's lane is set in the result.
+template <char Byte>
+static inline uint64_t wordHasByte(uint64_t word) {
+  uint64_t mask = word ^ (UINT64_C(0x0101010101010101) * (unsigned char)Byte);
+  return (mask - UINT64_C(0x0101010101010101)) & ~mask &
+         UINT64_C(0x8080808080808080);
+}
+
+/// Advance \p CurPtr over a run of "plain" ASCII bytes, a word at a time.
+///
+/// Bytes with the high bit set (potential UTF-8 sequences), NUL, '\n' and
+/// '\r' always stop the scan, as do the extra stop characters \p Stop0
+/// and \p Stop1; \p CurPtr is left pointing at the first such byte within
+/// the next word (the caller's byte-wise loop handles it, along with any
+/// sub-word tail near \p BufferEnd).
+template <char Stop0 = '\n', char Stop1 = '\n'>
+static void advanceOverPlainASCII(const char *&CurPtr,
+                                  const char *BufferEnd) {
+  while (CurPtr + 8 <= BufferEnd) {
+    uint64_t word =
+        llvm::support::endian::read64le(CurPtr);
+    uint64_t stops = (word & UINT64_C(0x8080808080808080)) |
+                     wordHasByte<0>(word) | wordHasByte<'\n'>(word) |
+                     wordHasByte<'\r'>(word) | wordHasByte<Stop0>(word) |
+                     wordHasByte<Stop1>(word);
+    if (stops) {
+      CurPtr += llvm::countTrailingZeros(stops) / 8;
+      return;
+    }
+    CurPtr += 8;
+  }
+}
+
 /// Advance \p CurPtr to the end of line or the end of file. Returns \c true
 /// if it stopped at the end of line, \c false if it stopped at the end of file.
 static bool advanceToEndOfLine(const char *&CurPtr, const char *BufferEnd,
                                const char *CodeCompletionPtr = nullptr,
                                DiagnosticEngine *Diags = nullptr) {
   while (1) {
+    // Eat the uninteresting bulk of the line a word at a time.
+    advanceOverPlainASCII(CurPtr, BufferEnd);
     switch (*CurPtr++) {
     case '\n':
     case '\r':
@@ -445,6 +482,8 @@ static bool skipToEndOfSlashStarComment(const char *&CurPtr,
   bool isMultiline = false;
 
   while (1) {
+    // Eat the uninteresting bulk of the comment a word at a time.
+    advanceOverPlainASCII<'*', '/'>(CurPtr, BufferEnd);
     switch (*CurPtr++) {
     case '*':
       // Check for a '*/'
@@ -25,6 +25,7 @@
 #include "clang/AST/Decl.h"
 #include "clang/Basic/Module.h"
 
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/Support/raw_ostream.h"
 
 using namespace swift;
@@ -482,70 +483,86 @@ public:
     });
     decls.erase(newEnd, decls.end());
 
+    // The number of members of an extension is used as a sort key below;
+    // memoize it so comparing the same extension repeatedly doesn't walk its
+    // member list every time.
+    llvm::SmallDenseMap<const ExtensionDecl *, unsigned, 32> numMembersCache;
+    auto getNumMembers = [&numMembersCache](const ExtensionDecl *ED) {
+      auto known = numMembersCache.find(ED);
+      if (known == numMembersCache.end()) {
+        auto members = ED->getMembers();
+        unsigned count = std::distance(members.begin(), members.end());
+        known = numMembersCache.insert({ED, count}).first;
+      }
+      return known->second;
+    };
+
     // REVERSE sort the decls, since we are going to copy them onto a stack.
-    llvm::array_pod_sort(decls.begin(), decls.end(),
-                         [](Decl * const *lhs, Decl * const *rhs) -> int {
+    // The sort must be stable: extensions that compare equivalent below fall
+    // back to source order, keeping the printed header byte-for-byte
+    // reproducible so unchanged headers are never rewritten.
+    std::stable_sort(decls.begin(), decls.end(),
+                     [&](Decl *lhs, Decl *rhs) -> bool {
       enum : int {
         Ascending = -1,
         Equivalent = 0,
         Descending = 1,
       };
 
-      assert(*lhs != *rhs && "duplicate top-level decl");
+      auto compare = [&](Decl *lhs, Decl *rhs) -> int {
+        assert(lhs != rhs && "duplicate top-level decl");
 
-      auto getSortName = [](const Decl *D) -> StringRef {
-        if (auto VD = dyn_cast<ValueDecl>(D))
-          return VD->getBaseName().userFacingName();
+        auto getSortName = [](const Decl *D) -> StringRef {
+          if (auto VD = dyn_cast<ValueDecl>(D))
+            return VD->getBaseName().userFacingName();
 
-        if (auto ED = dyn_cast<ExtensionDecl>(D)) {
-          auto baseClass = ED->getSelfClassDecl();
-          return baseClass->getName().str();
-        }
-        llvm_unreachable("unknown top-level ObjC decl");
+          if (auto ED = dyn_cast<ExtensionDecl>(D)) {
+            auto baseClass = ED->getSelfClassDecl();
+            return baseClass->getName().str();
+          }
+          llvm_unreachable("unknown top-level ObjC decl");
+        };
+
+        // Sort by names.
+        int result = getSortName(rhs).compare(getSortName(lhs));
+        if (result != 0)
+          return result;
+
+        // Prefer value decls to extensions.
+        assert(!(isa<ValueDecl>(lhs) && isa<ValueDecl>(rhs)));
+        if (isa<ValueDecl>(lhs) && !isa<ValueDecl>(rhs))
+          return Descending;
+        if (!isa<ValueDecl>(lhs) && isa<ValueDecl>(rhs))
+          return Ascending;
+
+        // Break ties in extensions by putting smaller extensions last (in
+        // reverse order).
+        unsigned numLHSMembers = getNumMembers(cast<ExtensionDecl>(lhs));
+        unsigned numRHSMembers = getNumMembers(cast<ExtensionDecl>(rhs));
+        if (numLHSMembers != numRHSMembers)
+          return numLHSMembers < numRHSMembers ? Descending : Ascending;
+
+        // Or the extension with fewer protocols.
+        auto lhsProtos = cast<ExtensionDecl>(lhs)->getLocalProtocols();
+        auto rhsProtos = cast<ExtensionDecl>(rhs)->getLocalProtocols();
+        if (lhsProtos.size() != rhsProtos.size())
+          return lhsProtos.size() < rhsProtos.size() ? Descending : Ascending;
+
+        // If that fails, pick the extension whose protocols are
+        // alphabetically first.
+        auto mismatch =
+          std::mismatch(lhsProtos.begin(), lhsProtos.end(), rhsProtos.begin(),
+                        [] (const ProtocolDecl *nextLHSProto,
+                            const ProtocolDecl *nextRHSProto) {
+          return nextLHSProto->getName() != nextRHSProto->getName();
+        });
+        if (mismatch.first == lhsProtos.end())
+          return Equivalent;
+        StringRef lhsProtoName = (*mismatch.first)->getName().str();
+        return lhsProtoName.compare((*mismatch.second)->getName().str());
       };
 
-      // Sort by names.
-      int result = getSortName(*rhs).compare(getSortName(*lhs));
-      if (result != 0)
-        return result;
-
-      // Prefer value decls to extensions.
-      assert(!(isa<ValueDecl>(*lhs) && isa<ValueDecl>(*rhs)));
-      if (isa<ValueDecl>(*lhs) && !isa<ValueDecl>(*rhs))
-        return Descending;
-      if (!isa<ValueDecl>(*lhs) && isa<ValueDecl>(*rhs))
-        return Ascending;
-
-      // Break ties in extensions by putting smaller extensions last (in reverse
-      // order).
-      // FIXME: This will end up taking linear time.
-      auto lhsMembers = cast<ExtensionDecl>(*lhs)->getMembers();
-      auto rhsMembers = cast<ExtensionDecl>(*rhs)->getMembers();
-      unsigned numLHSMembers = std::distance(lhsMembers.begin(),
-                                             lhsMembers.end());
-      unsigned numRHSMembers = std::distance(rhsMembers.begin(),
-                                             rhsMembers.end());
-      if (numLHSMembers != numRHSMembers)
-        return numLHSMembers < numRHSMembers ? Descending : Ascending;
-
-      // Or the extension with fewer protocols.
-      auto lhsProtos = cast<ExtensionDecl>(*lhs)->getLocalProtocols();
-      auto rhsProtos = cast<ExtensionDecl>(*rhs)->getLocalProtocols();
-      if (lhsProtos.size() != rhsProtos.size())
-        return lhsProtos.size() < rhsProtos.size() ? Descending : Ascending;
-
-      // If that fails, arbitrarily pick the extension whose protocols are
-      // alphabetically first.
-      auto mismatch =
-        std::mismatch(lhsProtos.begin(), lhsProtos.end(), rhsProtos.begin(),
-                      [] (const ProtocolDecl *nextLHSProto,
-                          const ProtocolDecl *nextRHSProto) {
-        return nextLHSProto->getName() != nextRHSProto->getName();
-      });
-      if (mismatch.first == lhsProtos.end())
-        return Equivalent;
-      StringRef lhsProtoName = (*mismatch.first)->getName().str();
-      return lhsProtoName.compare((*mismatch.second)->getName().str());
+      return compare(lhs, rhs) < 0;
     });
 
     assert(declsToWrite.empty());
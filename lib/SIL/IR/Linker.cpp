@@ -46,6 +46,10 @@
 /// that might be missed from deserializing late. The performance pipeline uses
 /// LinkAll mode.
 ///
+/// With -enable-lazy-sil-linking, LinkAll mode only deserializes what
+/// LinkNormal would, and optimizations which need to see a body (such as the
+/// performance inliner) materialize it on demand instead.
+///
 /// *NOTE*: In LinkAll mode, we deserialize all vtables and witness tables,
 /// even those with public linkage. This is not strictly necessary, since the
 /// devirtualizer deserializes vtables and witness tables as needed. However,
@@ -98,8 +102,12 @@ void SILLinkerVisitor::maybeAddFunctionToWorklist(SILFunction *F) {
   if (!F->isExternalDeclaration())
     return;
 
-  // In the performance pipeline, we deserialize all reachable functions.
-  if (isLinkAll())
+  // In the performance pipeline, we deserialize all reachable functions
+  // eagerly, to uncover optimization opportunities. Under lazy linking we
+  // instead fall through to the LinkNormal rules below, which only pull in
+  // what has to be emitted into the client; the remaining bodies are
+  // materialized on demand when an optimization inspects them.
+  if (isLinkAll() && !Mod.getOptions().EnableLazyLinking)
     return addFunctionToWorklist(F);
 
   // Otherwise, make sure to deserialize shared functions; we need to
@@ -132,7 +132,7 @@ SILFunction *SILFunctionBuilder::getOrCreateFunction(
     llvm::function_ref<SILFunction *(SILLocation loc, SILDeclRef constant)>
         getOrCreateDeclaration,
     ProfileCounter entryCount) {
-  auto nameTmp = constant.mangle();
+  auto nameTmp = mod.getMangledName(constant);
   auto constantType = mod.Types.getConstantFunctionType(
       TypeExpansionContext::minimal(), constant);
   SILLinkage linkage = constant.getLinkage(forDefinition);
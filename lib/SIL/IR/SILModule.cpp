@@ -192,11 +192,44 @@ void *SILModule::allocate(unsigned Size, unsigned Align) const {
 }
 
 void *SILModule::allocateInst(unsigned Size, unsigned Align) const {
-  return AlignedAlloc(Size, Align);
+  assert(Align <= 16 && "instruction alignment exceeds arena alignment");
+
+  // Every allocation is preceded by a 16-byte header whose second word
+  // records the free-list bucket the allocation belongs to, or zero if the
+  // memory came from the C allocator. Returned pointers are always 16-byte
+  // aligned, so a recycled allocation satisfies any instruction's alignment
+  // regardless of what it was first used for.
+  unsigned bucket =
+      (Size + InstFreeListGranularity - 1) / InstFreeListGranularity;
+  if (bucket > NumInstFreeListBuckets || getASTContext().LangOpts.UseMalloc) {
+    char *base = static_cast<char *>(AlignedAlloc(Size + 16, 16));
+    reinterpret_cast<uint64_t *>(base)[1] = 0;
+    return base + 16;
+  }
+
+  if (void *reused = InstFreeLists[bucket - 1]) {
+    InstFreeLists[bucket - 1] = *static_cast<void **>(reused);
+    return reused;
+  }
+
+  char *base = static_cast<char *>(
+      InstAllocator.Allocate(bucket * InstFreeListGranularity + 16, 16));
+  reinterpret_cast<uint64_t *>(base)[1] = bucket;
+  return base + 16;
 }
 
 void SILModule::deallocateInst(SILInstruction *I) {
-  AlignedFree(I);
+  char *base = reinterpret_cast<char *>(I) - 16;
+  uint64_t bucket = reinterpret_cast<uint64_t *>(base)[1];
+  if (bucket == 0) {
+    AlignedFree(base);
+    return;
+  }
+
+  // Push the memory onto its bucket's free list; the first word of the dead
+  // instruction serves as the link.
+  *reinterpret_cast<void **>(I) = InstFreeLists[bucket - 1];
+  InstFreeLists[bucket - 1] = I;
 }
 
 SILWitnessTable *
@@ -378,8 +411,17 @@ const BuiltinInfo &SILModule::getBuiltinInfo(Identifier ID) {
 }
 
 SILFunction *SILModule::lookUpFunction(SILDeclRef fnRef) {
+  return lookUpFunction(getMangledName(fnRef));
+}
+
+std::string SILModule::getMangledName(SILDeclRef fnRef) {
+  auto found = MangledNameCache.find(fnRef);
+  if (found != MangledNameCache.end())
+    return found->second;
+
   auto name = fnRef.mangle();
-  return lookUpFunction(name);
+  MangledNameCache.insert({fnRef, name});
+  return name;
 }
 
 bool SILModule::loadFunction(SILFunction *F) {
@@ -562,7 +562,15 @@ class SILPrinter : public SILInstructionVisitor<SILPrinter> {
   
   SILPrinter &operator<<(SILType t) {
     printSILTypeColorAndSigil(PrintState.OS, t);
-    t.getASTType().print(PrintState.OS, PrintState.ASTOptions);
+    // The same types recur constantly across a module's instructions; render
+    // each AST type once per print context. Alternative type names are
+    // printer-local, so bypass the cache when they are in use.
+    if (PrintState.ASTOptions.AlternativeTypeNames) {
+      t.getASTType().print(PrintState.OS, PrintState.ASTOptions);
+    } else {
+      PrintState.OS << Ctx.getTypeString(t.getASTType(),
+                                         PrintState.ASTOptions);
+    }
     return *this;
   }
   
@@ -3544,6 +3552,15 @@ SILPrintContext::~SILPrintContext() {
 void SILPrintContext::printInstructionCallBack(const SILInstruction *I) {
 }
 
+StringRef SILPrintContext::getTypeString(CanType Ty, const PrintOptions &PO) {
+  auto &Entry = TypeStringCache[Ty];
+  if (Entry.empty()) {
+    llvm::raw_string_ostream OS(Entry);
+    Ty.print(OS, PO);
+  }
+  return Entry;
+}
+
 void SILPrintContext::initBlockIDs(ArrayRef<const SILBasicBlock *> Blocks) {
   if (Blocks.empty())
     return;
@@ -128,6 +128,14 @@ namespace {
     llvm::StringMap<ValueBase*> LocalValues;
     llvm::StringMap<SourceLoc> ForwardRefLocalValues;
 
+    /// Types that have already been resolved in this function, keyed by
+    /// their source spelling. Large SIL bodies repeat the same handful of
+    /// type spellings on almost every instruction, so resolving each
+    /// spelling once saves re-entering type resolution per occurrence.
+    /// The value records the generic environment the spelling was resolved
+    /// against; a hit is only valid for the same environment.
+    llvm::StringMap<std::pair<GenericEnvironment *, Type>> ParsedTypeCache;
+
     /// A callback to be invoked every time a type was deserialized.
     std::function<void(Type)> ParsedTypeCallback;
 
@@ -1204,6 +1212,7 @@ bool SILParser::parseSILType(SILType &Result,
   }
 
   // Parse attributes.
+  SourceLoc TypeTextBegin = P.Tok.getLoc();
   ParamDecl::Specifier specifier;
   SourceLoc specifierLoc;
   TypeAttributes attrs;
@@ -1224,8 +1233,47 @@ bool SILParser::parseSILType(SILType &Result,
   if (TyR.isNull())
     return true;
 
+  // If the spelling declares no generic parameters of its own, its resolution
+  // is a pure function of the source text and the outer generic environment,
+  // and SIL functions repeat such spellings constantly. Check the cache before
+  // re-entering type resolution. Spellings with their own generic parameter
+  // lists are excluded because binding them creates fresh environments.
+  class DeclaresGenericParamsWalker : public ASTWalker {
+  public:
+    bool Result = false;
+
+    bool walkToTypeReprPre(TypeRepr *T) override {
+      if (auto fnType = dyn_cast<FunctionTypeRepr>(T))
+        if (fnType->getGenericParams() || fnType->getPatternGenericParams())
+          Result = true;
+
+      if (auto boxType = dyn_cast<SILBoxTypeRepr>(T))
+        if (boxType->getGenericParams())
+          Result = true;
+
+      return !Result;
+    }
+  };
+
+  StringRef TypeText;
+  DeclaresGenericParamsWalker Walker;
+  TyR.get()->walk(Walker);
+  if (!IsFuncDecl && !Walker.Result) {
+    auto TextRange = Lexer::getCharSourceRangeFromSourceRange(
+        P.SourceMgr, SourceRange(TypeTextBegin, TyR.get()->getEndLoc()));
+    TypeText = P.SourceMgr.extractText(TextRange);
+    auto Cached = ParsedTypeCache.find(TypeText);
+    if (Cached != ParsedTypeCache.end() &&
+        Cached->second.first == OuterGenericEnv) {
+      Type Ty = Cached->second.second;
+      Result = SILType::getPrimitiveType(Ty->getCanonicalType(), category);
+      ParsedTypeCallback(Ty);
+      return false;
+    }
+  }
+
   bindSILGenericParams(TyR.get());
-  
+
   // Apply attributes to the type.
   auto *attrRepr =
       P.applyAttributeToType(TyR.get(), attrs, specifier, specifierLoc);
@@ -1243,6 +1291,9 @@ bool SILParser::parseSILType(SILType &Result,
       ParsedGenericParams = genericParams;
   }
 
+  if (!TypeText.empty())
+    ParsedTypeCache[TypeText] = {OuterGenericEnv, Ty};
+
   Result = SILType::getPrimitiveType(Ty->getCanonicalType(),
                                      category);
 
@@ -1436,7 +1436,45 @@ void SILGenModule::emitDefaultArgGenerators(SILDeclRef::Loc decl,
   }
 }
 
+/// Under -enable-lazy-objc-thunks, returns true if the Objective-C entry
+/// point for the given member may be omitted, together with its method list
+/// entry. Only members that module-local analysis shows can be reached
+/// through objc_msgSend in some way are kept: dynamic members, overrides,
+/// witnesses of @objc protocol requirements, members that opted into
+/// selector-based dispatch explicitly (an explicit @objc attribute, IB
+/// attributes, @NSManaged, @GKInspectable), and anything visible to
+/// Objective-C importers of the module.
+static bool canOmitObjCEntryPoint(ValueDecl *decl) {
+  if (decl->isDynamic() || decl->isObjCDynamic())
+    return false;
+  if (decl->getOverriddenDecl())
+    return false;
+  if (!decl->getSatisfiedProtocolRequirements().empty())
+    return false;
+
+  auto &attrs = decl->getAttrs();
+  if (auto *objcAttr = attrs.getAttribute<ObjCAttr>())
+    if (!objcAttr->isImplicit())
+      return false;
+  if (attrs.hasAttribute<IBActionAttr>() ||
+      attrs.hasAttribute<IBSegueActionAttr>() ||
+      attrs.hasAttribute<IBOutletAttr>() ||
+      attrs.hasAttribute<IBInspectableAttr>() ||
+      attrs.hasAttribute<GKInspectableAttr>() ||
+      attrs.hasAttribute<NSManagedAttr>())
+    return false;
+
+  // Public members can be messaged by Objective-C code outside the module.
+  if (decl->getEffectiveAccess() >= AccessLevel::Public)
+    return false;
+
+  return true;
+}
+
 void SILGenModule::emitObjCMethodThunk(FuncDecl *method) {
+  if (M.getOptions().LazyObjCThunks && canOmitObjCEntryPoint(method))
+    return;
+
   auto thunk = SILDeclRef(method).asForeign();
 
   // Don't emit the thunk if it already exists.
@@ -1448,6 +1486,9 @@ void SILGenModule::emitObjCMethodThunk(FuncDecl *method) {
 }
 
 void SILGenModule::emitObjCPropertyMethodThunks(AbstractStorageDecl *prop) {
+  if (M.getOptions().LazyObjCThunks && canOmitObjCEntryPoint(prop))
+    return;
+
   auto *getter = prop->getOpaqueAccessor(AccessorKind::Get);
 
   // If we don't actually need an entry point for the getter, do nothing.
@@ -1474,6 +1515,9 @@ void SILGenModule::emitObjCPropertyMethodThunks(AbstractStorageDecl *prop) {
 }
 
 void SILGenModule::emitObjCConstructorThunk(ConstructorDecl *constructor) {
+  if (M.getOptions().LazyObjCThunks && canOmitObjCEntryPoint(constructor))
+    return;
+
   auto thunk = SILDeclRef(constructor, SILDeclRef::Kind::Initializer)
     .asForeign();
 
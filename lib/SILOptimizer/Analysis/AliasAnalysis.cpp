@@ -793,5 +793,6 @@ AliasKeyTy AliasAnalysis::toAliasKey(SILValue V1, SILValue V2,
          "~0 index reserved for empty/tombstone keys");
   void *t1 = Type1.getOpaqueValue();
   void *t2 = Type2.getOpaqueValue();
-  return {idx1, idx2, t1, t2};
+  SILFunction *F = V1->getFunction() ? V1->getFunction() : V2->getFunction();
+  return {idx1, idx2, t1, t2, getFunctionGeneration(F)};
 }
@@ -1859,10 +1859,15 @@ bool EscapeAnalysis::buildConnectionGraphForDestructor(
 EscapeAnalysis::ArrayUninitCall
 EscapeAnalysis::canOptimizeArrayUninitializedCall(ApplyInst *ai) {
   ArrayUninitCall call;
-  // This must be an exact match so we don't accidentally optimize
-  // "array.uninitialized_intrinsic".
-  if (!ArraySemanticsCall(ai, "array.uninitialized", false))
+  // Match both variants exactly so we don't accidentally optimize an
+  // unrelated "array." semantics function.
+  if (ArraySemanticsCall(ai, "array.uninitialized_intrinsic", false)) {
+    // The intrinsic allocates the array storage itself; its only argument is
+    // the element count.
+    call.isIntrinsic = true;
+  } else if (!ArraySemanticsCall(ai, "array.uninitialized", false)) {
     return call;
+  }
 
   // Check if the result is used in the usual way: extracting the
   // array and the element pointer with tuple_extract.
@@ -1892,7 +1897,7 @@ EscapeAnalysis::canOptimizeArrayUninitializedCall(ApplyInst *ai) {
   // won't be able to map the result nodes onto it. There is a variant of
   // @_semantics("array.uninitialized") that does not take the storage as input,
   // so it will effectively bail out here.
-  if (isPointer(ai->getArgument(0)))
+  if (!call.isIntrinsic && isPointer(ai->getArgument(0)))
     call.arrayStorageRef = ai->getArgument(0);
   return call;
 }
@@ -1919,6 +1924,15 @@ void EscapeAnalysis::createArrayUninitializedSubgraph(
   CGNode *arrayStructNode = conGraph->getNode(call.arrayStruct);
   assert(arrayStructNode && "Array struct must have a node");
 
+  if (call.isIntrinsic) {
+    // The intrinsic allocates fresh storage, so the buffer object is simply
+    // the content of the returned array struct; nothing escapes. The element
+    // pointer points to the same fresh object.
+    CGNode *arrayObjNode = conGraph->getValueContent(call.arrayStruct);
+    conGraph->setNode(call.arrayElementPtr, arrayObjNode);
+    return;
+  }
+
   CGNode *arrayRefNode = conGraph->getNode(call.arrayStorageRef);
   assert(arrayRefNode && "canOptimizeArrayUninitializedCall checks isPointer");
   // If the arrayRefNode != null then arrayObjNode must be valid.
@@ -1951,7 +1965,8 @@ void EscapeAnalysis::analyzeInstruction(SILInstruction *I,
       case ArrayCallKind::kMakeMutable:
         // These array semantics calls do not capture anything.
         return;
-      case ArrayCallKind::kArrayUninitialized: {
+      case ArrayCallKind::kArrayUninitialized:
+      case ArrayCallKind::kArrayUninitializedIntrinsic: {
         ArrayUninitCall call = canOptimizeArrayUninitializedCall(
             cast<ApplyInst>(FAS.getInstruction()));
         if (call.isValid()) {
@@ -2674,6 +2689,38 @@ bool EscapeAnalysis::canEscapeTo(SILValue V, RefCountingInst *RI) {
   return canEscapeToUsePoint(V, RI, ConGraph);
 }
 
+bool EscapeAnalysis::canParameterEscape(FullApplySite FAS, int ParamIdx,
+                                        bool checkContentOfIndirectParam) {
+  CalleeList Callees = BCA->getCalleeList(FAS);
+  if (!Callees.allCalleesVisible())
+    return true;
+
+  // Check the summary graph of each known callee: the escape states of the
+  // parameter nodes already account for everything that happens further down
+  // the call tree.
+  for (SILFunction *Callee : Callees) {
+    if (Callee->empty())
+      return true;
+    FunctionInfo *FInfo = getFunctionInfo(Callee);
+    if (!FInfo->isValid())
+      recompute(FInfo);
+
+    CGNode *Node = FInfo->SummaryGraph.getNode(Callee->getArgument(ParamIdx));
+    if (!Node)
+      return true;
+
+    if (checkContentOfIndirectParam) {
+      Node = Node->getContentNodeOrNull();
+      if (!Node)
+        continue;
+    }
+
+    if (Node->escapes())
+      return true;
+  }
+  return false;
+}
+
 /// Utility to get the function which contains both values \p V1 and \p V2.
 static SILFunction *getCommonFunction(SILValue V1, SILValue V2) {
   SILBasicBlock *BB1 = V1->getParentBlock();
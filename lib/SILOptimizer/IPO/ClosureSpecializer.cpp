@@ -222,11 +222,33 @@ public:
 
   SILParameterInfo getClosureParameterInfo() const { return ClosureParamInfo; }
 
+  /// Return the substitutions the closure was created with, or an empty map
+  /// for a thin_to_thick_function closure.
+  SubstitutionMap getClosureSubstitutions() const {
+    if (auto *PAI = dyn_cast<PartialApplyInst>(getClosure()))
+      return PAI->getSubstitutionMap();
+    return SubstitutionMap();
+  }
+
+  /// Return the closure callee's function type with the closure's
+  /// substitutions applied. The substitutions are always fully concrete
+  /// (isSupportedClosure rejects archetypes), so the resulting type is valid
+  /// in any function.
+  CanSILFunctionType getClosureCalleeType(TypeExpansionContext context) const {
+    auto calleeTy = getClosureCallee()->getLoweredFunctionType();
+    auto subs = getClosureSubstitutions();
+    if (!subs.empty())
+      calleeTy = calleeTy->substGenericArgs(getClosureCallee()->getModule(),
+                                            subs, context);
+    return calleeTy;
+  }
+
   SingleValueInstruction *
   createNewClosure(SILBuilder &B, SILValue V,
                    llvm::SmallVectorImpl<SILValue> &Args) const {
     if (auto *PA = dyn_cast<PartialApplyInst>(getClosure()))
-      return B.createPartialApply(getClosure()->getLoc(), V, {}, Args,
+      return B.createPartialApply(getClosure()->getLoc(), V,
+                                  PA->getSubstitutionMap(), Args,
                                   getClosure()
                                       ->getType()
                                       .getAs<SILFunctionType>()
@@ -541,8 +563,13 @@ static bool isSupportedClosure(const SILInstruction *Closure) {
 
   // If Closure is a partial apply...
   if (auto *PAI = dyn_cast<PartialApplyInst>(Closure)) {
-    // And it has substitutions, return false.
-    if (PAI->hasSubstitutions())
+    // If it has substitutions, we only support the case where they are all
+    // concrete: the substitution map can then be transplanted into the
+    // specialized function as-is. Substitutions containing archetypes depend
+    // on the closure-creating function's generic environment, which the
+    // specialized apply callee does not have.
+    if (PAI->hasSubstitutions() &&
+        PAI->getSubstitutionMap().hasArchetypes())
       return false;
 
     // Ok, it is a closure we support, set Callee.
@@ -625,10 +652,12 @@ ClosureSpecCloner::initCloned(SILOptFunctionBuilder &FunctionBuilder,
 
   // Then add any arguments that are captured in the closure to the function's
   // argument type. Since they are captured, we need to pass them directly into
-  // the new specialized function.
-  SILFunction *ClosedOverFun = CallSiteDesc.getClosureCallee();
-  auto ClosedOverFunConv = ClosedOverFun->getConventions();
+  // the new specialized function. Use the closure's substitutions (if any) so
+  // that the captured parameters have their concrete types.
   SILModule &M = ClosureUser->getModule();
+  auto ClosedOverFunTy = CallSiteDesc.getClosureCalleeType(
+      CallSiteDesc.getApplyInst().getFunction()->getTypeExpansionContext());
+  SILFunctionConventions ClosedOverFunConv(ClosedOverFunTy, M);
 
   // Captured parameters are always appended to the function signature. If the
   // type of the captured argument is:
@@ -745,7 +774,8 @@ SILValue ClosureSpecCloner::cloneCalleeConversion(
     assert(origRef);
     auto FunRef = Builder.createFunctionRef(CallSiteDesc.getLoc(), origRef);
     auto NewPA = Builder.createPartialApply(
-        CallSiteDesc.getLoc(), FunRef, {}, {calleeValue},
+        CallSiteDesc.getLoc(), FunRef, PAI->getSubstitutionMap(),
+        {calleeValue},
         PAI->getType().getAs<SILFunctionType>()->getCalleeConvention(),
         PAI->isOnStack());
     // If the partial_apply is on stack we will emit a dealloc_stack in the
@@ -819,7 +849,10 @@ void ClosureSpecCloner::populateCloned() {
   // the arguments is the partial apply that we will create.
   SILFunction *ClosedOverFun = CallSiteDesc.getClosureCallee();
   SILBuilder &Builder = getBuilder();
-  auto ClosedOverFunConv = ClosedOverFun->getConventions();
+  auto ClosedOverFunTy =
+      CallSiteDesc.getClosureCalleeType(Cloned->getTypeExpansionContext());
+  SILFunctionConventions ClosedOverFunConv(ClosedOverFunTy,
+                                           Cloned->getModule());
   unsigned NumTotalParams = ClosedOverFunConv.getNumParameters();
   unsigned NumNotCaptured = NumTotalParams - CallSiteDesc.getNumArguments();
   llvm::SmallVector<SILValue, 4> NewPAIArgs;
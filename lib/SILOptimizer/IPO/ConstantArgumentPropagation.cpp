@@ -0,0 +1,199 @@
+//===--- ConstantArgumentPropagation.cpp - propagate literal arguments ----===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2021 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+//
+// Propagates literal arguments across the call graph: if every caller of a
+// function passes the same literal for an argument, the literal is
+// materialized in the callee's entry block and the argument's uses are
+// replaced with it. The intraprocedural passes (SILCombine, constant
+// propagation, SimplifyCFG) then fold with the constant inside the callee,
+// which in particular lets configuration constants passed down from main()
+// dead-code-eliminate branches in leaf functions.
+//
+// The signature of the callee is not changed; the now-unused argument is
+// cleaned up later by the dead-argument elimination in the function
+// signature optimizations. Running this pass repeatedly propagates constants
+// one call-graph level further each time.
+//
+//===----------------------------------------------------------------------===//
+
+#define DEBUG_TYPE "constant-arg-propagation"
+#include "swift/SIL/ApplySite.h"
+#include "swift/SIL/SILBuilder.h"
+#include "swift/SIL/SILFunction.h"
+#include "swift/SIL/SILInstruction.h"
+#include "swift/SIL/SILModule.h"
+#include "swift/SILOptimizer/Analysis/CallerAnalysis.h"
+#include "swift/SILOptimizer/PassManager/Passes.h"
+#include "swift/SILOptimizer/PassManager/Transforms.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/Statistic.h"
+#include "llvm/Support/Debug.h"
+
+STATISTIC(NumLiteralArgsPropagated, "Number of literal arguments propagated");
+
+using namespace swift;
+
+namespace {
+
+/// All the direct references to a function which we found in the module.
+struct CalleeInfo {
+  /// All full apply sites which directly call the function.
+  llvm::SmallVector<FullApplySite, 8> applies;
+
+  /// True if a reference to the function exists which is not the callee of a
+  /// full apply site, e.g. an escaping function_ref or a partial_apply.
+  bool hasUnknownUses = false;
+};
+
+/// Propagates arguments which are the same literal at every call site into
+/// the callee.
+class ConstantArgumentPropagation : public SILModuleTransform {
+  void run() override;
+
+  bool propagateLiteralArguments(SILFunction *callee,
+                                 const CalleeInfo &info);
+};
+
+} // end anonymous namespace
+
+/// Returns the defining instruction of \p value if it is a literal which can
+/// be rematerialized in another function, or null otherwise.
+///
+/// All supported literals are of trivial type, so no ownership fixup is
+/// needed when replacing an argument with a cloned literal.
+static SingleValueInstruction *getPropagatableLiteral(SILValue value) {
+  if (isa<IntegerLiteralInst>(value) || isa<FloatLiteralInst>(value) ||
+      isa<StringLiteralInst>(value))
+    return cast<SingleValueInstruction>(value);
+  return nullptr;
+}
+
+/// Returns true if \p lhs and \p rhs are literals of the same type with the
+/// same value.
+static bool isSameLiteral(SingleValueInstruction *lhs,
+                          SingleValueInstruction *rhs) {
+  if (lhs->getKind() != rhs->getKind() || lhs->getType() != rhs->getType())
+    return false;
+  if (auto *il = dyn_cast<IntegerLiteralInst>(lhs))
+    return il->getValue() == cast<IntegerLiteralInst>(rhs)->getValue();
+  if (auto *fl = dyn_cast<FloatLiteralInst>(lhs))
+    return fl->getBits() == cast<FloatLiteralInst>(rhs)->getBits();
+  auto *sl = cast<StringLiteralInst>(lhs);
+  auto *otherSL = cast<StringLiteralInst>(rhs);
+  return sl->getEncoding() == otherSL->getEncoding() &&
+         sl->getValue() == otherSL->getValue();
+}
+
+/// Re-creates the literal \p literal at the beginning of the entry block of
+/// \p callee.
+static SingleValueInstruction *cloneLiteralInto(SILFunction *callee,
+                                             SingleValueInstruction *literal) {
+  SILBuilderWithScope builder(&*callee->getEntryBlock()->begin());
+  SILLocation loc = RegularLocation::getAutoGeneratedLocation();
+  if (auto *il = dyn_cast<IntegerLiteralInst>(literal))
+    return builder.createIntegerLiteral(loc, il->getType(), il->getValue());
+  if (auto *fl = dyn_cast<FloatLiteralInst>(literal))
+    return builder.createFloatLiteral(loc, fl->getType(), fl->getValue());
+  auto *sl = cast<StringLiteralInst>(literal);
+  return builder.createStringLiteral(loc, sl->getValue(), sl->getEncoding());
+}
+
+bool ConstantArgumentPropagation::
+propagateLiteralArguments(SILFunction *callee, const CalleeInfo &info) {
+  bool changed = false;
+
+  auto *entry = callee->getEntryBlock();
+  for (unsigned argIdx : indices(entry->getArguments())) {
+    SILArgument *arg = entry->getArgument(argIdx);
+    if (arg->use_empty())
+      continue;
+
+    // Check if all call sites pass the same literal for this argument.
+    SingleValueInstruction *commonLiteral = nullptr;
+    for (FullApplySite apply : info.applies) {
+      if (argIdx >= apply.getNumArguments()) {
+        commonLiteral = nullptr;
+        break;
+      }
+      auto *literal = getPropagatableLiteral(apply.getArgument(argIdx));
+      if (!literal || literal->getType() != arg->getType() ||
+          (commonLiteral && !isSameLiteral(commonLiteral, literal))) {
+        commonLiteral = nullptr;
+        break;
+      }
+      commonLiteral = literal;
+    }
+    if (!commonLiteral)
+      continue;
+
+    LLVM_DEBUG(llvm::dbgs() << "Propagating literal argument " << argIdx
+                            << " into " << callee->getName() << "\n");
+    arg->replaceAllUsesWith(cloneLiteralInto(callee, commonLiteral));
+    ++NumLiteralArgsPropagated;
+    changed = true;
+  }
+  return changed;
+}
+
+void ConstantArgumentPropagation::run() {
+  SILModule *M = getModule();
+  CallerAnalysis *CA = PM->getAnalysis<CallerAnalysis>();
+
+  // Collect all direct references to functions in the module.
+  llvm::DenseMap<SILFunction *, CalleeInfo> calleeInfos;
+  for (SILFunction &F : *M) {
+    for (SILBasicBlock &BB : F) {
+      for (SILInstruction &I : BB) {
+        auto *FRI = dyn_cast<FunctionRefInst>(&I);
+        if (!FRI)
+          continue;
+        CalleeInfo &info = calleeInfos[FRI->getInitiallyReferencedFunction()];
+        for (Operand *use : FRI->getUses()) {
+          FullApplySite apply = FullApplySite::isa(use->getUser());
+          if (apply && apply.getCalleeOperand() == use) {
+            info.applies.push_back(apply);
+          } else {
+            info.hasUnknownUses = true;
+          }
+        }
+      }
+    }
+  }
+
+  for (auto &entry : calleeInfos) {
+    SILFunction *callee = entry.first;
+    const CalleeInfo &info = entry.second;
+
+    if (info.hasUnknownUses || info.applies.empty())
+      continue;
+    if (!callee->isDefinition() || !callee->shouldOptimize())
+      continue;
+    // The callee must not be callable from outside the module or through a
+    // vtable, witness table or dynamic replacement. CallerAnalysis already
+    // answers this conservatively.
+    if (callee->isDynamicallyReplaceable() ||
+        !CA->getFunctionInfo(callee).foundAllCallers())
+      continue;
+    // For generic callees the literal's type in the caller does not match
+    // the interface type of the argument.
+    if (callee->getLoweredFunctionType()->isPolymorphic())
+      continue;
+
+    if (propagateLiteralArguments(callee, info)) {
+      invalidateAnalysis(callee, SILAnalysis::InvalidationKind::Instructions);
+    }
+  }
+}
+
+SILTransform *swift::createConstantArgumentPropagation() {
+  return new ConstantArgumentPropagation();
+}
@@ -20,6 +20,7 @@
 #include "swift/SIL/SILCloner.h"
 #include "swift/SIL/SILFunction.h"
 #include "swift/SIL/SILModule.h"
+#include "swift/SILOptimizer/Analysis/SideEffectAnalysis.h"
 #include "swift/SILOptimizer/PassManager/Passes.h"
 #include "swift/SILOptimizer/PassManager/Transforms.h"
 #include "swift/SILOptimizer/Utils/InstOptUtils.h"
@@ -429,6 +430,36 @@ void CrossModuleSerializationSetup::scanModule() {
   }
 }
 
+/// Derive a conservative EffectsKind from the computed side effects of a
+/// function, or Unspecified if none of the coarse kinds applies.
+///
+/// The mapping must be sound with respect to how
+/// FunctionSideEffects::setDefinedEffects interprets the kinds on the client
+/// side: clients assume that a readnone/readonly/releasenone function neither
+/// traps, allocates, nor touches reference counts beyond what the kind
+/// permits.
+static EffectsKind deriveEffectsSummary(const FunctionSideEffects &effects) {
+  bool anyRead = effects.getGlobalEffects().mayRead();
+  bool anyWrite = effects.getGlobalEffects().mayWrite();
+  bool anyRetain = effects.getGlobalEffects().mayRetain();
+  bool anyRelease = effects.getGlobalEffects().mayRelease();
+  for (const FunctionSideEffectFlags &param : effects.getParameterEffects()) {
+    anyRead |= param.mayRead();
+    anyWrite |= param.mayWrite();
+    anyRetain |= param.mayRetain();
+    anyRelease |= param.mayRelease();
+  }
+  if (anyRetain || anyRelease || effects.mayAllocObjects() ||
+      effects.mayTrap() || effects.mayReadRC())
+    return EffectsKind::Unspecified;
+
+  if (!anyRead && !anyWrite)
+    return EffectsKind::ReadNone;
+  if (!anyWrite)
+    return EffectsKind::ReadOnly;
+  return EffectsKind::ReleaseNone;
+}
+
 class CrossModuleSerializationSetupPass: public SILModuleTransform {
   void run() override {
 
@@ -442,6 +473,27 @@ class CrossModuleSerializationSetupPass: public SILModuleTransform {
 
     CrossModuleSerializationSetup CMSS(M);
     CMSS.scanModule();
+    inferEffectsSummaries(M);
+  }
+
+  /// Annotate public functions whose bodies are not serialized with a
+  /// conservative effects summary, so that clients get cross-module
+  /// side-effect information without shipping implementation SIL. The
+  /// summary is serialized as part of the function declaration record.
+  void inferEffectsSummaries(SILModule &M) {
+    auto *SEA = getAnalysis<SideEffectAnalysis>();
+    for (SILFunction &F : M) {
+      // Functions which are serialized ship their bodies anyway, and the
+      // effects of a dynamically replaceable function can change at runtime.
+      if (F.isExternalDeclaration() || F.isSerialized() ||
+          !hasPublicVisibility(F.getLinkage()) || F.hasEffectsKind() ||
+          F.isDynamicallyReplaceable())
+        continue;
+
+      EffectsKind summary = deriveEffectsSummary(SEA->getEffects(&F));
+      if (summary != EffectsKind::Unspecified)
+        F.setEffectsKind(summary);
+    }
   }
 };
 
@@ -112,6 +112,11 @@ class SILGlobalOpt {
   llvm::SmallVector<SILInstruction *, 4> InstToRemove;
   llvm::SmallVector<SILGlobalVariable *, 4> GlobalsToRemove;
 
+  /// The functions in which this pass actually changed instructions.
+  /// Only those need their analyses invalidated; the rest of the module is
+  /// untouched.
+  llvm::SmallPtrSet<SILFunction *, 16> ChangedFunctions;
+
 public:
   SILGlobalOpt(SILOptFunctionBuilder &FunctionBuilder, SILModule *M,
                DominanceAnalysis *DA, SILPassManager *PM)
@@ -119,6 +124,12 @@ public:
 
   bool run();
 
+  /// Returns the set of functions which were changed by this pass. Only valid
+  /// after run() returned true.
+  const llvm::SmallPtrSetImpl<SILFunction *> &getChangedFunctions() const {
+    return ChangedFunctions;
+  }
+
 protected:
   /// Checks if a given global variable is assigned only once.
   bool isAssignedOnlyOnceInInitializer(SILGlobalVariable *SILG,
@@ -385,6 +396,8 @@ replaceLoadsByKnownValue(SILFunction *InitF, SILGlobalVariable *SILG,
       continue;
     }
 
+    ChangedFunctions.insert(initCall->getFunction());
+
     StaticInitCloner cloner(initCall);
     SmallVector<SILInstruction *, 8> insertedInsts;
     cloner.setTrackingList(&insertedInsts);
@@ -455,6 +468,7 @@ bool SILGlobalOpt::optimizeInitializer(SILFunction *AddrF,
                           << SILG->getName() << '\n');
 
   // Remove "once" call from the addressor.
+  ChangedFunctions.insert(AddrF);
   removeToken(CallToOnce->getOperand(0));
   eraseUsesOfInstruction(CallToOnce);
   recursivelyDeleteTriviallyDeadInstructions(CallToOnce, true);
@@ -696,6 +710,7 @@ void SILGlobalOpt::optimizeGlobalAccess(SILGlobalVariable *SILG,
     cloner.add(initVal);
 
     // Replace all loads from the addressor with the initial value of the global.
+    ChangedFunctions.insert(globalAddr->getFunction());
     replaceLoadsFromGlobal(globalAddr, initVal, cloner);
 
     HasChanged = true;
@@ -819,6 +834,7 @@ bool SILGlobalOpt::run() {
 
   // Erase the instructions that we have marked for deletion.
   for (auto *inst : InstToRemove) {
+    ChangedFunctions.insert(inst->getFunction());
     eraseUsesOfInstruction(inst);
     inst->eraseFromParent();
   }
@@ -846,8 +862,14 @@ class SILGlobalOptPass : public SILModuleTransform {
   void run() override {
     auto *DA = PM->getAnalysis<DominanceAnalysis>();
     SILOptFunctionBuilder FunctionBuilder(*this);
-    if (SILGlobalOpt(FunctionBuilder, getModule(), DA, PM).run()) {
-      invalidateAll();
+    SILGlobalOpt Opt(FunctionBuilder, getModule(), DA, PM);
+    if (Opt.run()) {
+      // Even though this is a module pass, only the functions in which
+      // instructions were actually rewritten need to be re-analyzed.
+      // Invalidating them individually keeps the analysis results of all
+      // other functions in the module alive.
+      for (SILFunction *F : Opt.getChangedFunctions())
+        invalidateAnalysis(F, SILAnalysis::InvalidationKind::FunctionBody);
     }
   }
 };
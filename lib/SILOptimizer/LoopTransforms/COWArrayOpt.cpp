@@ -32,6 +32,7 @@
 #include "swift/SILOptimizer/Analysis/DominanceAnalysis.h"
 #include "swift/SILOptimizer/Analysis/LoopAnalysis.h"
 #include "swift/SILOptimizer/Analysis/RCIdentityAnalysis.h"
+#include "swift/SILOptimizer/Analysis/SideEffectAnalysis.h"
 #include "swift/SILOptimizer/Analysis/ValueTracking.h"
 #include "swift/SILOptimizer/PassManager/Passes.h"
 #include "swift/SILOptimizer/PassManager/Transforms.h"
@@ -135,6 +136,7 @@ class COWArrayOpt {
   typedef StructUseCollector::UserOperList UserOperList;
 
   RCIdentityFunctionInfo *RCIA;
+  SideEffectAnalysis *SEA;
   SILFunction *Function;
   SILLoop *Loop;
   SILBasicBlock *Preheader;
@@ -182,8 +184,9 @@ class COWArrayOpt {
   // analyzing.
   SILValue CurrentArrayAddr;
 public:
-  COWArrayOpt(RCIdentityFunctionInfo *RCIA, SILLoop *L, DominanceAnalysis *DA)
-      : RCIA(RCIA), Function(L->getHeader()->getParent()), Loop(L),
+  COWArrayOpt(RCIdentityFunctionInfo *RCIA, SideEffectAnalysis *SEA,
+              SILLoop *L, DominanceAnalysis *DA)
+      : RCIA(RCIA), SEA(SEA), Function(L->getHeader()->getParent()), Loop(L),
         Preheader(L->getLoopPreheader()), DomTree(DA->get(Function)),
         ColdBlocks(DA), CachedSafeLoop(false, false) {}
 
@@ -622,6 +625,7 @@ bool COWArrayOpt::checkSafeElementValueUses(UserOperList &ElementValueUsers) {
 ///   * all array semantic functions
 ///   * stores to array elements
 ///   * any instruction that does not have side effects.
+///   * calls which provably only read memory (they cannot retain the array).
 ///   * any retain must be matched by a release before we hit astd::make_unique.
 ///
 /// Note, that a release in this modus (we don't have a uniquely identified
@@ -697,6 +701,20 @@ bool COWArrayOpt::hasLoopOnlyDestructorSafeArrayOperations() {
       if (isa<AllocationInst>(Inst) || isa<DeallocStackInst>(Inst))
         continue;
 
+      // Calls which provably only read memory are safe: they can neither
+      // mutate the array nor retain it, i.e. they cannot create a new
+      // reference to the array storage which would defeat the hoisted
+      // uniqueness check. Note that we must observe retains here because a
+      // retain inside the callee is all it takes to save an alias for a
+      // later mutation.
+      if (auto *AI = dyn_cast<ApplyInst>(Inst)) {
+        FunctionSideEffects E;
+        SEA->getCalleeEffects(E, AI);
+        if (E.getMemBehavior(RetainObserveKind::ObserveRetains) <=
+            SILInstruction::MemoryBehavior::MayRead)
+          continue;
+      }
+
       if (isa<RetainValueInst>(Inst) || isa<StrongRetainInst>(Inst))
         if (isRetainReleasedBeforeMutate(Inst, false))
           continue;
@@ -998,6 +1016,7 @@ class COWArrayOptPass : public SILFunctionTransform {
 
     auto *DA = PM->getAnalysis<DominanceAnalysis>();
     auto *LA = PM->getAnalysis<SILLoopAnalysis>();
+    auto *SEA = PM->getAnalysis<SideEffectAnalysis>();
     auto *RCIA =
       PM->getAnalysis<RCIdentityAnalysis>()->get(getFunction());
     SILLoopInfo *LI = LA->get(getFunction());
@@ -1018,7 +1037,7 @@ class COWArrayOptPass : public SILFunctionTransform {
 
     bool HasChanged = false;
     for (auto *L : Loops)
-      HasChanged |= COWArrayOpt(RCIA, L, DA).run();
+      HasChanged |= COWArrayOpt(RCIA, SEA, L, DA).run();
 
     if (HasChanged)
       invalidateAnalysis(SILAnalysis::InvalidationKind::CallsAndInstructions);
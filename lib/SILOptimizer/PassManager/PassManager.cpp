@@ -115,10 +115,20 @@ llvm::cl::opt<bool> SILVerifyWithoutInvalidation(
     "sil-verify-without-invalidation", llvm::cl::init(false),
     llvm::cl::desc("Verify after passes even if the pass has not invalidated"));
 
+llvm::cl::opt<bool> SILVerifyIncrementally(
+    "sil-verify-incrementally", llvm::cl::init(false),
+    llvm::cl::desc("With -sil-verify-all, only verify functions which changed "
+                   "since the last verification"));
+
 llvm::cl::opt<bool> SILDisableSkippingPasses(
     "sil-disable-skipping-passes", llvm::cl::init(false),
     llvm::cl::desc("Do not skip passes even if nothing was changed"));
 
+llvm::cl::opt<unsigned> SILFunctionPassConvergenceBudget(
+    "sil-function-pass-convergence-budget", llvm::cl::init(0),
+    llvm::cl::desc("If non-zero, remove a function from the pass pipeline "
+                   "after <N> consecutive passes did not change it"));
+
 llvm::cl::opt<bool> SILForceVerifyAll(
     "sil-verify-force-analysis", llvm::cl::init(false),
     llvm::cl::desc("For all passes, precompute analyses before the pass and "
@@ -450,7 +460,13 @@ void SILPassManager::runPassOnFunction(unsigned TransIdx, SILFunction *F) {
     F->dump(getOptions().EmitVerboseSIL);
   }
 
-  llvm::sys::TimePoint<> StartTime = std::chrono::system_clock::now();
+  // Timestamps are only consumed by -sil-print-pass-time and the
+  // optimizer-stats counters; don't pay for two clock reads on every
+  // pass run otherwise.
+  const bool ShouldTimePass = SILPrintPassTime || shouldCollectSILModuleStats();
+  llvm::sys::TimePoint<> StartTime =
+      ShouldTimePass ? std::chrono::system_clock::now()
+                     : llvm::sys::TimePoint<>();
   Mod->registerDeleteNotificationHandler(SFT);
   if (breakBeforeRunning(F->getName(), SFT))
     LLVM_BUILTIN_DEBUGTRAP;
@@ -470,7 +486,9 @@ void SILPassManager::runPassOnFunction(unsigned TransIdx, SILFunction *F) {
   assert(analysesUnlocked() && "Expected all analyses to be unlocked!");
   Mod->removeDeleteNotificationHandler(SFT);
 
-  auto Delta = (std::chrono::system_clock::now() - StartTime).count();
+  auto Delta = ShouldTimePass
+                   ? (std::chrono::system_clock::now() - StartTime).count()
+                   : 0;
   if (SILPrintPassTime) {
     llvm::dbgs() << Delta << " (" << SFT->getID() << "," << F->getName()
                  << ")\n";
@@ -493,6 +511,10 @@ void SILPassManager::runPassOnFunction(unsigned TransIdx, SILFunction *F) {
       (CurrentPassHasInvalidated || SILVerifyWithoutInvalidation)) {
     F->verify();
     verifyAnalyses(F);
+    // The function is known to be consistent now; don't re-verify it at the
+    // next incremental whole-module checkpoint unless it changes again.
+    if (SILVerifyIncrementally)
+      ChangedFunctions.erase(F);
   } else {
     if ((SILVerifyAfterPass.end() != std::find_if(SILVerifyAfterPass.begin(),
                                                   SILVerifyAfterPass.end(),
@@ -508,6 +530,27 @@ void SILPassManager::runPassOnFunction(unsigned TransIdx, SILFunction *F) {
   ++NumPassesRun;
 }
 
+bool SILPassManager::allRemainingPassesWouldBeSkipped(SILFunction *F,
+                                                      unsigned TransIdx,
+                                                      unsigned ToTransIdx) {
+  if (SILDisableSkippingPasses)
+    return false;
+
+  auto found = CompletedPassesMap.find(F);
+  if (found == CompletedPassesMap.end())
+    return false;
+  const CompletedPasses &completedPasses = found->second;
+
+  for (unsigned Idx = TransIdx; Idx < ToTransIdx; ++Idx) {
+    auto *SFT = cast<SILFunctionTransform>(Transformations[Idx]);
+    if (isMandatoryFunctionPass(SFT))
+      return false;
+    if (!completedPasses.test((size_t)SFT->getPassKind()))
+      return false;
+  }
+  return true;
+}
+
 void SILPassManager::
 runFunctionPasses(unsigned FromTransIdx, unsigned ToTransIdx) {
   if (ToTransIdx <= FromTransIdx)
@@ -564,8 +607,32 @@ runFunctionPasses(unsigned FromTransIdx, unsigned ToTransIdx) {
     if (shouldRestartPipeline() && Entry.NumRestarts < MaxNumRestarts) {
       ++Entry.NumRestarts;
       Entry.PipelineIdx = 0;
+      Entry.NumConsecutiveUnchanged = 0;
     } else {
       ++Entry.PipelineIdx;
+
+      // Check if the function has converged. A pass which left the function
+      // unchanged has its completed-bit set (this also covers the case where
+      // the pass was skipped because the bit was set already).
+      auto *SFT =
+          cast<SILFunctionTransform>(Transformations[FromTransIdx +
+                                                     PipelineIdx]);
+      if (!isMandatoryFunctionPass(SFT) &&
+          CompletedPassesMap[F].test((size_t)SFT->getPassKind())) {
+        ++Entry.NumConsecutiveUnchanged;
+        // If all remaining passes would be skipped anyway, or the function
+        // exhausted its convergence budget, fast-forward to the end of the
+        // pipeline so that it gets popped off the worklist.
+        if (allRemainingPassesWouldBeSkipped(F, FromTransIdx + Entry.PipelineIdx,
+                                             ToTransIdx) ||
+            (SILFunctionPassConvergenceBudget != 0 &&
+             Entry.NumConsecutiveUnchanged >=
+                 SILFunctionPassConvergenceBudget)) {
+          Entry.PipelineIdx = ToTransIdx - FromTransIdx;
+        }
+      } else {
+        Entry.NumConsecutiveUnchanged = 0;
+      }
     }
     clearRestartPipeline();
   }
@@ -633,7 +700,10 @@ void SILPassManager::runModulePass(unsigned TransIdx) {
 
   if (Options.VerifyAll &&
       (CurrentPassHasInvalidated || !SILVerifyWithoutInvalidation)) {
-    Mod->verify();
+    if (SILVerifyIncrementally)
+      verifyChangedFunctions();
+    else
+      Mod->verify();
     verifyAnalyses();
   } else {
     if ((SILVerifyAfterPass.end() != std::find_if(SILVerifyAfterPass.begin(),
@@ -648,6 +718,23 @@ void SILPassManager::runModulePass(unsigned TransIdx) {
   }
 }
 
+void SILPassManager::verifyChangedFunctions() {
+  // Changes to the module-level tables cannot be attributed to individual
+  // functions, so they invalidate the whole checkpoint.
+  if (ModuleLevelChange) {
+    Mod->verify();
+    ModuleLevelChange = false;
+    ChangedFunctions.clear();
+    return;
+  }
+
+  // Passes which delete a function notify the pass manager first, which
+  // removes it from ChangedFunctions, so all remaining entries are alive.
+  for (SILFunction *F : ChangedFunctions)
+    F->verify();
+  ChangedFunctions.clear();
+}
+
 void SILPassManager::executePassPipelinePlan(const SILPassPipelinePlan &Plan) {
   for (const SILPassPipeline &Pipeline : Plan.getPipelines()) {
     setStageName(Pipeline.Name);
@@ -737,6 +824,7 @@ SILPassManager::~SILPassManager() {
 }
 
 void SILPassManager::notifyOfNewFunction(SILFunction *F, SILTransform *T) {
+  ChangedFunctions.insert(F);
   if (doPrintAfter(T, F, SILPrintAll)) {
     dumpPassInfo("*** New SIL function in ", T, F);
     F->dump(getOptions().EmitVerboseSIL);
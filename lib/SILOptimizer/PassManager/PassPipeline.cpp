@@ -508,6 +508,12 @@ static void addHighLevelModulePipeline(SILPassPipelinePlan &P) {
   P.startPipeline("HighLevel,Module+StackPromote");
   P.addDeadFunctionElimination();
   P.addPerformanceSILLinker();
+
+  // Resolve indirect dispatch module-wide now that the high-level function
+  // pipeline has specialized and inlined the call tree. Doing this before the
+  // mid-level pipeline lets the inliner see through the devirtualized calls.
+  P.addWholeModuleDevirtualizer();
+
   P.addDeadObjectElimination();
   P.addGlobalPropertyOpt();
 
@@ -564,11 +570,23 @@ static void addClosureSpecializePassPipeline(SILPassPipelinePlan &P) {
   P.addPerformanceConstantPropagation();
   P.addSimplifyCFG();
 
+  // Outline constant literal aggregates (e.g. arrays of constants) into
+  // statically initialized objects as soon as the array intrinsics have been
+  // inlined, so that GlobalOpt, LetPropertiesOpt and the remaining
+  // optimization rounds can fold reads from them. The run in the low-level
+  // pipeline stays as a catch-all for allocations that only become constant
+  // later.
+  P.addObjectOutliner();
+
   // Hoist globals out of loops.
   // Global-init functions should not be inlined GlobalOpt is done.
   P.addGlobalOpt();
   P.addLetPropertiesOpt();
 
+  // Propagate literal arguments which are the same at every call site into
+  // their callees, so that the cleanup passes below can fold with them.
+  P.addConstantArgumentPropagation();
+
   // Propagate constants into closures and convert to static dispatch.  This
   // should run after specialization and inlining because we don't want to
   // specialize a call that can be inlined. It should run before
@@ -617,6 +635,10 @@ static void addLowLevelPassPipeline(SILPassPipelinePlan &P) {
 static void addLateLoopOptPassPipeline(SILPassPipelinePlan &P) {
   P.startPipeline("LateLoopOpt");
 
+  // Redirect references to duplicate thunks onto a canonical copy so that
+  // the dead-function elimination below can delete the rest.
+  P.addThunkDeduplication();
+
   // Delete dead code and drop the bodies of shared functions.
   // Also, remove externally available witness tables. They are not needed
   // anymore after the last devirtualizer run.
@@ -644,6 +666,7 @@ static void addLateLoopOptPassPipeline(SILPassPipelinePlan &P) {
 
   // Optimize overflow checks.
   P.addRedundantOverflowCheckRemoval();
+  P.addRedundantCondFailRemoval();
   P.addMergeCondFails();
 
   // Remove dead code.
@@ -670,9 +693,19 @@ static void addLastChanceOptPassPipeline(SILPassPipelinePlan &P) {
   // A loop might have only one dynamic access now, i.e. hoistable
   P.addLICM();
 
+  // Convert reference counting of objects which provably never leave their
+  // allocating thread to non-atomic operations. Runs late so that inlining
+  // and the ARC optimizations already removed all removable operations.
+  P.addNonAtomicRC();
+
   // Only has an effect if the -assume-single-thread option is specified.
   P.addAssumeSingleThreaded();
 
+  // Annotate branches into precondition-failure and other dead-end regions
+  // with probabilities so LLVM's block placement moves them out of the hot
+  // path. Runs after all CFG-mutating optimizations.
+  P.addColdPathLayout();
+
   // Only has an effect if opt-remark is enabled.
   P.addOptRemarkGenerator();
 
@@ -144,6 +144,29 @@ public:
   }
 };
 
+/// Returns true if SILCombiner declares a visitor for instructions of the
+/// given kind.
+///
+/// Most instruction kinds have no combine and their dispatch just falls
+/// through to the do-nothing default. Knowing that up front lets the driver
+/// skip the visit stage for them entirely. The table is derived from the
+/// visitor declarations themselves: taking the address of an inherited
+/// default visit method yields a pointer-to-member of the visitor base class,
+/// so the exact type comparison below holds only for the methods SILCombiner
+/// overrides. All of SILCombiner's visitors are declared for concrete
+/// instruction classes; a visitor declared for an abstract class would not be
+/// detected here.
+static constexpr bool hasCombinerVisitor(SILInstructionKind kind) {
+  switch (kind) {
+#define INST(CLASS, PARENT)                                                    \
+  case SILInstructionKind::CLASS:                                              \
+    return std::is_same<decltype(&SILCombiner::visit##CLASS),                  \
+                        SILInstruction *(SILCombiner::*)(CLASS *)>::value;
+#include "swift/SIL/SILNodes.def"
+  }
+  llvm_unreachable("covered switch");
+}
+
 bool SILCombiner::doOneIteration(SILFunction &F, unsigned Iteration) {
   MadeChange = false;
 
@@ -182,6 +205,12 @@ bool SILCombiner::doOneIteration(SILFunction &F, unsigned Iteration) {
       continue;
     }
 
+    // If there is no combine for this kind of instruction, we are done with
+    // it: the DCE and canonicalization stages above are the only ones that
+    // apply to every instruction.
+    if (!hasCombinerVisitor(I->getKind()))
+      continue;
+
     // If we have reached this point, all attempts to do simple simplifications
     // have failed. Prepare to SILCombine.
     Builder.setInsertionPoint(I);
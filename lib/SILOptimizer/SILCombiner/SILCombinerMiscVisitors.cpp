@@ -22,6 +22,7 @@
 #include "swift/SIL/SILVisitor.h"
 #include "swift/SILOptimizer/Analysis/ARCAnalysis.h"
 #include "swift/SILOptimizer/Analysis/AliasAnalysis.h"
+#include "swift/SILOptimizer/Analysis/DominanceAnalysis.h"
 #include "swift/SILOptimizer/Analysis/ValueTracking.h"
 #include "swift/SILOptimizer/Utils/CFGOptUtils.h"
 #include "swift/SILOptimizer/Utils/Devirtualize.h"
@@ -54,39 +55,66 @@ SILCombiner::visitAllocExistentialBoxInst(AllocExistentialBoxInst *AEBI) {
   //   store %7 to %6#1 : $*ColorError
   //   debug_value %6#0 : $Error
   //   strong_release %6#0 : $Error
+  //
+  // The box may also be retained and released multiple times, e.g. when it is
+  // copied along a chain of calls which got inlined. The box is just a
+  // reference counted container for the stored value, so as long as it does
+  // not escape we can forward all of its reference counting operations to the
+  // value directly and get rid of the allocation.
 
   SILValue boxedValue =
     getConcreteValueOfExistentialBox(AEBI, /*ignoreUser*/ nullptr);
   if (!boxedValue)
     return nullptr;
 
-  // Check if the box is released at a single place. That's the end of its
-  // lifetime.
-  StrongReleaseInst *singleRelease = nullptr;
+  // Collect all reference counting operations on the box. Any other users are
+  // already known to be harmless, otherwise getConcreteValueOfExistentialBox
+  // would have bailed.
+  SmallVector<RefCountingInst *, 4> rcOperations;
+  bool hasRelease = false;
   for (Operand *use : AEBI->getUses()) {
-    if (auto *RI = dyn_cast<StrongReleaseInst>(use->getUser())) {
-      // If this is not the only release of the box then bail out.
-      if (singleRelease)
-        return nullptr;
-      singleRelease = RI;
+    SILInstruction *user = use->getUser();
+    if (isa<StrongRetainInst>(user) || isa<StrongReleaseInst>(user)) {
+      rcOperations.push_back(cast<RefCountingInst>(user));
+      hasRelease |= isa<StrongReleaseInst>(user);
     }
   }
-  if (!singleRelease)
+  // Without any release the box leaks and we leave it alone.
+  if (!hasRelease)
     return nullptr;
 
-  // Release the value that was stored into the existential box. The box
-  // is going away so we need to release the stored value.
-  // NOTE: It's important that the release is inserted at the single
-  // release of the box and not at the store, because a balancing retain could
-  // be _after_ the store, e.g:
+  // The replacement operations operate on the boxed value, so its definition
+  // must be available at all of them.
+  DominanceInfo *DT = DA->get(AEBI->getFunction());
+  for (RefCountingInst *rcOperation : rcOperations) {
+    if (!DT->properlyDominates(boxedValue, rcOperation))
+      return nullptr;
+  }
+
+  // Turn each retain and release of the box into a retain and release of the
+  // stored value. At every point of execution the box's reference count equals
+  // one plus the retains minus the releases seen so far, so the rewritten
+  // operations never over-release the value and the dynamically last release
+  // of the box - which would have destroyed the stored value - becomes the
+  // balancing release of the store's +1.
+  // NOTE: It's important that the releases are inserted at the releases of the
+  // box and not at the store, because a balancing retain could be _after_ the
+  // store, e.g:
   //      %box = alloc_existential_box
   //      %addr = project_existential_box %box
   //      store %value to %addr
   //      retain_value %value    // must insert the release after this retain
   //      strong_release %box
-  Builder.setInsertionPoint(singleRelease);
-  Builder.createReleaseValue(AEBI->getLoc(), boxedValue,
-                             singleRelease->getAtomicity());
+  for (RefCountingInst *rcOperation : rcOperations) {
+    Builder.setInsertionPoint(rcOperation);
+    if (isa<StrongRetainInst>(rcOperation)) {
+      Builder.createRetainValue(AEBI->getLoc(), boxedValue,
+                                rcOperation->getAtomicity());
+    } else {
+      Builder.createReleaseValue(AEBI->getLoc(), boxedValue,
+                                 rcOperation->getAtomicity());
+    }
+  }
 
   eraseInstIncludingUsers(AEBI);
   return nullptr;
@@ -1062,9 +1090,24 @@ SILInstruction *SILCombiner::visitCondFailInst(CondFailInst *CFI) {
   return nullptr;
 }
 
+/// Return true if \p value is the result of a global_value instruction,
+/// looking through upcasts. Such objects are statically initialized and
+/// immortal at runtime, so retaining or releasing them is a no-op and no
+/// deinitializer can ever run.
+static bool isImmortalGlobalObject(SILValue value) {
+  while (auto *upcast = dyn_cast<UpcastInst>(value))
+    value = upcast->getOperand();
+  return isa<GlobalValueInst>(value);
+}
+
 SILInstruction *SILCombiner::visitStrongRetainInst(StrongRetainInst *SRI) {
   assert(!SRI->getFunction()->hasOwnership());
 
+  // Retain of a statically-initialized global object is a no-op: the object
+  // is immortal.
+  if (isImmortalGlobalObject(SRI->getOperand()))
+    return eraseInstFromFunction(*SRI);
+
   // Retain of ThinToThickFunction is a no-op.
   SILValue funcOper = SRI->getOperand();
   if (auto *CFI = dyn_cast<ConvertFunctionInst>(funcOper))
@@ -1621,6 +1664,11 @@ visitUncheckedTakeEnumDataAddrInst(UncheckedTakeEnumDataAddrInst *TEDAI) {
 SILInstruction *SILCombiner::visitStrongReleaseInst(StrongReleaseInst *SRI) {
   assert(!SRI->getFunction()->hasOwnership());
 
+  // Release of a statically-initialized global object is a no-op: the object
+  // is immortal and its deinitializer can never run.
+  if (isImmortalGlobalObject(SRI->getOperand()))
+    return eraseInstFromFunction(*SRI);
+
   // Release of ThinToThickFunction is a no-op.
   if (isa<ThinToThickFunctionInst>(SRI->getOperand()))
     return eraseInstFromFunction(*SRI);
@@ -71,6 +71,7 @@
 
 #define DEBUG_TYPE "sil-rr-code-motion"
 #include "swift/SIL/InstructionUtils.h"
+#include "swift/SIL/SILArgument.h"
 #include "swift/SIL/SILBuilder.h"
 #include "swift/SILOptimizer/Analysis/ARCAnalysis.h"
 #include "swift/SILOptimizer/Analysis/AliasAnalysis.h"
@@ -97,6 +98,18 @@ STATISTIC(NumReleasesHoisted, "Number of releases hoisted");
 
 llvm::cl::opt<bool> DisableARCCodeMotion("disable-arc-cm", llvm::cl::init(false));
 
+/// Return true if \p Root is a function argument with a guaranteed
+/// convention. The caller keeps such a value alive for the whole duration of
+/// the function, so no decrement inside the function can possibly destroy it.
+/// The only effect of retains and releases on such a value that remains
+/// observable is the reference count itself, which uniqueness checks read.
+static bool isGuaranteedFunctionArgument(SILValue Root) {
+  auto *Arg = dyn_cast<SILFunctionArgument>(Root);
+  if (!Arg)
+    return false;
+  return Arg->getArgumentConvention().isGuaranteedConvention();
+}
+
 //===----------------------------------------------------------------------===//
 //                             Block State 
 //===----------------------------------------------------------------------===//
@@ -325,8 +338,16 @@ class RetainCodeMotionContext : public CodeMotionContext {
                  << "Retain " << Ptr << "  at refcount check " << *II);
       return true;
     }
-    // mayDecrement reference count stops code motion.
-    if (mayDecrementRefCount(II, Ptr, AA)) {
+    // mayDecrement reference count stops code motion, unless the root is a
+    // guaranteed function argument. A decrement can never destroy such a
+    // value, so the retain may keep sinking across it. This is what moves
+    // retain/release pairs on loop-live arguments out of tight loops: the
+    // calls in the loop body no longer pin the retain. Releases of the root
+    // itself still block; sinking the retain below one would let the local
+    // balance dip below zero and release the caller's reference.
+    if (mayDecrementRefCount(II, Ptr, AA) &&
+        (!isGuaranteedFunctionArgument(Ptr) ||
+         (isReleaseInstruction(II) && getRCRoot(II) == Ptr))) {
       LLVM_DEBUG(if (printCtx) llvm::dbgs()
                  << "Retain " << Ptr << "  at may decrement " << *II);
       return true;
@@ -692,8 +713,15 @@ class ReleaseCodeMotionContext : public CodeMotionContext {
                  << "Release " << Ptr << "  at matching release " << *II);
       return true;
     }
-    // Stop at may interfere.
-    if (mayHaveSymmetricInterference(II, Ptr, AA)) {
+    // Stop at may interfere. A guaranteed function argument outlives the
+    // function no matter where this release ends up, so uses and decrements
+    // of it do not interfere. Two barriers remain for it: uniqueness checks,
+    // which observe the reference count itself, and retains of the root,
+    // above which the release must not move or the local balance would dip
+    // below zero and release the caller's reference.
+    if (mayHaveSymmetricInterference(II, Ptr, AA) &&
+        (!isGuaranteedFunctionArgument(Ptr) || mayCheckRefCount(II) ||
+         (isRetainInstruction(II) && getRCRoot(II) == Ptr))) {
       LLVM_DEBUG(if (printCtx) llvm::dbgs()
                  << "Release " << Ptr << "  at interference " << *II);
       return true;
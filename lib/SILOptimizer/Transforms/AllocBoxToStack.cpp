@@ -18,6 +18,7 @@
 #include "swift/SIL/SILArgument.h"
 #include "swift/SIL/SILBuilder.h"
 #include "swift/SIL/SILCloner.h"
+#include "swift/SILOptimizer/Analysis/EscapeAnalysis.h"
 #include "swift/SILOptimizer/PassManager/Passes.h"
 #include "swift/SILOptimizer/PassManager/Transforms.h"
 #include "swift/SILOptimizer/Utils/InstOptUtils.h"
@@ -217,23 +218,34 @@ static bool getFinalReleases(SILValue Box,
 /// not have that many arguments and even fewer promoted arguments.
 using ArgIndexList = SmallVector<unsigned, 8>;
 
-static bool partialApplyEscapes(SILValue V, bool examineApply);
+static bool partialApplyEscapes(SILValue V, bool examineApply,
+                                EscapeAnalysis *EA);
 
 /// Could this operand to an apply escape that function by being
 /// stored or returned?
-static bool applyArgumentEscapes(FullApplySite Apply, Operand *O) {
-  SILFunction *F = Apply.getReferencedFunctionOrNull();
-  // If we cannot examine the function body, assume the worst.
-  if (!F || F->empty())
-    return true;
-
+static bool applyArgumentEscapes(FullApplySite Apply, Operand *O,
+                                 EscapeAnalysis *EA) {
   // Check the uses of the operand, but do not recurse down into other
   // apply instructions.
-  auto calleeArg = F->getArgument(Apply.getCalleeArgIndex(*O));
-  return partialApplyEscapes(calleeArg, /* examineApply = */ false);
+  SILFunction *F = Apply.getReferencedFunctionOrNull();
+  if (F && !F->empty()) {
+    auto calleeArg = F->getArgument(Apply.getCalleeArgIndex(*O));
+    if (!partialApplyEscapes(calleeArg, /* examineApply = */ false, EA))
+      return false;
+  }
+
+  // The one-level syntactic check failed, or we cannot examine the function
+  // body. Consult the interprocedural escape summary, which sees through
+  // chains of applies.
+  if (EA && !EA->canParameterEscape(Apply, Apply.getCalleeArgIndex(*O),
+                                    /*checkContentOfIndirectParam*/ false))
+    return false;
+
+  return true;
 }
 
-static bool partialApplyEscapes(SILValue V, bool examineApply) {
+static bool partialApplyEscapes(SILValue V, bool examineApply,
+                                EscapeAnalysis *EA) {
   SILModuleConventions ModConv(*V->getModule());
   SmallVector<Operand *, 32> Worklist(V->use_begin(), V->use_end());
   while (!Worklist.empty()) {
@@ -265,7 +277,7 @@ static bool partialApplyEscapes(SILValue V, bool examineApply) {
 
       // Optionally drill down into an apply to see if the operand is
       // captured in or returned from the apply.
-      if (examineApply && !applyArgumentEscapes(Apply, Op))
+      if (examineApply && !applyArgumentEscapes(Apply, Op, EA))
         continue;
     }
 
@@ -277,7 +289,7 @@ static bool partialApplyEscapes(SILValue V, bool examineApply) {
       auto Params = PartialApply->getSubstCalleeType()->getParameters();
       Params = Params.slice(Params.size() - Args.size(), Args.size());
       if (ModConv.isSILIndirect(Params[Op->getOperandNumber() - 1])) {
-        if (partialApplyEscapes(PartialApply, /*examineApply = */ true))
+        if (partialApplyEscapes(PartialApply, /*examineApply = */ true, EA))
           return true;
         continue;
       }
@@ -291,7 +303,8 @@ static bool partialApplyEscapes(SILValue V, bool examineApply) {
 
 static SILInstruction *recursivelyFindBoxOperandsPromotableToAddress(
     SILValue Box, bool inAppliedFunction, SmallVectorImpl<Operand *> &,
-    SmallPtrSetImpl<SILFunction *> &, unsigned CurrentRecurDepth);
+    SmallPtrSetImpl<SILFunction *> &, EscapeAnalysis *EA,
+    unsigned CurrentRecurDepth);
 
 /// checkLocalApplyBody - Check the body of an apply's callee to see
 /// if the box pointer argument passed to it has uses that would
@@ -300,6 +313,7 @@ static SILInstruction *recursivelyFindBoxOperandsPromotableToAddress(
 static bool checkLocalApplyBody(Operand *O,
                                 SmallVectorImpl<Operand *> &PromotedOperands,
                                 SmallPtrSetImpl<SILFunction *> &VisitedCallees,
+                                EscapeAnalysis *EA,
                                 unsigned CurrentRecurDepth) {
   SILFunction *F = ApplySite(O->getUser()).getReferencedFunctionOrNull();
   // If we cannot examine the function body, assume the worst.
@@ -315,7 +329,7 @@ static bool checkLocalApplyBody(Operand *O,
   auto calleeArg = F->getArgument(ApplySite(O->getUser()).getCalleeArgIndex(*O));
   auto res = !recursivelyFindBoxOperandsPromotableToAddress(
       calleeArg,
-      /* inAppliedFunction = */ true, PromotedOperands, VisitedCallees,
+      /* inAppliedFunction = */ true, PromotedOperands, VisitedCallees, EA,
       CurrentRecurDepth + 1);
   return res;
 }
@@ -361,7 +375,7 @@ static bool isOptimizableApplySite(ApplySite Apply) {
 static SILInstruction *recursivelyFindBoxOperandsPromotableToAddress(
     SILValue Box, bool inAppliedFunction,
     SmallVectorImpl<Operand *> &PromotedOperands,
-    SmallPtrSetImpl<SILFunction *> &VisitedCallees,
+    SmallPtrSetImpl<SILFunction *> &VisitedCallees, EscapeAnalysis *EA,
     unsigned CurrentRecurDepth = 0) {
   assert((Box->getType().is<SILBoxType>()
           || Box->getType()
@@ -400,10 +414,10 @@ static SILInstruction *recursivelyFindBoxOperandsPromotableToAddress(
       }
       switch (Apply.getKind()) {
       case ApplySiteKind::PartialApplyInst: {
-        if (checkLocalApplyBody(Op, LocalPromotedOperands, VisitedCallees,
+        if (checkLocalApplyBody(Op, LocalPromotedOperands, VisitedCallees, EA,
                                 CurrentRecurDepth) &&
             !partialApplyEscapes(cast<PartialApplyInst>(User),
-                                 /* examineApply = */ true)) {
+                                 /* examineApply = */ true, EA)) {
           LocalPromotedOperands.push_back(Op);
           continue;
         }
@@ -413,7 +427,7 @@ static SILInstruction *recursivelyFindBoxOperandsPromotableToAddress(
       case ApplySiteKind::BeginApplyInst:
       case ApplySiteKind::TryApplyInst:
         if (isOptimizableApplySite(Apply) &&
-            checkLocalApplyBody(Op, LocalPromotedOperands, VisitedCallees,
+            checkLocalApplyBody(Op, LocalPromotedOperands, VisitedCallees, EA,
                                 CurrentRecurDepth)) {
           LocalPromotedOperands.push_back(Op);
           continue;
@@ -436,14 +450,14 @@ static InFlightDiagnostic diagnose(ASTContext &Context, SourceLoc loc,
 }
 
 /// canPromoteAllocBox - Can we promote this alloc_box to an alloc_stack?
-static bool canPromoteAllocBox(AllocBoxInst *ABI,
+static bool canPromoteAllocBox(AllocBoxInst *ABI, EscapeAnalysis *EA,
                                SmallVectorImpl<Operand *> &PromotedOperands) {
   SmallPtrSet<SILFunction *, 8> VisitedCallees;
   // Scan all of the uses of the address of the box to see if any
   // disqualifies the box from being promoted to the stack.
   if (auto *User = recursivelyFindBoxOperandsPromotableToAddress(
           ABI,
-          /* inAppliedFunction = */ false, PromotedOperands, VisitedCallees,
+          /* inAppliedFunction = */ false, PromotedOperands, VisitedCallees, EA,
           /* CurrentRecurDepth = */ 0)) {
     (void)User;
     // Otherwise, we have an unexpected use.
@@ -1077,11 +1091,13 @@ class AllocBoxToStack : public SILFunctionTransform {
     if (getFunction()->wasDeserializedCanonical())
       return;
 
+    auto *EA = PM->getAnalysis<EscapeAnalysis>();
+
     AllocBoxToStackState pass(this);
     for (auto &BB : *getFunction()) {
       for (auto &I : BB)
         if (auto *ABI = dyn_cast<AllocBoxInst>(&I))
-          if (canPromoteAllocBox(ABI, pass.PromotedOperands))
+          if (canPromoteAllocBox(ABI, EA, pass.PromotedOperands))
             pass.Promotable.push_back(ABI);
     }
 
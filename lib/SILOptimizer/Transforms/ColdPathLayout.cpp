@@ -0,0 +1,117 @@
+//===--- ColdPathLayout.cpp - Push cold paths out of the hot code ---------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2017 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+//
+// Annotate conditional branches whose one side is statically known to be cold
+// with branch probabilities. A successor is considered cold if it is a
+// dead-end region (every path ends in an unreachable, e.g. a precondition
+// failure) or if ColdBlockInfo identifies it as the slow path of a branch
+// hint. IRGen lowers the probabilities to LLVM branch weights, which lets
+// LLVM's block placement lay out the failure and error continuations after
+// the hot code instead of interleaved with it.
+//
+// Branches which already carry real profile data are left alone.
+//
+//===----------------------------------------------------------------------===//
+
+#define DEBUG_TYPE "sil-cold-path-layout"
+
+#include "swift/SIL/BasicBlockUtils.h"
+#include "swift/SIL/SILBuilder.h"
+#include "swift/SIL/SILFunction.h"
+#include "swift/SIL/SILInstruction.h"
+#include "swift/SILOptimizer/Analysis/ColdBlockInfo.h"
+#include "swift/SILOptimizer/Analysis/DominanceAnalysis.h"
+#include "swift/SILOptimizer/PassManager/Transforms.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/Statistic.h"
+
+STATISTIC(NumBranchesAnnotated,
+          "Number of cold branches annotated with probabilities");
+
+using namespace swift;
+
+namespace {
+
+/// The weights used for an annotated branch. These match the ratio LLVM uses
+/// for llvm.expect, so a statically detected cold edge is treated like an
+/// explicit branch hint downstream.
+static constexpr uint64_t HotBranchWeight = 2000;
+static constexpr uint64_t ColdBranchWeight = 1;
+
+class ColdPathLayout : public SILFunctionTransform {
+
+  /// The entry point to the transformation.
+  void run() override {
+    SILFunction *F = getFunction();
+
+    auto *DA = PM->getAnalysis<DominanceAnalysis>();
+    ColdBlockInfo ColdBlocks(DA);
+    DeadEndBlocks DEBlocks(F);
+
+    // Collect the candidates first; annotating replaces the terminator.
+    llvm::SmallVector<CondBranchInst *, 8> Candidates;
+    for (SILBasicBlock &BB : *F) {
+      auto *CBI = dyn_cast<CondBranchInst>(BB.getTerminator());
+      if (!CBI)
+        continue;
+
+      // Don't second-guess measured profile data.
+      if (CBI->getTrueBBCount() || CBI->getFalseBBCount())
+        continue;
+
+      Candidates.push_back(CBI);
+    }
+
+    bool Changed = false;
+    for (CondBranchInst *CBI : Candidates) {
+      bool trueIsCold = isCold(CBI->getTrueBB(), ColdBlocks, DEBlocks);
+      bool falseIsCold = isCold(CBI->getFalseBB(), ColdBlocks, DEBlocks);
+
+      // Only annotate if exactly one side is cold; a branch between two
+      // failure paths carries no layout information.
+      if (trueIsCold == falseIsCold)
+        continue;
+
+      SILBuilderWithScope Builder(CBI);
+      Builder.createCondBranch(
+          CBI->getLoc(), CBI->getCondition(), CBI->getTrueBB(),
+          CBI->getTrueArgs(), CBI->getFalseBB(), CBI->getFalseArgs(),
+          ProfileCounter(trueIsCold ? ColdBranchWeight : HotBranchWeight),
+          ProfileCounter(falseIsCold ? ColdBranchWeight : HotBranchWeight));
+      CBI->eraseFromParent();
+      ++NumBranchesAnnotated;
+      Changed = true;
+    }
+
+    if (Changed) {
+      invalidateAnalysis(SILAnalysis::InvalidationKind::Instructions);
+    }
+  }
+
+  /// Is \p BB statically known to be rarely executed?
+  static bool isCold(SILBasicBlock *BB, ColdBlockInfo &ColdBlocks,
+                     DeadEndBlocks &DEBlocks) {
+    // Dead-end regions never return to the caller: precondition failures,
+    // fatalError calls and similar trap continuations.
+    if (DEBlocks.isDeadEnd(BB))
+      return true;
+
+    // Slow paths identified from branch hints.
+    return ColdBlocks.isCold(BB);
+  }
+};
+
+} // end anonymous namespace
+
+SILTransform *swift::createColdPathLayout() {
+  return new ColdPathLayout();
+}
@@ -445,6 +445,13 @@ private:
   /// Get the bit representing the location in the LocationVault.
   unsigned getLocationBit(const LSLocation &L);
 
+  /// Returns true if \p L was enumerated in the LocationVault. A location may
+  /// stay unenumerated because of the location limit; accesses to it are then
+  /// handled like unknown memory instructions.
+  bool isTrackedLocation(const LSLocation &L) {
+    return LocToBitIndex.find(L) != LocToBitIndex.end();
+  }
+
 public:
   /// Constructor.
   DSEContext(SILFunction *F, SILModule *M, SILPassManager *PM,
@@ -860,6 +867,13 @@ void DSEContext::processRead(SILInstruction *I, SILValue Mem, DSEKind Kind) {
   LSLocation::expand(L, &I->getModule(),
                      TypeExpansionContext(*I->getFunction()), Locs, TE);
 
+  // If the location stayed unenumerated because of the location limit, treat
+  // it as an unknown memory read.
+  if (!Locs.empty() && !isTrackedLocation(Locs[0])) {
+    processUnknownReadInst(I, Kind);
+    return;
+  }
+
   // Are we building the genset and killset.
   if (isBuildingGenKillSet(Kind)) {
     for (auto &E : Locs) {
@@ -946,6 +960,13 @@ void DSEContext::processWrite(SILInstruction *I, SILValue Val, SILValue Mem,
   LSLocation::expand(L, Mod, TypeExpansionContext(*I->getFunction()), Locs, TE);
   SmallBitVector V(Locs.size());
 
+  // If the location stayed unenumerated because of the location limit, the
+  // store cannot be a candidate; ignore it like a store whose location
+  // cannot be formed. A write never keeps an earlier store alive, so this
+  // is conservative.
+  if (!Locs.empty() && !isTrackedLocation(Locs[0]))
+    return;
+
   // Are we computing max store set.
   if (isComputeMaxStoreSet(Kind)) {
     for (auto &E : Locs) {
@@ -1191,9 +1212,14 @@ void DSEContext::runIterativeDSE() {
 bool DSEContext::run() {
   std::pair<int, int> LSCount = std::make_pair(0, 0);
   // Walk over the function and find all the locations accessed by
-  // this function.
+  // this function. Cap the number of enumerated locations so that the data
+  // flow stays within budget even on large functions, instead of giving up
+  // on them entirely. Accesses to unenumerated locations are handled
+  // conservatively.
+  unsigned LocationLimit =
+      MaxLSLocationBBMultiplicationNone / std::max(1u, (unsigned)F->size());
   LSLocation::enumerateLSLocations(*F, LocationVault, LocToBitIndex,
-                                   BaseToLocIndex, TE, LSCount);
+                                   BaseToLocIndex, TE, LSCount, LocationLimit);
 
   // Check how to optimize this function.
   ProcessKind Kind = getProcessFunctionKind(LSCount.second);
@@ -15,10 +15,15 @@
 #include "swift/SIL/SILBuilder.h"
 #include "swift/SIL/SILInstruction.h"
 #include "swift/SILOptimizer/Analysis/Analysis.h"
+#include "swift/SILOptimizer/Analysis/ArraySemantic.h"
+#include "swift/SILOptimizer/Analysis/ValueTracking.h"
 #include "swift/SILOptimizer/PassManager/Passes.h"
 #include "swift/SILOptimizer/PassManager/Transforms.h"
 #include "swift/SILOptimizer/Utils/InstOptUtils.h"
 
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/Support/Debug.h"
 
 using namespace swift;
@@ -32,6 +37,126 @@ static bool hasOverflowConditionOperand(CondFailInst *CFI) {
   return false;
 }
 
+/// Return true if the overflow bit of the given arithmetic builtin is guarded
+/// by a cond_fail, so that the checked code never observes a wrapped result.
+static bool hasGuardedOverflowBit(BuiltinInst *BI) {
+  for (auto *Use : BI->getUses()) {
+    auto *TEI = dyn_cast<TupleExtractInst>(Use->getUser());
+    if (!TEI || TEI->getFieldNo() != 1)
+      continue;
+    for (auto *TUse : TEI->getUses())
+      if (isa<CondFailInst>(TUse->getUser()))
+        return true;
+  }
+  return false;
+}
+
+/// Return true if \p V is known to be a non-negative integer.
+static bool isKnownNonNegative(SILValue V) {
+  if (auto SignBit = computeSignBit(V))
+    return !*SignBit;
+  // Array counts are never negative.
+  ArraySemanticsCall GetCount(V, "array.get_count");
+  return bool(GetCount);
+}
+
+namespace {
+/// A bounds-check-like cond_fail condition of the form
+///   cmp_uge (base + offset), bound
+/// where the addition, if present, is an overflow-checked signed add of a
+/// constant. A plain cmp_uge of \p base matches with a zero offset.
+struct IndexCheck {
+  CondFailInst *CondFail;
+  SILValue Base;
+  SILValue Bound;
+  llvm::APInt Offset;
+};
+} // end anonymous namespace
+
+/// Match a cond_fail condition of the form cmp_uge(base + constant, bound).
+static llvm::Optional<IndexCheck> matchIndexCheck(CondFailInst *CFI) {
+  auto *Cmp = dyn_cast<BuiltinInst>(CFI->getOperand());
+  if (!Cmp || Cmp->getBuiltinInfo().ID != BuiltinValueKind::ICMP_UGE)
+    return llvm::None;
+
+  SILValue Idx = Cmp->getArguments()[0];
+  auto IntTy = Idx->getType().getAs<BuiltinIntegerType>();
+  if (!IntTy || !IntTy->isFixedWidth())
+    return llvm::None;
+
+  IndexCheck Check;
+  Check.CondFail = CFI;
+  Check.Base = Idx;
+  Check.Bound = Cmp->getArguments()[1];
+  Check.Offset = llvm::APInt(IntTy->getFixedWidth(), 0);
+
+  // Peek through an overflow-checked "base + constant". The overflow bit must
+  // be guarded by its own cond_fail: it guarantees that the indices of a
+  // coalesced run never wrap, which the subsumption argument below relies on.
+  auto *TEI = dyn_cast<TupleExtractInst>(Idx);
+  if (!TEI || TEI->getFieldNo() != 0)
+    return Check;
+  auto *Add = dyn_cast<BuiltinInst>(TEI->getOperand());
+  if (!Add || Add->getBuiltinInfo().ID != BuiltinValueKind::SAddOver ||
+      !hasGuardedOverflowBit(Add))
+    return Check;
+
+  SILValue LHS = Add->getArguments()[0];
+  SILValue RHS = Add->getArguments()[1];
+  if (auto *Lit = dyn_cast<IntegerLiteralInst>(RHS)) {
+    Check.Base = LHS;
+    Check.Offset = Lit->getValue().sextOrTrunc(IntTy->getFixedWidth());
+  } else if (auto *Lit = dyn_cast<IntegerLiteralInst>(LHS)) {
+    Check.Base = RHS;
+    Check.Offset = Lit->getValue().sextOrTrunc(IntTy->getFixedWidth());
+  }
+  return Check;
+}
+
+/// Remove the bounds checks of an unrolled index run that are subsumed by
+/// the checks of the run's smallest and largest index.
+///
+/// The run's additions are overflow-checked and the bound is known to be
+/// non-negative, so if any index of the run fails its check (an unsigned
+/// comparison, which also catches negative indices), the smallest or the
+/// largest index fails as well: either all indices are non-negative and the
+/// largest subsumes the rest, or the smallest index is negative and its
+/// unsigned value already exceeds the bound.
+static bool coalesceIndexChecks(SmallVectorImpl<CondFailInst *> &CondFailToMerge) {
+  llvm::SmallDenseMap<std::pair<SILValue, SILValue>,
+                      SmallVector<IndexCheck, 8>, 4> Groups;
+  for (auto *CFI : CondFailToMerge)
+    if (auto Check = matchIndexCheck(CFI))
+      Groups[{Check->Base, Check->Bound}].push_back(*Check);
+
+  llvm::SmallPtrSet<CondFailInst *, 8> Subsumed;
+  for (auto &KV : Groups) {
+    auto &Checks = KV.second;
+    if (Checks.size() < 3 || !isKnownNonNegative(KV.first.second))
+      continue;
+
+    IndexCheck *Min = &Checks[0];
+    IndexCheck *Max = &Checks[0];
+    for (auto &Check : Checks) {
+      if (Check.Offset.slt(Min->Offset))
+        Min = &Check;
+      if (Check.Offset.sgt(Max->Offset))
+        Max = &Check;
+    }
+    for (auto &Check : Checks)
+      if (&Check != Min && &Check != Max)
+        Subsumed.insert(Check.CondFail);
+  }
+  if (Subsumed.empty())
+    return false;
+
+  llvm::erase_if(CondFailToMerge,
+                 [&](CondFailInst *CFI) { return Subsumed.count(CFI) != 0; });
+  for (auto *CFI : Subsumed)
+    CFI->eraseFromParent();
+  return true;
+}
+
 namespace {
 /// Merge cond_fail instructions.
 ///
@@ -92,8 +217,13 @@ public:
     assert(CondFailToMerge.size() > 1 &&
            "Need at least two cond_fail instructions");
 
+    // First drop the checks of an unrolled index run that are subsumed by
+    // the run's extreme indices; hoisting whole runs out of loops remains
+    // the job of ABCOpt.
+    bool Coalesced = coalesceIndexChecks(CondFailToMerge);
+
     if (CondFailToMerge.size() < 2)
-      return false;
+      return Coalesced;
 
     SILValue MergedCond;
     auto *LastCFI = CondFailToMerge.back();
@@ -0,0 +1,96 @@
+//===--- NonAtomicRC.cpp - Non-atomic RC of thread-confined objects -------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2021 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+//
+// Converts reference counting operations on provably thread-confined objects
+// into non-atomic ones.
+//
+// An object is thread-confined if it is allocated in the current function and
+// the allocated reference does not escape the function: then its whole
+// lifetime - allocation, all retains and releases, and deallocation - happens
+// on the allocating thread, so the atomic memory ordering of the reference
+// count updates buys nothing. Non-atomic increments and decrements are
+// significantly cheaper on most targets.
+//
+// Unlike the AssumeSingleThreaded pass, which rewrites every reference
+// counting operation based on a whole-program promise given by the user, this
+// pass only rewrites operations it can prove safe, so it is always enabled.
+// It is sound even if callees perform atomic operations on the same object:
+// mixing atomic and non-atomic updates is safe as long as all of them happen
+// on a single thread.
+//
+//===----------------------------------------------------------------------===//
+
+#define DEBUG_TYPE "nonatomic-rc"
+#include "swift/SIL/InstructionUtils.h"
+#include "swift/SIL/SILFunction.h"
+#include "swift/SIL/SILInstruction.h"
+#include "swift/SILOptimizer/Analysis/EscapeAnalysis.h"
+#include "swift/SILOptimizer/PassManager/Passes.h"
+#include "swift/SILOptimizer/PassManager/Transforms.h"
+#include "llvm/ADT/Statistic.h"
+#include "llvm/Support/Debug.h"
+
+STATISTIC(NumNonAtomicRC, "Number of rc instructions converted to non-atomic");
+
+using namespace swift;
+
+namespace {
+
+/// Converts reference counting instructions on non-escaping, locally
+/// allocated objects to their non-atomic form.
+class NonAtomicRC : public SILFunctionTransform {
+
+  /// The entry point to the transformation.
+  void run() override {
+    SILFunction *F = getFunction();
+
+    auto *EA = PM->getAnalysis<EscapeAnalysis>();
+    auto *ConGraph = EA->getConnectionGraph(F);
+
+    bool Changed = false;
+    for (SILBasicBlock &BB : *F) {
+      for (SILInstruction &I : BB) {
+        auto *RCInst = dyn_cast<RefCountingInst>(&I);
+        if (!RCInst || RCInst->isNonAtomic())
+          continue;
+
+        // Only locally allocated objects can be proven to be confined to the
+        // allocating thread. ObjC allocations may be counted by the ObjC
+        // runtime, which is not aware of non-atomic updates.
+        auto *ARI = dyn_cast<AllocRefInst>(
+            getUnderlyingObject(RCInst->getOperand(0)));
+        if (!ARI || ARI->isObjC())
+          continue;
+
+        // If the reference escapes the function, another thread may
+        // concurrently retain or release the object.
+        auto *contentNode = ConGraph->getValueContent(ARI);
+        if (!contentNode || contentNode->escapes())
+          continue;
+
+        LLVM_DEBUG(llvm::dbgs() << "Make non-atomic " << *RCInst);
+        RCInst->setNonAtomic();
+        ++NumNonAtomicRC;
+        Changed = true;
+      }
+    }
+    if (Changed) {
+      invalidateAnalysis(SILAnalysis::InvalidationKind::Instructions);
+    }
+  }
+};
+
+} // end anonymous namespace
+
+SILTransform *swift::createNonAtomicRC() {
+  return new NonAtomicRC();
+}
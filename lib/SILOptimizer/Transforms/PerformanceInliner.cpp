@@ -72,6 +72,17 @@ class SILPerformanceInliner {
   llvm::DenseMap<SILFunction *, ShortestPathAnalysis *> SPAs;
   llvm::SpecificBumpPtrAllocator<ShortestPathAnalysis> SPAAllocator;
 
+  /// Caches the decisions of ReabstractionInfo::canBeSpecialized.
+  ///
+  /// The same generic call inside a candidate callee is re-analyzed for every
+  /// caller-side apply of that callee, so the result of the check is memoized
+  /// per (call, callee, substitutions). All queries happen while collecting
+  /// candidates, before inlining deletes any apply.
+  llvm::DenseMap<
+      std::pair<std::pair<SILInstruction *, SILFunction *>, SubstitutionMap>,
+      bool>
+      SpecializationChecks;
+
   ColdBlockInfo CBI;
 
   OptRemark::Emitter &ORE;
@@ -126,6 +137,12 @@ class SILPerformanceInliner {
     /// increasing the code size.
     TrivialFunctionThreshold = 18,
 
+    /// When profile data is available but the callee has no entry count, a
+    /// call site whose block count is smaller than the caller's entry count
+    /// divided by this ratio is considered cold and only gets
+    /// size-neutral inlining.
+    ProfileColdCallSiteRatio = 50,
+
     /// Configuration for the "soft" caller block limit. When changing, make
     /// sure you update BlockLimitMaxIntNumerator.
     BlockLimitDenominator = 3000,
@@ -162,6 +179,9 @@ class SILPerformanceInliner {
     return SPA;
   }
 
+  bool canSpecializeGeneric(ApplySite AI, SILFunction *F,
+                            SubstitutionMap Subs);
+
   bool profileBasedDecision(
       const FullApplySite &AI, int Benefit, SILFunction *Callee, int CalleeCost,
       int &NumCallerBlocks,
@@ -204,9 +224,15 @@ public:
 
 // Returns true if it is possible to perform a generic
 // specialization for a given call.
-static bool canSpecializeGeneric(ApplySite AI, SILFunction *F,
-                                 SubstitutionMap Subs) {
-  return ReabstractionInfo::canBeSpecialized(AI, F, Subs);
+bool SILPerformanceInliner::canSpecializeGeneric(ApplySite AI, SILFunction *F,
+                                                 SubstitutionMap Subs) {
+  auto Key = std::make_pair(std::make_pair(AI.getInstruction(), F), Subs);
+  auto Entry = SpecializationChecks.find(Key);
+  if (Entry != SpecializationChecks.end())
+    return Entry->second;
+  bool CanSpecialize = ReabstractionInfo::canBeSpecialized(AI, F, Subs);
+  SpecializationChecks[Key] = CanSpecialize;
+  return CanSpecialize;
 }
 
 bool SILPerformanceInliner::profileBasedDecision(
@@ -244,8 +270,17 @@ bool SILPerformanceInliner::profileBasedDecision(
                llvm::dbgs() << "profiled decision: YES, reason=SI "
                             << std::to_string(percent) << "%\n");
   } else {
-    // No callee count - use a "modified" aggressive IHF for now
-    if (CalleeCost > Benefit && callerCount < 100) {
+    // No callee count - use a "modified" aggressive IHF for now.
+    // Judge the hotness of the call site relative to the caller's own entry
+    // count instead of using an absolute cutoff: an absolute threshold
+    // treats every block of a hot function as hot, including its rarely
+    // taken failure paths, and everything in a moderately called function
+    // as cold.
+    uint64_t coldCallSiteThreshold = 100;
+    if (auto callerEntryCount = AI.getFunction()->getEntryCount())
+      coldCallSiteThreshold = std::max<uint64_t>(
+          callerEntryCount.getValue() / ProfileColdCallSiteRatio, 1);
+    if (CalleeCost > Benefit && callerCount < coldCallSiteThreshold) {
       LLVM_DEBUG(dumpCaller(AI.getFunction());
                  llvm::dbgs() << "profiled decision: NO, reason=IHF "
                               << callerCount << '\n');
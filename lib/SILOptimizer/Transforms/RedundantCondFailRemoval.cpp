@@ -0,0 +1,88 @@
+//===--- RedundantCondFailRemoval.cpp - Remove dominated cond_fails -------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2021 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+//
+// Removes cond_fail instructions which are dominated by another cond_fail on
+// the same condition value. If the condition were true at the dominated
+// check, the dominating check would already have trapped, so the dominated
+// check can never fire.
+//
+// Such redundant checks are left over from inlining and loop transformations,
+// e.g. the bounds checks of UnsafeBufferPointer subscripts after unrolling.
+// Removing them is worthwhile on its own, and it also un-clutters simple
+// loops enough for LLVM's loop vectorizer to engage.
+//
+//===----------------------------------------------------------------------===//
+
+#define DEBUG_TYPE "remove-redundant-cond-fails"
+
+#include "swift/SIL/Dominance.h"
+#include "swift/SIL/SILFunction.h"
+#include "swift/SIL/SILInstruction.h"
+#include "swift/SILOptimizer/Analysis/DominanceAnalysis.h"
+#include "swift/SILOptimizer/PassManager/Passes.h"
+#include "swift/SILOptimizer/PassManager/Transforms.h"
+#include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/ADT/Statistic.h"
+#include "llvm/Support/Debug.h"
+
+STATISTIC(NumCondFailsRemoved, "Number of dominated cond_fails removed");
+
+using namespace swift;
+
+namespace {
+
+/// Removes cond_fail instructions whose condition was already checked by a
+/// dominating cond_fail.
+class RedundantCondFailRemoval : public SILFunctionTransform {
+  void run() override {
+    SILFunction *F = getFunction();
+    DominanceInfo *DT = PM->getAnalysis<DominanceAnalysis>()->get(F);
+
+    // Group all cond_fail instructions by their condition value.
+    llvm::SmallDenseMap<SILValue, SmallVector<CondFailInst *, 2>, 8> checks;
+    for (auto &BB : *F) {
+      for (auto &I : BB) {
+        if (auto *CFI = dyn_cast<CondFailInst>(&I))
+          checks[CFI->getOperand()].push_back(CFI);
+      }
+    }
+
+    llvm::SmallPtrSet<CondFailInst *, 8> redundantChecks;
+    for (auto &entry : checks) {
+      auto &condFails = entry.second;
+      // Dominance is transitive, so it is fine to remove a check which itself
+      // dominates other removable checks.
+      for (CondFailInst *check : condFails) {
+        for (CondFailInst *dominated : condFails) {
+          if (check != dominated && DT->properlyDominates(check, dominated))
+            redundantChecks.insert(dominated);
+        }
+      }
+    }
+
+    if (redundantChecks.empty())
+      return;
+
+    for (CondFailInst *CFI : redundantChecks) {
+      LLVM_DEBUG(llvm::dbgs() << "Removing dominated check " << *CFI);
+      CFI->eraseFromParent();
+      ++NumCondFailsRemoved;
+    }
+    invalidateAnalysis(SILAnalysis::InvalidationKind::Instructions);
+  }
+};
+
+} // end anonymous namespace
+
+SILTransform *swift::createRedundantCondFailRemoval() {
+  return new RedundantCondFailRemoval();
+}
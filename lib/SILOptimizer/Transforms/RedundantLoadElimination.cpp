@@ -548,6 +548,13 @@ public:
   /// Get the bit representing the LSLocation in the LocationVault.
   unsigned getLocationBit(const LSLocation &L);
 
+  /// Returns true if \p L was enumerated in the LocationVault. A location may
+  /// stay unenumerated because of the location limit; accesses to it are then
+  /// handled like unknown memory instructions.
+  bool isTrackedLocation(const LSLocation &L) {
+    return LocToBitIndex.find(L) != LocToBitIndex.end();
+  }
+
   /// Given the bit, get the LSLocation from the LocationVault.
   LSLocation &getLocation(const unsigned index);
 
@@ -865,6 +872,15 @@ void BlockState::processWrite(RLEContext &Ctx, SILInstruction *I, SILValue Mem,
                      TypeExpansionContext(*I->getFunction()), Locs,
                      Ctx.getTE());
 
+  // If the location stayed unenumerated because of the location limit, treat
+  // the store as an unknown memory write.
+  if (!Locs.empty() && !Ctx.isTrackedLocation(Locs[0])) {
+    if (!isComputeAvailSetMax(Kind)) {
+      processUnknownWriteInst(Ctx, I, Kind);
+    }
+    return;
+  }
+
   if (isComputeAvailSetMax(Kind)) {
     for (unsigned i = 0; i < Locs.size(); ++i) {
       updateMaxAvailSetForWrite(Ctx, Ctx.getLocationBit(Locs[i]));
@@ -919,6 +935,11 @@ void BlockState::processRead(RLEContext &Ctx, SILInstruction *I, SILValue Mem,
                      TypeExpansionContext(*I->getFunction()), Locs,
                      Ctx.getTE());
 
+  // If the location stayed unenumerated because of the location limit, there
+  // is nothing to forward; a read does not invalidate any tracked location.
+  if (!Locs.empty() && !Ctx.isTrackedLocation(Locs[0]))
+    return;
+
   if (isComputeAvailSetMax(Kind)) {
     for (unsigned i = 0; i < Locs.size(); ++i) {
       updateMaxAvailSetForRead(Ctx, Ctx.getLocationBit(Locs[i]));
@@ -1553,11 +1574,16 @@ bool RLEContext::run() {
   // Phase 4. we perform the redundant load elimination.
   // Walk over the function and find all the locations accessed by
   // this function.
-  std::pair<int, int> LSCount = std::make_pair(0, 0); 
+  // Cap the number of enumerated locations so that the data flow stays
+  // within budget even on large functions, instead of giving up on them
+  // entirely. Accesses to unenumerated locations are handled conservatively.
+  unsigned LocationLimit =
+      MaxLSLocationBBMultiplicationNone / std::max(1u, (unsigned)Fn->size());
+  std::pair<int, int> LSCount = std::make_pair(0, 0);
   LSLocation::enumerateLSLocations(*Fn, LocationVault,
                                    LocToBitIndex,
                                    BaseToLocIndex, TE,
-                                   LSCount);
+                                   LSCount, LocationLimit);
 
   // Check how to optimize this function.
   ProcessKind Kind = getProcessFunctionKind(LSCount.first, LSCount.second);
@@ -852,6 +852,49 @@ static bool couldSimplifyEnumUsers(SILArgument *BBArg, int Budget) {
   return false;
 }
 
+/// Returns true if \p value is a function value which is ultimately rooted in
+/// a statically known function, e.g. a thin_to_thick_function of a
+/// function_ref or a closure over one.
+static bool isKnownFunctionValue(SILValue value) {
+  while (true) {
+    if (auto *cvt = dyn_cast<ConvertFunctionInst>(value)) {
+      value = cvt->getConverted();
+      continue;
+    }
+    if (auto *cvt = dyn_cast<ConvertEscapeToNoEscapeInst>(value)) {
+      value = cvt->getOperand();
+      continue;
+    }
+    if (auto *ttf = dyn_cast<ThinToThickFunctionInst>(value)) {
+      value = ttf->getOperand();
+      continue;
+    }
+    if (auto *pa = dyn_cast<PartialApplyInst>(value)) {
+      value = pa->getCallee();
+      continue;
+    }
+    return isa<FunctionRefInst>(value);
+  }
+}
+
+/// Check if substituting a known function value for \p BBArg turns an indirect
+/// call in the block into a direct call. If so, return that call.
+static FullApplySite couldSimplifyApplyUsers(SILArgument *BBArg) {
+  SILBasicBlock *BB = BBArg->getParent();
+
+  for (Operand *UI : BBArg->getUses()) {
+    auto *User = UI->getUser();
+    if (User->getParent() != BB)
+      continue;
+
+    if (auto FAS = FullApplySite::isa(User)) {
+      if (FAS.getCallee() == BBArg)
+        return FAS;
+    }
+  }
+  return FullApplySite();
+}
+
 void SimplifyCFG::findLoopHeaders() {
   /// Find back edges in the CFG. This performs a dfs search and identifies
   /// back edges as edges going to an ancestor in the dfs search. If a basic
@@ -975,6 +1018,11 @@ bool SimplifyCFG::tryJumpThreading(BranchInst *BI) {
   // given the duplication.
   int ThreadingBudget = 0;
 
+  // An apply in the destination block whose callee becomes a statically known
+  // function by substituting one of the branch arguments. Duplicating it is
+  // the whole point of threading: the call becomes direct and can be inlined.
+  FullApplySite DevirtualizableApply;
+
   for (unsigned i = 0, e = BI->getArgs().size(); i != e; ++i) {
     // If the value being substituted on is release there is a chance we could
     // remove the release after jump threading.
@@ -984,9 +1032,20 @@ bool SimplifyCFG::tryJumpThreading(BranchInst *BI) {
         break;
     }
 
+    SILValue Arg = BI->getArg(i);
+
+    // If the value being substituted is a statically known function value,
+    // check if the destination calls it.
+    if (isKnownFunctionValue(Arg)) {
+      if (auto FAS = couldSimplifyApplyUsers(DestBB->getArgument(i))) {
+        DevirtualizableApply = FAS;
+        ThreadingBudget = 8;
+        break;
+      }
+    }
+
     // If the value being substituted is an enum, check to see if there are any
     // switches on it.
-    SILValue Arg = BI->getArg(i);
     if (!getEnumCase(Arg, BI->getParent()) &&
         !isa<IntegerLiteralInst>(Arg))
       continue;
@@ -1044,7 +1103,15 @@ bool SimplifyCFG::tryJumpThreading(BranchInst *BI) {
   int copyCosts = 0;
   BasicBlockCloner Cloner(DestBB);
   for (auto &inst : *DestBB) {
-    copyCosts += getThreadingCost(&inst);
+    if (DevirtualizableApply && DevirtualizableApply.getInstruction() == &inst &&
+        inst.isTriviallyDuplicatable()) {
+      // This call becomes a direct call after threading. Account for it like a
+      // regular instruction instead of letting the "don't jumpthread calls"
+      // rule veto the duplication.
+      copyCosts += 1;
+    } else {
+      copyCosts += getThreadingCost(&inst);
+    }
     if (ThreadingBudget <= copyCosts)
       return false;
 
@@ -2421,6 +2488,32 @@ static bool isTryApplyOfConvertFunction(TryApplyInst *TAI,
   return true;
 }
 
+/// Checks if the callee of \p TAI is a function whose body is known and
+/// contains no throw instruction. Returning with an error is only possible
+/// with a throw, so such a callee can never throw, regardless of which
+/// functions it calls itself: rethrowing a callee's error also requires a
+/// throw.
+static bool isTryApplyOfNoThrowCallee(TryApplyInst *TAI, SILValue &Callee,
+                                      SILType &CalleeType) {
+  // Use an exact function_ref match: the initially referenced function of a
+  // (prev_)dynamic_function_ref can be replaced at runtime, so its body
+  // proves nothing.
+  auto *FRI = dyn_cast<FunctionRefInst>(TAI->getCallee());
+  if (!FRI)
+    return false;
+  SILFunction *CalleeFn = FRI->getReferencedFunctionOrNull();
+  if (!CalleeFn || CalleeFn->empty() || CalleeFn->isDynamicallyReplaceable())
+    return false;
+
+  for (SILBasicBlock &BB : *CalleeFn) {
+    if (isa<ThrowInst>(BB.getTerminator()))
+      return false;
+  }
+  Callee = TAI->getCallee();
+  CalleeType = TAI->getSubstCalleeSILType();
+  return true;
+}
+
 /// Checks if the error block of \p TAI has just an unreachable instruction.
 /// In this case we know that the callee cannot throw.
 static bool isTryApplyWithUnreachableError(TryApplyInst *TAI,
@@ -2444,9 +2537,10 @@ bool SimplifyCFG::simplifyTryApplyBlock(TryApplyInst *TAI) {
   SILValue Callee;
   SILType CalleeType;
 
-  // Two reasons for converting a try_apply to an apply.
+  // Three reasons for converting a try_apply to an apply.
   if (isTryApplyOfConvertFunction(TAI, Callee, CalleeType) ||
-      isTryApplyWithUnreachableError(TAI, Callee, CalleeType)) {
+      isTryApplyWithUnreachableError(TAI, Callee, CalleeType) ||
+      isTryApplyOfNoThrowCallee(TAI, Callee, CalleeType)) {
 
     auto CalleeFnTy = CalleeType.castTo<SILFunctionType>();
     SILFunctionConventions calleeConv(CalleeFnTy, TAI->getModule());
@@ -0,0 +1,216 @@
+//===--- ThunkDeduplication.cpp - Share structurally identical thunks -----===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2020 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+//
+// SILGen emits reabstraction and witness thunks per (function, abstraction
+// pattern) pair, so large whole-module builds accumulate many thunks that
+// are structurally identical apart from their mangled name. Each copy costs
+// code size and competes for icache and branch-predictor capacity.
+//
+// This pass buckets shared-linkage thunk definitions by a structural hash
+// of their bodies, verifies exact instruction-by-instruction equivalence
+// within a bucket, and redirects every function_ref of a duplicate to the
+// bucket's canonical thunk. The duplicates themselves are left in place;
+// once unreferenced they are removed by dead-function elimination, which
+// runs immediately after this pass in the pipeline.
+//
+//===----------------------------------------------------------------------===//
+
+#define DEBUG_TYPE "thunk-dedup"
+
+#include "swift/SIL/SILBuilder.h"
+#include "swift/SIL/SILFunction.h"
+#include "swift/SIL/SILInstruction.h"
+#include "swift/SIL/SILModule.h"
+#include "swift/SILOptimizer/PassManager/Passes.h"
+#include "swift/SILOptimizer/PassManager/Transforms.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/Hashing.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/Statistic.h"
+#include "llvm/Support/Debug.h"
+
+STATISTIC(NumThunksDeduplicated, "Number of duplicate thunks replaced");
+STATISTIC(NumThunkRefsRedirected,
+          "Number of function_refs redirected to a canonical thunk");
+
+using namespace swift;
+
+namespace {
+
+/// Returns true if \p F may be replaced by a structurally identical
+/// function at its references.
+static bool isDeduplicationCandidate(SILFunction &F) {
+  if (!F.isDefinition() || F.isAvailableExternally())
+    return false;
+  if (!F.isThunk())
+    return false;
+  // Only shared-linkage thunks: nothing outside the module may name them,
+  // so redirecting every in-module reference retires the copy completely.
+  if (!hasSharedVisibility(F.getLinkage()))
+    return false;
+  if (F.isDynamicallyReplaceable())
+    return false;
+  // Attributes that later passes key off must not silently change when a
+  // reference is retargeted to another function.
+  if (F.hasSemanticsAttrs() || F.isGlobalInit())
+    return false;
+  return true;
+}
+
+/// Computes a coarse structural hash of \p F's body. Functions with equal
+/// bodies hash equally; collisions are resolved by the exact comparison.
+static uint64_t getStructuralHash(SILFunction &F) {
+  llvm::hash_code hash =
+      llvm::hash_combine(F.getLoweredFunctionType().getPointer(), F.size(),
+                         unsigned(F.getEffectsKind()));
+  for (SILBasicBlock &BB : F) {
+    hash = llvm::hash_combine(hash, BB.getNumArguments());
+    for (SILInstruction &I : BB)
+      hash = llvm::hash_combine(hash, unsigned(I.getKind()),
+                                I.getNumOperands());
+  }
+  return uint64_t(size_t(hash));
+}
+
+/// Returns true if \p lhs and \p rhs have instruction-for-instruction
+/// identical bodies, identical signatures, and isomorphic control flow.
+static bool areStructurallyEquivalent(SILFunction &lhs, SILFunction &rhs) {
+  if (lhs.getLoweredFunctionType() != rhs.getLoweredFunctionType())
+    return false;
+  if (lhs.getEffectsKind() != rhs.getEffectsKind())
+    return false;
+  if (lhs.size() != rhs.size())
+    return false;
+
+  // Pair up blocks in layout order and values by position, then require
+  // every instruction pair to be identical modulo that correspondence.
+  llvm::DenseMap<SILBasicBlock *, SILBasicBlock *> blockMap;
+  llvm::DenseMap<SILValue, SILValue> valueMap;
+
+  auto lhsBlock = lhs.begin(), rhsBlock = rhs.begin();
+  for (; lhsBlock != lhs.end(); ++lhsBlock, ++rhsBlock) {
+    blockMap[&*lhsBlock] = &*rhsBlock;
+    if (lhsBlock->getNumArguments() != rhsBlock->getNumArguments())
+      return false;
+    for (unsigned i = 0, e = lhsBlock->getNumArguments(); i != e; ++i) {
+      SILArgument *lhsArg = lhsBlock->getArgument(i);
+      SILArgument *rhsArg = rhsBlock->getArgument(i);
+      if (lhsArg->getType() != rhsArg->getType())
+        return false;
+      valueMap[lhsArg] = rhsArg;
+    }
+  }
+
+  auto opEqual = [&](const SILValue &lhsOp, const SILValue &rhsOp) -> bool {
+    auto mapped = valueMap.find(lhsOp);
+    if (mapped != valueMap.end())
+      return mapped->second == rhsOp;
+    // Values not defined within the function, e.g. undef.
+    return lhsOp == rhsOp;
+  };
+
+  lhsBlock = lhs.begin();
+  rhsBlock = rhs.begin();
+  for (; lhsBlock != lhs.end(); ++lhsBlock, ++rhsBlock) {
+    auto lhsInst = lhsBlock->begin(), rhsInst = rhsBlock->begin();
+    for (;; ++lhsInst, ++rhsInst) {
+      bool lhsDone = lhsInst == lhsBlock->end();
+      bool rhsDone = rhsInst == rhsBlock->end();
+      if (lhsDone || rhsDone)
+        return lhsDone == rhsDone;
+      if (!lhsInst->isIdenticalTo(&*rhsInst, opEqual))
+        return false;
+      auto lhsResults = lhsInst->getResults();
+      auto rhsResults = rhsInst->getResults();
+      for (unsigned i = 0, e = lhsResults.size(); i != e; ++i)
+        valueMap[lhsResults[i]] = rhsResults[i];
+      if (auto *lhsTerm = dyn_cast<TermInst>(&*lhsInst)) {
+        // Successors are not operands; require them to map block-for-block.
+        auto *rhsTerm = cast<TermInst>(&*rhsInst);
+        auto lhsSuccs = lhsTerm->getSuccessors();
+        auto rhsSuccs = rhsTerm->getSuccessors();
+        if (lhsSuccs.size() != rhsSuccs.size())
+          return false;
+        for (unsigned i = 0, e = lhsSuccs.size(); i != e; ++i)
+          if (blockMap[lhsSuccs[i].getBB()] != rhsSuccs[i].getBB())
+            return false;
+      }
+    }
+  }
+  return true;
+}
+
+class ThunkDeduplication : public SILModuleTransform {
+  void run() override {
+    SILModule *M = getModule();
+
+    // Bucket candidate thunks by structural hash and pick the first
+    // structurally equivalent thunk in module order as each one's canonical
+    // representative.
+    llvm::DenseMap<uint64_t, llvm::SmallVector<SILFunction *, 2>> buckets;
+    llvm::DenseMap<SILFunction *, SILFunction *> canonicalThunk;
+    for (SILFunction &F : *M) {
+      if (!isDeduplicationCandidate(F))
+        continue;
+      auto &bucket = buckets[getStructuralHash(F)];
+      for (SILFunction *candidate : bucket) {
+        if (areStructurallyEquivalent(*candidate, F)) {
+          canonicalThunk[&F] = candidate;
+          ++NumThunksDeduplicated;
+          LLVM_DEBUG(llvm::dbgs()
+                     << "Deduplicating thunk " << F.getName() << " into "
+                     << candidate->getName() << "\n");
+          break;
+        }
+      }
+      if (!canonicalThunk.count(&F))
+        bucket.push_back(&F);
+    }
+    if (canonicalThunk.empty())
+      return;
+
+    // Redirect every function_ref of a duplicate to its canonical thunk.
+    // The now-unreferenced duplicates are cleaned up by dead-function
+    // elimination.
+    for (SILFunction &F : *M) {
+      bool changed = false;
+      for (SILBasicBlock &BB : F) {
+        for (auto instIter = BB.begin(); instIter != BB.end();) {
+          auto *FRI = dyn_cast<FunctionRefInst>(&*instIter);
+          ++instIter;
+          if (!FRI)
+            continue;
+          auto canonical =
+              canonicalThunk.find(FRI->getReferencedFunctionOrNull());
+          if (canonical == canonicalThunk.end())
+            continue;
+          SILBuilder builder(FRI);
+          auto *newFRI =
+              builder.createFunctionRef(FRI->getLoc(), canonical->second);
+          FRI->replaceAllUsesWith(newFRI);
+          FRI->eraseFromParent();
+          ++NumThunkRefsRedirected;
+          changed = true;
+        }
+      }
+      if (changed)
+        invalidateAnalysis(&F,
+                           SILAnalysis::InvalidationKind::CallsAndInstructions);
+    }
+  }
+};
+
+} // end anonymous namespace
+
+SILTransform *swift::createThunkDeduplication() {
+  return new ThunkDeduplication();
+}
@@ -0,0 +1,149 @@
+//===--- WholeModuleDevirtualizer.cpp - Module-wide devirtualization ------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2017 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+//
+// Devirtualize class_method and witness_method dispatch across the whole
+// module at once. Under whole-module optimization the hierarchy of internal
+// classes and the set of conformances to internal protocols are closed, so a
+// method with a single implementation can be called directly. The
+// function-local Devirtualizer makes the same rewrites but only sees the one
+// function it was invoked on; this pass processes the module's functions in
+// bottom-up call order and immediately revisits callees whose bodies become
+// visible through devirtualization, so chains of indirect dispatch collapse
+// within a single run.
+//
+//===----------------------------------------------------------------------===//
+
+#define DEBUG_TYPE "sil-wmo-devirtualizer"
+
+#include "swift/SIL/OptimizationRemark.h"
+#include "swift/SIL/SILFunction.h"
+#include "swift/SIL/SILInstruction.h"
+#include "swift/SIL/SILModule.h"
+#include "swift/SILOptimizer/Analysis/BasicCalleeAnalysis.h"
+#include "swift/SILOptimizer/Analysis/ClassHierarchyAnalysis.h"
+#include "swift/SILOptimizer/Analysis/FunctionOrder.h"
+#include "swift/SILOptimizer/PassManager/Transforms.h"
+#include "swift/SILOptimizer/Utils/Devirtualize.h"
+#include "llvm/ADT/SetVector.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/Statistic.h"
+
+STATISTIC(NumWMODevirtualizedCalls,
+          "Number of calls devirtualized module-wide");
+
+using namespace swift;
+
+namespace {
+
+class WholeModuleDevirtualizer : public SILModuleTransform {
+
+  bool devirtualizeAppliesInFunction(
+      SILFunction &F, ClassHierarchyAnalysis *CHA,
+      llvm::SmallSetVector<SILFunction *, 16> &worklist);
+
+  /// The entry point to the transformation.
+  void run() override {
+    SILModule *M = getModule();
+
+    // The hierarchy of internal classes and the set of conformances to
+    // internal protocols are only closed in whole-module compilation;
+    // otherwise every non-final method must be assumed overridable from
+    // other files.
+    if (!M->isWholeModule())
+      return;
+
+    auto *CHA = PM->getAnalysis<ClassHierarchyAnalysis>();
+    auto *BCA = PM->getAnalysis<BasicCalleeAnalysis>();
+
+    // Visit callees before callers so that, by the time a caller is
+    // processed, dispatch in its callees has already been resolved.
+    BottomUpFunctionOrder bottomUpOrder(*M, BCA);
+    llvm::SmallSetVector<SILFunction *, 16> worklist;
+    for (SILFunction *F : bottomUpOrder.getFunctions()) {
+      if (!F->isDefinition() || !F->shouldOptimize())
+        continue;
+      worklist.insert(F);
+    }
+
+    while (!worklist.empty()) {
+      SILFunction *F = worklist.pop_back_val();
+      devirtualizeAppliesInFunction(*F, CHA, worklist);
+    }
+  }
+};
+
+} // end anonymous namespace
+
+/// Devirtualize the indirect apply sites of \p F, appending devirtualized
+/// callees that deserve a visit of their own to \p worklist.
+bool WholeModuleDevirtualizer::devirtualizeAppliesInFunction(
+    SILFunction &F, ClassHierarchyAnalysis *CHA,
+    llvm::SmallSetVector<SILFunction *, 16> &worklist) {
+  bool Changed = false;
+  bool ChangedCFG = false;
+  OptRemark::Emitter ORE(DEBUG_TYPE, F);
+
+  SmallVector<ApplySite, 16> Applies;
+  for (auto &BB : F) {
+    for (auto &I : BB) {
+      auto Apply = ApplySite::isa(&I);
+      if (!Apply)
+        continue;
+
+      // Only indirect dispatch is interesting here; direct applies are
+      // left to the function pass pipeline.
+      if (!isa<MethodInst>(Apply.getCallee()))
+        continue;
+      Applies.push_back(Apply);
+    }
+  }
+
+  llvm::SmallVector<ApplySite, 8> NewApplies;
+  for (auto Apply : Applies) {
+    ApplySite NewInst;
+    bool modifiedCFG;
+    std::tie(NewInst, modifiedCFG) = tryDevirtualizeApply(Apply, CHA, &ORE);
+    if (!NewInst)
+      continue;
+
+    ++NumWMODevirtualizedCalls;
+    Changed = true;
+    ChangedCFG |= modifiedCFG;
+
+    deleteDevirtualizedApply(Apply);
+    NewApplies.push_back(NewInst);
+  }
+
+  for (auto Apply : NewApplies) {
+    auto *CalleeFn = Apply.getInitiallyReferencedFunction();
+    assert(CalleeFn && "Expected devirtualized callee!");
+
+    // Link in the body of the devirtualized callee if we do not already have
+    // it; it may have non-public linkage, and its own apply sites may now be
+    // devirtualizable too.
+    if (!CalleeFn->isDefinition())
+      F.getModule().linkFunction(CalleeFn, SILModule::LinkingMode::LinkAll);
+
+    if (CalleeFn->isDefinition() && CalleeFn->shouldOptimize())
+      worklist.insert(CalleeFn);
+  }
+
+  if (ChangedCFG)
+    invalidateAnalysis(&F, SILAnalysis::InvalidationKind::Everything);
+  else if (Changed)
+    invalidateAnalysis(&F, SILAnalysis::InvalidationKind::CallsAndInstructions);
+  return Changed;
+}
+
+SILTransform *swift::createWholeModuleDevirtualizer() {
+  return new WholeModuleDevirtualizer();
+}
@@ -1240,6 +1240,11 @@ ConstExprFunctionState::computeCallResult(ApplyInst *apply) {
   // analyze the function. Note: pull in everything referenced from another
   // module in case some referenced functions have non-public linkage.
   if (callee->isExternalDeclaration()) {
+    // Under lazy linking, linkFunction only materializes bodies which have to
+    // be emitted into the client; load the callee explicitly since we need to
+    // see its body.
+    if (apply->getModule().getOptions().EnableLazyLinking)
+      apply->getModule().loadFunction(callee);
     apply->getModule().linkFunction(callee, SILModule::LinkingMode::LinkAll);
     if (callee->isExternalDeclaration())
       return computeOpaqueCallResult(apply, callee);
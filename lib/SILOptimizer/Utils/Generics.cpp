@@ -1836,6 +1836,20 @@ SILFunction *GenericFuncSpecializer::lookupSpecialization() {
                             << ClonedName << "\n");
     return SpecializedF;
   }
+
+  // The standard library ships public pre-specializations of its most
+  // commonly used generic entry points. If the required specialization is
+  // among them, reference it instead of cloning the generic body yet again.
+  // Only non-serialized specializations can match, because that is how the
+  // shipped pre-specializations are mangled.
+  if (SILFunction *Prespec = lookupPrespecializedSymbol(M, ClonedName)) {
+    assert(ReInfo.getSpecializedType() == Prespec->getLoweredFunctionType() &&
+           "Pre-specialized function does not match expected type.");
+    LLVM_DEBUG(llvm::dbgs() << "Using a pre-specialized function for: "
+                            << ClonedName << "\n");
+    return Prespec;
+  }
+
   LLVM_DEBUG(llvm::dbgs() << "Could not find an existing specialization for: "
                           << ClonedName << "\n");
   return nullptr;
@@ -2669,8 +2683,8 @@ void swift::checkCompletenessOfPrespecializations(SILModule &M) {
 /// of optimized specializations.
 static SILFunction *lookupExistingSpecialization(SILModule &M,
                                                  StringRef FunctionName) {
-  // Try to link existing specialization only in -Onone mode.
-  // All other compilation modes perform specialization themselves.
+  // This lookup serves both the -Onone UsePrespecialized pass and the
+  // optimizing generic specializer, which consults it before cloning.
   // TODO: Cache optimized specializations and perform lookup here?
   // Only check that this function exists, but don't read
   // its body. It can save some compile-time.
@@ -695,43 +695,73 @@ void swift::eraseUsesOfValue(SILValue v) {
 
 SILValue swift::
 getConcreteValueOfExistentialBox(AllocExistentialBoxInst *existentialBox,
-                                  SILInstruction *ignoreUser) {
+                                  SILInstruction *ignoreUser,
+                                  bool lookThroughBranches) {
   StoreInst *singleStore = nullptr;
-  for (Operand *use : getNonDebugUses(existentialBox)) {
-    SILInstruction *user = use->getUser();
-    switch (user->getKind()) {
-      case SILInstructionKind::StrongRetainInst:
-      case SILInstructionKind::StrongReleaseInst:
-        break;
-      case SILInstructionKind::ProjectExistentialBoxInst: {
-        auto *projectedAddr = cast<ProjectExistentialBoxInst>(user);
-        for (Operand *addrUse : getNonDebugUses(projectedAddr)) {
-          if (auto *store = dyn_cast<StoreInst>(addrUse->getUser())) {
-            assert(store->getSrc() != projectedAddr &&
-                   "cannot store an address");
-            // Bail if there are multiple stores.
-            if (singleStore)
-              return SILValue();
-            singleStore = store;
-            continue;
+  // The box and all block arguments it is known to be passed to verbatim.
+  SmallPtrSet<SILValue, 4> aliases;
+  SmallVector<SILValue, 4> worklist;
+  aliases.insert(existentialBox);
+  worklist.push_back(existentialBox);
+  while (!worklist.empty()) {
+    SILValue boxValue = worklist.pop_back_val();
+    for (Operand *use : getNonDebugUses(boxValue)) {
+      SILInstruction *user = use->getUser();
+      switch (user->getKind()) {
+        case SILInstructionKind::StrongRetainInst:
+        case SILInstructionKind::StrongReleaseInst:
+          break;
+        case SILInstructionKind::ProjectExistentialBoxInst: {
+          auto *projectedAddr = cast<ProjectExistentialBoxInst>(user);
+          for (Operand *addrUse : getNonDebugUses(projectedAddr)) {
+            if (auto *store = dyn_cast<StoreInst>(addrUse->getUser())) {
+              assert(store->getSrc() != projectedAddr &&
+                     "cannot store an address");
+              // Bail if there are multiple stores.
+              if (singleStore)
+                return SILValue();
+              singleStore = store;
+              continue;
+            }
+            // If there are other users to the box value address then bail out.
+            return SILValue();
           }
-          // If there are other users to the box value address then bail out.
-          return SILValue();
+          break;
         }
-        break;
-      }
-      case SILInstructionKind::BuiltinInst: {
-        auto *builtin = cast<BuiltinInst>(user);
-        if (KeepWillThrowCall ||
-            builtin->getBuiltinInfo().ID != BuiltinValueKind::WillThrow) {
-          return SILValue();
+        case SILInstructionKind::BuiltinInst: {
+          auto *builtin = cast<BuiltinInst>(user);
+          if (KeepWillThrowCall ||
+              builtin->getBuiltinInfo().ID != BuiltinValueKind::WillThrow) {
+            return SILValue();
+          }
+          break;
         }
-        break;
+        case SILInstructionKind::BranchInst: {
+          // The box is handed to a successor block, e.g. from an inlined
+          // throw to the error block of the enclosing try_apply. Continue
+          // with the uses of the destination argument, as long as the box is
+          // the argument's only incoming value.
+          if (!lookThroughBranches)
+            return SILValue();
+          auto *branch = cast<BranchInst>(user);
+          auto *destArg = cast<SILPhiArgument>(
+              branch->getDestBB()->getArgument(use->getOperandNumber()));
+          SmallVector<SILValue, 4> incomingValues;
+          if (!destArg->getIncomingPhiValues(incomingValues))
+            return SILValue();
+          for (SILValue incoming : incomingValues) {
+            if (!aliases.count(incoming))
+              return SILValue();
+          }
+          if (aliases.insert(destArg).second)
+            worklist.push_back(destArg);
+          break;
+        }
+        default:
+          if (user != ignoreUser)
+            return SILValue();
+          break;
       }
-      default:
-        if (user != ignoreUser)
-          return SILValue();
-        break;
     }
   }
   if (!singleStore)
@@ -771,11 +801,30 @@ getConcreteValueOfExistentialBoxAddr(SILValue addr, SILInstruction *ignoreUser)
   if (!singleStackStore)
     return SILValue();
 
-  auto *box = dyn_cast<AllocExistentialBoxInst>(singleStackStore->getSrc());
+  // The box may have been passed along branches before it was stored, e.g.
+  // from an inlined throw to the error block of the enclosing try_apply. Look
+  // through such block arguments as long as the incoming value is unique.
+  SILValue boxValue = singleStackStore->getSrc();
+  SmallPtrSet<SILArgument *, 4> visitedPhis;
+  while (auto *phi = dyn_cast<SILPhiArgument>(boxValue)) {
+    if (!visitedPhis.insert(phi).second)
+      return SILValue();
+    SmallVector<SILValue, 4> incomingValues;
+    if (!phi->getIncomingPhiValues(incomingValues) || incomingValues.empty())
+      return SILValue();
+    for (SILValue incoming : incomingValues) {
+      if (incoming != incomingValues[0])
+        return SILValue();
+    }
+    boxValue = incomingValues[0];
+  }
+
+  auto *box = dyn_cast<AllocExistentialBoxInst>(boxValue);
   if (!box)
     return SILValue();
 
-  return getConcreteValueOfExistentialBox(box, singleStackStore);
+  return getConcreteValueOfExistentialBox(box, singleStackStore,
+                                          /*lookThroughBranches*/ true);
 }
 
 // Devirtualization of functions with covariant return types produces
@@ -251,7 +251,8 @@ void LSLocation::enumerateLSLocation(TypeExpansionContext context, SILModule *M,
                                      std::vector<LSLocation> &Locations,
                                      LSLocationIndexMap &IndexMap,
                                      LSLocationBaseMap &BaseMap,
-                                     TypeExpansionAnalysis *TypeCache) {
+                                     TypeExpansionAnalysis *TypeCache,
+                                     unsigned LocationLimit) {
   // We have processed this SILValue before.
   if (BaseMap.find(Mem) != BaseMap.end())
     return;
@@ -269,13 +270,26 @@ void LSLocation::enumerateLSLocation(TypeExpansionContext context, SILModule *M,
   if (!L.isValid())
     return;
 
-  // Record the SILValue to location mapping.
-  BaseMap[Mem] = L; 
-
   // Expand the given Mem into individual fields and add them to the
   // locationvault.
   LSLocationList Locs;
   LSLocation::expand(L, M, context, Locs, TypeCache);
+
+  // The clients rely on the fields of an expanded location being enumerated
+  // all-or-nothing, so if the whole expansion does not fit within the limit,
+  // leave the location unenumerated. Accesses to it are then treated as
+  // unknown memory instructions.
+  unsigned NumNewLocs = 0;
+  for (auto &Loc : Locs) {
+    if (IndexMap.find(Loc) == IndexMap.end())
+      ++NumNewLocs;
+  }
+  if (Locations.size() + NumNewLocs > LocationLimit)
+    return;
+
+  // Record the SILValue to location mapping.
+  BaseMap[Mem] = L;
+
   for (auto &Loc : Locs) {
     if (IndexMap.find(Loc) != IndexMap.end())
       continue;
@@ -290,21 +304,22 @@ LSLocation::enumerateLSLocations(SILFunction &F,
                                  LSLocationIndexMap &IndexMap,
                                  LSLocationBaseMap &BaseMap,
                                  TypeExpansionAnalysis *TypeCache,
-                                 std::pair<int, int> &LSCount) {
+                                 std::pair<int, int> &LSCount,
+                                 unsigned LocationLimit) {
   // Enumerate all locations accessed by the loads or stores.
   for (auto &B : F) {
     for (auto &I : B) {
       if (auto *LI = dyn_cast<LoadInst>(&I)) {
         enumerateLSLocation(F.getTypeExpansionContext(), &I.getModule(),
                             LI->getOperand(), Locations, IndexMap, BaseMap,
-                            TypeCache);
+                            TypeCache, LocationLimit);
         ++LSCount.first;
         continue;
       }
       if (auto *SI = dyn_cast<StoreInst>(&I)) {
         enumerateLSLocation(F.getTypeExpansionContext(), &I.getModule(),
                             SI->getDest(), Locations, IndexMap, BaseMap,
-                            TypeCache);
+                            TypeCache, LocationLimit);
         ++LSCount.second;
         continue;
       }
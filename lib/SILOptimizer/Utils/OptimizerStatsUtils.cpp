@@ -953,6 +953,10 @@ FunctionStat::FunctionStat(SILFunction *F) {
 /// \param M SILModule to be processed
 /// \param Transform the SIL transformation that was just executed
 /// \param PM the PassManager being used
+bool swift::shouldCollectSILModuleStats() {
+  return SILStatsModules || SILStatsFunctions || SILStatsDumpAll;
+}
+
 void swift::updateSILModuleStatsAfterTransform(SILModule &M,
                                                SILTransform *Transform,
                                                SILPassManager &PM,
@@ -693,9 +693,17 @@ SILFunction *swift::getEligibleFunction(FullApplySite AI,
     }
   }
 
-  // We can't inline external declarations.
+  // We can't inline external declarations. Under lazy linking the body may
+  // just not have been deserialized yet; materialize it now, and link it so
+  // that anything it references which has to be emitted into the client is
+  // pulled in as well.
   if (Callee->empty() || Callee->isExternalDeclaration()) {
-    return nullptr;
+    SILModule &M = Callee->getModule();
+    if (!M.getOptions().EnableLazyLinking || !Callee->isExternalDeclaration() ||
+        !M.loadFunction(Callee) || Callee->isExternalDeclaration()) {
+      return nullptr;
+    }
+    M.linkFunction(Callee, SILModule::LinkingMode::LinkAll);
   }
 
   // Explicitly disabled inlining.
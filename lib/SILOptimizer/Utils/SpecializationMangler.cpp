@@ -273,6 +273,13 @@ FunctionSignatureSpecializationMangler::mangleClosureProp(SILInstruction *Inst)
     SILType Ty = Op.get()->getType();
     appendType(Ty.getASTType());
   }
+
+  // If the closure was created with substitutions, mangle the replacement
+  // types as well, so that the same callee specialized with different
+  // substitutions gets distinct names.
+  for (Type Replacement : PAI->getSubstitutionMap().getReplacementTypes()) {
+    appendType(Replacement->getCanonicalType());
+  }
 }
 
 void FunctionSignatureSpecializationMangler::mangleArgument(
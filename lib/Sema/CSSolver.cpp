@@ -462,8 +462,22 @@ ConstraintSystem::SolverState::~SolverState() {
 #endif
 }
 
+ConstraintSystem::SolverScope::ConstraintArenaMark::ConstraintArenaMark(
+    ConstraintSystem &cs)
+    : cs(cs), mark(cs.ConstraintArena.getMark()) {}
+
+ConstraintSystem::SolverScope::ConstraintArenaMark::~ConstraintArenaMark() {
+  // Keep the memory if the failed constraint was recorded within this
+  // scope; it outlives the scope to drive diagnostics.
+  if (cs.failedConstraint &&
+      cs.ConstraintArena.isAllocatedAfter(mark, cs.failedConstraint))
+    return;
+
+  cs.ConstraintArena.rollbackToMark(mark);
+}
+
 ConstraintSystem::SolverScope::SolverScope(ConstraintSystem &cs)
-  : cs(cs), CGScope(cs.CG)
+  : cs(cs), ArenaMark(cs), CGScope(cs.CG)
 {
   numTypeVariables = cs.TypeVariables.size();
   numSavedBindings = cs.solverState->savedBindings.size();
@@ -1315,6 +1329,22 @@ bool ConstraintSystem::solve(SmallVectorImpl<Solution> &solutions,
     }
   }
 
+  // If requested, emit the solver statistics as a remark attached to the
+  // expression, so tooling can collect them from serialized diagnostics.
+  if (getASTContext().TypeCheckerOpts.ExpressionTypeCheckingRemarks && Timer) {
+    auto *E = Timer->getExpr();
+    if (E->getLoc().isValid()) {
+      unsigned elapsedMS = unsigned(
+          1000 * Timer->getElapsedProcessTimeInFractionalSeconds());
+      getASTContext().Diags
+          .diagnose(E->getLoc(), diag::expression_type_check_stats, elapsedMS,
+                    solverState->NumStatesExplored, solverState->maxDepth,
+                    solverState->NumDisjunctions,
+                    solverState->NumDisjunctionTerms)
+          .highlight(E->getSourceRange());
+    }
+  }
+
   // Filter deduced solutions, try to figure out if there is
   // a single best solution to use, if not explicitly disabled
   // by constraint system options.
@@ -2302,6 +2332,19 @@ void ConstraintSystem::partitionDisjunction(
     everythingElse.push_back(index);
     return true;
   });
+
+  // Order the remaining choices so that ones which have failed under
+  // previously attempted outer decisions are explored last; every choice
+  // is still attempted, this only redirects the search toward choices
+  // that haven't produced conflicts yet.
+  if (!getASTContext().TypeCheckerOpts.DisableConstraintSolverPerformanceHacks) {
+    std::stable_sort(everythingElse.begin(), everythingElse.end(),
+                     [&](unsigned lhsIndex, unsigned rhsIndex) {
+                       return Choices[lhsIndex]->getNumFailures() <
+                              Choices[rhsIndex]->getNumFailures();
+                     });
+  }
+
   appendPartition(favored);
   appendPartition(everythingElse);
   appendPartition(simdOperators);
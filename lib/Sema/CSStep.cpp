@@ -499,7 +499,11 @@ StepResult DisjunctionStep::resume(bool prevFailed) {
   // choices have to be attempted regardless, since final
   // decision could be made only after attempting all
   // of the choices, so let's just ignore failed ones.
-  if (!prevFailed) {
+  if (prevFailed) {
+    // Remember the failure; subsequent attempts of this disjunction under
+    // different outer decisions order such choices last.
+    static_cast<Constraint *>(ActiveChoice->second)->recordFailure();
+  } else {
     auto &choice = ActiveChoice->second;
     auto score = getBestScore(Solutions);
 
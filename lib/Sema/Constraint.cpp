@@ -647,7 +647,7 @@ Constraint *Constraint::create(ConstraintSystem &cs, ConstraintKind kind,
 
   // Create the constraint.
   unsigned size = totalSizeToAlloc<TypeVariableType*>(typeVars.size());
-  void *mem = cs.getAllocator().Allocate(size, alignof(Constraint));
+  void *mem = cs.allocateConstraint(size);
   return ::new (mem) Constraint(kind, first, second, locator, typeVars);
 }
 
@@ -667,7 +667,7 @@ Constraint *Constraint::create(ConstraintSystem &cs, ConstraintKind kind,
   uniqueTypeVariables(typeVars);
   
   unsigned size = totalSizeToAlloc<TypeVariableType*>(typeVars.size());
-  void *mem = cs.getAllocator().Allocate(size, alignof(Constraint));
+  void *mem = cs.allocateConstraint(size);
   return ::new (mem) Constraint(kind,
                                 first, second, third,
                                 locator, typeVars);
@@ -708,7 +708,7 @@ Constraint *Constraint::createMember(ConstraintSystem &cs, ConstraintKind kind,
 
   // Create the constraint.
   unsigned size = totalSizeToAlloc<TypeVariableType*>(typeVars.size());
-  void *mem = cs.getAllocator().Allocate(size, alignof(Constraint));
+  void *mem = cs.allocateConstraint(size);
   return new (mem) Constraint(kind, first, second, member, useDC,
                               functionRefKind, locator, typeVars);
 }
@@ -729,7 +729,7 @@ Constraint *Constraint::createValueWitness(
 
   // Create the constraint.
   unsigned size = totalSizeToAlloc<TypeVariableType*>(typeVars.size());
-  void *mem = cs.getAllocator().Allocate(size, alignof(Constraint));
+  void *mem = cs.allocateConstraint(size);
   return new (mem) Constraint(kind, first, second, requirement, useDC,
                               functionRefKind, locator, typeVars);
 }
@@ -756,7 +756,7 @@ Constraint *Constraint::createRestricted(ConstraintSystem &cs,
 
   // Create the constraint.
   unsigned size = totalSizeToAlloc<TypeVariableType*>(typeVars.size());
-  void *mem = cs.getAllocator().Allocate(size, alignof(Constraint));
+  void *mem = cs.allocateConstraint(size);
   return new (mem) Constraint(kind, restriction, first, second, locator,
                               typeVars);
 }
@@ -774,7 +774,7 @@ Constraint *Constraint::createFixed(ConstraintSystem &cs, ConstraintKind kind,
 
   // Create the constraint.
   unsigned size = totalSizeToAlloc<TypeVariableType*>(typeVars.size());
-  void *mem = cs.getAllocator().Allocate(size, alignof(Constraint));
+  void *mem = cs.allocateConstraint(size);
   return new (mem) Constraint(kind, fix, first, second, locator, typeVars);
 }
 
@@ -793,7 +793,7 @@ Constraint *Constraint::createFixedChoice(ConstraintSystem &cs, Type type,
 
   // Create the constraint.
   unsigned size = totalSizeToAlloc<TypeVariableType *>(typeVars.size());
-  void *mem = cs.getAllocator().Allocate(size, alignof(Constraint));
+  void *mem = cs.allocateConstraint(size);
   return new (mem) Constraint(type, choice, useDC, fix, locator, typeVars);
 }
 
@@ -864,7 +864,7 @@ Constraint *Constraint::createDisjunction(ConstraintSystem &cs,
   // Create the disjunction constraint.
   uniqueTypeVariables(typeVars);
   unsigned size = totalSizeToAlloc<TypeVariableType*>(typeVars.size());
-  void *mem = cs.getAllocator().Allocate(size, alignof(Constraint));
+  void *mem = cs.allocateConstraint(size);
   auto disjunction =  new (mem) Constraint(ConstraintKind::Disjunction,
                               cs.allocateCopy(constraints), locator, typeVars);
   disjunction->RememberChoice = (bool) rememberChoice;
@@ -885,7 +885,7 @@ Constraint *Constraint::createApplicableFunction(
 
   // Create the constraint.
   unsigned size = totalSizeToAlloc<TypeVariableType*>(typeVars.size());
-  void *mem = cs.getAllocator().Allocate(size, alignof(Constraint));
+  void *mem = cs.allocateConstraint(size);
   auto constraint = new (mem) Constraint(
       ConstraintKind::ApplicableFunction, argumentFnType, calleeType, locator,
       typeVars);
@@ -922,5 +922,5 @@ Constraint::getTrailingClosureMatching() const {
 
 void *Constraint::operator new(size_t bytes, ConstraintSystem& cs,
                                size_t alignment) {
-  return ::operator new (bytes, cs, alignment);
+  return cs.getConstraintArena().Allocate(bytes, alignment);
 }
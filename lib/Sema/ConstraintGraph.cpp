@@ -563,6 +563,9 @@ namespace {
                         ArrayRef<TypeVariableType *> typeVars)
         : cg(cg), typeVars(typeVars)
     {
+      // In the common case every type variable ends up with an entry.
+      representatives.reserve(typeVars.size());
+
       auto oneWayConstraints = connectedComponents();
 
       // If there were no one-way constraints, we're done.
@@ -717,16 +720,25 @@ namespace {
     /// Find the representative for the given type variable within the set
     /// of representatives in a union-find data structure.
     TypeVariableType *findRepresentative(TypeVariableType *typeVar) const {
-      // If we don't have a record of this type variable, it is it's own
-      // representative.
-      auto known = representatives.find(typeVar);
-      if (known == representatives.end() || known->second == typeVar)
-        return typeVar;
-
-      // Find the representative of the parent.
-      auto parent = known->second;
-      auto rep = findRepresentative(parent);
-      representatives[typeVar] = rep;
+      // Walk to the root of this type variable's set. A type variable
+      // without a record is its own representative.
+      auto rep = typeVar;
+      while (true) {
+        auto known = representatives.find(rep);
+        if (known == representatives.end() || known->second == rep)
+          break;
+        rep = known->second;
+      }
+
+      // Compress the path we just walked so that every entry along it
+      // points directly at the root, making the next query a single
+      // lookup.
+      while (typeVar != rep) {
+        auto known = representatives.find(typeVar);
+        auto parent = known->second;
+        known->second = rep;
+        typeVar = parent;
+      }
 
       return rep;
     }
@@ -271,6 +271,15 @@ void swift::performImportResolution(SourceFile &SF) {
 
   ImportResolver resolver(SF);
 
+  // Give the module loaders a chance to overlap discovery of the modules this
+  // file imports before we start loading them one by one.
+  SmallVector<Identifier, 4> importedModuleNames;
+  for (auto D : SF.getTopLevelDecls())
+    if (auto *ID = dyn_cast<ImportDecl>(D))
+      importedModuleNames.push_back(ID->getModulePath().front().Item);
+  if (!importedModuleNames.empty())
+    SF.getASTContext().prefetchModules(importedModuleNames);
+
   // Resolve each import declaration.
   for (auto D : SF.getTopLevelDecls())
     resolver.visit(D);
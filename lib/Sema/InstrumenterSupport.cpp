@@ -42,7 +42,9 @@ public:
       error = true;
     }
     DiagnosticEngine::formatDiagnosticText(llvm::errs(), Info.FormatString,
-                                           Info.FormatArgs);
+                                           Info.FormatArgs,
+                                           DiagnosticFormatOptions(),
+                                           Info.FormatCache);
     llvm::errs() << "\n";
   }
   bool hadError() { return error; }
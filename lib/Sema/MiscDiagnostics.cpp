@@ -4584,20 +4584,66 @@ static void diagnoseComparisonWithNaN(const Expr *E, const DeclContext *DC) {
 // High-level entry points.
 //===----------------------------------------------------------------------===//
 
+namespace {
+/// A single cheap pre-pass over an expression that records which kinds of
+/// syntactic nodes occur anywhere within it, so that diagnostic walks which
+/// can only ever fire on a particular kind of node are skipped outright when
+/// no such node is present. This pass deliberately walks into everything -
+/// including separately-checked closures and capture initializers - so that
+/// it over-approximates what any of the gated walks would visit.
+class SyntacticDiagnosticSummaryWalker : public ASTWalker {
+public:
+  bool HasClosure = false;
+  bool HasBinaryExpr = false;
+  bool HasCallExpr = false;
+  bool HasMemberRefExpr = false;
+  bool HasKeyPathApplicationExpr = false;
+
+  bool shouldWalkCaptureInitializerExpressions() override { return true; }
+
+  std::pair<bool, Expr *> walkToExprPre(Expr *E) override {
+    if (isa<AbstractClosureExpr>(E))
+      HasClosure = true;
+    else if (isa<BinaryExpr>(E))
+      HasBinaryExpr = true;
+    else if (isa<CallExpr>(E))
+      HasCallExpr = true;
+    else if (isa<MemberRefExpr>(E))
+      HasMemberRefExpr = true;
+    else if (isa<KeyPathApplicationExpr>(E))
+      HasKeyPathApplicationExpr = true;
+
+    return {true, E};
+  }
+};
+} // end anonymous namespace
+
 /// Emit diagnostics for syntactic restrictions on a given expression.
 void swift::performSyntacticExprDiagnostics(const Expr *E,
                                             const DeclContext *DC,
                                             bool isExprStmt) {
   auto &ctx = DC->getASTContext();
+
+  // Summarize the expression up front so that the walks below that only
+  // diagnose one kind of node can be skipped when that kind never occurs.
+  SyntacticDiagnosticSummaryWalker summary;
+  const_cast<Expr *>(E)->walk(summary);
+
   TypeChecker::diagnoseSelfAssignment(E);
   diagSyntacticUseRestrictions(E, DC, isExprStmt);
   diagRecursivePropertyAccess(E, DC);
-  diagnoseImplicitSelfUseInClosure(E, DC);
+  // Implicit self uses can only be diagnosed within a closure, either one
+  // inside this expression or one enclosing the declaration context.
+  if (summary.HasClosure || DC->isLocalContext())
+    diagnoseImplicitSelfUseInClosure(E, DC);
   diagnoseUnintendedOptionalBehavior(E, DC);
-  maybeDiagnoseCallToKeyValueObserveMethod(E, DC);
-  diagnoseExplicitUseOfLazyVariableStorage(E, DC);
-  diagnoseComparisonWithNaN(E, DC);
-  if (!ctx.isSwiftVersionAtLeast(5))
+  if (summary.HasCallExpr)
+    maybeDiagnoseCallToKeyValueObserveMethod(E, DC);
+  if (summary.HasMemberRefExpr)
+    diagnoseExplicitUseOfLazyVariableStorage(E, DC);
+  if (summary.HasBinaryExpr)
+    diagnoseComparisonWithNaN(E, DC);
+  if (!ctx.isSwiftVersionAtLeast(5) && summary.HasKeyPathApplicationExpr)
     diagnoseDeprecatedWritableKeyPath(E, DC);
   if (!ctx.LangOpts.DisableAvailabilityChecking)
     diagAvailability(E, const_cast<DeclContext*>(DC));
@@ -27,6 +27,7 @@
 #include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/SaveAndRestore.h"
+#include "llvm/Support/ThreadPool.h"
 #include <system_error>
 
 using namespace swift;
@@ -62,7 +63,51 @@ void SourceLoader::collectVisibleTopLevelModuleNames(
   // TODO: Implement?
 }
 
+void SourceLoader::prefetchModules(ArrayRef<Identifier> names) {
+  // Gather the modules we haven't already loaded or prefetched.
+  SmallVector<Identifier, 4> toFetch;
+  for (auto name : names) {
+    if (Ctx.getLoadedModule(name))
+      continue;
+    if (PrefetchedFiles.count(name.str()))
+      continue;
+    toFetch.push_back(name);
+  }
+
+  // Reading a single file ahead of time saves nothing over letting
+  // loadModule read it on demand.
+  if (toFetch.size() < 2)
+    return;
+
+  // Read each candidate file on its own worker. findModule only consults the
+  // immutable search paths and the source manager's file system, so it is
+  // safe to run concurrently as long as diagnostics are deferred to
+  // loadModule.
+  std::vector<FileOrError> results;
+  results.reserve(toFetch.size());
+  for (unsigned i = 0, e = toFetch.size(); i != e; ++i)
+    results.emplace_back(make_error_code(std::errc::no_such_file_or_directory));
+
+  llvm::ThreadPool pool;
+  for (unsigned i = 0, e = toFetch.size(); i != e; ++i) {
+    pool.async([this, &toFetch, &results, i] {
+      results[i] = findModule(Ctx, toFetch[i].str(), SourceLoc());
+    });
+  }
+  pool.wait();
+
+  // Keep the successful reads; failures are dropped so that loadModule
+  // retries them and emits the appropriate diagnostics.
+  for (unsigned i = 0, e = toFetch.size(); i != e; ++i)
+    if (results[i])
+      PrefetchedFiles[toFetch[i].str()] = std::move(results[i].get());
+}
+
 bool SourceLoader::canImportModule(ImportPath::Element ID) {
+  // If we already read the module's source file while prefetching, it exists.
+  if (PrefetchedFiles.count(ID.Item.str()))
+    return true;
+
   // Search the memory buffers to see if we can find this file on disk.
   FileOrError inputFileOrError = findModule(Ctx, ID.Item.str(),
                                             ID.Loc);
@@ -86,19 +131,26 @@ ModuleDecl *SourceLoader::loadModule(SourceLoc importLoc,
 
   auto moduleID = path[0];
 
-  FileOrError inputFileOrError = findModule(Ctx, moduleID.Item.str(),
-                                            moduleID.Loc);
-  if (!inputFileOrError) {
-    auto err = inputFileOrError.getError();
-    if (err != std::errc::no_such_file_or_directory) {
-      Ctx.Diags.diagnose(moduleID.Loc, diag::sema_opening_import,
-                         moduleID.Item, err.message());
+  // Use the buffer read ahead of time by prefetchModules, if there is one.
+  std::unique_ptr<llvm::MemoryBuffer> inputFile;
+  auto prefetched = PrefetchedFiles.find(moduleID.Item.str());
+  if (prefetched != PrefetchedFiles.end()) {
+    inputFile = std::move(prefetched->second);
+    PrefetchedFiles.erase(prefetched);
+  } else {
+    FileOrError inputFileOrError = findModule(Ctx, moduleID.Item.str(),
+                                              moduleID.Loc);
+    if (!inputFileOrError) {
+      auto err = inputFileOrError.getError();
+      if (err != std::errc::no_such_file_or_directory) {
+        Ctx.Diags.diagnose(moduleID.Loc, diag::sema_opening_import,
+                           moduleID.Item, err.message());
+      }
+
+      return nullptr;
     }
-
-    return nullptr;
+    inputFile = std::move(inputFileOrError.get());
   }
-  std::unique_ptr<llvm::MemoryBuffer> inputFile =
-    std::move(inputFileOrError.get());
 
   if (dependencyTracker)
     dependencyTracker->addDependency(inputFile->getBufferIdentifier(),
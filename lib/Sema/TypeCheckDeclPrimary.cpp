@@ -2305,8 +2305,10 @@ public:
     if (!AFD->getBodySourceRange().isValid())
       return false;
 
-    // If we're gonna serialize the body, we can't skip it.
-    if (AFD->getResilienceExpansion() == ResilienceExpansion::Minimal)
+    // If we're gonna serialize the body, we can't skip it, unless we're
+    // skipping all bodies and giving up on serialized SIL entirely.
+    if (!getASTContext().TypeCheckerOpts.SkipAllFunctionBodies &&
+        AFD->getResilienceExpansion() == ResilienceExpansion::Minimal)
       return false;
 
     return true;
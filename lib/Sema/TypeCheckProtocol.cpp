@@ -1157,25 +1157,47 @@ WitnessChecker::lookupValueWitnesses(ValueDecl *req, bool *ignoringNames) {
   auto reqBaseName = reqName.withoutArgumentLabels();
 
   if (req->isOperator()) {
-    // Operator lookup is always global.
-    auto lookup = TypeChecker::lookupUnqualified(DC->getModuleScopeContext(),
-                                                 reqBaseName, SourceLoc(),
-                                                 defaultUnqualifiedLookupOptions);
-    for (auto candidate : lookup) {
-      auto decl = candidate.getValueDecl();
-      if (swift::isMemberOperator(cast<FuncDecl>(decl), Adoptee)) {
-        witnesses.push_back(decl);
+    // Operator lookup is always global, and its results don't depend on the
+    // requirement beyond the operator's name; overloaded operator
+    // requirements share a name, so look each name up only once per
+    // conformance.
+    auto known = WitnessLookupCache.find(reqBaseName.getFullName());
+    if (known == WitnessLookupCache.end()) {
+      SmallVector<ValueDecl *, 4> found;
+      auto lookup = TypeChecker::lookupUnqualified(
+          DC->getModuleScopeContext(), reqBaseName, SourceLoc(),
+          defaultUnqualifiedLookupOptions);
+      for (auto candidate : lookup) {
+        auto decl = candidate.getValueDecl();
+        if (swift::isMemberOperator(cast<FuncDecl>(decl), Adoptee)) {
+          found.push_back(decl);
+        }
       }
+      known = WitnessLookupCache.insert(
+          {reqBaseName.getFullName(), std::move(found)}).first;
     }
+    witnesses.append(known->second.begin(), known->second.end());
   } else {
     // Variable/function/subscript requirements.
     auto *nominal = Adoptee->getAnyNominal();
-    nominal->synthesizeSemanticMembersIfNeeded(reqName.getFullName());
 
-    SmallVector<ValueDecl *, 4> lookupResults;
+    // Cache the qualified lookups by name as well; overloaded requirements
+    // repeat them.
+    auto lookupCached = [&](DeclNameRef name) -> ArrayRef<ValueDecl *> {
+      auto known = WitnessLookupCache.find(name.getFullName());
+      if (known == WitnessLookupCache.end()) {
+        nominal->synthesizeSemanticMembersIfNeeded(name.getFullName());
+
+        SmallVector<ValueDecl *, 4> lookupResults;
+        DC->lookupQualified(nominal, name, NL_ProtocolMembers, lookupResults);
+        known = WitnessLookupCache.insert(
+            {name.getFullName(), std::move(lookupResults)}).first;
+      }
+      return known->second;
+    };
+
     bool addedAny = false;
-    DC->lookupQualified(nominal, reqName, NL_ProtocolMembers, lookupResults);
-    for (auto *decl : lookupResults) {
+    for (auto *decl : lookupCached(reqName)) {
       if (!isa<ProtocolDecl>(decl->getDeclContext())) {
         witnesses.push_back(decl);
         addedAny = true;
@@ -1185,9 +1207,7 @@ WitnessChecker::lookupValueWitnesses(ValueDecl *req, bool *ignoringNames) {
     // If we didn't find anything with the appropriate name, look
     // again using only the base name.
     if (!addedAny && ignoringNames) {
-      lookupResults.clear();
-      DC->lookupQualified(nominal, reqBaseName, NL_ProtocolMembers, lookupResults);
-      for (auto *decl : lookupResults) {
+      for (auto *decl : lookupCached(reqBaseName)) {
         if (!isa<ProtocolDecl>(decl->getDeclContext()))
           witnesses.push_back(decl);
       }
@@ -4034,6 +4054,10 @@ ResolveWitnessResult ConformanceChecker::resolveWitnessViaDerivation(
   if (!derived)
     return ResolveWitnessResult::ExplicitFailed;
 
+  // Derivation adds members to the adoptee, so witness lookups performed
+  // before this point may be incomplete now.
+  WitnessLookupCache.clear();
+
   // Try to match the derived requirement.
   auto match = matchWitness(ReqEnvironmentCache, Proto, Conformance, DC,
                             requirement, derived);
@@ -576,6 +576,12 @@ protected:
 
   RequirementEnvironmentCache ReqEnvironmentCache;
 
+  /// Caches the results of the name lookups performed when gathering value
+  /// witnesses, keyed by the looked-up name. Requirements in a large
+  /// protocol frequently share names across overloads, and the operator
+  /// lookups in particular are module-wide.
+  llvm::DenseMap<DeclName, SmallVector<ValueDecl *, 4>> WitnessLookupCache;
+
   Optional<std::pair<AccessScope, bool>> RequiredAccessScopeAndUsableFromInline;
 
   WitnessChecker(ASTContext &ctx, ProtocolDecl *proto, Type adoptee,
@@ -595,6 +595,13 @@ SILDeserializer::readSILFunctionChecked(DeclID FID, SILFunction *existingFn,
 
     fn->setSerialized(IsSerialized_t(isSerialized));
 
+    // The record may carry an effects summary inferred by the optimizer in
+    // the defining module (see cross-module optimization), which is not
+    // derivable from the AST; transfer it to the existing declaration.
+    if (!fn->hasEffectsKind() &&
+        EffectsKind(effect) != EffectsKind::Unspecified)
+      fn->setEffectsKind(EffectsKind(effect));
+
     // If the serialized function comes from the same module, we're merging
     // modules, and can update the the linkage directly. This is needed to
     // correctly update the linkage for forward declarations to entities defined
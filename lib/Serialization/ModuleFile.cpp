@@ -904,6 +904,22 @@ void ModuleFile::getDisplayDecls(SmallVectorImpl<Decl *> &results) {
   getTopLevelDecls(results);
 }
 
+bool ModuleFile::getExportedTBDSymbols(
+       SmallVectorImpl<std::pair<uint8_t, StringRef>> &symbols) const {
+  StringRef blob = Core->ExportedTBDSymbols;
+  if (blob.empty())
+    return false;
+
+  while (!blob.empty()) {
+    uint8_t kind = static_cast<uint8_t>(blob.front());
+    blob = blob.drop_front();
+    StringRef name = blob.take_until([](char c) { return c == '\0'; });
+    symbols.push_back({kind, name});
+    blob = blob.drop_front(std::min(name.size() + 1, blob.size()));
+  }
+  return true;
+}
+
 Optional<CommentInfo> ModuleFile::getCommentForDecl(const Decl *D) const {
   assert(D);
 
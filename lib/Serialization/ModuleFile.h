@@ -624,6 +624,14 @@ public:
   /// shadowed clang module.
   void getDisplayDecls(SmallVectorImpl<Decl*> &results);
 
+  /// Adds the TBD symbol table serialized when this module was built, if
+  /// any, to the given vector as (raw \c llvm::MachO::SymbolKind, mangled
+  /// name) pairs.
+  ///
+  /// \returns true if a symbol table was serialized into this module.
+  bool getExportedTBDSymbols(
+         SmallVectorImpl<std::pair<uint8_t, StringRef>> &symbols) const;
+
   StringRef getModuleFilename() const {
     if (!Core->ModuleInterfacePath.empty())
       return Core->ModuleInterfacePath;
@@ -15,7 +15,11 @@
 #include "BCReadingExtras.h"
 #include "DeserializationErrors.h"
 #include "swift/Strings.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/Support/FileSystem.h"
 #include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Mutex.h"
+#include "llvm/Support/raw_ostream.h"
 #include "llvm/Support/OnDiskHashTable.h"
 
 using namespace swift;
@@ -670,6 +674,9 @@ bool ModuleFileSharedCore::readIndexBlock(llvm::BitstreamCursor &cursor) {
       case index_block::ORDERED_TOP_LEVEL_DECLS:
         allocateBuffer(OrderedTopLevelDecls, scratch);
         break;
+      case index_block::EXPORTED_TBD_SYMBOLS:
+        ExportedTBDSymbols = blobData;
+        break;
       case index_block::LOCAL_TYPE_DECLS:
         LocalTypeDecls = readLocalDeclTable(scratch, blobData);
         break;
@@ -1083,6 +1090,86 @@ StringRef ModuleFileSharedCore::getIdentifierText(IdentifierID IID) const {
   return rawStrPtr.slice(0, terminatorOffset);
 }
 
+namespace {
+/// A process-wide registry mapping module files to their already-loaded
+/// shared cores. Entries hold weak references so the registry never
+/// extends a core's lifetime past its last client.
+struct SharedCoreRegistry {
+  llvm::sys::Mutex Lock;
+  llvm::StringMap<std::pair<std::weak_ptr<const ModuleFileSharedCore>,
+                            serialization::ValidationInfo>>
+      Entries;
+
+  static SharedCoreRegistry &get() {
+    static SharedCoreRegistry registry;
+    return registry;
+  }
+};
+} // end anonymous namespace
+
+serialization::ValidationInfo ModuleFileSharedCore::loadShared(
+    StringRef moduleInterfacePath,
+    std::unique_ptr<llvm::MemoryBuffer> moduleInputBuffer,
+    std::unique_ptr<llvm::MemoryBuffer> moduleDocInputBuffer,
+    std::unique_ptr<llvm::MemoryBuffer> moduleSourceInfoInputBuffer,
+    bool isFramework,
+    std::shared_ptr<const ModuleFileSharedCore> &theModule) {
+  // Buffers synthesized in memory have no stable identity to key on, and a
+  // module rebuilt in place can keep the same path and size, so the file's
+  // modification time has to participate in the key as well. If the buffer
+  // does not correspond to a file we can stat, don't share the core.
+  llvm::sys::fs::file_status fileStatus;
+  bool isCacheable =
+      !moduleInputBuffer->getBufferIdentifier().empty() &&
+      moduleInputBuffer->getBufferIdentifier() != "<buffer>" &&
+      !llvm::sys::fs::status(moduleInputBuffer->getBufferIdentifier(),
+                             fileStatus);
+
+  // Key the registry on the module's identity as the filesystem reported
+  // it, plus everything else that shapes the loaded core. Hashing the
+  // buffer contents instead would fault in the entire file and defeat
+  // lazy paging of the decls-and-types block.
+  llvm::SmallString<256> key;
+  if (isCacheable) {
+    llvm::raw_svector_ostream keyOS(key);
+    keyOS << moduleInputBuffer->getBufferIdentifier() << '\0'
+          << moduleInputBuffer->getBufferSize() << '\0'
+          << fileStatus.getLastModificationTime()
+                 .time_since_epoch()
+                 .count() << '\0'
+          << (isFramework ? 'F' : 'f')
+          << (moduleDocInputBuffer ? 'D' : 'd')
+          << (moduleSourceInfoInputBuffer ? 'S' : 's') << '\0'
+          << moduleInterfacePath;
+  }
+
+  auto &registry = SharedCoreRegistry::get();
+  if (isCacheable) {
+    llvm::sys::ScopedLock guard(registry.Lock);
+    auto known = registry.Entries.find(key);
+    if (known != registry.Entries.end()) {
+      if (auto existing = known->second.first.lock()) {
+        theModule = std::move(existing);
+        return known->second.second;
+      }
+      registry.Entries.erase(known);
+    }
+  }
+
+  auto info = load(moduleInterfacePath, std::move(moduleInputBuffer),
+                   std::move(moduleDocInputBuffer),
+                   std::move(moduleSourceInfoInputBuffer), isFramework,
+                   theModule);
+
+  // Only fully-valid cores are worth sharing.
+  if (isCacheable && info.status == serialization::Status::Valid) {
+    llvm::sys::ScopedLock guard(registry.Lock);
+    registry.Entries[key] = {theModule, info};
+  }
+
+  return info;
+}
+
 ModuleFileSharedCore::ModuleFileSharedCore(
     std::unique_ptr<llvm::MemoryBuffer> moduleInputBuffer,
     std::unique_ptr<llvm::MemoryBuffer> moduleDocInputBuffer,
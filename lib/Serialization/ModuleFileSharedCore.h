@@ -259,6 +259,11 @@ private:
 
   ArrayRef<serialization::DeclID> OrderedTopLevelDecls;
 
+  /// The module's TBD symbol table, if one was serialized: per symbol, the
+  /// raw \c llvm::MachO::SymbolKind byte followed by the null-terminated
+  /// mangled name. Points into the module's memory buffer.
+  StringRef ExportedTBDSymbols;
+
   class DeclCommentTableInfo;
   using SerializedDeclCommentTable =
       llvm::OnDiskIterableChainedHashTable<DeclCommentTableInfo>;
@@ -481,6 +486,22 @@ public:
     return info;
   }
 
+  /// Loads a module from the given memory buffer, consulting a
+  /// process-wide registry of already-loaded module files first.
+  ///
+  /// When several compiler instances in one process (e.g. SourceKit
+  /// sessions or batch-mode frontends) import the same module file, they
+  /// all map to a single \c ModuleFileSharedCore, so per-module index
+  /// tables and lazily-deserialized state are shared rather than
+  /// duplicated. Otherwise behaves exactly like \c load().
+  static serialization::ValidationInfo
+  loadShared(StringRef moduleInterfacePath,
+             std::unique_ptr<llvm::MemoryBuffer> moduleInputBuffer,
+             std::unique_ptr<llvm::MemoryBuffer> moduleDocInputBuffer,
+             std::unique_ptr<llvm::MemoryBuffer> moduleSourceInfoInputBuffer,
+             bool isFramework,
+             std::shared_ptr<const ModuleFileSharedCore> &theModule);
+
   // Out of line to avoid instantiation OnDiskChainedHashTable here.
   ~ModuleFileSharedCore();
 
@@ -56,7 +56,7 @@ const uint16_t SWIFTMODULE_VERSION_MAJOR = 0;
 /// describe what change you made. The content of this comment isn't important;
 /// it just ensures a conflict if two people change the module format.
 /// Don't worry about adhering to the 80-column limit for this line.
-const uint16_t SWIFTMODULE_VERSION_MINOR = 580; // async_continuation SIL insns
+const uint16_t SWIFTMODULE_VERSION_MINOR = 582; // @_alwaysEmitReflectionMetadata
 
 /// A standard hash seed used for all string hashes in a serialized module.
 ///
@@ -1995,7 +1995,11 @@ namespace index_block {
 
     SUBSTITUTION_MAP_OFFSETS,
     CLANG_TYPE_OFFSETS,
-    LastRecordKind = CLANG_TYPE_OFFSETS,
+
+    /// The module's TBD symbol table, precomputed by TBDGen when the module
+    /// was built so TBD files can be re-emitted without visiting the AST.
+    EXPORTED_TBD_SYMBOLS,
+    LastRecordKind = EXPORTED_TBD_SYMBOLS,
   };
   
   constexpr const unsigned RecordIDFieldWidth = 5;
@@ -2058,6 +2062,12 @@ namespace index_block {
     RecordIDField,        // record ID
     BCArray<DeclIDField>  // list of decls by ID
   >;
+
+  using ExportedTBDSymbolsLayout = BCRecordLayout<
+    EXPORTED_TBD_SYMBOLS,
+    BCBlob // per symbol: raw llvm::MachO::SymbolKind byte, then the
+           // null-terminated mangled name
+  >;
 }
 
 /// \sa DECL_MEMBER_TABLES_BLOCK_ID
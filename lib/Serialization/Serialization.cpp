@@ -788,6 +788,7 @@ void Serializer::writeBlockInfoBlock() {
   BLOCK_RECORD(index_block, NESTED_TYPE_DECLS);
   BLOCK_RECORD(index_block, DECL_MEMBER_NAMES);
   BLOCK_RECORD(index_block, ORDERED_TOP_LEVEL_DECLS);
+  BLOCK_RECORD(index_block, EXPORTED_TBD_SYMBOLS);
 
   BLOCK(DECL_MEMBER_TABLES_BLOCK);
   BLOCK_RECORD(decl_member_tables_block, DECL_MEMBERS);
@@ -5006,7 +5007,8 @@ static void collectInterestingNestedDeclarations(
   }
 }
 
-void Serializer::writeAST(ModuleOrSourceFile DC) {
+void Serializer::writeAST(ModuleOrSourceFile DC,
+                          const SerializationOptions &options) {
   DeclTable topLevelDecls, operatorDecls, operatorMethodDecls;
   DeclTable precedenceGroupDecls;
   ObjCMethodTable objcMethods;
@@ -5161,6 +5163,17 @@ void Serializer::writeAST(ModuleOrSourceFile DC) {
     OrderedDecls.emit(ScratchRecord, index_block::ORDERED_TOP_LEVEL_DECLS,
                       orderedTopLevelDecls);
 
+    if (!options.TBDSymbols.empty()) {
+      SmallString<4096> blob;
+      for (const auto &symbol : options.TBDSymbols) {
+        blob.push_back(static_cast<char>(symbol.first));
+        blob.append(symbol.second);
+        blob.push_back('\0');
+      }
+      index_block::ExportedTBDSymbolsLayout TBDSymbolsTable(Out);
+      TBDSymbolsTable.emit(ScratchRecord, blob);
+    }
+
     index_block::ObjCMethodTableLayout ObjCMethodTable(Out);
     writeObjCMethodTable(ObjCMethodTable, objcMethods);
 
@@ -5228,6 +5241,16 @@ void Serializer::writeToStream(
     const fine_grained_dependencies::SourceFileDepGraph *DepGraph) {
   Serializer S{SWIFTMODULE_SIGNATURE, DC};
 
+  // Swiftmodule sizes are stable across rebuilds, so the previous build of
+  // this module is a good capacity estimate. Without it, a large module
+  // grows the bitstream buffer through dozens of doublings, copying the
+  // accumulated contents each time.
+  if (!StringRef::withNullAsEmpty(options.OutputPath).empty()) {
+    uint64_t prevSize;
+    if (!llvm::sys::fs::file_size(options.OutputPath, prevSize))
+      S.Buffer.reserve(prevSize + prevSize / 8);
+  }
+
   // FIXME: This is only really needed for debugging. We don't actually use it.
   S.writeBlockInfoBlock();
 
@@ -5236,7 +5259,7 @@ void Serializer::writeToStream(
     S.writeHeader(options);
     S.writeInputBlock(options);
     S.writeSIL(SILMod, options.SerializeAllSIL);
-    S.writeAST(DC);
+    S.writeAST(DC, options);
     if (options.ExperimentalCrossModuleIncrementalInfo && DepGraph) {
       fine_grained_dependencies::writeFineGrainedDependencyGraph(
           S.Out, *DepGraph, fine_grained_dependencies::Purpose::ForSwiftModule);
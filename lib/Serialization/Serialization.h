@@ -391,7 +391,7 @@ private:
   void writeSIL(const SILModule *M, bool serializeAllSIL);
 
   /// Top-level entry point for serializing a module.
-  void writeAST(ModuleOrSourceFile DC);
+  void writeAST(ModuleOrSourceFile DC, const SerializationOptions &options);
 
   /// Serializes the given dependnecy graph into the incremental information
   /// section of this swift module.
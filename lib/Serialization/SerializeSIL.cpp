@@ -2801,6 +2801,18 @@ void SILSerializer::writeSILBlock(const SILModule *SILMod) {
   // `Worklist` is processed separately.
   processSILFunctionWorklist();
 
+  // Under cross-module optimization, emit declaration-only records for
+  // public functions which carry an effects summary but whose bodies are
+  // not serialized, so that clients can consume the summary without the
+  // implementation SIL.
+  if (SILMod->getOptions().CrossModuleOptimization) {
+    for (const SILFunction &F : *SILMod) {
+      if (F.hasEffectsKind() && !F.isExternalDeclaration() &&
+          hasPublicVisibility(F.getLinkage()) && !FuncsToEmit.count(&F))
+        FuncsToEmit[&F] = true;
+    }
+  }
+
   // Now write function declarations for every function we've
   // emitted a reference to without emitting a function body for.
   for (const SILFunction &F : *SILMod) {
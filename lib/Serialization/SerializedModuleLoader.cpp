@@ -363,11 +363,17 @@ std::error_code SerializedModuleLoaderBase::openModuleFile(
   // the surface look like memory corruption.
   //
   // rdar://63755989
+  // Note that the module file is read through bitstream cursors, which are
+  // purely range-based, so no null terminator is required. Requesting one
+  // would force files whose size is a multiple of the page size to be copied
+  // into allocated memory instead of mmap'ed, and the copy would be paid up
+  // front for blocks (notably DECLS_AND_TYPES) that are deserialized lazily,
+  // if at all.
   bool enableVolatileModules = Ctx.LangOpts.EnableVolatileModules;
   llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> ModuleOrErr =
       FS.getBufferForFile(ModulePath,
                           /*FileSize=*/-1,
-                          /*RequiresNullTerminator=*/true,
+                          /*RequiresNullTerminator=*/false,
                           /*IsVolatile=*/enableVolatileModules);
   if (!ModuleOrErr)
     return ModuleOrErr.getError();
@@ -378,9 +384,12 @@ std::error_code SerializedModuleLoaderBase::openModuleFile(
 
 llvm::ErrorOr<ModuleDependencies> SerializedModuleLoaderBase::scanModuleFile(
     Twine modulePath) {
-  // Open the module file
+  // Open the module file. As above, no null terminator is required and
+  // asking for one can defeat mmap.
   auto &fs = *Ctx.SourceMgr.getFileSystem();
-  auto moduleBuf = fs.getBufferForFile(modulePath);
+  auto moduleBuf = fs.getBufferForFile(modulePath,
+                                       /*FileSize=*/-1,
+                                       /*RequiresNullTerminator=*/false);
   if (!moduleBuf)
     return moduleBuf.getError();
 
@@ -701,7 +710,7 @@ LoadedFile *SerializedModuleLoaderBase::loadAST(
   std::unique_ptr<ModuleFile> loadedModuleFile;
   std::shared_ptr<const ModuleFileSharedCore> loadedModuleFileCore;
   serialization::ValidationInfo loadInfo =
-      ModuleFileSharedCore::load(moduleInterfacePath,
+      ModuleFileSharedCore::loadShared(moduleInterfacePath,
                        std::move(moduleInputBuffer),
                        std::move(moduleDocInputBuffer),
                        std::move(moduleSourceInfoInputBuffer),
@@ -1268,6 +1277,11 @@ void SerializedASTFile::getTopLevelDeclsWhereAttributesMatch(
   File.getTopLevelDecls(results, matchAttributes);
 }
 
+bool SerializedASTFile::getExportedTBDSymbols(
+    SmallVectorImpl<std::pair<uint8_t, StringRef>> &symbols) const {
+  return File.getExportedTBDSymbols(symbols);
+}
+
 void SerializedASTFile::getOperatorDecls(
     SmallVectorImpl<OperatorDecl *> &results) const {
   File.getOperatorDecls(results);
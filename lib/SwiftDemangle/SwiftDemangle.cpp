@@ -17,6 +17,78 @@
 
 #include "swift/Demangling/Demangle.h"
 #include "swift/SwiftDemangle/SwiftDemangle.h"
+#include "llvm/ADT/Hashing.h"
+#include <vector>
+
+namespace {
+
+/// Per-thread demangling state shared by the entry points below.
+///
+/// Keeping one Context alive per thread lets the demangler recycle its node
+/// slab memory across symbols instead of re-allocating it for each call (see
+/// NodeFactory::clear). On top of that, a direct-mapped cache keyed by the
+/// hash of the mangled string remembers the printed result of recently
+/// demangled symbols. Clients like crash symbolication demangle large and
+/// highly duplicate symbol sets; for them a repeated symbol becomes a hash
+/// lookup and a string compare. A hash collision simply evicts the older
+/// entry, which bounds the cache's memory and approximates LRU behavior for
+/// such workloads. Everything is thread-local, so no locking is needed.
+class ThreadDemangler {
+  static const size_t CacheSize = 1024;
+
+  struct CacheEntry {
+    std::string MangledName;
+    std::string DemangledName;
+  };
+
+  swift::Demangle::Context DCtx;
+
+  /// Allocated lazily on the first cacheable demangling.
+  std::vector<CacheEntry> Cache;
+
+public:
+  /// Demangle \p MangledName with \p Options, without consulting the cache.
+  std::string demangle(llvm::StringRef MangledName,
+                       const swift::Demangle::DemangleOptions &Options) {
+    std::string Result = DCtx.demangleSymbolAsString(MangledName, Options);
+    DCtx.clear();
+    return Result;
+  }
+
+  /// Demangle \p MangledName with the fixed option set of
+  /// swift_demangle_getDemangledName, consulting the cache first.
+  ///
+  /// The returned reference is valid until the cache entry is evicted by a
+  /// colliding symbol on the same thread.
+  const std::string &getDemangledName(llvm::StringRef MangledName) {
+    if (Cache.empty())
+      Cache.resize(CacheSize);
+    CacheEntry &E = Cache[llvm::hash_value(MangledName) % CacheSize];
+    if (E.MangledName != MangledName) {
+      swift::Demangle::DemangleOptions Options;
+      Options.SynthesizeSugarOnTypes = true;
+      E.MangledName = MangledName.str();
+      E.DemangledName = demangle(MangledName, Options);
+    }
+    return E.DemangledName;
+  }
+
+  swift::Demangle::Context &getContext() { return DCtx; }
+};
+
+thread_local ThreadDemangler Demangler;
+
+/// Copy \p Result to an output buffer and ensure '\0' termination.
+size_t copyResult(const std::string &Result, char *OutputBuffer,
+                  size_t Length) {
+  if (OutputBuffer && Length > 0) {
+    auto Dest = strncpy(OutputBuffer, Result.c_str(), Length);
+    Dest[Length - 1] = '\0';
+  }
+  return Result.length();
+}
+
+} // end anonymous namespace
 
 static size_t swift_demangle_getDemangledName_Options(const char *MangledName,
     char *OutputBuffer, size_t Length,
@@ -27,27 +99,31 @@ static size_t swift_demangle_getDemangledName_Options(const char *MangledName,
   if (!swift::Demangle::isSwiftSymbol(MangledName))
     return 0; // Not a mangled name
 
-  std::string Result = swift::Demangle::demangleSymbolAsString(
-      llvm::StringRef(MangledName), DemangleOptions);
+  std::string Result =
+      Demangler.demangle(llvm::StringRef(MangledName), DemangleOptions);
 
   if (Result == MangledName)
     return 0; // Not a mangled name
 
-  // Copy the result to an output buffer and ensure '\0' termination.
-  if (OutputBuffer && Length > 0) {
-    auto Dest = strncpy(OutputBuffer, Result.c_str(), Length);
-    Dest[Length - 1] = '\0';
-  }
-  return Result.length();
+  return copyResult(Result, OutputBuffer, Length);
 }
 
 size_t swift_demangle_getDemangledName(const char *MangledName,
                                        char *OutputBuffer,
                                        size_t Length) {
-  swift::Demangle::DemangleOptions DemangleOptions;
-  DemangleOptions.SynthesizeSugarOnTypes = true;
-  return swift_demangle_getDemangledName_Options(MangledName, OutputBuffer,
-                                                 Length, DemangleOptions);
+  assert(MangledName != nullptr && "null input");
+  assert(OutputBuffer != nullptr || Length == 0);
+
+  if (!swift::Demangle::isSwiftSymbol(MangledName))
+    return 0; // Not a mangled name
+
+  const std::string &Result =
+      Demangler.getDemangledName(llvm::StringRef(MangledName));
+
+  if (Result == MangledName)
+    return 0; // Not a mangled name
+
+  return copyResult(Result, OutputBuffer, Length);
 }
 
 size_t swift_demangle_getSimplifiedDemangledName(const char *MangledName,
@@ -62,27 +138,22 @@ size_t swift_demangle_getModuleName(const char *MangledName,
                                     char *OutputBuffer,
                                     size_t Length) {
 
-  swift::Demangle::Context DCtx;
+  auto &DCtx = Demangler.getContext();
   std::string Result = DCtx.getModuleName(llvm::StringRef(MangledName));
+  DCtx.clear();
 
-  // Copy the result to an output buffer and ensure '\0' termination.
-  if (OutputBuffer && Length > 0) {
-    auto Dest = strncpy(OutputBuffer, Result.c_str(), Length);
-    Dest[Length - 1] = '\0';
-  }
-  return Result.length();
+  return copyResult(Result, OutputBuffer, Length);
 }
 
 
 int swift_demangle_hasSwiftCallingConvention(const char *MangledName) {
-  swift::Demangle::Context DCtx;
-  if (DCtx.hasSwiftCallingConvention(llvm::StringRef(MangledName)))
-    return 1;
-  return 0;
+  auto &DCtx = Demangler.getContext();
+  bool Result = DCtx.hasSwiftCallingConvention(llvm::StringRef(MangledName));
+  DCtx.clear();
+  return Result ? 1 : 0;
 }
 
 size_t fnd_get_demangled_name(const char *MangledName, char *OutputBuffer,
                               size_t Length) {
   return swift_demangle_getDemangledName(MangledName, OutputBuffer, Length);
 }
-
@@ -10,6 +10,7 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include "llvm/Support/FileSystem.h"
 #include "llvm/Support/JSON.h"
 #include "llvm/Support/Path.h"
 #include "swift/SymbolGraphGen/SymbolGraphGen.h"
@@ -46,6 +47,34 @@ int serializeSymbolGraph(SymbolGraph &SG,
   return EXIT_SUCCESS;
 }
 
+/// Check whether the symbol graph files for `M` are already newer than the
+/// serialized module file they would be generated from.
+bool symbolGraphIsUpToDate(const ModuleDecl &M,
+                           const SymbolGraphOptions &Options) {
+  auto ModuleFile = M.getModuleFilename();
+  if (ModuleFile.empty()) {
+    return false;
+  }
+
+  llvm::sys::fs::file_status ModuleStatus;
+  if (llvm::sys::fs::status(ModuleFile, ModuleStatus)) {
+    return false;
+  }
+
+  SmallString<1024> OutputPath(Options.OutputDir);
+  llvm::sys::path::append(OutputPath,
+                          llvm::Twine(M.getNameStr()) + ".symbols.json");
+  llvm::sys::fs::file_status OutputStatus;
+  if (llvm::sys::fs::status(OutputPath, OutputStatus)) {
+    return false;
+  }
+
+  // The main graph and any extension graphs are written together, so the
+  // main graph's timestamp stands in for all of the module's output files.
+  return ModuleStatus.getLastModificationTime() <=
+         OutputStatus.getLastModificationTime();
+}
+
 } // end anonymous namespace
 
 // MARK: - Main Entry Point
@@ -54,6 +83,12 @@ int serializeSymbolGraph(SymbolGraph &SG,
 int
 symbolgraphgen::emitSymbolGraphForModule(ModuleDecl *M,
                                          const SymbolGraphOptions &Options) {
+  if (Options.SkipUpToDate && symbolGraphIsUpToDate(*M, Options)) {
+    llvm::errs() << "Symbol graph for " << M->getNameStr()
+        << " is up to date; skipping.\n";
+    return EXIT_SUCCESS;
+  }
+
   SymbolGraphASTWalker Walker(*M, Options);
   SmallVector<Decl *, 64> ModuleDecls;
   M->getDisplayDecls(ModuleDecls);
@@ -44,19 +44,22 @@ static bool shouldCacheNode(tok TokKind, size_t TextSize,
 
 RC<RawSyntax>
 RawSyntaxTokenCache::getToken(RC<SyntaxArena> &Arena, tok TokKind,
-                              OwnedString Text,
+                              StringRef Text,
                               ArrayRef<TriviaPiece> LeadingTrivia,
                               ArrayRef<TriviaPiece> TrailingTrivia) {
   // Determine whether this token is worth to cache.
   if (!shouldCacheNode(TokKind, Text.size(), LeadingTrivia, TrailingTrivia)) {
-    // Do not use cache.
-    return RawSyntax::make(TokKind, Text, LeadingTrivia, TrailingTrivia,
+    // Do not use cache. The node is allocated in the arena and freed together
+    // with it, so the token text can live there as well instead of in a
+    // separate ref-counted allocation.
+    auto OwnedText = OwnedString::makeUnowned(Arena->copyString(Text));
+    return RawSyntax::make(TokKind, OwnedText, LeadingTrivia, TrailingTrivia,
                            SourcePresence::Present, Arena);
   }
 
   // This node is cacheable. Get or create.
   llvm::FoldingSetNodeID ID;
-  RawSyntax::Profile(ID, TokKind, Text.str(), LeadingTrivia, TrailingTrivia);
+  RawSyntax::Profile(ID, TokKind, Text, LeadingTrivia, TrailingTrivia);
 
   void *insertPos = nullptr;
   if (auto existing = CachedTokens.FindNodeOrInsertPos(ID, insertPos)) {
@@ -64,8 +67,10 @@ RawSyntaxTokenCache::getToken(RC<SyntaxArena> &Arena, tok TokKind,
     return existing->get();
   }
 
-  // Could not found in the cache. Create it.
-  auto Raw = RawSyntax::make(TokKind, Text, LeadingTrivia, TrailingTrivia,
+  // Could not found in the cache. Create it. Only copy the text into the
+  // arena on a miss so that repeated tokens don't accumulate dead copies.
+  auto OwnedText = OwnedString::makeUnowned(Arena->copyString(Text));
+  auto Raw = RawSyntax::make(TokKind, OwnedText, LeadingTrivia, TrailingTrivia,
                              SourcePresence::Present, Arena);
   auto IDRef = ID.Intern(Arena->getAllocator());
   auto CacheNode = new (Arena) RawSyntaxCacheNode(Raw, IDRef);
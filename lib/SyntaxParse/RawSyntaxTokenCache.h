@@ -21,7 +21,6 @@
 
 namespace swift {
   enum class tok;
-  class OwnedString;
 
 namespace syntax {
   class RawSyntax;
@@ -61,8 +60,12 @@ class RawSyntaxTokenCache {
   std::vector<RawSyntaxCacheNode *> CacheNodes;
 
 public:
+  /// Returns a \c RawSyntax token with the given contents, either from the
+  /// cache or newly created. \p Text does not need to outlive the call; on a
+  /// cache miss it is copied into \p Arena so that it lives exactly as long
+  /// as the returned node.
   RC<syntax::RawSyntax> getToken(RC<syntax::SyntaxArena> &Arena, tok TokKind,
-                                 OwnedString Text,
+                                 StringRef Text,
                                  ArrayRef<syntax::TriviaPiece> LeadingTrivia,
                                  ArrayRef<syntax::TriviaPiece> TrailingTrivia);
 
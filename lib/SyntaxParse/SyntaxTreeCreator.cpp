@@ -109,6 +109,31 @@ SyntaxTreeCreator::realizeSyntaxRoot(OpaqueSyntaxNode rootN,
   return rootNode;
 }
 
+/// Equivalent to \c ParsedTriviaPiece::convertToSyntaxTrivia, except that
+/// comment text is copied into \p arena, where it is freed together with the
+/// nodes referencing it, instead of into a separate ref-counted allocation
+/// per piece.
+static Trivia convertToSyntaxTriviaInArena(ArrayRef<ParsedTriviaPiece> pieces,
+                                           SourceLoc loc,
+                                           const SourceManager &SM,
+                                           unsigned bufferID,
+                                           const RC<SyntaxArena> &arena) {
+  Trivia trivia;
+  SourceLoc curLoc = loc;
+  for (const auto &piece : pieces) {
+    CharSourceRange range{curLoc, piece.getLength()};
+    StringRef text = SM.extractText(range, bufferID);
+    if (TriviaPiece::storesText(piece.getKind())) {
+      trivia.push_back(TriviaPiece::fromText(
+          piece.getKind(), OwnedString::makeUnowned(arena->copyString(text))));
+    } else {
+      trivia.push_back(TriviaPiece::fromText(piece.getKind(), text));
+    }
+    curLoc = curLoc.getAdvancedLoc(piece.getLength());
+  }
+  return trivia;
+}
+
 OpaqueSyntaxNode
 SyntaxTreeCreator::recordToken(tok tokenKind,
                                ArrayRef<ParsedTriviaPiece> leadingTriviaPieces,
@@ -124,15 +149,12 @@ SyntaxTreeCreator::recordToken(tok tokenKind,
   CharSourceRange tokRange = CharSourceRange{tokLoc, tokLength};
   SourceLoc leadingTriviaLoc = range.getStart();
   SourceLoc trailingTriviaLoc = tokLoc.getAdvancedLoc(tokLength);
-  Trivia syntaxLeadingTrivia =
-    ParsedTriviaPiece::convertToSyntaxTrivia(leadingTriviaPieces,
-                                             leadingTriviaLoc, SM, BufferID);
-  Trivia syntaxTrailingTrivia =
-    ParsedTriviaPiece::convertToSyntaxTrivia(trailingTriviaPieces,
-                                             trailingTriviaLoc, SM, BufferID);
+  Trivia syntaxLeadingTrivia = convertToSyntaxTriviaInArena(
+      leadingTriviaPieces, leadingTriviaLoc, SM, BufferID, Arena);
+  Trivia syntaxTrailingTrivia = convertToSyntaxTriviaInArena(
+      trailingTriviaPieces, trailingTriviaLoc, SM, BufferID, Arena);
   StringRef tokenText = SM.extractText(tokRange, BufferID);
-  auto ownedText = OwnedString::makeRefCounted(tokenText);
-  auto raw = TokenCache->getToken(Arena, tokenKind, ownedText,
+  auto raw = TokenCache->getToken(Arena, tokenKind, tokenText,
                     syntaxLeadingTrivia.Pieces, syntaxTrailingTrivia.Pieces);
   OpaqueSyntaxNode opaqueN = raw.get();
   raw.resetWithoutRelease();
@@ -141,7 +163,9 @@ SyntaxTreeCreator::recordToken(tok tokenKind,
 
 OpaqueSyntaxNode
 SyntaxTreeCreator::recordMissingToken(tok kind, SourceLoc loc) {
-  auto ownedText = OwnedString::makeRefCounted(getTokenText(kind));
+  // The text of a missing token is a reference to the static token-spelling
+  // table, so there is nothing to copy or own.
+  auto ownedText = OwnedString::makeUnowned(getTokenText(kind));
   auto raw = RawSyntax::missing(kind, ownedText, Arena);
   OpaqueSyntaxNode opaqueN = raw.get();
   raw.resetWithoutRelease();
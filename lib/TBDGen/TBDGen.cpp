@@ -36,6 +36,7 @@
 #include "swift/SIL/SILWitnessTable.h"
 #include "swift/SIL/SILWitnessVisitor.h"
 #include "swift/SIL/TypeLowering.h"
+#include "swift/Serialization/SerializedModuleLoader.h"
 #include "clang/Basic/TargetInfo.h"
 #include "llvm/ADT/StringSet.h"
 #include "llvm/ADT/StringSwitch.h"
@@ -1100,6 +1101,26 @@ void TBDGenVisitor::visitFile(FileUnit *file) {
   }
 }
 
+bool TBDGenVisitor::addSymbolsFromSerializedFile(FileUnit *file) {
+  // The serialized symbol table reflects the options of the compilation that
+  // produced the module; only reuse it for the configuration it captures.
+  if (Opts.LinkerDirectivesOnly || !Opts.PublicSymbolsOnly)
+    return false;
+
+  auto *serialized = dyn_cast<SerializedASTFile>(file);
+  if (!serialized)
+    return false;
+
+  SmallVector<std::pair<uint8_t, StringRef>, 64> symbols;
+  if (!serialized->getExportedTBDSymbols(symbols))
+    return false;
+
+  for (const auto &symbol : symbols)
+    addSymbolInternal(symbol.second, SymbolKind(symbol.first),
+                      SymbolSource::forUnknown());
+  return true;
+}
+
 void TBDGenVisitor::visit(const TBDGenDescriptor &desc) {
   if (auto *singleFile = desc.getSingleFile()) {
     assert(SwiftModule == singleFile->getParentModule() &&
@@ -1132,6 +1153,10 @@ void TBDGenVisitor::visit(const TBDGenDescriptor &desc) {
   // Collect symbols in each module.
   llvm::for_each(Modules, [&](ModuleDecl *M) {
     for (auto *file : M->getFiles()) {
+      // Modules whose swiftmodule carries a symbol table serialized at build
+      // time can contribute their symbols without their AST being visited.
+      if (M != SwiftModule && addSymbolsFromSerializedFile(file))
+        continue;
       visitFile(file);
     }
   });
@@ -1244,6 +1269,19 @@ std::vector<std::string> swift::getPublicSymbols(TBDGenDescriptor desc) {
   auto &evaluator = desc.getParentModule()->getASTContext().evaluator;
   return llvm::cantFail(evaluator(PublicSymbolsRequest{desc}));
 }
+
+std::vector<std::pair<uint8_t, std::string>>
+swift::getTBDSymbolsForSerialization(TBDGenDescriptor desc) {
+  auto &evaluator = desc.getParentModule()->getASTContext().evaluator;
+  auto file = llvm::cantFail(evaluator(GenerateTBDRequest{desc}));
+
+  std::vector<std::pair<uint8_t, std::string>> symbols;
+  for (const auto *symbol : file.symbols())
+    symbols.push_back(
+        {static_cast<uint8_t>(symbol->getKind()), symbol->getName().str()});
+  llvm::sort(symbols);
+  return symbols;
+}
 void swift::writeTBDFile(ModuleDecl *M, llvm::raw_ostream &os,
                          const TBDGenOptions &opts) {
   auto &evaluator = M->getASTContext().evaluator;
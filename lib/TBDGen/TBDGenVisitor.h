@@ -205,6 +205,13 @@ public:
   /// Visit the symbols in a given file unit.
   void visitFile(FileUnit *file);
 
+  /// If \p file carries the TBD symbol table serialized when its module was
+  /// built, add those symbols directly instead of visiting the deserialized
+  /// AST.
+  ///
+  /// \returns true if the serialized symbol table was used.
+  bool addSymbolsFromSerializedFile(FileUnit *file);
+
   /// Visit the files specified by a given TBDGenDescriptor.
   void visit(const TBDGenDescriptor &desc);
 };
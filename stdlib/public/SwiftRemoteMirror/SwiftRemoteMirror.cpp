@@ -23,6 +23,7 @@ unsigned long long swift_reflection_classIsSwiftMask = 2;
 #include "swift/Reflection/ReflectionContext.h"
 #include "swift/Reflection/TypeLowering.h"
 #include "swift/Remote/CMemoryReader.h"
+#include "swift/Remote/CachingMemoryReader.h"
 #include "swift/Basic/Unreachable.h"
 
 #if defined(__APPLE__) && defined(__MACH__)
@@ -43,7 +44,10 @@ struct SwiftReflectionContext {
   std::string lastString;
 
   SwiftReflectionContext(MemoryReaderImpl impl) {
-    auto Reader = std::make_shared<CMemoryReader>(impl);
+    // Walking metadata through the C interface issues many small neighboring
+    // reads; batch them by caching whole pages of the remote process.
+    auto Reader = std::make_shared<CachingMemoryReader>(
+        std::make_shared<CMemoryReader>(impl));
     nativeContext = new NativeReflectionContext(Reader);
   }
   
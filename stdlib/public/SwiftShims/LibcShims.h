@@ -163,6 +163,14 @@ double lgamma_r(double x, int *psigngam);
 long double lgammal_r(long double x, int *psigngam);
 #endif // defined(__APPLE__)
 
+// Parallel execution support
+SWIFT_RUNTIME_STDLIB_INTERNAL
+__swift_size_t _swift_stdlib_hardware_concurrency(void);
+SWIFT_RUNTIME_STDLIB_INTERNAL
+void _swift_stdlib_parallelFor(__swift_size_t chunkCount, void *context,
+                               void (*body)(void *context,
+                                            __swift_size_t chunkIndex));
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
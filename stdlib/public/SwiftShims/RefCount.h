@@ -1316,6 +1316,13 @@ class HeapObjectSideTableEntry {
     : object(newObject), refCounts()
   { }
 
+  // Side table entries are allocated from a free list of fixed-size cells
+  // so that forming the first weak (or overflowed unowned) reference to an
+  // object does not pay for a general-purpose heap allocation.
+  // See RefCount.cpp.
+  void *operator new(size_t size);
+  void operator delete(void *p);
+
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Winvalid-offsetof"
   static ptrdiff_t refCountsOffset() {
@@ -122,6 +122,33 @@ extension _UnsafeBitset {
   }
 }
 
+extension _UnsafeBitset {
+  /// Calls `body` with a temporary cleared bitset of the specified minimum
+  /// capacity. Small bitsets are allocated directly on the stack; the bitset
+  /// is only valid for the duration of the call.
+  @_alwaysEmitIntoClient
+  @inline(__always)
+  internal static func withTemporaryBitset<R>(
+    capacity: Int,
+    run body: (_UnsafeBitset) throws -> R
+  ) rethrows -> R {
+    let wordCount = Swift.max(1, _UnsafeBitset.wordCount(forCapacity: capacity))
+    if wordCount <= 2 {
+      var buffer: (Word, Word) = (.empty, .empty)
+      return try withUnsafeMutablePointer(to: &buffer) { p in
+        // Homogeneous tuples are guaranteed to be laid out like an array.
+        let words = UnsafeMutableRawPointer(p).assumingMemoryBound(
+          to: Word.self)
+        return try body(_UnsafeBitset(words: words, wordCount: wordCount))
+      }
+    }
+    let words = UnsafeMutablePointer<Word>.allocate(capacity: wordCount)
+    defer { words.deallocate() }
+    words.initialize(repeating: .empty, count: wordCount)
+    return try body(_UnsafeBitset(words: words, wordCount: wordCount))
+  }
+}
+
 extension _UnsafeBitset: Sequence {
   @usableFromInline
   internal typealias Element = Int
@@ -166,6 +166,77 @@ extension String {
     return String._fromCodeUnits(
       codeUnits, encoding: encoding, repair: isRepairing)
   }
+  /// Calls `body` with a string that reads the given null-terminated UTF-8
+  /// data in place, without copying it.
+  ///
+  /// Unlike `String(cString:)`, no managed copy of the code units is made:
+  /// the string (and any slice of it) reads directly from `cString`'s memory
+  /// for as long as it exists. In exchange, neither the string nor anything
+  /// derived from it may outlive the call to `body`, and the memory must not
+  /// be mutated while `body` executes. Strings short enough for the
+  /// small-string form are copied into the value instead, which costs nothing
+  /// and carries no lifetime restriction.
+  ///
+  /// Returns `nil` without calling `body` if `cString` does not contain valid
+  /// UTF-8; use `_withUnsafeBorrowedCString` to skip validation when the
+  /// contents are already known to be valid.
+  ///
+  /// - Parameters:
+  ///   - cString: A pointer to a null-terminated UTF-8 code sequence.
+  ///   - body: A closure receiving the borrowed string.
+  public // SPI(Foundation)
+  static func _withBorrowedCString<R>(
+    _ cString: UnsafePointer<CChar>,
+    _ body: (String) throws -> R
+  ) rethrows -> R? {
+    let len = UTF8._nullCodeUnitOffset(in: cString)
+    let codeUnits = UnsafeBufferPointer(start: cString._asUInt8, count: len)
+    guard case .success(let extraInfo) = validateUTF8(codeUnits) else {
+      return nil
+    }
+    return try _withBorrowedUTF8(
+      codeUnits, isASCII: extraInfo.isASCII, body)
+  }
+
+  /// Like `_withBorrowedCString`, but requires the caller to guarantee that
+  /// `cString` contains valid UTF-8.
+  ///
+  /// Only UTF-8 validation is skipped; the contents are still scanned once
+  /// for the length of the sequence and for the ASCII-ness flag the string
+  /// representation requires.
+  public // SPI(Foundation)
+  static func _withUnsafeBorrowedCString<R>(
+    _ cString: UnsafePointer<CChar>,
+    _ body: (String) throws -> R
+  ) rethrows -> R {
+    let len = UTF8._nullCodeUnitOffset(in: cString)
+    let codeUnits = UnsafeBufferPointer(start: cString._asUInt8, count: len)
+    return try _withBorrowedUTF8(
+      codeUnits, isASCII: _allASCII(codeUnits), body)
+  }
+
+  internal static func _withBorrowedUTF8<R>(
+    _ input: UnsafeBufferPointer<UInt8>,
+    isASCII: Bool,
+    _ body: (String) throws -> R
+  ) rethrows -> R {
+    if let smol = _SmallString(input) {
+      return try body(String(_StringGuts(smol)))
+    }
+    // Unlike _uncheckedFromBorrowedUTF8, the storage header is not
+    // immortalized: it is an ordinary reference-counted object that does not
+    // own the code units, so it is freed when the last string referencing it
+    // goes away. The scoped shape of this API is what keeps the underlying
+    // memory alive for that long.
+    let storage = __SharedStringStorage(
+      immortal: input.baseAddress._unsafelyUnwrappedUnchecked,
+      countAndFlags: _StringObject.CountAndFlags(
+        sharedCount: input.count, isASCII: isASCII))
+    return try withExtendedLifetime(storage) {
+      try body($0.asString)
+    }
+  }
+
   /// Creates a string from the null-terminated sequence of bytes at the given
   /// pointer.
   ///
@@ -22,6 +22,22 @@ extension Character {
     ) == self.unicodeScalars.endIndex
   }
 
+  /// The value of a character consisting of a single ASCII scalar, otherwise
+  /// nil.
+  ///
+  /// Unlike `asciiValue`, this does not map CR-LF to LF: multi-scalar
+  /// characters simply report nil. The classification properties below use
+  /// this to answer from range checks instead of consulting the scalar
+  /// property data; ASCII classifications never depend on trailing combining
+  /// scalars, so a nil just means taking the general path.
+  @inlinable @inline(__always)
+  internal var _singleASCIIValue: UInt8? {
+    guard _isSingleScalar else { return nil }
+    let value = _firstScalar.value
+    guard value < 0x80 else { return nil }
+    return UInt8(truncatingIfNeeded: value)
+  }
+
   /// A Boolean value indicating whether this is an ASCII character.
   @inlinable
   public var isASCII: Bool {
@@ -65,6 +81,10 @@ extension Character {
   /// - U+2029 PARAGRAPH SEPARATOR
   /// - U+3000 IDEOGRAPHIC SPACE
   public var isWhitespace: Bool {
+    if let ascii = _singleASCIIValue {
+      // SPACE or CHARACTER TABULATION...CARRIAGE RETURN
+      return ascii == 0x20 || (0x09...0x0D).contains(ascii)
+    }
     return _firstScalar.properties.isWhitespace
   }
 
@@ -101,6 +121,9 @@ extension Character {
   /// - "𝟠" (U+1D7E0 MATHEMATICAL DOUBLE-STRUCK DIGIT EIGHT)
   /// - "๒" (U+0E52 THAI DIGIT TWO)
   public var isNumber: Bool {
+    if let ascii = _singleASCIIValue {
+      return ascii >= UInt8(ascii: "0") && ascii <= UInt8(ascii: "9")
+    }
     return _firstScalar.properties.numericType != nil
   }
 
@@ -135,6 +158,12 @@ extension Character {
   ///     // a --> nil
   public var wholeNumberValue: Int? {
     guard _isSingleScalar else { return nil }
+    let scalarValue = _firstScalar.value
+    if scalarValue < 0x80 {
+      // DIGIT ZERO...DIGIT NINE; no other ASCII scalar is numeric.
+      guard (0x30...0x39).contains(scalarValue) else { return nil }
+      return Int(scalarValue &- 0x30)
+    }
     guard let value = _firstScalar.properties.numericValue else { return nil }
     return Int(exactly: value)
   }
@@ -197,6 +226,10 @@ extension Character {
   /// - "日" (U+65E5 CJK UNIFIED IDEOGRAPH-65E5)
   /// - "ᚨ" (U+16A8 RUNIC LETTER ANSUZ A)
   public var isLetter: Bool {
+    if let ascii = _singleASCIIValue {
+      let lowercased = ascii | 0x20
+      return lowercased >= UInt8(ascii: "a") && lowercased <= UInt8(ascii: "z")
+    }
     return _firstScalar.properties.isAlphabetic
   }
 
@@ -250,6 +283,9 @@ extension Character {
   /// - "Π" (U+03A0 GREEK CAPITAL LETTER PI)
   @inlinable
   public var isUppercase: Bool {
+    if let ascii = _singleASCIIValue {
+      return ascii >= UInt8(ascii: "A") && ascii <= UInt8(ascii: "Z")
+    }
     if _fastPath(_isSingleScalar && _firstScalar.properties.isUppercase) {
       return true
     }
@@ -266,6 +302,9 @@ extension Character {
   /// - "π" (U+03C0 GREEK SMALL LETTER PI)
   @inlinable
   public var isLowercase: Bool {
+    if let ascii = _singleASCIIValue {
+      return ascii >= UInt8(ascii: "a") && ascii <= UInt8(ascii: "z")
+    }
     if _fastPath(_isSingleScalar && _firstScalar.properties.isLowercase) {
       return true
     }
@@ -276,6 +315,10 @@ extension Character {
   /// of case conversion.
   @inlinable
   public var isCased: Bool {
+    if let ascii = _singleASCIIValue {
+      let lowercased = ascii | 0x20
+      return lowercased >= UInt8(ascii: "a") && lowercased <= UInt8(ascii: "z")
+    }
     if _fastPath(_isSingleScalar && _firstScalar.properties.isCased) {
       return true
     }
@@ -295,6 +338,15 @@ extension Character {
   /// - "⌹" (U+2339 APL FUNCTIONAL SYMBOL QUAD DIVIDE)
   /// - "⡆" (U+2846 BRAILLE PATTERN DOTS-237)
   public var isSymbol: Bool {
+    if let ascii = _singleASCIIValue {
+      // DOLLAR SIGN, PLUS SIGN, LESS-THAN...GREATER-THAN SIGN, CIRCUMFLEX
+      // ACCENT, GRAVE ACCENT, VERTICAL LINE and TILDE are the only ASCII
+      // scalars in a symbol general category.
+      return ascii == UInt8(ascii: "$") || ascii == UInt8(ascii: "+")
+        || (ascii >= UInt8(ascii: "<") && ascii <= UInt8(ascii: ">"))
+        || ascii == UInt8(ascii: "^") || ascii == UInt8(ascii: "`")
+        || ascii == UInt8(ascii: "|") || ascii == UInt8(ascii: "~")
+    }
     return _firstScalar.properties.generalCategory._isSymbol
   }
 
@@ -328,6 +380,9 @@ extension Character {
   /// - "¥" (U+00A5 YEN SIGN)
   /// - "€" (U+20AC EURO SIGN)
   public var isCurrencySymbol: Bool {
+    if let ascii = _singleASCIIValue {
+      return ascii == UInt8(ascii: "$")
+    }
     return _firstScalar.properties.generalCategory == .currencySymbol
   }
 
@@ -341,6 +396,23 @@ extension Character {
   /// - "—" (U+2014 EM DASH)
   /// - "“" (U+201C LEFT DOUBLE QUOTATION MARK)
   public var isPunctuation: Bool {
+    if let ascii = _singleASCIIValue {
+      // Every ASCII scalar that is neither a control, a space, alphanumeric,
+      // nor one of the symbols above is in a punctuation general category.
+      switch ascii {
+      case UInt8(ascii: "!")...UInt8(ascii: "#"),
+           UInt8(ascii: "%")...UInt8(ascii: "*"),
+           UInt8(ascii: ",")...UInt8(ascii: "/"),
+           UInt8(ascii: ":"), UInt8(ascii: ";"),
+           UInt8(ascii: "?"), UInt8(ascii: "@"),
+           UInt8(ascii: "[")...UInt8(ascii: "]"),
+           UInt8(ascii: "_"),
+           UInt8(ascii: "{"), UInt8(ascii: "}"):
+        return true
+      default:
+        return false
+      }
+    }
     return _firstScalar.properties.generalCategory._isPunctuation
   }
 }
@@ -5643,6 +5643,7 @@ extension Dictionary: Decodable where Key: Decodable, Value: Decodable {
 // Default implementation of encodeConditional(_:forKey:) in terms of
 // encode(_:forKey:)
 extension KeyedEncodingContainerProtocol {
+  @inlinable
   public mutating func encodeConditional<T: AnyObject & Encodable>(
     _ object: T,
     forKey key: Key
@@ -5654,6 +5655,7 @@ extension KeyedEncodingContainerProtocol {
 // Default implementation of encodeIfPresent(_:forKey:) in terms of
 // encode(_:forKey:)
 extension KeyedEncodingContainerProtocol {
+  @inlinable
   public mutating func encodeIfPresent(
     _ value: Bool?,
     forKey key: Key
@@ -5662,6 +5664,7 @@ extension KeyedEncodingContainerProtocol {
     try encode(value, forKey: key)
   }
 
+  @inlinable
   public mutating func encodeIfPresent(
     _ value: String?,
     forKey key: Key
@@ -5670,6 +5673,7 @@ extension KeyedEncodingContainerProtocol {
     try encode(value, forKey: key)
   }
 
+  @inlinable
   public mutating func encodeIfPresent(
     _ value: Double?,
     forKey key: Key
@@ -5678,6 +5682,7 @@ extension KeyedEncodingContainerProtocol {
     try encode(value, forKey: key)
   }
 
+  @inlinable
   public mutating func encodeIfPresent(
     _ value: Float?,
     forKey key: Key
@@ -5686,6 +5691,7 @@ extension KeyedEncodingContainerProtocol {
     try encode(value, forKey: key)
   }
 
+  @inlinable
   public mutating func encodeIfPresent(
     _ value: Int?,
     forKey key: Key
@@ -5694,6 +5700,7 @@ extension KeyedEncodingContainerProtocol {
     try encode(value, forKey: key)
   }
 
+  @inlinable
   public mutating func encodeIfPresent(
     _ value: Int8?,
     forKey key: Key
@@ -5702,6 +5709,7 @@ extension KeyedEncodingContainerProtocol {
     try encode(value, forKey: key)
   }
 
+  @inlinable
   public mutating func encodeIfPresent(
     _ value: Int16?,
     forKey key: Key
@@ -5710,6 +5718,7 @@ extension KeyedEncodingContainerProtocol {
     try encode(value, forKey: key)
   }
 
+  @inlinable
   public mutating func encodeIfPresent(
     _ value: Int32?,
     forKey key: Key
@@ -5718,6 +5727,7 @@ extension KeyedEncodingContainerProtocol {
     try encode(value, forKey: key)
   }
 
+  @inlinable
   public mutating func encodeIfPresent(
     _ value: Int64?,
     forKey key: Key
@@ -5726,6 +5736,7 @@ extension KeyedEncodingContainerProtocol {
     try encode(value, forKey: key)
   }
 
+  @inlinable
   public mutating func encodeIfPresent(
     _ value: UInt?,
     forKey key: Key
@@ -5734,6 +5745,7 @@ extension KeyedEncodingContainerProtocol {
     try encode(value, forKey: key)
   }
 
+  @inlinable
   public mutating func encodeIfPresent(
     _ value: UInt8?,
     forKey key: Key
@@ -5742,6 +5754,7 @@ extension KeyedEncodingContainerProtocol {
     try encode(value, forKey: key)
   }
 
+  @inlinable
   public mutating func encodeIfPresent(
     _ value: UInt16?,
     forKey key: Key
@@ -5750,6 +5763,7 @@ extension KeyedEncodingContainerProtocol {
     try encode(value, forKey: key)
   }
 
+  @inlinable
   public mutating func encodeIfPresent(
     _ value: UInt32?,
     forKey key: Key
@@ -5758,6 +5772,7 @@ extension KeyedEncodingContainerProtocol {
     try encode(value, forKey: key)
   }
 
+  @inlinable
   public mutating func encodeIfPresent(
     _ value: UInt64?,
     forKey key: Key
@@ -5766,6 +5781,7 @@ extension KeyedEncodingContainerProtocol {
     try encode(value, forKey: key)
   }
 
+  @inlinable
   public mutating func encodeIfPresent<T: Encodable>(
     _ value: T?,
     forKey key: Key
@@ -5778,6 +5794,7 @@ extension KeyedEncodingContainerProtocol {
 // Default implementation of decodeIfPresent(_:forKey:) in terms of
 // decode(_:forKey:) and decodeNil(forKey:)
 extension KeyedDecodingContainerProtocol {
+  @inlinable
   public func decodeIfPresent(
     _ type: Bool.Type,
     forKey key: Key
@@ -5787,6 +5804,7 @@ extension KeyedDecodingContainerProtocol {
     return try self.decode(Bool.self, forKey: key)
   }
 
+  @inlinable
   public func decodeIfPresent(
     _ type: String.Type,
     forKey key: Key
@@ -5796,6 +5814,7 @@ extension KeyedDecodingContainerProtocol {
     return try self.decode(String.self, forKey: key)
   }
 
+  @inlinable
   public func decodeIfPresent(
     _ type: Double.Type,
     forKey key: Key
@@ -5805,6 +5824,7 @@ extension KeyedDecodingContainerProtocol {
     return try self.decode(Double.self, forKey: key)
   }
 
+  @inlinable
   public func decodeIfPresent(
     _ type: Float.Type,
     forKey key: Key
@@ -5814,6 +5834,7 @@ extension KeyedDecodingContainerProtocol {
     return try self.decode(Float.self, forKey: key)
   }
 
+  @inlinable
   public func decodeIfPresent(
     _ type: Int.Type,
     forKey key: Key
@@ -5823,6 +5844,7 @@ extension KeyedDecodingContainerProtocol {
     return try self.decode(Int.self, forKey: key)
   }
 
+  @inlinable
   public func decodeIfPresent(
     _ type: Int8.Type,
     forKey key: Key
@@ -5832,6 +5854,7 @@ extension KeyedDecodingContainerProtocol {
     return try self.decode(Int8.self, forKey: key)
   }
 
+  @inlinable
   public func decodeIfPresent(
     _ type: Int16.Type,
     forKey key: Key
@@ -5841,6 +5864,7 @@ extension KeyedDecodingContainerProtocol {
     return try self.decode(Int16.self, forKey: key)
   }
 
+  @inlinable
   public func decodeIfPresent(
     _ type: Int32.Type,
     forKey key: Key
@@ -5850,6 +5874,7 @@ extension KeyedDecodingContainerProtocol {
     return try self.decode(Int32.self, forKey: key)
   }
 
+  @inlinable
   public func decodeIfPresent(
     _ type: Int64.Type,
     forKey key: Key
@@ -5859,6 +5884,7 @@ extension KeyedDecodingContainerProtocol {
     return try self.decode(Int64.self, forKey: key)
   }
 
+  @inlinable
   public func decodeIfPresent(
     _ type: UInt.Type,
     forKey key: Key
@@ -5868,6 +5894,7 @@ extension KeyedDecodingContainerProtocol {
     return try self.decode(UInt.self, forKey: key)
   }
 
+  @inlinable
   public func decodeIfPresent(
     _ type: UInt8.Type,
     forKey key: Key
@@ -5877,6 +5904,7 @@ extension KeyedDecodingContainerProtocol {
     return try self.decode(UInt8.self, forKey: key)
   }
 
+  @inlinable
   public func decodeIfPresent(
     _ type: UInt16.Type,
     forKey key: Key
@@ -5886,6 +5914,7 @@ extension KeyedDecodingContainerProtocol {
     return try self.decode(UInt16.self, forKey: key)
   }
 
+  @inlinable
   public func decodeIfPresent(
     _ type: UInt32.Type,
     forKey key: Key
@@ -5895,6 +5924,7 @@ extension KeyedDecodingContainerProtocol {
     return try self.decode(UInt32.self, forKey: key)
   }
 
+  @inlinable
   public func decodeIfPresent(
     _ type: UInt64.Type,
     forKey key: Key
@@ -5904,6 +5934,7 @@ extension KeyedDecodingContainerProtocol {
     return try self.decode(UInt64.self, forKey: key)
   }
 
+  @inlinable
   public func decodeIfPresent<T: Decodable>(
     _ type: T.Type,
     forKey key: Key
@@ -5917,12 +5948,14 @@ extension KeyedDecodingContainerProtocol {
 // Default implementation of encodeConditional(_:) in terms of encode(_:),
 // and encode(contentsOf:) in terms of encode(_:) loop.
 extension UnkeyedEncodingContainer {
+  @inlinable
   public mutating func encodeConditional<T: AnyObject & Encodable>(
     _ object: T
   ) throws {
     try self.encode(object)
   }
 
+  @inlinable
   public mutating func encode<T: Sequence>(
     contentsOf sequence: T
   ) throws where T.Element == Bool {
@@ -5931,6 +5964,7 @@ extension UnkeyedEncodingContainer {
     }
   }
 
+  @inlinable
   public mutating func encode<T: Sequence>(
     contentsOf sequence: T
   ) throws where T.Element == String {
@@ -5939,6 +5973,7 @@ extension UnkeyedEncodingContainer {
     }
   }
 
+  @inlinable
   public mutating func encode<T: Sequence>(
     contentsOf sequence: T
   ) throws where T.Element == Double {
@@ -5947,6 +5982,7 @@ extension UnkeyedEncodingContainer {
     }
   }
 
+  @inlinable
   public mutating func encode<T: Sequence>(
     contentsOf sequence: T
   ) throws where T.Element == Float {
@@ -5955,6 +5991,7 @@ extension UnkeyedEncodingContainer {
     }
   }
 
+  @inlinable
   public mutating func encode<T: Sequence>(
     contentsOf sequence: T
   ) throws where T.Element == Int {
@@ -5963,6 +6000,7 @@ extension UnkeyedEncodingContainer {
     }
   }
 
+  @inlinable
   public mutating func encode<T: Sequence>(
     contentsOf sequence: T
   ) throws where T.Element == Int8 {
@@ -5971,6 +6009,7 @@ extension UnkeyedEncodingContainer {
     }
   }
 
+  @inlinable
   public mutating func encode<T: Sequence>(
     contentsOf sequence: T
   ) throws where T.Element == Int16 {
@@ -5979,6 +6018,7 @@ extension UnkeyedEncodingContainer {
     }
   }
 
+  @inlinable
   public mutating func encode<T: Sequence>(
     contentsOf sequence: T
   ) throws where T.Element == Int32 {
@@ -5987,6 +6027,7 @@ extension UnkeyedEncodingContainer {
     }
   }
 
+  @inlinable
   public mutating func encode<T: Sequence>(
     contentsOf sequence: T
   ) throws where T.Element == Int64 {
@@ -5995,6 +6036,7 @@ extension UnkeyedEncodingContainer {
     }
   }
 
+  @inlinable
   public mutating func encode<T: Sequence>(
     contentsOf sequence: T
   ) throws where T.Element == UInt {
@@ -6003,6 +6045,7 @@ extension UnkeyedEncodingContainer {
     }
   }
 
+  @inlinable
   public mutating func encode<T: Sequence>(
     contentsOf sequence: T
   ) throws where T.Element == UInt8 {
@@ -6011,6 +6054,7 @@ extension UnkeyedEncodingContainer {
     }
   }
 
+  @inlinable
   public mutating func encode<T: Sequence>(
     contentsOf sequence: T
   ) throws where T.Element == UInt16 {
@@ -6019,6 +6063,7 @@ extension UnkeyedEncodingContainer {
     }
   }
 
+  @inlinable
   public mutating func encode<T: Sequence>(
     contentsOf sequence: T
   ) throws where T.Element == UInt32 {
@@ -6027,6 +6072,7 @@ extension UnkeyedEncodingContainer {
     }
   }
 
+  @inlinable
   public mutating func encode<T: Sequence>(
     contentsOf sequence: T
   ) throws where T.Element == UInt64 {
@@ -6035,6 +6081,7 @@ extension UnkeyedEncodingContainer {
     }
   }
 
+  @inlinable
   public mutating func encode<T: Sequence>(
     contentsOf sequence: T
   ) throws where T.Element: Encodable {
@@ -6047,6 +6094,7 @@ extension UnkeyedEncodingContainer {
 // Default implementation of decodeIfPresent(_:) in terms of decode(_:) and
 // decodeNil()
 extension UnkeyedDecodingContainer {
+  @inlinable
   public mutating func decodeIfPresent(
     _ type: Bool.Type
   ) throws -> Bool? {
@@ -6054,6 +6102,7 @@ extension UnkeyedDecodingContainer {
     return try self.decode(Bool.self)
   }
 
+  @inlinable
   public mutating func decodeIfPresent(
     _ type: String.Type
   ) throws -> String? {
@@ -6061,6 +6110,7 @@ extension UnkeyedDecodingContainer {
     return try self.decode(String.self)
   }
 
+  @inlinable
   public mutating func decodeIfPresent(
     _ type: Double.Type
   ) throws -> Double? {
@@ -6068,6 +6118,7 @@ extension UnkeyedDecodingContainer {
     return try self.decode(Double.self)
   }
 
+  @inlinable
   public mutating func decodeIfPresent(
     _ type: Float.Type
   ) throws -> Float? {
@@ -6075,6 +6126,7 @@ extension UnkeyedDecodingContainer {
     return try self.decode(Float.self)
   }
 
+  @inlinable
   public mutating func decodeIfPresent(
     _ type: Int.Type
   ) throws -> Int? {
@@ -6082,6 +6134,7 @@ extension UnkeyedDecodingContainer {
     return try self.decode(Int.self)
   }
 
+  @inlinable
   public mutating func decodeIfPresent(
     _ type: Int8.Type
   ) throws -> Int8? {
@@ -6089,6 +6142,7 @@ extension UnkeyedDecodingContainer {
     return try self.decode(Int8.self)
   }
 
+  @inlinable
   public mutating func decodeIfPresent(
     _ type: Int16.Type
   ) throws -> Int16? {
@@ -6096,6 +6150,7 @@ extension UnkeyedDecodingContainer {
     return try self.decode(Int16.self)
   }
 
+  @inlinable
   public mutating func decodeIfPresent(
     _ type: Int32.Type
   ) throws -> Int32? {
@@ -6103,6 +6158,7 @@ extension UnkeyedDecodingContainer {
     return try self.decode(Int32.self)
   }
 
+  @inlinable
   public mutating func decodeIfPresent(
     _ type: Int64.Type
   ) throws -> Int64? {
@@ -6110,6 +6166,7 @@ extension UnkeyedDecodingContainer {
     return try self.decode(Int64.self)
   }
 
+  @inlinable
   public mutating func decodeIfPresent(
     _ type: UInt.Type
   ) throws -> UInt? {
@@ -6117,6 +6174,7 @@ extension UnkeyedDecodingContainer {
     return try self.decode(UInt.self)
   }
 
+  @inlinable
   public mutating func decodeIfPresent(
     _ type: UInt8.Type
   ) throws -> UInt8? {
@@ -6124,6 +6182,7 @@ extension UnkeyedDecodingContainer {
     return try self.decode(UInt8.self)
   }
 
+  @inlinable
   public mutating func decodeIfPresent(
     _ type: UInt16.Type
   ) throws -> UInt16? {
@@ -6131,6 +6190,7 @@ extension UnkeyedDecodingContainer {
     return try self.decode(UInt16.self)
   }
 
+  @inlinable
   public mutating func decodeIfPresent(
     _ type: UInt32.Type
   ) throws -> UInt32? {
@@ -6138,6 +6198,7 @@ extension UnkeyedDecodingContainer {
     return try self.decode(UInt32.self)
   }
 
+  @inlinable
   public mutating func decodeIfPresent(
     _ type: UInt64.Type
   ) throws -> UInt64? {
@@ -6145,6 +6206,7 @@ extension UnkeyedDecodingContainer {
     return try self.decode(UInt64.self)
   }
 
+  @inlinable
   public mutating func decodeIfPresent<T: Decodable>(
     _ type: T.Type
   ) throws -> T? {
@@ -889,6 +889,69 @@ extension ContiguousArray: RangeReplaceableCollection {
     _endMutation()
   }
 
+  /// Reserves capacity for the specified number of additional elements, then
+  /// calls the given closure with a buffer covering the array's uninitialized
+  /// tail memory.
+  ///
+  /// Inside the closure, set the `initializedCount` parameter to the number
+  /// of elements that are initialized by the closure; those elements become
+  /// the new last elements of the array. The memory in the range
+  /// `buffer[0..<initializedCount]` must be initialized at the end of the
+  /// closure's execution, and the memory in the range
+  /// `buffer[initializedCount...]` must be uninitialized. This postcondition
+  /// must hold even if the `initializer` closure throws an error.
+  ///
+  /// - Note: While the array's new capacity may exceed the requested amount,
+  ///   the buffer passed to the closure will cover exactly the requested
+  ///   number of elements.
+  ///
+  /// - Parameters:
+  ///   - unsafeUninitializedCapacity: The number of additional elements to
+  ///     reserve space for.
+  ///   - initializer: A closure that initializes appended elements and sets
+  ///     the count of elements it initialized.
+  ///     - Parameters:
+  ///       - buffer: A buffer covering uninitialized memory with room for the
+  ///         specified number of elements, starting after the array's last
+  ///         existing element.
+  ///       - initializedCount: The count of elements initialized by the
+  ///         closure, which begins as zero. Set `initializedCount` to the
+  ///         number of elements you initialize.
+  @_alwaysEmitIntoClient
+  public mutating func append(
+    unsafeUninitializedCapacity: Int,
+    initializingWith initializer: (
+      _ buffer: inout UnsafeMutableBufferPointer<Element>,
+      _ initializedCount: inout Int) throws -> Void
+  ) rethrows {
+    _reserveCapacityImpl(
+      minimumCapacity: self.count + unsafeUninitializedCapacity,
+      growForAppend: true)
+
+    let oldCount = _buffer.mutableCount
+    let startNewElements = _buffer.mutableFirstElementAddress + oldCount
+    var buffer = UnsafeMutableBufferPointer(
+      start: startNewElements, count: unsafeUninitializedCapacity)
+    var initializedCount = 0
+    defer {
+      // Update self.count even if initializer throws an error.
+      _precondition(
+        initializedCount <= unsafeUninitializedCapacity,
+        "Initialized count set to greater than specified capacity."
+      )
+      _precondition(
+        buffer.baseAddress == startNewElements,
+        "Can't reassign buffer in ContiguousArray.append(unsafeUninitializedCapacity:initializingWith:)"
+      )
+      // This check prevents a data race writing to _swiftEmptyArrayStorage
+      if initializedCount > 0 {
+        _buffer.mutableCount = oldCount + initializedCount
+      }
+      _endMutation()
+    }
+    try initializer(&buffer, &initializedCount)
+  }
+
   @inlinable
   @_semantics("array.mutate_unknown")
   public mutating func _customRemoveLast() -> Element? {
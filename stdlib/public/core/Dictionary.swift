@@ -492,6 +492,27 @@ public struct Dictionary<Key: Hashable, Value> {
     self.init(_native: native)
   }
 
+  /// Creates a new dictionary from the key-value pairs in the given
+  /// collection.
+  ///
+  /// This behaves like the corresponding initializer for sequences, but the
+  /// exact element count of a collection is known up front, so the dictionary
+  /// is sized exactly once and the elements are inserted in bulk, without
+  /// per-element capacity checks.
+  ///
+  /// - Parameter keysAndValues: A collection of key-value pairs to use for
+  ///   the new dictionary. Every key in `keysAndValues` must be unique.
+  /// - Returns: A new dictionary initialized with the elements of
+  ///   `keysAndValues`.
+  /// - Precondition: The collection must not have duplicate keys.
+  @_alwaysEmitIntoClient
+  public init<C: Collection>(
+    uniqueKeysWithValues keysAndValues: __owned C
+  ) where C.Element == (Key, Value) {
+    self.init(
+      _native: _NativeDictionary(uniqueKeysWithValues: keysAndValues))
+  }
+
   /// Creates a new dictionary from the key-value pairs in the given sequence,
   /// using a combining closure to determine the value for any duplicate keys.
   ///
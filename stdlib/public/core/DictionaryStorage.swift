@@ -218,13 +218,17 @@ extension __RawDictionaryStorage {
   internal final func find<Key: Hashable>(_ key: Key, hashValue: Int) -> (bucket: _HashTable.Bucket, found: Bool) {
       let hashTable = _hashTable
       var bucket = hashTable.idealBucket(forHashValue: hashValue)
-      while hashTable._isOccupied(bucket) {
+      // Find the end of the collision chain up front by scanning the
+      // occupancy bitmap a word at a time; the probe loop below then only
+      // needs to compare keys, not test occupancy on every step.
+      let hole = hashTable.nextHole(atOrAfter: bucket)
+      while bucket != hole {
         if uncheckedKey(at: bucket) == key {
           return (bucket, true)
         }
         bucket = hashTable.bucket(wrappedAfter: bucket)
       }
-      return (bucket, false)
+      return (hole, false)
   }
 }
 
@@ -99,6 +99,31 @@ extension LazyFilterSequence: Sequence {
     guard _predicate(element) else { return false }
     return _base._customContainsEquatableElement(element)
   }
+
+  /// Materializes the surviving elements without any intermediate copy.
+  ///
+  /// When the base sequence has contiguous storage -- arrays and array
+  /// slices in particular -- the predicate is evaluated in a single pass
+  /// over the base's memory, instead of round-tripping every element through
+  /// an indexing iterator.
+  @inlinable // lazy-performance
+  public __consuming func _copyToContiguousArray() -> ContiguousArray<Element> {
+    if let result = _base.withContiguousStorageIfAvailable({
+      (base: UnsafeBufferPointer<Element>) -> ContiguousArray<Element> in
+      var result = ContiguousArray<Element>()
+      let b = base.baseAddress._unsafelyUnwrappedUnchecked
+      for i in 0..<base.count {
+        let element = b[i]
+        if _predicate(element) {
+          result.append(element)
+        }
+      }
+      return result
+    }) {
+      return result
+    }
+    return _copySequenceToContiguousArray(self)
+  }
 }
 
 extension LazyFilterSequence: LazySequenceProtocol { }
@@ -1561,6 +1561,55 @@ extension BinaryInteger {
   public var description: String {
     return _description(radix: 10, uppercase: false)
   }
+
+  /// Writes the ASCII representation of this value into the given buffer and
+  /// returns the number of bytes written.
+  ///
+  /// This is the buffer-filling core of `description`, for inner loops that
+  /// format many numbers into a caller-reused scratch buffer without creating
+  /// a `String` per value. For values whose `bitWidth` is at most 64 the
+  /// digits are produced directly in `buffer` without allocating; wider
+  /// types fall back to the allocating generic path and copy the digits out.
+  ///
+  /// - Parameters:
+  ///   - radix: The base to use for the representation; must be in the range
+  ///     `2...36`.
+  ///   - uppercase: Whether digits above 9 are written as uppercase letters.
+  ///   - buffer: The buffer to write into. Must hold at least 32 bytes, or
+  ///     72 bytes when `radix` is less than 10.
+  public // SPI(Foundation)
+  func _formatted(
+    radix: Int = 10,
+    uppercase: Bool = false,
+    into buffer: UnsafeMutableBufferPointer<UInt8>
+  ) -> Int {
+    _precondition(2...36 ~= radix, "Radix must be between 2 and 36")
+    _precondition(
+      buffer.count >= (radix >= 10 ? 32 : 72),
+      "Insufficient space for formatting")
+    let bufferPtr = buffer.baseAddress._unsafelyUnwrappedUnchecked
+
+    if bitWidth <= 64 {
+      let radix_ = Int64(radix)
+      let length = Self.isSigned
+        ? _int64ToStringImpl(
+            bufferPtr, UInt(buffer.count),
+            Int64(truncatingIfNeeded: self), radix_, uppercase)
+        : _uint64ToStringImpl(
+            bufferPtr, UInt(buffer.count),
+            UInt64(truncatingIfNeeded: self), radix_, uppercase)
+      return Int(truncatingIfNeeded: length)
+    }
+
+    var result = _description(radix: radix, uppercase: uppercase)
+    return result.withUTF8 { utf8 in
+      _precondition(
+        utf8.count <= buffer.count, "Insufficient space for formatting")
+      bufferPtr.initialize(
+        from: utf8.baseAddress._unsafelyUnwrappedUnchecked, count: utf8.count)
+      return utf8.count
+    }
+  }
 }
 
 
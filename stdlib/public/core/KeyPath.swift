@@ -124,7 +124,10 @@ public class AnyKeyPath: Hashable, _AppendKeyPath {
   public var _kvcKeyPathString: String? {
     @_semantics("keypath.kvcKeyPathString")
     get {
-      guard let ptr = _kvcKeyPathStringPtr else { return nil }
+      // The pointer storage may hold a cached pure-struct offset instead of
+      // a string.
+      guard _getOffsetFromStorage() == nil,
+            let ptr = _kvcKeyPathStringPtr else { return nil }
 
       return String(validatingUTF8: ptr)
     }
@@ -190,6 +193,44 @@ public class AnyKeyPath: Hashable, _AppendKeyPath {
       }
     }
   }
+
+  // MARK: Cached pure-struct offset
+
+  // A key path that traverses only stored struct properties reduces to a
+  // constant byte offset from the root, so projecting it is a single load
+  // instead of an interpretive walk over the component buffer. We cache that
+  // offset in the storage of `_kvcKeyPathStringPtr`: KVC strings only exist
+  // for Objective-C properties, so the two uses of the field are mutually
+  // exclusive. Cached offsets are stored as tagged non-pointer bit patterns
+  // to keep them distinguishable from real C string pointers: on 64-bit
+  // targets an offset n is stored as the bit pattern -(n + 1), which is never
+  // a valid user-space pointer; 32-bit targets have no such guarantee, so
+  // there we only cache offsets that fit below the unmapped 4 KiB null page,
+  // stored as n + 1.
+
+  internal static var _maxOffsetFor32BitOffsetCache: Int { return 4094 }
+
+  final internal func _assignOffsetToStorage(offset: Int) {
+    _internalInvariant(offset >= 0, "component offsets are never negative")
+    if MemoryLayout<Int>.size == 8 {
+      _kvcKeyPathStringPtr = UnsafePointer(bitPattern: -(offset + 1))
+    } else if offset <= AnyKeyPath._maxOffsetFor32BitOffsetCache {
+      _kvcKeyPathStringPtr = UnsafePointer(bitPattern: offset + 1)
+    }
+  }
+
+  final internal func _getOffsetFromStorage() -> Int? {
+    let value = Int(bitPattern: _kvcKeyPathStringPtr)
+    if MemoryLayout<Int>.size == 8 {
+      guard value < 0 else { return nil }
+      return -value - 1
+    }
+    guard value > 0,
+          value <= AnyKeyPath._maxOffsetFor32BitOffsetCache + 1 else {
+      return nil
+    }
+    return value - 1
+  }
 }
 
 /// A partially type-erased key path, from a concrete root type to any
@@ -238,6 +279,14 @@ public class KeyPath<Root, Value>: PartialKeyPath<Root> {
   
   @usableFromInline
   internal final func _projectReadOnly(from root: Root) -> Value {
+    // A pure stored-struct key path is a single load at a cached constant
+    // offset; skip the component interpreter entirely.
+    if let offset = _getOffsetFromStorage() {
+      return withUnsafeBytes(of: root) {
+        return $0.load(fromByteOffset: offset, as: Value.self)
+      }
+    }
+
     // TODO: For perf, we could use a local growable buffer instead of Any
     var curBase: Any = root
     return withBuffer {
@@ -2244,7 +2293,9 @@ internal func _appendingKeyPaths<
       // KVC-compatible.
       let appendedKVCLength: Int, rootKVCLength: Int, leafKVCLength: Int
 
-      if let rootPtr = root._kvcKeyPathStringPtr,
+      if root._getOffsetFromStorage() == nil,
+         leaf._getOffsetFromStorage() == nil,
+         let rootPtr = root._kvcKeyPathStringPtr,
          let leafPtr = leaf._kvcKeyPathStringPtr {
         rootKVCLength = Int(_swift_stdlib_strlen(rootPtr))
         leafKVCLength = Int(_swift_stdlib_strlen(leafPtr))
@@ -2380,6 +2431,10 @@ internal func _appendingKeyPaths<
           UnsafePointer(kvcStringBuffer.assumingMemoryBound(to: CChar.self))
         kvcStringBuffer.advanced(by: rootKVCLength + leafKVCLength + 1)
           .storeBytes(of: 0 /* '\0' */, as: CChar.self)
+      } else if let offset = result._storedInlineOffset {
+        // Appending two pure stored-struct key paths yields another one;
+        // cache the combined offset so projection stays a single load.
+        result._assignOffsetToStorage(offset: offset)
       }
       return unsafeDowncast(result, to: Result.self)
     }
@@ -2485,6 +2540,14 @@ public func _swift_getKeyPath(pattern: UnsafeMutableRawPointer,
       kvcStringPtr.assumingMemoryBound(to: CChar.self)
   }
 
+  // If the key path traverses only stored struct properties, it projects as
+  // a load at a constant offset from the root. Resolve that offset once per
+  // instantiation so projection can skip the component interpreter.
+  if instance._kvcKeyPathStringPtr == nil,
+     let offset = instance._storedInlineOffset {
+    instance._assignOffsetToStorage(offset: offset)
+  }
+
   // If we can cache this instance as a shared instance, do so.
   if let oncePtr = oncePtr {
     // Try to replace a null pointer in the cache variable with the instance
@@ -90,6 +90,33 @@ extension LazyMapSequence: LazySequenceProtocol {
   public var underestimatedCount: Int {
     return _base.underestimatedCount
   }
+
+  /// Materializes the mapped elements without any intermediate copy.
+  ///
+  /// When the base sequence has contiguous storage -- arrays and array
+  /// slices in particular -- the transform is applied in a single pass over
+  /// the base's memory, writing the results directly into result storage of
+  /// exactly the right size, instead of round-tripping every element through
+  /// an indexing iterator and an appending builder.
+  @inlinable
+  public __consuming func _copyToContiguousArray() -> ContiguousArray<Element> {
+    if let result = _base.withContiguousStorageIfAvailable({
+      (base: UnsafeBufferPointer<Base.Element>) -> ContiguousArray<Element> in
+      let count = base.count
+      if count == 0 { return ContiguousArray() }
+      var result = _ContiguousArrayBuffer<Element>(
+        _uninitializedCount: count, minimumCapacity: 0)
+      let p = result.firstElementAddress
+      let b = base.baseAddress._unsafelyUnwrappedUnchecked
+      for i in 0..<count {
+        (p + i).initialize(to: _transform(b[i]))
+      }
+      return ContiguousArray(_buffer: result)
+    }) {
+      return result
+    }
+    return _copySequenceToContiguousArray(self)
+  }
 }
 
 /// A `Collection` whose elements consist of those in a `Base`
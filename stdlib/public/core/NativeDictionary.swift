@@ -748,6 +748,33 @@ extension _NativeDictionary { // High-level operations
     }
   }
 
+  /// Fill a new dictionary with the elements of `keysAndValues`.
+  ///
+  /// This is a bulk-loading fast path for collections, whose exact count is
+  /// known up front: the storage is sized exactly once, and because a freshly
+  /// allocated dictionary is always uniquely held with adequate capacity, each
+  /// element can be inserted directly, without the per-element uniqueness and
+  /// capacity checks (and the potential mid-loop resizes) of the general
+  /// `merge` path above.
+  ///
+  /// Traps if `keysAndValues` contains duplicate keys.
+  @_alwaysEmitIntoClient
+  internal init<C: Collection>(
+    uniqueKeysWithValues keysAndValues: __owned C
+  ) where C.Element == (Key, Value) {
+    self.init(capacity: keysAndValues.count)
+    for (key, value) in keysAndValues {
+      let hashValue = self.hashValue(for: key)
+      let (bucket, found) = find(key, hashValue: hashValue)
+      if found {
+        fatalError("Duplicate values for key: '\(key)'")
+      }
+      hashTable.insert(bucket)
+      uncheckedInitialize(at: bucket, toKey: key, value: value)
+      _storage._count &+= 1
+    }
+  }
+
   @inlinable
   @inline(__always)
   internal init<S: Sequence>(
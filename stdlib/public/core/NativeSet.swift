@@ -159,13 +159,17 @@ extension _NativeSet { // Low-level lookup operations
   ) -> (bucket: Bucket, found: Bool) {
     let hashTable = self.hashTable
     var bucket = hashTable.idealBucket(forHashValue: hashValue)
-    while hashTable._isOccupied(bucket) {
+    // Find the end of the collision chain up front by scanning the occupancy
+    // bitmap a word at a time; the probe loop below then only needs to
+    // compare elements, not test occupancy on every step.
+    let hole = hashTable.nextHole(atOrAfter: bucket)
+    while bucket != hole {
       if uncheckedElement(at: bucket) == element {
         return (bucket, true)
       }
       bucket = hashTable.bucket(wrappedAfter: bucket)
     }
-    return (bucket, false)
+    return (hole, false)
   }
 }
 
@@ -487,6 +491,77 @@ extension _NativeSet {
 #endif
 }
 
+extension _NativeSet { // Bulk set algebra
+  /// Returns the elements at the bucket offsets recorded in `bitset`, copied
+  /// in a single pass into storage of exactly the requested capacity.
+  /// `count` must be the number of bits set in `bitset`.
+  @_alwaysEmitIntoClient
+  internal __consuming func extractSubset(
+    using bitset: _UnsafeBitset,
+    count: Int
+  ) -> _NativeSet {
+    var count = count
+    if count == 0 { return _NativeSet() }
+    if count == self.count { return self }
+    let result = _NativeSet(capacity: count)
+    for offset in bitset {
+      result._unsafeInsertNew(uncheckedElement(at: Bucket(offset: offset)))
+      // The bitset iterator keeps going to the end of the last word; stop as
+      // soon as all marked elements have been copied.
+      count &-= 1
+      if count == 0 { break }
+    }
+    return result
+  }
+
+  @_alwaysEmitIntoClient
+  internal __consuming func intersection(_ other: _NativeSet) -> _NativeSet {
+    // Prefer to iterate over the smaller set: the membership test costs the
+    // same either way, and this bounds the number of candidate buckets.
+    guard count <= other.count else {
+      return other.intersection(self)
+    }
+    // Rather than inserting matching elements into a fresh set one by one --
+    // re-hashing each one and repeatedly growing the result -- mark the
+    // buckets of the matches in a temporary bitset, then copy them out in a
+    // single pass with the exact count known up front.
+    return _UnsafeBitset.withTemporaryBitset(
+      capacity: hashTable.bucketCount
+    ) { bitset in
+      var count = 0
+      for bucket in hashTable {
+        if other.contains(uncheckedElement(at: bucket)) {
+          bitset.uncheckedInsert(bucket.offset)
+          count &+= 1
+        }
+      }
+      return extractSubset(using: bitset, count: count)
+    }
+  }
+
+  /// Generic intersection with an arbitrary finite sequence, marking the
+  /// buckets of this set that hold an element of `other`. Duplicates in
+  /// `other` are harmless: a bucket is only counted the first time its bit
+  /// is set.
+  @_alwaysEmitIntoClient
+  internal __consuming func genericIntersection<S: Sequence>(
+    _ other: S
+  ) -> _NativeSet where S.Element == Element {
+    return _UnsafeBitset.withTemporaryBitset(
+      capacity: hashTable.bucketCount
+    ) { bitset in
+      var count = 0
+      for element in other {
+        let (bucket, found) = find(element)
+        if found, bitset.uncheckedInsert(bucket.offset) {
+          count &+= 1
+        }
+      }
+      return extractSubset(using: bitset, count: count)
+    }
+  }
+}
+
 extension _NativeSet: _HashTableDelegate {
   @inlinable
   @inline(__always)
@@ -0,0 +1,173 @@
+//===--- ParallelAlgorithms.swift -----------------------------*- swift -*-===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2020 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+//
+// Data-parallel variants of map, filter, and reduce for random-access
+// collections. The collection is split into contiguous chunks; worker
+// threads claim chunks from a shared counter, so uneven per-element costs
+// balance across threads without pre-partitioning.
+//
+//===----------------------------------------------------------------------===//
+
+import SwiftShims
+
+/// Invokes `body` once per chunk index in `0..<chunkCount`, distributing the
+/// calls across threads. Returns after every call has completed.
+internal func _parallelFor(chunkCount: Int, _ body: (Int) -> Void) {
+  if chunkCount <= 0 { return }
+  withoutActuallyEscaping(body) { body in
+    var context = body
+    withUnsafeMutablePointer(to: &context) { contextPtr in
+      _swift_stdlib_parallelFor(
+        __swift_size_t(chunkCount),
+        UnsafeMutableRawPointer(contextPtr)
+      ) { rawContext, chunkIndex in
+        rawContext.assumingMemoryBound(to: ((Int) -> Void).self)
+          .pointee(Int(chunkIndex))
+      }
+    }
+  }
+}
+
+/// Returns the number of chunks to split `count` elements into: enough to
+/// keep every core busy and absorb imbalance, but never more chunks than
+/// elements.
+internal func _parallelChunkCount(for count: Int) -> Int {
+  let cores = Int(_swift_stdlib_hardware_concurrency())
+  return Swift.min(count, cores * 4)
+}
+
+extension RandomAccessCollection {
+  /// Returns an array containing the results of mapping the given closure
+  /// over the collection's elements, computing the transformations in
+  /// parallel.
+  ///
+  /// The result is identical to `map(_:)`; only the order of evaluation
+  /// differs. Because `transform` may be called concurrently from multiple
+  /// threads, it must not access shared mutable state without its own
+  /// synchronization.
+  ///
+  /// - Parameter transform: A mapping closure, safe to call concurrently.
+  /// - Returns: An array of the transformed elements.
+  public func parallelMap<T>(_ transform: (Element) -> T) -> [T] {
+    let n = self.count
+    if n == 0 { return [] }
+    let chunks = _parallelChunkCount(for: n)
+    let chunkSize = (n + chunks - 1) / chunks
+    return Array(unsafeUninitializedCapacity: n) { buffer, initializedCount in
+      let base = buffer.baseAddress._unsafelyUnwrappedUnchecked
+      _parallelFor(chunkCount: chunks) { chunk in
+        let lower = chunk * chunkSize
+        let upper = Swift.min(lower + chunkSize, n)
+        var index = self.index(self.startIndex, offsetBy: lower)
+        for i in lower..<upper {
+          (base + i).initialize(to: transform(self[index]))
+          self.formIndex(after: &index)
+        }
+      }
+      initializedCount = n
+    }
+  }
+
+  /// Returns an array containing the elements of the collection that satisfy
+  /// the given predicate, evaluating the predicate in parallel.
+  ///
+  /// The result preserves the collection's order, matching `filter(_:)`.
+  /// Because `isIncluded` may be called concurrently from multiple threads,
+  /// it must not access shared mutable state without its own
+  /// synchronization.
+  ///
+  /// - Parameter isIncluded: A predicate closure, safe to call concurrently.
+  /// - Returns: An array of the elements that `isIncluded` allowed.
+  public func parallelFilter(_ isIncluded: (Element) -> Bool) -> [Element] {
+    let n = self.count
+    if n == 0 { return [] }
+    let chunks = _parallelChunkCount(for: n)
+    let chunkSize = (n + chunks - 1) / chunks
+    // Each chunk filters into its own local array; the per-chunk results
+    // are then concatenated in order. The [[Element]] slots are disjoint,
+    // so the chunk bodies never contend.
+    var partial = [[Element]](repeating: [], count: chunks)
+    partial.withUnsafeMutableBufferPointer { partialBuffer in
+      let partialBase = partialBuffer.baseAddress._unsafelyUnwrappedUnchecked
+      _parallelFor(chunkCount: chunks) { chunk in
+        let lower = chunk * chunkSize
+        let upper = Swift.min(lower + chunkSize, n)
+        var local: [Element] = []
+        var index = self.index(self.startIndex, offsetBy: lower)
+        for _ in lower..<upper {
+          let element = self[index]
+          if isIncluded(element) { local.append(element) }
+          self.formIndex(after: &index)
+        }
+        (partialBase + chunk).pointee = local
+      }
+    }
+    var result: [Element] = []
+    result.reserveCapacity(partial.reduce(0) { $0 + $1.count })
+    for chunkResult in partial {
+      result.append(contentsOf: chunkResult)
+    }
+    return result
+  }
+
+  /// Returns the result of combining the collection's elements, folding the
+  /// chunks of the collection in parallel.
+  ///
+  /// Each chunk is folded sequentially with `nextPartialResult` starting
+  /// from `initialResult`, and the per-chunk results are then merged in
+  /// order with `combine`. For the result to match a sequential
+  /// `reduce(_:_:)`, `initialResult` must be an identity for the operation
+  /// and `combine` must be associative — as with `0` and `+` for a sum.
+  /// Both closures may be called concurrently from multiple threads, so
+  /// they must not access shared mutable state without their own
+  /// synchronization.
+  ///
+  /// - Parameters:
+  ///   - initialResult: The identity value each chunk's fold starts from.
+  ///   - nextPartialResult: A closure folding an element into a partial
+  ///     result, safe to call concurrently.
+  ///   - combine: An associative closure merging two partial results.
+  /// - Returns: The combined result, or `initialResult` if the collection
+  ///   is empty.
+  public func parallelReduce<T>(
+    _ initialResult: T,
+    _ nextPartialResult: (T, Element) -> T,
+    _ combine: (T, T) -> T
+  ) -> T {
+    let n = self.count
+    if n == 0 { return initialResult }
+    let chunks = _parallelChunkCount(for: n)
+    let chunkSize = (n + chunks - 1) / chunks
+    let partial = Array<T>(
+      unsafeUninitializedCapacity: chunks
+    ) { buffer, initializedCount in
+      let base = buffer.baseAddress._unsafelyUnwrappedUnchecked
+      _parallelFor(chunkCount: chunks) { chunk in
+        let lower = chunk * chunkSize
+        let upper = Swift.min(lower + chunkSize, n)
+        var accumulator = initialResult
+        var index = self.index(self.startIndex, offsetBy: lower)
+        for _ in lower..<upper {
+          accumulator = nextPartialResult(accumulator, self[index])
+          self.formIndex(after: &index)
+        }
+        (base + chunk).initialize(to: accumulator)
+      }
+      initializedCount = chunks
+    }
+    var result = partial[0]
+    for chunkResult in partial.dropFirst() {
+      result = combine(result, chunkResult)
+    }
+    return result
+  }
+}
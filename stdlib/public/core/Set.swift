@@ -946,8 +946,13 @@ extension Set: SetAlgebra {
   @inlinable
   public __consuming func intersection<S: Sequence>(_ other: S) -> Set<Element>
   where S.Element == Element {
-    let otherSet = Set(other)
-    return intersection(otherSet)
+#if _runtime(_ObjC)
+    guard _variant.isNative else {
+      let otherSet = Set(other)
+      return intersection(otherSet)
+    }
+#endif
+    return Set(_native: _variant.asNative.genericIntersection(other))
   }
 
   /// Removes the elements of the set that aren't also in the given sequence.
@@ -1222,13 +1227,18 @@ extension Set {
   /// - Returns: A new set.
   @inlinable
   public __consuming func intersection(_ other: Set<Element>) -> Set<Element> {
-    var newSet = Set<Element>()
-    for member in self {
-      if other.contains(member) {
-        newSet.insert(member)
+#if _runtime(_ObjC)
+    guard _variant.isNative && other._variant.isNative else {
+      var newSet = Set<Element>()
+      for member in self {
+        if other.contains(member) {
+          newSet.insert(member)
+        }
       }
+      return newSet
     }
-    return newSet
+#endif
+    return Set(_native: _variant.asNative.intersection(other._variant.asNative))
   }
 
   /// Removes the elements of the set that are also in the given sequence and
@@ -44,8 +44,13 @@ extension Sequence where Element: Comparable {
   ///
   /// - Complexity: O(*n* log *n*), where *n* is the length of the sequence.
   @inlinable
+  @_specialize(where Self == Array<Int>)
+  @_specialize(where Self == Array<Double>)
+  @_specialize(where Self == Array<String>)
   public func sorted() -> [Element] {
-    return sorted(by: <)
+    var result = ContiguousArray(self)
+    result.sort()
+    return Array(result)
   }
 }
 
@@ -136,6 +141,42 @@ extension Sequence {
     try result.sort(by: areInIncreasingOrder)
     return Array(result)
   }
+
+  /// Returns the elements of the sequence, sorted into ascending order of
+  /// the keys that the given closure produces.
+  ///
+  /// Use this method instead of `sorted(by:)` when the ordering is defined
+  /// by a derived key that is expensive to compute. A comparator passed to
+  /// `sorted(by:)` is invoked -- and therefore recomputes its keys --
+  /// O(*n* log *n*) times, while this method computes each element's key
+  /// exactly once, sorts the keys alongside the elements, and then discards
+  /// them:
+  ///
+  ///     let sortedPaths = paths.sorted(byKey: { $0.lowercased() })
+  ///
+  /// Elements with equal keys may not remain in their original relative
+  /// order, matching `sorted(by:)`.
+  ///
+  /// - Parameter key: A closure that maps an element to its sort key.
+  /// - Returns: A sorted array of the sequence's elements.
+  ///
+  /// - Complexity: O(*n* log *n*) key comparisons and exactly *n* calls to
+  ///   `key`, where *n* is the length of the sequence.
+  @inlinable
+  public func sorted<Key: Comparable>(
+    byKey key: (Element) throws -> Key
+  ) rethrows -> [Element] {
+    // Decorate each element with its key, computing every key exactly once.
+    var decorated = ContiguousArray<(key: Key, element: Element)>()
+    decorated.reserveCapacity(underestimatedCount)
+    for element in self {
+      decorated.append((key: try key(element), element: element))
+    }
+    // The keys were chosen to be cheap to compare; sorting the decorated
+    // pairs touches only them.
+    decorated.sort { $0.key < $1.key }
+    return decorated.map { $0.element }
+  }
 }
 
 extension MutableCollection
@@ -167,7 +208,17 @@ where Self: RandomAccessCollection, Element: Comparable {
   ///
   /// - Complexity: O(*n* log *n*), where *n* is the length of the collection.
   @inlinable
+  @_specialize(where Self == Array<Int>)
+  @_specialize(where Self == Array<Double>)
+  @_specialize(where Self == Array<String>)
   public mutating func sort() {
+    // When the elements are fixed-width integers and the ordering is the
+    // default ascending one, a radix sort avoids the per-comparison closure
+    // overhead of the general algorithm on large inputs.
+    let didRadixSort: Bool? = _withUnsafeMutableBufferPointerIfSupported {
+      buffer in buffer._sortIntegersAscendingIfApplicable()
+    }
+    if didRadixSort == true { return }
     sort(by: <)
   }
 }
@@ -699,3 +750,147 @@ extension UnsafeMutableBufferPointer {
     precondition(result)
   }
 }
+
+//===----------------------------------------------------------------------===//
+// Radix sort for fixed-width integers
+//===----------------------------------------------------------------------===//
+
+/// The minimum number of elements for which a radix sort is expected to beat
+/// the general merge sort. Below this, the fixed cost of the byte-counting
+/// passes outweighs the comparisons they replace.
+@inlinable
+internal var _radixSortMinimumCount: Int {
+  @inline(__always) get { return 512 }
+}
+
+extension UnsafeMutableBufferPointer where Element: FixedWidthInteger {
+  /// Sorts the buffer into ascending order using a least-significant-digit
+  /// radix sort with one byte per digit, using `scratch` as out-of-place
+  /// storage.
+  ///
+  /// - Precondition: `count > 0`, and `scratch` must point to a region of
+  ///   memory at least as large as `count` elements.
+  @inlinable
+  internal func _radixSortAscending(scratch: UnsafeMutablePointer<Element>) {
+    _internalInvariant(_isPOD(Element.self))
+    _internalInvariant(count > 0)
+    let count = self.count
+
+    // Flipping the sign bit of a signed integer's bit pattern yields an
+    // unsigned value that orders the same way the signed value does, so
+    // signed and unsigned elements can share the digit extraction below.
+    let signFlip: Element.Magnitude = Element.isSigned
+      ? (1 as Element.Magnitude) &<< (Element.bitWidth - 1)
+      : 0
+
+    @inline(__always)
+    func digit(of element: Element, at shift: Int) -> Int {
+      let key = Element.Magnitude(truncatingIfNeeded: element) ^ signFlip
+      return Int(truncatingIfNeeded: (key &>> shift) & 0xFF)
+    }
+
+    var source = baseAddress._unsafelyUnwrappedUnchecked
+    var destination = scratch
+    var counts = [Int](repeating: 0, count: 256)
+
+    var shift = 0
+    while shift < Element.bitWidth {
+      // Count the byte values in this digit position.
+      for i in 0..<counts.count {
+        counts[i] = 0
+      }
+      for i in 0..<count {
+        counts[digit(of: source[i], at: shift)] &+= 1
+      }
+
+      // If every element has the same byte in this position, the pass would
+      // be the identity permutation; skip it.
+      if counts[digit(of: source[0], at: shift)] == count {
+        shift &+= 8
+        continue
+      }
+
+      // Convert the counts into bucket start offsets.
+      var offset = 0
+      for i in 0..<counts.count {
+        let bucketCount = counts[i]
+        counts[i] = offset
+        offset &+= bucketCount
+      }
+
+      // Scatter the elements into their buckets. Plain stores are fine even
+      // though the destination may be uninitialized, because the elements
+      // are POD.
+      for i in 0..<count {
+        let element = source[i]
+        let bucket = digit(of: element, at: shift)
+        destination[counts[bucket]] = element
+        counts[bucket] &+= 1
+      }
+
+      swap(&source, &destination)
+      shift &+= 8
+    }
+
+    // An odd number of performed passes leaves the sorted elements in the
+    // scratch buffer; copy them back.
+    if source != baseAddress._unsafelyUnwrappedUnchecked {
+      baseAddress._unsafelyUnwrappedUnchecked.assign(from: source, count: count)
+    }
+  }
+}
+
+extension UnsafeMutableBufferPointer {
+  /// Sorts the buffer into ascending order with a radix sort, if `Element`
+  /// is one of the standard fixed-width integer types and the buffer is
+  /// large enough for the radix passes to pay for themselves.
+  ///
+  /// - Returns: `true` if the buffer was sorted.
+  @inlinable
+  internal mutating func _sortIntegersAscendingIfApplicable() -> Bool {
+    guard count >= _radixSortMinimumCount else { return false }
+
+    // `Element` is dynamically known to be `T` in each of the calls below,
+    // so the memory is already bound to the right type.
+    @inline(__always)
+    func radixSort<T: FixedWidthInteger>(_: T.Type, count: Int) {
+      let start = UnsafeMutableRawPointer(
+        self.baseAddress._unsafelyUnwrappedUnchecked
+      ).assumingMemoryBound(to: T.self)
+      let elements = UnsafeMutableBufferPointer<T>(start: start, count: count)
+
+      // Use array's allocating initializer to create the scratch buffer, the
+      // same way `_stableSortImpl` allocates its merge buffer. The elements
+      // are POD, so there is no need to set the initialized count.
+      _ = Array<T>(_unsafeUninitializedCapacity: count) { scratch, _ in
+        elements._radixSortAscending(
+          scratch: scratch.baseAddress._unsafelyUnwrappedUnchecked)
+      }
+    }
+
+    if Element.self == Int.self {
+      radixSort(Int.self, count: count)
+    } else if Element.self == UInt.self {
+      radixSort(UInt.self, count: count)
+    } else if Element.self == Int64.self {
+      radixSort(Int64.self, count: count)
+    } else if Element.self == UInt64.self {
+      radixSort(UInt64.self, count: count)
+    } else if Element.self == Int32.self {
+      radixSort(Int32.self, count: count)
+    } else if Element.self == UInt32.self {
+      radixSort(UInt32.self, count: count)
+    } else if Element.self == Int16.self {
+      radixSort(Int16.self, count: count)
+    } else if Element.self == UInt16.self {
+      radixSort(UInt16.self, count: count)
+    } else if Element.self == Int8.self {
+      radixSort(Int8.self, count: count)
+    } else if Element.self == UInt8.self {
+      radixSort(UInt8.self, count: count)
+    } else {
+      return false
+    }
+    return true
+  }
+}
@@ -108,6 +108,17 @@ private func _stringCompareFastUTF8(
     return _lexicographicalCompare(cmp, 0, expecting: expecting)
   }
 
+  // The per-string isNFC bit is currently only set for ASCII contents, so
+  // most normalized non-ASCII text lands here. Quick-check the contents
+  // before falling into the segment-by-segment path: if every scalar on both
+  // sides forms its own NFC segment, both strings are already normalized and
+  // a plain binary comparison is decisive. The scan is linear with word-wise
+  // skips over ASCII runs and bails at the first combining mark.
+  if utf8Left.isKnownNFC() && utf8Right.isKnownNFC() {
+    let cmp = _binaryCompare(utf8Left, utf8Right)
+    return _lexicographicalCompare(cmp, 0, expecting: expecting)
+  }
+
   return _stringCompareFastUTF8Abnormal(
     utf8Left, utf8Right, expecting: expecting)
 }
@@ -12,6 +12,8 @@
 // String Creation Helpers
 //===----------------------------------------------------------------------===//
 
+import SwiftShims
+
 internal func _allASCII(_ input: UnsafeBufferPointer<UInt8>) -> Bool {
   if input.isEmpty { return true }
 
@@ -88,6 +90,49 @@ extension String {
     return String._uncheckedFromUTF8(input, isASCII: extraInfo.isASCII)
   }
 
+  /// Creates a string that reads its UTF-8 code units directly out of
+  /// caller-owned memory, without copying them.
+  ///
+  /// The caller is responsible for keeping `input` allocated and unmodified
+  /// for the lifetime of the result and of every string or substring derived
+  /// from it; this is intended for process-lifetime regions such as
+  /// memory-mapped files. The shared storage header is immortalized, so
+  /// copying the result does not perform any reference counting, and the
+  /// (small, fixed-size) header is never deallocated.
+  ///
+  /// Returns `nil` if `input` is not valid UTF-8.
+  public // SPI(Foundation)
+  static func _tryFromBorrowedUTF8(
+    _ input: UnsafeBufferPointer<UInt8>
+  ) -> String? {
+    guard case .success(let extraInfo) = validateUTF8(input) else {
+      return nil
+    }
+    return String._uncheckedFromBorrowedUTF8(
+      input, isASCII: extraInfo.isASCII)
+  }
+
+  /// Like `_tryFromBorrowedUTF8`, but requires the caller to guarantee that
+  /// `input` is valid UTF-8, and to already know whether it is all ASCII.
+  public // SPI(Foundation)
+  static func _uncheckedFromBorrowedUTF8(
+    _ input: UnsafeBufferPointer<UInt8>,
+    isASCII: Bool
+  ) -> String {
+    // Small strings fit in the String value itself. Copying them costs
+    // nothing and drops the lifetime dependency on the caller's memory.
+    if let smol = _SmallString(input) {
+      return String(_StringGuts(smol))
+    }
+
+    let storage = __SharedStringStorage(
+      immortal: input.baseAddress._unsafelyUnwrappedUnchecked,
+      countAndFlags: _StringObject.CountAndFlags(
+        sharedCount: input.count, isASCII: isASCII))
+    _swift_stdlib_immortalize(Unmanaged.passUnretained(storage).toOpaque())
+    return storage.asString
+  }
+
   @usableFromInline
   internal static func _fromUTF8Repairing(
     _ input: UnsafeBufferPointer<UInt8>
@@ -215,6 +260,10 @@ extension String {
     where Input == UnsafeBufferPointer<UInt8>, Encoding == Unicode.ASCII)
   @_specialize(
     where Input == Array<UInt8>, Encoding == Unicode.ASCII)
+  @_specialize(
+    where Input == UnsafeBufferPointer<UInt16>, Encoding == Unicode.UTF16)
+  @_specialize(
+    where Input == Array<UInt16>, Encoding == Unicode.UTF16)
   internal static func _fromCodeUnits<
     Input: Collection,
     Encoding: Unicode.Encoding
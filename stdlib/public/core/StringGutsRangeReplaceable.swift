@@ -311,6 +311,17 @@ extension _StringGuts {
         }
         return
       }
+      // Note: a Substring of self would hold a second reference to our
+      // storage, so we cannot be uniquely referenced here; the replacement
+      // cannot alias the storage we splice into.
+      if let replSubstr = newElements as? Substring,
+         replSubstr._wholeGuts.isFastUTF8 {
+        replSubstr._wholeGuts.withFastUTF8(range: replSubstr._offsetRange) {
+          uniqueNativeReplaceSubrange(
+            bounds, with: $0, isASCII: replSubstr._wholeGuts.isASCII)
+        }
+        return
+      }
       uniqueNativeReplaceSubrange(
         bounds, with: newElements.lazy.flatMap { $0.utf8 })
       return
@@ -12,6 +12,29 @@
 
 import SwiftShims
 
+/// Feeds a string's NFC byte content to the hasher.
+///
+/// Content that fits the small-string form and is all ASCII is hashed as the
+/// two words of its canonical small representation — two integer mixes
+/// instead of a byte-buffer pass. All other content is hashed as its byte
+/// sequence followed by a terminator. Equal content can reach the hasher
+/// from any representation (small, large native, or foreign), so the choice
+/// between the two encodings is keyed on the content alone, never on
+/// representation flags.
+@inline(__always)
+internal func _hashNFCBytes(
+  _ utf8: UnsafeBufferPointer<UInt8>, into hasher: inout Hasher
+) {
+  if let small = _SmallString(utf8), small.isASCII {
+    let raw = small.rawBits
+    hasher.combine(raw.0)
+    hasher.combine(raw.1)
+    return
+  }
+  hasher.combine(bytes: UnsafeRawBufferPointer(utf8))
+  hasher.combine(0xFF as UInt8) // terminator
+}
+
 extension String: Hashable {
   /// Hashes the essential components of this value by feeding them into the
   /// given hasher.
@@ -19,11 +42,19 @@ extension String: Hashable {
   /// - Parameter hasher: The hasher to use when combining the components
   ///   of this instance.
   public func hash(into hasher: inout Hasher) {
-    if _fastPath(self._guts.isNFCFastUTF8) {
-      self._guts.withFastUTF8 {
-        hasher.combine(bytes: UnsafeRawBufferPointer($0))
+    let guts = self._guts
+    // ASCII small-string fast-path: the storage words are already the
+    // canonical form _hashNFCBytes would rebuild.
+    if _fastPath(guts.isSmallASCII) {
+      let raw = guts.asSmall.rawBits
+      hasher.combine(raw.0)
+      hasher.combine(raw.1)
+      return
+    }
+    if _fastPath(guts.isNFCFastUTF8) {
+      guts.withFastUTF8 {
+        _hashNFCBytes($0, into: &hasher)
       }
-      hasher.combine(0xFF as UInt8) // terminator
     } else {
       _gutsSlice._normalizedHash(into: &hasher)
     }
@@ -48,14 +79,43 @@ extension _StringGutsSlice {
   internal func _normalizedHash(into hasher: inout Hasher) {
     if self.isNFCFastUTF8 {
       self.withFastUTF8 {
-        hasher.combine(bytes: UnsafeRawBufferPointer($0))
+        _hashNFCBytes($0, into: &hasher)
       }
-    } else {
-      _withNFCCodeUnits {
-        hasher.combine($0)
+      return
+    }
+
+    // The normalized code units arrive as a stream. Buffer the first
+    // small-string's worth so that short all-ASCII content takes the same
+    // word path as above; longer streams flush the buffer and keep feeding
+    // the hasher directly.
+    var prefix: _SmallString.RawBitPattern = (0, 0)
+    var overflowed = false
+    withUnsafeMutableBytes(of: &prefix) { rawPrefix in
+      var length = 0
+      _withNFCCodeUnits { cu in
+        if !overflowed {
+          if length < _SmallString.capacity {
+            rawPrefix[length] = cu
+            length += 1
+            return
+          }
+          overflowed = true
+          hasher.combine(bytes: UnsafeRawBufferPointer(
+            start: rawPrefix.baseAddress, count: length))
+        }
+        hasher.combine(cu)
+      }
+      if !overflowed {
+        let buffered = UnsafeBufferPointer(
+          start: rawPrefix.baseAddress._unsafelyUnwrappedUnchecked
+            .assumingMemoryBound(to: UInt8.self),
+          count: length)
+        _hashNFCBytes(buffered, into: &hasher)
       }
     }
-    hasher.combine(0xFF as UInt8) // terminator
+    if overflowed {
+      hasher.combine(0xFF as UInt8) // terminator
+    }
   }
 }
 
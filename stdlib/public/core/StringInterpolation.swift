@@ -72,9 +72,22 @@ public struct DefaultStringInterpolation: StringInterpolationProtocol {
   /// interpreting string interpolations.
   @inlinable
   public init(literalCapacity: Int, interpolationCount: Int) {
-    let capacityPerInterpolation = 2
-    let initialCapacity = literalCapacity +
-      interpolationCount * capacityPerInterpolation
+    // Typical interpolated values (integers, doubles, short strings) render
+    // to several UTF-8 code units, so reserve 8 per interpolation up front.
+    // Underestimating costs a full grow-and-copy of the partially built
+    // string on the append that overflows; overestimating is usually free
+    // because the storage allocation rounds up to a malloc bucket and claims
+    // the excess as capacity anyway. However, if a conservative estimate of
+    // 2 code units per interpolation still fits in the small-string form,
+    // prefer that: it keeps short results allocation-free, and outgrowing it
+    // copies at most a small string's worth of bytes.
+    let conservativeCapacity = literalCapacity + interpolationCount * 2
+    let initialCapacity: Int
+    if conservativeCapacity <= _SmallString.capacity {
+      initialCapacity = conservativeCapacity
+    } else {
+      initialCapacity = literalCapacity + interpolationCount * 8
+    }
     _storage = String._createEmpty(withInitialCapacity: initialCapacity)
   }
   
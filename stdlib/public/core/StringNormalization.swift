@@ -167,7 +167,49 @@ extension UnsafeBufferPointer where Element == UInt8 {
     }
     return !UTF8.isContinuation(self[index])
   }
-  
+
+  /// A conservative, single-pass check whether the contents are known to be
+  /// in normal form C.
+  ///
+  /// Returns true if every scalar is an NFC starter, i.e. forms its own
+  /// normalization segment; such contents are trivially NFC. Contents
+  /// containing combining marks report false even when they happen to be
+  /// normalized, and take the normalizing paths instead.
+  internal func isKnownNFC() -> Bool {
+    guard let ptr = self.baseAddress else { return true }
+
+    let count = self.count
+    let stride = MemoryLayout<UInt>.stride
+    let address = Int(bitPattern: ptr)
+    let wordASCIIMask = UInt(truncatingIfNeeded: 0x8080_8080_8080_8080 as UInt64)
+
+    var i = 0
+    while i < count {
+      // Word-wise skip over ASCII runs, which make up the bulk of
+      // mostly-ASCII contents that failed the whole-string ASCII check.
+      if (address &+ i) % stride == 0 {
+        while (i &+ stride) <= count {
+          let word: UInt = UnsafePointer<UInt>(
+            bitPattern: address &+ i
+          )._unsafelyUnwrappedUnchecked.pointee
+          guard word & wordASCIIMask == 0 else { break }
+          i &+= stride
+        }
+        if i == count { break }
+      }
+
+      let byte = ptr[i]
+      // ASCII and two-byte scalars below U+0300 are always NFC starters.
+      if byte < 0xCC {
+        i &+= byte < 0x80 ? 1 : 2
+        continue
+      }
+      let (scalar, len) = _decodeScalar(self, startingAt: i)
+      guard scalar._isNFCStarter else { return false }
+      i &+= len
+    }
+    return true
+  }
 }
 
 //If this returns nil, it means the outputBuffer ran out of space
@@ -36,11 +36,13 @@ internal func validateUTF8(_ buf: UnsafeBufferPointer<UInt8>) -> UTF8ValidationR
     return .success(UTF8ExtraInfo(isASCII: true))
   }
 
-  var iter = buf.makeIterator()
   var lastValidIndex = buf.startIndex
+  var readIndex = buf.startIndex
 
   @inline(__always) func guaranteeIn(_ f: (UInt8) -> Bool) throws {
-    guard let cu = iter.next() else { throw UTF8ValidationError() }
+    guard readIndex < buf.endIndex else { throw UTF8ValidationError() }
+    let cu = buf[readIndex]
+    readIndex &+= 1
     guard f(cu) else { throw UTF8ValidationError() }
   }
   @inline(__always) func guaranteeContinuation() throws {
@@ -102,8 +104,33 @@ internal func validateUTF8(_ buf: UnsafeBufferPointer<UInt8>) -> UTF8ValidationR
 
   do {
     var isASCII = true
-    while let cu = iter.next() {
-      if UTF8.isASCII(cu) { lastValidIndex &+= 1; continue }
+    let address = Int(
+      bitPattern: buf.baseAddress._unsafelyUnwrappedUnchecked)
+    let wordStride = MemoryLayout<UInt>.stride
+    let wordASCIIMask = UInt(
+      truncatingIfNeeded: 0x8080_8080_8080_8080 as UInt64)
+    while readIndex < buf.endIndex {
+      let cu = buf[readIndex]
+      if UTF8.isASCII(cu) {
+        readIndex &+= 1
+        lastValidIndex &+= 1
+        // ASCII tends to come in runs, even inside otherwise non-ASCII
+        // text. Once the read position is word-aligned, skip over the rest
+        // of the run a word at a time instead of re-entering the state
+        // machine for every byte.
+        if (address &+ readIndex) % wordStride == 0 {
+          while readIndex &+ wordStride <= buf.endIndex {
+            let word: UInt = UnsafePointer(
+              bitPattern: address &+ readIndex
+            )._unsafelyUnwrappedUnchecked.pointee
+            guard word & wordASCIIMask == 0 else { break }
+            readIndex &+= wordStride
+            lastValidIndex &+= wordStride
+          }
+        }
+        continue
+      }
+      readIndex &+= 1
       isASCII = false
       if _slowPath(!_isUTF8MultiByteLeading(cu)) {
         throw UTF8ValidationError()
@@ -22,12 +22,25 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include "Private.h"
 #include "swift/Runtime/Config.h"
 #include "swift/Runtime/HeapObject.h"
 #include "swift/Runtime/Metadata.h"
 
 using namespace swift;
 
+/// Return true if the array elements are single Swift-native class
+/// references. Copying such an element is a pointer copy plus a retain and
+/// destroying it is a release, so whole-array operations can treat the
+/// buffer as a flat array of object pointers and bulk-update reference
+/// counts instead of making one value witness call per element.
+static bool elementsAreNativeClassReferences(const Metadata *self) {
+  if (self->getKind() != MetadataKind::Class)
+    return false;
+  return usesNativeSwiftReferenceCounting(
+      static_cast<const ClassMetadata *>(self));
+}
+
 namespace {
 enum class ArrayCopy : unsigned {
   NoAlias = 0,
@@ -98,6 +111,14 @@ static void array_copy_operation(OpaqueValue *dest, OpaqueValue *src,
       array_pod_copy(copyKind, dest, src, stride, count);
       return;
     }
+    // Initializing from an array of Swift-native class references is a
+    // pointer copy followed by one bulk retain pass over the new buffer,
+    // instead of a retaining witness call per element.
+    if (destOp == ArrayDest::Init && elementsAreNativeClassReferences(self)) {
+      array_pod_copy(copyKind, dest, src, stride, count);
+      swift_bulkRetain(reinterpret_cast<HeapObject **>(dest), count);
+      return;
+    }
   } else {
     // Otherwise, we are doing a take and need bitwise takability for a copy.
     assert(srcOp == ArraySource::Take);
@@ -108,14 +129,33 @@ static void array_copy_operation(OpaqueValue *dest, OpaqueValue *src,
     }
   }
 
-  // Call the witness to do the copy.
+  // Call the witness to do the copy. Process the elements in blocks of four
+  // so that the loop control and address arithmetic amortize over several
+  // indirect calls.
   if (copyKind == ArrayCopy::NoAlias || copyKind == ArrayCopy::FrontToBack) {
     auto copy = get_witness_function<destOp, srcOp>(wtable);
-    for (size_t i = 0; i < count; ++i) {
-      auto offset = i * stride;
-      auto *from = reinterpret_cast<OpaqueValue *>((char *)src + offset);
-      auto *to = reinterpret_cast<OpaqueValue *>((char *)dest + offset);
-      copy(to, from, self);
+    auto *from = (char *)src;
+    auto *to = (char *)dest;
+    size_t remaining = count;
+    while (remaining >= 4) {
+      copy(reinterpret_cast<OpaqueValue *>(to),
+           reinterpret_cast<OpaqueValue *>(from), self);
+      copy(reinterpret_cast<OpaqueValue *>(to + stride),
+           reinterpret_cast<OpaqueValue *>(from + stride), self);
+      copy(reinterpret_cast<OpaqueValue *>(to + 2 * stride),
+           reinterpret_cast<OpaqueValue *>(from + 2 * stride), self);
+      copy(reinterpret_cast<OpaqueValue *>(to + 3 * stride),
+           reinterpret_cast<OpaqueValue *>(from + 3 * stride), self);
+      from += 4 * stride;
+      to += 4 * stride;
+      remaining -= 4;
+    }
+    while (remaining > 0) {
+      copy(reinterpret_cast<OpaqueValue *>(to),
+           reinterpret_cast<OpaqueValue *>(from), self);
+      from += stride;
+      to += stride;
+      --remaining;
     }
     return;
   }
@@ -201,10 +241,30 @@ void swift_arrayDestroy(OpaqueValue *begin, size_t count, const Metadata *self)
   if (wtable->isPOD())
     return;
 
+  // Destroying an array of Swift-native class references is one bulk
+  // release pass over the buffer instead of a witness call per element.
+  if (elementsAreNativeClassReferences(self)) {
+    swift_bulkRelease(reinterpret_cast<HeapObject **>(begin), count);
+    return;
+  }
+
+  // Destroy the elements in blocks of four so that the loop control and
+  // address arithmetic amortize over several indirect calls.
+  auto destroy = wtable->destroy;
   auto stride = wtable->getStride();
-  for (size_t i = 0; i < count; ++i) {
-    auto offset = i * stride;
-    auto *obj = reinterpret_cast<OpaqueValue *>((char *)begin + offset);
-    wtable->destroy(obj, self);
+  auto *obj = (char *)begin;
+  size_t remaining = count;
+  while (remaining >= 4) {
+    destroy(reinterpret_cast<OpaqueValue *>(obj), self);
+    destroy(reinterpret_cast<OpaqueValue *>(obj + stride), self);
+    destroy(reinterpret_cast<OpaqueValue *>(obj + 2 * stride), self);
+    destroy(reinterpret_cast<OpaqueValue *>(obj + 3 * stride), self);
+    obj += 4 * stride;
+    remaining -= 4;
+  }
+  while (remaining > 0) {
+    destroy(reinterpret_cast<OpaqueValue *>(obj), self);
+    obj += stride;
+    --remaining;
   }
 }
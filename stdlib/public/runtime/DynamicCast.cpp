@@ -21,6 +21,7 @@
 #include "swift/ABI/MetadataValues.h"
 #include "swift/Basic/Lazy.h"
 #include "swift/Runtime/Casting.h"
+#include "swift/Runtime/Concurrent.h"
 #include "swift/Runtime/Config.h"
 #include "swift/Runtime/ExistentialContainer.h"
 #include "swift/Runtime/HeapObject.h"
@@ -1833,6 +1834,80 @@ static tryCastFunctionType *selectCasterForDest(const Metadata *destType) {
   }
 }
 
+/******************************************************************************/
+/************************* Failed-Cast Result Cache ***************************/
+/******************************************************************************/
+
+// Repeated casting between the same pair of types is common (e.g. chains of
+// `as?` used to dispatch on a value's type), and a failed cast walks the
+// entire strategy search above every time. For type pairs whose outcome
+// depends only on the static types, we remember failures in a lock-free map
+// so later casts between the same pair fail after a single lookup.
+//
+// Successes are not cached: a successful cast still has to convert the
+// value, so there is no search to skip.
+
+namespace {
+struct FailedCastCacheKey {
+  const Metadata *srcType;
+  const Metadata *destType;
+};
+
+struct FailedCastCacheEntry {
+  const Metadata *srcType;
+  const Metadata *destType;
+
+  FailedCastCacheEntry(FailedCastCacheKey key)
+    : srcType(key.srcType), destType(key.destType) {}
+
+  int compareWithKey(const FailedCastCacheKey &key) const {
+    if (key.srcType != srcType)
+      return uintptr_t(key.srcType) < uintptr_t(srcType) ? -1 : 1;
+    if (key.destType != destType)
+      return uintptr_t(key.destType) < uintptr_t(destType) ? -1 : 1;
+    return 0;
+  }
+
+  static size_t getExtraAllocationSize(FailedCastCacheKey key) { return 0; }
+  size_t getExtraAllocationSize() const { return 0; }
+};
+} // end anonymous namespace
+
+static ConcurrentMap<FailedCastCacheEntry, /*Destructor*/ false>
+  FailedCastCache;
+
+/// Return true if the outcome of a cast between these static types is the
+/// same for every value of the source type, so a failure can be cached.
+///
+/// Classes are excluded because the cast retries with the value's dynamic
+/// type; existentials, optionals and AnyHashable because the outcome depends
+/// on the wrapped value; the covariant containers (Array, Dictionary, Set)
+/// because the outcome depends on the element values; and metatypes because
+/// a value of static type C.Type can store the metatype of any subclass of
+/// C, which tryCastToMetatype checks against the destination.
+static bool castResultIsValueIndependent(const Metadata *srcType,
+                                         const Metadata *destType) {
+  for (auto *type : {srcType, destType}) {
+    switch (type->getKind()) {
+    case MetadataKind::Struct: {
+      auto descriptor = cast<StructMetadata>(type)->Description;
+      if (descriptor == &STRUCT_TYPE_DESCR_SYM(s11AnyHashable)
+          || descriptor == &NOMINAL_TYPE_DESCR_SYM(Sa)
+          || descriptor == &NOMINAL_TYPE_DESCR_SYM(SD)
+          || descriptor == &NOMINAL_TYPE_DESCR_SYM(Sh))
+        return false;
+      break;
+    }
+    case MetadataKind::Enum:
+    case MetadataKind::Function:
+      break;
+    default:
+      return false;
+    }
+  }
+  return true;
+}
+
 // This top-level driver provides the general flow for all casting
 // operations.  It recursively unwraps source and destination as it
 // searches for a suitable conversion.
@@ -1864,6 +1939,13 @@ tryCast(
   auto destKind = destType->getKind();
   auto srcKind = srcType->getKind();
 
+  // If this pair of types is known to always fail, fail now.
+  bool cacheableFailure = castResultIsValueIndependent(srcType, destType);
+  if (cacheableFailure
+      && FailedCastCache.find(FailedCastCacheKey{srcType, destType})) {
+    return DynamicCastResult::Failure;
+  }
+
   ////////////////////////////////////////////////////////////////////////
   //
   // 2. Try directly casting the current srcValue to the target type.
@@ -2111,6 +2193,13 @@ tryCast(
     break;
   }
 
+  // Every strategy failed. If the outcome was determined by the static types
+  // alone, remember that so the next cast between this pair fails after a
+  // single cache lookup.
+  if (cacheableFailure) {
+    FailedCastCache.getOrInsert(FailedCastCacheKey{srcType, destType});
+  }
+
   return DynamicCastResult::Failure;
 }
 
@@ -21,13 +21,85 @@
 
 #if !SWIFT_OBJC_INTEROP
 
+#include <new>
 #include <stdio.h>
 #include "swift/Runtime/Debug.h"
+#include "swift/Runtime/HeapObject.h"
 #include "ErrorObject.h"
 #include "Private.h"
 
 using namespace swift;
 
+namespace {
+
+/// A small per-thread cache of recently deallocated error boxes.
+///
+/// Recoverable-error control flow can allocate and free error boxes at a very
+/// high rate: a throw which is immediately caught and discarded frees its box
+/// right away, and the next thrown error allocates an identically sized one.
+/// Recycling the last few freed boxes avoids the round trip through the
+/// allocator on that path. Boxes are reused only for an exact size and
+/// alignment match, which is what the repeated-throw pattern produces.
+class ErrorBoxCache {
+  static const size_t MaxEntries = 4;
+  // Don't let unusually large error payloads pin memory to the thread.
+  static const size_t MaxCachedSize = 256;
+
+  struct Entry {
+    void *box;
+    size_t size;
+    size_t alignMask;
+  };
+  Entry Entries[MaxEntries];
+  unsigned Count = 0;
+  // Deallocations can arrive from other thread-exit destructors after this
+  // cache's destructor has run; they must fall through to the allocator.
+  bool Destroyed = false;
+
+public:
+  constexpr ErrorBoxCache() : Entries{} {}
+
+  ~ErrorBoxCache() {
+    while (Count > 0) {
+      auto &entry = Entries[--Count];
+      swift_slowDealloc(entry.box, entry.size, entry.alignMask);
+    }
+    Destroyed = true;
+  }
+
+  /// Returns null if no cached box matches.
+  void *allocate(size_t size, size_t alignMask) {
+    for (unsigned i = 0; i < Count; ++i) {
+      if (Entries[i].size == size && Entries[i].alignMask == alignMask) {
+        void *box = Entries[i].box;
+        Entries[i] = Entries[--Count];
+        return box;
+      }
+    }
+    return nullptr;
+  }
+
+  /// Returns false if the box is not taken by the cache and must be
+  /// deallocated by the caller.
+  bool deallocate(void *box, size_t size, size_t alignMask) {
+    if (Destroyed || Count == MaxEntries || size > MaxCachedSize)
+      return false;
+    Entries[Count++] = {box, size, alignMask};
+    return true;
+  }
+};
+
+} // end anonymous namespace
+
+#ifdef SWIFT_STDLIB_SINGLE_THREADED_RUNTIME
+static ErrorBoxCache TheErrorBoxCache;
+#else
+static thread_local ErrorBoxCache TheErrorBoxCache;
+#endif
+static ErrorBoxCache &getErrorBoxCache() {
+  return TheErrorBoxCache;
+}
+
 /// Determine the size and alignment of an Error box containing the given
 /// type.
 static std::pair<size_t, size_t>
@@ -53,8 +125,11 @@ static SWIFT_CC(swift) void _destroyErrorObject(SWIFT_CONTEXT HeapObject *obj) {
   auto type = error->type;
   type->vw_destroy(error->getValue());
   
-  // Deallocate the buffer.
+  // Deallocate the buffer, preferably into the per-thread cache.
   auto sizeAndAlign = _getErrorAllocatedSizeAndAlignmentMask(type);
+  if (getErrorBoxCache().deallocate(obj, sizeAndAlign.first,
+                                    sizeAndAlign.second))
+    return;
   swift_deallocObject(obj, sizeAndAlign.first, sizeAndAlign.second);
 }
 
@@ -70,10 +145,17 @@ swift::swift_allocError(const swift::Metadata *type,
                         OpaqueValue *initialValue,
                         bool isTake) {
   auto sizeAndAlign = _getErrorAllocatedSizeAndAlignmentMask(type);
-  
-  auto allocated = swift_allocObject(&ErrorMetadata,
-                                     sizeAndAlign.first, sizeAndAlign.second);
-  
+
+  HeapObject *allocated;
+  if (void *cached = getErrorBoxCache().allocate(sizeAndAlign.first,
+                                                 sizeAndAlign.second)) {
+    // Reinitialize the header of the recycled box.
+    allocated = new (cached) HeapObject(&ErrorMetadata);
+  } else {
+    allocated = swift_allocObject(&ErrorMetadata,
+                                  sizeAndAlign.first, sizeAndAlign.second);
+  }
+
   auto error = reinterpret_cast<SwiftError*>(allocated);
   
   error->type = type;
@@ -94,6 +176,9 @@ swift::swift_allocError(const swift::Metadata *type,
 void
 swift::swift_deallocError(SwiftError *error, const Metadata *type) {
   auto sizeAndAlign = _getErrorAllocatedSizeAndAlignmentMask(type);
+  if (getErrorBoxCache().deallocate(error, sizeAndAlign.first,
+                                    sizeAndAlign.second))
+    return;
   swift_deallocUninitializedObject(error, sizeAndAlign.first, sizeAndAlign.second);
 }
 
@@ -166,15 +166,63 @@ static_assert(sizeof(Access) <= sizeof(ValueBuffer) &&
               alignof(Access) <= alignof(ValueBuffer),
               "Access doesn't fit in a value buffer!");
 
-/// A set of accesses that we're tracking.  Just a singly-linked list.
+/// A fixed-size hash filter over the pointers of the tracked accesses.
+///
+/// Each bucket counts the live tracked accesses whose pointer hashes into
+/// it. Almost every access begins while no other access to the same pointer
+/// is live on the thread, so an empty bucket proves the absence of a
+/// conflict without walking the access list. Collisions only send us down
+/// the slow path; they never affect soundness.
+class AccessFilter {
+  enum : size_t { NumBuckets = 64 };
+  uint16_t Counts[NumBuckets] = {};
+
+  static size_t bucketFor(void *pointer) {
+    // Fold the high bits over the mostly-zero alignment bits before masking
+    // so that nearby addresses spread across buckets.
+    uintptr_t p = reinterpret_cast<uintptr_t>(pointer);
+    return ((p >> 3) ^ (p >> 9)) & (NumBuckets - 1);
+  }
+
+public:
+  constexpr AccessFilter() {}
+
+  bool mayContain(void *pointer) const {
+    return Counts[bucketFor(pointer)] != 0;
+  }
+
+  void insert(void *pointer) {
+    uint16_t &count = Counts[bucketFor(pointer)];
+    // Leave a saturated bucket sticky; it permanently takes the slow path.
+    if (count != UINT16_MAX)
+      ++count;
+  }
+
+  void remove(void *pointer) {
+    uint16_t &count = Counts[bucketFor(pointer)];
+    assert(count != 0 && "removing an access that was never inserted");
+    if (count != UINT16_MAX)
+      --count;
+  }
+};
+
+/// A set of accesses that we're tracking.  A singly-linked list, with a
+/// hash filter in front of it so that the common conflict-free begin_access
+/// doesn't walk the list at all.
 class AccessSet {
   Access *Head = nullptr;
+  AccessFilter Filter;
 public:
   constexpr AccessSet() {}
 
   bool insert(Access *access, void *pc, void *pointer, ExclusivityFlags flags) {
     auto action = getAccessAction(flags);
 
+    // Only walk the list when the filter says another live access might use
+    // the same pointer.
+    if (!Filter.mayContain(pointer))
+      return insertUnchecked(access, pc, pointer, flags, action);
+
     for (Access *cur = Head; cur != nullptr; cur = cur->getNext()) {
       // Ignore accesses to different values.
       if (cur->Pointer != pointer)
@@ -192,16 +240,12 @@ public:
       // 0 means no backtrace will be printed.
       fatalError(0, "Fatal access conflict detected.\n");
     }
-    if (!isTracking(flags))
-      return false;
-
-    // Insert to the front of the array so that remove tends to find it faster.
-    access->initialize(pc, pointer, Head, action);
-    Head = access;
-    return true;
+    return insertUnchecked(access, pc, pointer, flags, action);
   }
 
   void remove(Access *access) {
+    Filter.remove(access->Pointer);
+
     auto cur = Head;
     // Fast path: stack discipline.
     if (cur == access) {
@@ -231,6 +275,19 @@ public:
     }
   }
 #endif
+
+private:
+  bool insertUnchecked(Access *access, void *pc, void *pointer,
+                       ExclusivityFlags flags, ExclusivityFlags action) {
+    if (!isTracking(flags))
+      return false;
+
+    // Insert to the front of the array so that remove tends to find it faster.
+    access->initialize(pc, pointer, Head, action);
+    Head = access;
+    Filter.insert(pointer);
+    return true;
+  }
 };
 
 class SwiftTLSContext {
@@ -18,7 +18,9 @@
 #include "swift/Runtime/Heap.h"
 #include "Private.h"
 #include "swift/Runtime/Debug.h"
+#include "swift/Runtime/EnvironmentVariables.h"
 #include "../SwiftShims/RuntimeShims.h"
+#include "../SwiftShims/Visibility.h"
 #include <algorithm>
 #include <stdlib.h>
 #if defined(__APPLE__)
@@ -68,6 +70,103 @@ static inline malloc_zone_t *DEFAULT_ZONE() {
 }
 #endif
 
+namespace {
+
+/// A per-thread cache of small malloc blocks, bucketed by size class.
+///
+/// Fixed-size class instances — tree nodes, small ManagedBuffers — are
+/// allocated and destroyed at high rates, and every one of them otherwise
+/// round-trips through the general-purpose allocator. When the cache is
+/// enabled, small default-aligned allocations are rounded up to a 16-byte
+/// size class and deallocations feed a per-thread free list (a "magazine")
+/// for their class that subsequent allocations pop without locking.
+///
+/// All cached blocks come from malloc at their class's rounded size, so a
+/// block cached by one deallocation satisfies any later allocation in the
+/// same class, and overflowing or draining a magazine degenerates to plain
+/// free/malloc. Correctness relies on swift_slowDealloc callers reporting
+/// the allocated size accurately, which the object-deallocation paths that
+/// use the default-alignment branch guarantee.
+class SmallAllocationCache {
+  // Size classes are multiples of 16 bytes up to 256 bytes, which covers
+  // typical node-sized class instances while keeping the per-thread
+  // footprint small.
+  static const size_t Granule = 16;
+  static const size_t NumClasses = 16;
+  static const unsigned MaxBlocksPerClass = 32;
+
+  void *Blocks[NumClasses][MaxBlocksPerClass];
+  unsigned Counts[NumClasses] = {};
+
+  // Deallocations can arrive from other thread-exit destructors after this
+  // cache's destructor has run; they must fall through to plain free.
+  bool Destroyed = false;
+
+  static size_t classForSize(size_t size) {
+    // Size 0 shares the smallest class.
+    return size == 0 ? 0 : (size - 1) / Granule;
+  }
+
+public:
+  constexpr SmallAllocationCache() : Blocks{} {}
+
+  ~SmallAllocationCache() {
+    for (size_t c = 0; c < NumClasses; ++c) {
+      for (unsigned i = 0; i < Counts[c]; ++i)
+        free(Blocks[c][i]);
+      Counts[c] = 0;
+    }
+    Destroyed = true;
+  }
+
+  /// Returns null if \p size is not covered by the cache.
+  void *allocate(size_t size) {
+    size_t c = classForSize(size);
+    if (c >= NumClasses)
+      return nullptr;
+    if (!Destroyed && Counts[c] > 0)
+      return Blocks[c][--Counts[c]];
+    // Allocate the whole class size so the block can satisfy any later
+    // allocation in this class, including one on another thread whose cache
+    // the block may be freed into.
+    void *p = malloc((c + 1) * Granule);
+    if (!p) swift::crash("Could not allocate memory.");
+    return p;
+  }
+
+  /// Returns false if the block is not covered by the cache and must be
+  /// freed by the caller.
+  bool deallocate(void *ptr, size_t size) {
+    size_t c = classForSize(size);
+    if (c >= NumClasses || Destroyed)
+      return false;
+    if (Counts[c] == MaxBlocksPerClass) {
+      free(ptr);
+      return true;
+    }
+    Blocks[c][Counts[c]++] = ptr;
+    return true;
+  }
+};
+
+} // end anonymous namespace
+
+#ifdef SWIFT_STDLIB_SINGLE_THREADED_RUNTIME
+static SmallAllocationCache TheSmallAllocationCache;
+static SmallAllocationCache &getSmallAllocationCache() {
+  return TheSmallAllocationCache;
+}
+#else
+static thread_local SmallAllocationCache TheSmallAllocationCache;
+static SmallAllocationCache &getSmallAllocationCache() {
+  return TheSmallAllocationCache;
+}
+#endif
+
+static bool isSmallAllocationCacheEnabled() {
+  return runtime::environment::SWIFT_ENABLE_SMALL_ALLOCATION_CACHE();
+}
+
 // When alignMask == ~(size_t(0)), allocation uses the "default"
 // _swift_MinAllocationAlignment. This is different than calling swift_slowAlloc
 // with `alignMask == _swift_MinAllocationAlignment - 1` because it forces
@@ -88,6 +187,10 @@ void *swift::swift_slowAlloc(size_t size, size_t alignMask) {
   void *p;
   // This check also forces "default" alignment to use AlignedAlloc.
   if (alignMask <= MALLOC_ALIGN_MASK) {
+    if (SWIFT_UNLIKELY(isSmallAllocationCacheEnabled())) {
+      if (void *cached = getSmallAllocationCache().allocate(size))
+        return cached;
+    }
 #if defined(__APPLE__)
     p = malloc_zone_malloc(DEFAULT_ZONE(), size);
 #else
@@ -121,6 +224,10 @@ void *swift::swift_slowAlloc(size_t size, size_t alignMask) {
 //   consistent with allocation with the same alignment.
 void swift::swift_slowDealloc(void *ptr, size_t bytes, size_t alignMask) {
   if (alignMask <= MALLOC_ALIGN_MASK) {
+    if (SWIFT_UNLIKELY(isSmallAllocationCacheEnabled())) {
+      if (getSmallAllocationCache().deallocate(ptr, bytes))
+        return;
+    }
 #if defined(__APPLE__)
     malloc_zone_free(DEFAULT_ZONE(), ptr);
 #else
@@ -380,6 +380,23 @@ HeapObject *swift::swift_nonatomic_retain_n(HeapObject *object, uint32_t n) {
   return object;
 }
 
+void swift::swift_bulkRetain(HeapObject **objects, size_t count) {
+  size_t i = 0;
+  while (i < count) {
+    auto *object = objects[i];
+    // Coalesce a run of references to the same object into a single
+    // retain-by-n, paying one atomic increment for the whole run.
+    size_t runLength = 1;
+    while (i + runLength < count && objects[i + runLength] == object)
+      ++runLength;
+    i += runLength;
+    if (runLength == 1)
+      swift_retain(object);
+    else
+      swift_retain_n(object, (uint32_t)runLength);
+  }
+}
+
 static void _swift_release_(HeapObject *object) {
   SWIFT_RT_TRACK_INVOCATION(object, swift_release);
   if (isValidPointerForNativeRetain(object))
@@ -428,6 +445,23 @@ void swift::swift_nonatomic_release_n(HeapObject *object, uint32_t n) {
     object->refCounts.decrementAndMaybeDeinitNonAtomic(n);
 }
 
+void swift::swift_bulkRelease(HeapObject **objects, size_t count) {
+  size_t i = 0;
+  while (i < count) {
+    auto *object = objects[i];
+    // Coalesce a run of references to the same object into a single
+    // release-by-n, paying one atomic decrement for the whole run.
+    size_t runLength = 1;
+    while (i + runLength < count && objects[i + runLength] == object)
+      ++runLength;
+    i += runLength;
+    if (runLength == 1)
+      swift_release(object);
+    else
+      swift_release_n(object, (uint32_t)runLength);
+  }
+}
+
 size_t swift::swift_retainCount(HeapObject *object) {
   if (isValidPointerForNativeRetain(object))
     return object->refCounts.getCount();
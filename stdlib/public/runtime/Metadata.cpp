@@ -364,8 +364,62 @@ namespace {
   };
 
   using LazyGenericMetadataCache = Lazy<GenericMetadataCache>;
+
+  /// A key into the global cache of fully-instantiated generic metadata,
+  /// consisting of the type descriptor and the generic arguments.
+  struct CompleteGenericMetadataCacheKey {
+    const TypeContextDescriptor *Description;
+    MetadataCacheKey Key;
+
+    friend llvm::hash_code
+    hash_value(const CompleteGenericMetadataCacheKey &key) {
+      return llvm::hash_combine(key.Description, key.Key.hash());
+    }
+  };
+
+  /// An entry in the global cache of fully-instantiated generic metadata.
+  ///
+  /// The per-descriptor caches above have to support in-flight
+  /// instantiations, so lookups in them walk a concurrent tree. Metadata
+  /// which has reached MetadataState::Complete can never change again, so
+  /// it is republished here in a flat hash table whose snapshot-based
+  /// readers never take a lock or even write to shared memory. The stored
+  /// key refers to the persistent argument storage of the tree entry, which
+  /// is never deallocated or moved.
+  struct CompleteGenericMetadataCacheEntry {
+  private:
+    const TypeContextDescriptor *Description;
+    MetadataCacheKey Key;
+    Metadata *Value;
+
+  public:
+    CompleteGenericMetadataCacheEntry(CompleteGenericMetadataCacheKey key,
+                                      Metadata *value)
+        : Description(key.Description), Key(key.Key), Value(value) {}
+
+    bool matchesKey(const CompleteGenericMetadataCacheKey &key) const {
+      return Description == key.Description && Key == key.Key;
+    }
+
+    friend llvm::hash_code
+    hash_value(const CompleteGenericMetadataCacheEntry &entry) {
+      return llvm::hash_combine(entry.Description, entry.Key.hash());
+    }
+
+    template <class... Args>
+    static size_t getExtraAllocationSize(Args &&... ignored) {
+      return 0;
+    }
+
+    Metadata *getValue() const { return Value; }
+  };
 }
 
+/// The global cache of fully-instantiated generic metadata, the fast path
+/// of swift_getGenericMetadata.
+static Lazy<ConcurrentReadableHashMap<CompleteGenericMetadataCacheEntry>>
+    CompleteGenericMetadata;
+
 /// Fetch the metadata cache for a generic metadata structure.
 static GenericMetadataCache &getCache(
                                const TypeContextDescriptor &description) {
@@ -722,6 +776,26 @@ MetadataResponse swift::swift_getCanonicalSpecializedMetadata(
   auto &cache = getCache(*description);
   assert(description->getFullGenericContextHeader().Base.NumKeyArguments ==
          cache.NumKeyParameters + cache.NumWitnessTables);
+
+  const void *const *arguments =
+      reinterpret_cast<const void *const *>(candidate->getGenericArgs());
+  auto key = MetadataCacheKey(cache.NumKeyParameters, cache.NumWitnessTables,
+                              arguments);
+
+  // Check the global cache of complete instantiations first: if any other
+  // image has already published a record for these generic arguments,
+  // resolve this image's candidate to it without locking the per-descriptor
+  // cache.
+  auto &completeCache = CompleteGenericMetadata.get();
+  {
+    auto snapshot = completeCache.snapshot();
+    if (auto *entry = snapshot.find(
+            CompleteGenericMetadataCacheKey{description, key})) {
+      cachedMetadataAddr->store(entry->getValue(), std::memory_order_release);
+      return {entry->getValue(), MetadataState::Complete};
+    }
+  }
+
   if (auto *classDescription = dyn_cast<ClassDescriptor>(description)) {
     auto canonicalMetadataAccessors = classDescription->getCanonicalMetadataPrespecializationAccessors();
     for (auto &canonicalMetadataAccessorPtr : canonicalMetadataAccessors) {
@@ -749,12 +823,23 @@ MetadataResponse swift::swift_getCanonicalSpecializedMetadata(
       assert(result.second.Value == canonicalMetadata);
     }
   }
-  const void *const *arguments =
-      reinterpret_cast<const void *const *>(candidate->getGenericArgs());
-  auto key = MetadataCacheKey(cache.NumKeyParameters, cache.NumWitnessTables,
-                              arguments);
   auto result = cache.getOrInsert(key, request, candidate);
 
+  // Republish the resolved record so that candidate lookups from other
+  // images take the lock-free path above. The key refers to the persistent
+  // argument copy in the tree entry, not to the candidate's own storage.
+  if (result.second.State == MetadataState::Complete) {
+    CompleteGenericMetadataCacheKey cacheKey{description,
+                                             result.first->getKey()};
+    completeCache.getOrInsert(
+        cacheKey, [&](CompleteGenericMetadataCacheEntry *entry, bool created) {
+          if (created)
+            new (entry) CompleteGenericMetadataCacheEntry(
+                cacheKey, const_cast<Metadata *>(result.second.Value));
+          return created;
+        });
+  }
+
   cachedMetadataAddr->store(result.second.Value, std::memory_order_release);
 
   return result.second;
@@ -812,11 +897,39 @@ swift::swift_getGenericMetadata(MetadataRequest request,
          cache.NumKeyParameters + cache.NumWitnessTables);
   auto key = MetadataCacheKey(cache.NumKeyParameters, cache.NumWitnessTables,
                               arguments);
+
+  // Check the global cache of complete instantiations first. Complete
+  // metadata satisfies every request, and this path neither locks nor
+  // writes to shared memory.
+  auto &completeCache = CompleteGenericMetadata.get();
+  {
+    auto snapshot = completeCache.snapshot();
+    if (auto *entry = snapshot.find(
+            CompleteGenericMetadataCacheKey{description, key})) {
+      return {entry->getValue(), MetadataState::Complete};
+    }
+  }
+
   auto result = cache.getOrInsert(key, request, description, arguments);
 
   assert(
       !result.second.Value->isCanonicalStaticallySpecializedGenericMetadata());
 
+  // Once an instantiation is complete it can never change again, so
+  // republish it in the global cache. The key refers to the persistent
+  // argument copy in the tree entry, not to the caller's buffer.
+  if (result.second.State == MetadataState::Complete) {
+    CompleteGenericMetadataCacheKey cacheKey{description,
+                                             result.first->getKey()};
+    completeCache.getOrInsert(
+        cacheKey, [&](CompleteGenericMetadataCacheEntry *entry, bool created) {
+          if (created)
+            new (entry) CompleteGenericMetadataCacheEntry(
+                cacheKey, const_cast<Metadata *>(result.second.Value));
+          return created;
+        });
+  }
+
   return result.second;
 }
 
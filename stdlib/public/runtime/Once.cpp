@@ -34,9 +34,56 @@ using namespace swift;
 #include <dispatch/dispatch.h>
 static_assert(std::is_same<swift_once_t, dispatch_once_t>::value,
               "swift_once_t and dispatch_once_t must stay in sync");
+#elif defined(__linux__)
+
+// On Linux, swift_once is implemented directly on the futex syscall so that
+// the contended path parks waiters in the kernel instead of spinning, and so
+// that the predicate reaches a known "done" value (-1) the compiler can
+// check inline. See SwiftTargetInfo.OnceDonePredicateValue.
+
+#include <atomic>
+#include <climits>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace {
+
+/// The states a swift_once_t moves through. It starts as zero-initialized
+/// static storage and never leaves OnceDone once it gets there.
+enum : intptr_t {
+  OnceNotStarted = 0,
+  OnceRunning = 1,
+  OnceRunningWithWaiters = 2,
+  OnceDone = -1,
+};
+
+} // end anonymous namespace
+
+/// The futex syscall operates on 32 bits; pick the half of the predicate
+/// that actually changes between our states.
+static uint32_t *futexWordFor(std::atomic<intptr_t> *predicate) {
+  auto *words = reinterpret_cast<uint32_t *>(predicate);
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  return words + (sizeof(intptr_t) / sizeof(uint32_t)) - 1;
+#else
+  return words;
+#endif
+}
+
+static void futexWait(std::atomic<intptr_t> *predicate, intptr_t expected) {
+  syscall(SYS_futex, futexWordFor(predicate), FUTEX_WAIT_PRIVATE,
+          static_cast<uint32_t>(expected), nullptr, nullptr, 0);
+}
+
+static void futexWakeAll(std::atomic<intptr_t> *predicate) {
+  syscall(SYS_futex, futexWordFor(predicate), FUTEX_WAKE_PRIVATE, INT_MAX,
+          nullptr, nullptr, 0);
+}
+
 #else
 
-// On non-Darwin platforms we do not assume any barrier-free inline path
+// On other platforms we do not assume any barrier-free inline path
 // and SwiftTargetInfo.OnceDonePredicateValue is unset in the compiler.
 
 #endif
@@ -61,6 +108,35 @@ void swift::swift_once(swift_once_t *predicate, void (*fn)(void *),
   dispatch_once_f(predicate, context, fn);
 #elif defined(__CYGWIN__)
   _swift_once_f(predicate, context, fn);
+#elif defined(__linux__)
+  auto *state = reinterpret_cast<std::atomic<intptr_t> *>(predicate);
+  static_assert(sizeof(*state) == sizeof(swift_once_t),
+                "swift_once_t must match its atomic view");
+
+  intptr_t current = OnceNotStarted;
+  if (state->compare_exchange_strong(current, OnceRunning,
+                                     std::memory_order_acquire)) {
+    // We won the race to run the initializer.
+    fn(context);
+
+    // Publish completion. If anybody went to sleep in the meantime, wake
+    // the whole herd; they all just recheck the predicate.
+    if (state->exchange(OnceDone, std::memory_order_release) ==
+        OnceRunningWithWaiters)
+      futexWakeAll(state);
+    return;
+  }
+
+  // Somebody else is running (or has run) the initializer; park until the
+  // predicate reaches the done state.
+  while (current != OnceDone) {
+    if (current == OnceRunning &&
+        !state->compare_exchange_weak(current, OnceRunningWithWaiters,
+                                      std::memory_order_acquire))
+      continue;
+    futexWait(state, OnceRunningWithWaiters);
+    current = state->load(std::memory_order_acquire);
+  }
 #else
   std::call_once(*predicate, [fn, context]() { fn(context); });
 #endif
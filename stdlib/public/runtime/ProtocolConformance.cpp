@@ -20,7 +20,9 @@
 #include "swift/Runtime/Concurrent.h"
 #include "swift/Runtime/HeapObject.h"
 #include "swift/Runtime/Metadata.h"
+#include "swift/Runtime/Mutex.h"
 #include "swift/Basic/Unreachable.h"
+#include "llvm/ADT/DenseMap.h"
 #include "CompatibilityOverride.h"
 #include "ImageInspection.h"
 #include "Private.h"
@@ -238,7 +240,23 @@ namespace {
 struct ConformanceState {
   ConcurrentReadableHashMap<ConformanceCacheEntry> Cache;
   ConcurrentReadableArray<ConformanceSection> SectionsToScan;
-  
+
+  /// Lazily built index over all scanned conformance records, grouped by the
+  /// protocol they conform to, so that a cache miss only has to visit the
+  /// records of the queried protocol instead of every record in every loaded
+  /// image. Access MUST be protected using `ProtocolIndexLock`.
+  Mutex ProtocolIndexLock;
+  llvm::DenseMap<const ProtocolDescriptor *,
+                 std::vector<const ProtocolConformanceDescriptor *>>
+      ProtocolIndex;
+
+  /// The number of leading entries of SectionsToScan which have already been
+  /// merged into ProtocolIndex. Sections are only ever appended, so the
+  /// remaining ones can be merged incrementally after an image is loaded.
+  /// Access MUST be protected using `ProtocolIndexLock`.
+  size_t IndexedSectionCount = 0;
+
+
   ConformanceState() {
     initializeProtocolConformanceLookup();
   }
@@ -467,23 +485,40 @@ swift_conformsToProtocolImpl(const Metadata *const type,
 
   // Scan conformance records.
   auto snapshot = C.SectionsToScan.snapshot();
-  for (auto &section : snapshot) {
-    // Eagerly pull records for nondependent witnesses into our cache.
-    for (const auto &record : section) {
-      auto &descriptor = *record.get();
 
-      // We only care about conformances for this protocol.
-      if (descriptor.getProtocol() != protocol)
-        continue;
-
-      // If there's a matching type, record the positive result and return it.
-      // The matching type is exact, so they can't go stale, and we should
-      // always cache them.
-      ConformanceCandidate candidate(descriptor);
-      if (auto *matchingType = candidate.getMatchingType(type)) {
-        auto witness = descriptor.getWitnessTable(matchingType);
-        C.cacheResult(matchingType, protocol, witness, /*always cache*/ 0);
+  // Bring the per-protocol index up to date and pull out the records for the
+  // queried protocol. The records are copied out so that the candidate
+  // matching below runs without holding the lock; instantiating a witness
+  // table can re-enter the runtime.
+  std::vector<const ProtocolConformanceDescriptor *> candidates;
+  {
+    ScopedLock guard(C.ProtocolIndexLock);
+    if (C.IndexedSectionCount < snapshot.count()) {
+      size_t sectionIdx = 0;
+      for (auto &section : snapshot) {
+        if (sectionIdx++ < C.IndexedSectionCount)
+          continue;
+        for (const auto &record : section)
+          C.ProtocolIndex[record.get()->getProtocol()].push_back(record.get());
       }
+      C.IndexedSectionCount = snapshot.count();
+    }
+    auto indexed = C.ProtocolIndex.find(protocol);
+    if (indexed != C.ProtocolIndex.end())
+      candidates = indexed->second;
+  }
+
+  // Eagerly pull records for nondependent witnesses into our cache.
+  for (const auto *recordDescriptor : candidates) {
+    auto &descriptor = *recordDescriptor;
+
+    // If there's a matching type, record the positive result and return it.
+    // The matching type is exact, so they can't go stale, and we should
+    // always cache them.
+    ConformanceCandidate candidate(descriptor);
+    if (auto *matchingType = candidate.getMatchingType(type)) {
+      auto witness = descriptor.getWitnessTable(matchingType);
+      C.cacheResult(matchingType, protocol, witness, /*always cache*/ 0);
     }
   }
 
@@ -11,9 +11,49 @@
 //===----------------------------------------------------------------------===//
 
 #include "swift/Runtime/HeapObject.h"
+#include "swift/Runtime/Mutex.h"
+
+#include <new>
 
 namespace swift {
 
+// A LIFO cache of freed side table entries. All side table entries have the
+// same size, so the cache is simply a singly-linked list threaded through
+// the freed cells. It is capped so that a burst of weak references does not
+// hold memory forever, and LIFO reuse tends to hand back cells that are
+// still warm in cache. Entries that miss the cache fall back to the
+// general-purpose allocator.
+static StaticMutex SideTableFreeListLock;
+static void *SideTableFreeList = nullptr;
+static uint32_t SideTableFreeListCount = 0;
+static const uint32_t SideTableFreeListMaxCount = 128;
+
+void *HeapObjectSideTableEntry::operator new(size_t size) {
+  assert(size == sizeof(HeapObjectSideTableEntry));
+  {
+    StaticScopedLock lock(SideTableFreeListLock);
+    if (void *cell = SideTableFreeList) {
+      SideTableFreeList = *reinterpret_cast<void **>(cell);
+      --SideTableFreeListCount;
+      return cell;
+    }
+  }
+  return ::operator new(size);
+}
+
+void HeapObjectSideTableEntry::operator delete(void *p) {
+  if (p) {
+    StaticScopedLock lock(SideTableFreeListLock);
+    if (SideTableFreeListCount < SideTableFreeListMaxCount) {
+      *reinterpret_cast<void **>(p) = SideTableFreeList;
+      SideTableFreeList = p;
+      ++SideTableFreeListCount;
+      return;
+    }
+  }
+  ::operator delete(p);
+}
+
 template <typename RefCountBits>
 void RefCounts<RefCountBits>::incrementSlow(RefCountBits oldbits,
                                             uint32_t n) {
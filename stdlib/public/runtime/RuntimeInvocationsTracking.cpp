@@ -21,6 +21,8 @@
 #include "swift/Runtime/HeapObject.h"
 #include "swift/Runtime/Mutex.h"
 
+#include <atomic>
+
 #if defined(SWIFT_ENABLE_RUNTIME_FUNCTION_COUNTERS)
 
 #define SWIFT_RT_FUNCTION_INVOCATION_COUNTER_NAME(RT_FUNCTION)                 \
@@ -37,6 +39,17 @@ struct RuntimeFunctionCountersState {
 #include "RuntimeInvocationsTracking.def"
 };
 
+// One cache-line-padded shard of the global counters. Threads spread their
+// updates over the shards, so concurrent increments from different CPUs
+// neither serialize on a lock nor bounce a single cache line around.
+struct alignas(64) RuntimeFunctionCountersShard {
+#define FUNCTION_TO_TRACK(RT_FUNCTION)                                         \
+  std::atomic<uint32_t> SWIFT_RT_FUNCTION_INVOCATION_COUNTER_NAME(             \
+      RT_FUNCTION) = {0};
+// Provide one counter per runtime function being tracked.
+#include "RuntimeInvocationsTracking.def"
+};
+
 } // end namespace swift
 
 
@@ -46,12 +59,24 @@ static bool UpdatePerObjectRuntimeFunctionCounters = false;
 static bool UpdateGlobalRuntimeFunctionCounters = false;
 /// TODO: Add support for enabling/disabling counters on a per object basis?
 
-/// Global set of counters tracking the total number of runtime invocations.
-struct RuntimeFunctionCountersStateSentinel {
-  RuntimeFunctionCountersState State;
-  StaticReadWriteLock Lock;
-};
-static RuntimeFunctionCountersStateSentinel RuntimeGlobalFunctionCountersState;
+/// The number of shards the global counters are split over.
+static constexpr unsigned NumGlobalCounterShards = 16;
+
+/// Global set of counters tracking the total number of runtime invocations,
+/// sharded so that concurrent updates stay cheap. The total for a counter is
+/// the sum over all shards.
+static RuntimeFunctionCountersShard
+    RuntimeGlobalFunctionCountersShards[NumGlobalCounterShards];
+
+/// Return the shard to be updated by the current thread. The address of a
+/// local variable is used as a cheap proxy for the identity of the current
+/// thread: it lies on this thread's stack, so it requires neither TLS nor a
+/// syscall to obtain.
+static unsigned currentCounterShard() {
+  char threadMarker;
+  return (reinterpret_cast<uintptr_t>(&threadMarker) >> 12) %
+         NumGlobalCounterShards;
+}
 
 /// The object state cache mapping objects to the collected state associated with
 /// them.
@@ -84,6 +109,31 @@ enum RuntimeFunctionNamesIDs : uint32_t {
 static RuntimeFunctionCountersUpdateHandler
     GlobalRuntimeFunctionCountersUpdateHandler;
 
+/// If non-zero, approximately every Nth tracked invocation records the code
+/// address the runtime function was called from.
+static std::atomic<uint32_t> RuntimeFunctionCallSiteSamplingRate = {0};
+/// Invocations remaining until the next call site is sampled.
+static std::atomic<uint32_t> RuntimeFunctionCallSiteSamplingCountdown = {0};
+
+/// Sampled call sites, mapping the caller's code address to the number of
+/// samples attributed to it, per runtime function being tracked.
+struct RuntimeCallSiteCacheSentinel {
+  llvm::DenseMap<void *, uint64_t> Cache[ID_LastRuntimeFunctionName];
+  StaticReadWriteLock Lock;
+};
+static Lazy<RuntimeCallSiteCacheSentinel> RuntimeCallSiteCache;
+
+/// Record one sampled call site of a tracked runtime function. Only hit once
+/// every sampling-rate invocations, so taking a lock here is fine.
+static void sampleRuntimeFunctionCallSite(uint32_t functionID,
+                                          void *callSite) {
+  if (!callSite)
+    return;
+  auto &theSentinel = RuntimeCallSiteCache.get();
+  StaticScopedWriteLock lock(theSentinel.Lock);
+  ++theSentinel.Cache[functionID][callSite];
+}
+
 /// The offsets of the runtime function counters being tracked inside the
 /// RuntimeObjectState structure. The array is indexed by
 /// the enumerators from RuntimeFunctionNamesIDs.
@@ -101,9 +151,26 @@ static uint16_t RuntimeFunctionCountersOffsets[] = {
   void SWIFT_RT_TRACK_INVOCATION_NAME(RT_FUNCTION)(HeapObject * object) {      \
     /* Update global counters. */                                              \
     if (UpdateGlobalRuntimeFunctionCounters) {                                 \
-      StaticScopedWriteLock lock(RuntimeGlobalFunctionCountersState.Lock);     \
-      RuntimeGlobalFunctionCountersState.State                                 \
-          .SWIFT_RT_FUNCTION_INVOCATION_COUNTER_NAME(RT_FUNCTION)++;           \
+      /* Only this thread's shard is touched: a relaxed increment with no */   \
+      /* lock and no cache line shared with other CPUs. */                     \
+      RuntimeGlobalFunctionCountersShards[currentCounterShard()]               \
+          .SWIFT_RT_FUNCTION_INVOCATION_COUNTER_NAME(RT_FUNCTION)              \
+          .fetch_add(1, std::memory_order_relaxed);                            \
+      auto samplingRate = RuntimeFunctionCallSiteSamplingRate.load(            \
+          std::memory_order_relaxed);                                          \
+      if (samplingRate &&                                                      \
+          RuntimeFunctionCallSiteSamplingCountdown.fetch_sub(                  \
+              1, std::memory_order_relaxed) == 1) {                            \
+        RuntimeFunctionCallSiteSamplingCountdown.store(                        \
+            samplingRate, std::memory_order_relaxed);                          \
+        /* Level 0 is inside the runtime function this helper is called */     \
+        /* from; level 1 is the address the runtime function itself was */     \
+        /* called from. Walking that extra frame relies on frame        */     \
+        /* pointers, which are preserved on the platforms where these   */     \
+        /* counters are used. */                                               \
+        sampleRuntimeFunctionCallSite(RT_FUNCTION_ID(RT_FUNCTION),             \
+                                      __builtin_return_address(1));            \
+      }                                                                        \
       if (GlobalRuntimeFunctionCountersUpdateHandler) {                        \
         auto oldGlobalMode = _swift_setGlobalRuntimeFunctionCountersMode(0);   \
         auto oldPerObjectMode =                                                \
@@ -144,19 +211,38 @@ void _swift_setObjectRuntimeFunctionCounters(
   theSentinel.Cache[object] = *state;
 }
 
-/// Get the global runtime state containing the total numbers of invocations for
-/// each runtime function of interest.
+/// Get the global runtime state containing the total numbers of invocations
+/// for each runtime function of interest. The total for each counter is the
+/// sum over all of its shards.
 void _swift_getGlobalRuntimeFunctionCounters(
     RuntimeFunctionCountersState *result) {
-  StaticScopedReadLock lock(RuntimeGlobalFunctionCountersState.Lock);
-  *result = RuntimeGlobalFunctionCountersState.State;
+  *result = RuntimeFunctionCountersState();
+  for (auto &shard : RuntimeGlobalFunctionCountersShards) {
+#define FUNCTION_TO_TRACK(RT_FUNCTION)                                         \
+    result->SWIFT_RT_FUNCTION_INVOCATION_COUNTER_NAME(RT_FUNCTION) +=          \
+        shard.SWIFT_RT_FUNCTION_INVOCATION_COUNTER_NAME(RT_FUNCTION).load(     \
+            std::memory_order_relaxed);
+#include "RuntimeInvocationsTracking.def"
+  }
 }
 
 /// Set the global runtime state of function pointers from a provided state.
+/// The provided totals are stored into the first shard and the remaining
+/// shards are zeroed, preserving the invariant that the total is the sum
+/// over all shards.
 void _swift_setGlobalRuntimeFunctionCounters(
     RuntimeFunctionCountersState *state) {
-  StaticScopedWriteLock lock(RuntimeGlobalFunctionCountersState.Lock);
-  RuntimeGlobalFunctionCountersState.State = *state;
+  for (unsigned i = 0; i < NumGlobalCounterShards; ++i) {
+#define FUNCTION_TO_TRACK(RT_FUNCTION)                                         \
+    RuntimeGlobalFunctionCountersShards[i]                                     \
+        .SWIFT_RT_FUNCTION_INVOCATION_COUNTER_NAME(RT_FUNCTION)                \
+        .store(i == 0                                                          \
+                   ? state->SWIFT_RT_FUNCTION_INVOCATION_COUNTER_NAME(         \
+                         RT_FUNCTION)                                          \
+                   : 0,                                                        \
+               std::memory_order_relaxed);
+#include "RuntimeInvocationsTracking.def"
+  }
 }
 
 /// Return the names of the runtime functions being tracked.
@@ -216,6 +302,30 @@ int _swift_setPerObjectRuntimeFunctionCountersMode(int mode) {
   return oldMode;
 }
 
+/// Set the sampling rate for recording the call sites of tracked runtime
+/// functions and return the old rate. A rate of N records approximately
+/// every Nth invocation; a rate of 0 disables call site sampling.
+uint32_t _swift_setRuntimeFunctionCallSiteSamplingRate(uint32_t rate) {
+  auto oldRate =
+      RuntimeFunctionCallSiteSamplingRate.load(std::memory_order_relaxed);
+  RuntimeFunctionCallSiteSamplingCountdown.store(rate,
+                                                 std::memory_order_relaxed);
+  RuntimeFunctionCallSiteSamplingRate.store(rate, std::memory_order_relaxed);
+  return oldRate;
+}
+
+/// Dump all sampled runtime function call sites.
+void _swift_dumpRuntimeFunctionCallSites() {
+  auto &theSentinel = RuntimeCallSiteCache.get();
+  StaticScopedReadLock lock(theSentinel.Lock);
+  for (unsigned id = 0; id < ID_LastRuntimeFunctionName; ++id) {
+    for (auto &Pair : theSentinel.Cache[id]) {
+      printf("%s called from %p: %llu samples\n", RuntimeFunctionNames[id],
+             Pair.getFirst(), (unsigned long long)Pair.getSecond());
+    }
+  }
+}
+
 /// Add the ability to call custom handlers when a counter
 /// is being updated. The handler should take the object and may be
 /// the name of the runtime function as parameters. And this handler
@@ -105,6 +105,16 @@ SWIFT_RUNTIME_EXPORT void
 _swift_setObjectRuntimeFunctionCounters(HeapObject *object,
                                         RuntimeFunctionCountersState *state);
 
+/// Set the sampling rate for recording the call sites of tracked runtime
+/// functions. A rate of N records the calling code address of approximately
+/// every Nth invocation; a rate of 0 disables call site sampling.
+/// Return the old value of the rate.
+SWIFT_RUNTIME_EXPORT uint32_t
+_swift_setRuntimeFunctionCallSiteSamplingRate(uint32_t rate);
+
+/// Dump all sampled runtime function call sites.
+SWIFT_RUNTIME_EXPORT void _swift_dumpRuntimeFunctionCallSites();
+
 /// Set the global runtime function counters update handler.
 SWIFT_RUNTIME_EXPORT RuntimeFunctionCountersUpdateHandler
 _swift_setGlobalRuntimeFunctionCountersUpdateHandler(
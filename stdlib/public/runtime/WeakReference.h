@@ -103,8 +103,24 @@ class WeakReferenceBits {
 #endif
   };
 
+  // Set in a native weak reference value once a load has observed the
+  // pointed-to object deiniting. Further loads can then return nil after a
+  // single load and compare of the weak reference itself, without touching
+  // the (potentially contended) side table entry again. The side table
+  // reference is still owned by the weak reference and is given up when the
+  // weak reference is destroyed or assigned, as usual.
+  // Side table entries are at least 8-byte aligned, so this bit is never set
+  // in a stored side table pointer.
+  enum : uintptr_t {
+    ZeroedMarkerBit = 4
+  };
+
   static_assert((NativeMarkerMask & NativeMarkerValue) == NativeMarkerValue,
                 "native marker value must fall within native marker mask");
+  static_assert((NativeMarkerMask & ZeroedMarkerBit) == 0,
+                "zeroed marker bit must not overlap the native marker");
+  static_assert(alignof(HeapObjectSideTableEntry) > ZeroedMarkerBit,
+                "zeroed marker bit must be clear in side table pointers");
   static_assert((NativeMarkerMask & heap_object_abi::SwiftSpareBitsMask)
                 == NativeMarkerMask,
                 "native marker mask must fall within Swift spare bits");
@@ -138,8 +154,20 @@ class WeakReferenceBits {
      assert(isNativeOrNull());
      if (bits == 0)
        return nullptr;
-     return reinterpret_cast<HeapObjectSideTableEntry *>(bits &
-                                                         ~NativeMarkerMask);
+     return reinterpret_cast<HeapObjectSideTableEntry *>(
+         bits & ~(NativeMarkerMask | ZeroedMarkerBit));
+   }
+
+   SWIFT_ALWAYS_INLINE
+   bool isZeroed() const {
+     return bits & ZeroedMarkerBit;
+   }
+
+   SWIFT_ALWAYS_INLINE
+   WeakReferenceBits zeroed() const {
+     auto newBits = *this;
+     newBits.bits |= ZeroedMarkerBit;
+     return newBits;
    }
 
    SWIFT_ALWAYS_INLINE
@@ -168,23 +196,47 @@ class WeakReference {
   }
   
   HeapObject *nativeLoadStrongFromBits(WeakReferenceBits bits) {
+    // If a previous load already observed the object deiniting, nil can be
+    // returned after this single load and compare of the reference itself,
+    // without consulting the side table entry again.
+    if (bits.isZeroed())
+      return nullptr;
+
     auto side = bits.getNativeOrNull();
-    return side ? side->tryRetain() : nullptr;
+    if (!side)
+      return nullptr;
+
+    if (auto object = side->tryRetain())
+      return object;
+
+    // The object is deiniting or gone. Mark the reference as zeroed so that
+    // subsequent loads take the fast path above instead of re-probing the
+    // (potentially contended) side table entry. This only races with other
+    // loads doing the same marking, so a failed exchange needs no retry.
+    // The side table reference itself is still owned by this weak reference
+    // and is given up on destruction or assignment as usual.
+    nativeValue.compare_exchange_strong(bits, bits.zeroed(),
+                                        std::memory_order_relaxed);
+    return nullptr;
   }
-  
+
   HeapObject *nativeTakeStrongFromBits(WeakReferenceBits bits) {
     auto side = bits.getNativeOrNull();
     if (side) {
       side->decrementWeak();
-      return side->tryRetain();
+      return bits.isZeroed() ? nullptr : side->tryRetain();
     } else {
       return nullptr;
     }
   }
-  
+
   void nativeCopyInitFromBits(WeakReferenceBits srcBits) {
     auto side = srcBits.getNativeOrNull();
-    if (side)
+    // Copying a reference which is already known to be zeroed does not need
+    // to register with the side table at all.
+    if (srcBits.isZeroed())
+      side = nullptr;
+    else if (side)
       side = side->incrementWeak();
 
     nativeValue.store(WeakReferenceBits(side), std::memory_order_relaxed);
@@ -29,6 +29,12 @@
 
 #include <type_traits>
 
+#if !defined(SWIFT_STDLIB_SINGLE_THREADED_RUNTIME)
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#endif
+
 #include "../SwiftShims/LibcShims.h"
 
 SWIFT_RUNTIME_STDLIB_INTERNAL
@@ -75,3 +81,54 @@ int _swift_stdlib_close(int fd) {
   return close(fd);
 #endif
 }
+
+SWIFT_RUNTIME_STDLIB_INTERNAL
+__swift_size_t _swift_stdlib_hardware_concurrency(void) {
+#if defined(SWIFT_STDLIB_SINGLE_THREADED_RUNTIME)
+  return 1;
+#else
+  unsigned count = std::thread::hardware_concurrency();
+  // hardware_concurrency() may return 0 when the value is not computable.
+  return count > 0 ? count : 1;
+#endif
+}
+
+SWIFT_RUNTIME_STDLIB_INTERNAL
+void _swift_stdlib_parallelFor(__swift_size_t chunkCount, void *context,
+                               void (*body)(void *context,
+                                            __swift_size_t chunkIndex)) {
+#if defined(SWIFT_STDLIB_SINGLE_THREADED_RUNTIME)
+  for (__swift_size_t i = 0; i < chunkCount; ++i)
+    body(context, i);
+#else
+  if (chunkCount <= 1) {
+    if (chunkCount == 1)
+      body(context, 0);
+    return;
+  }
+
+  // Chunks are claimed from a shared counter rather than pre-partitioned,
+  // so threads that finish cheap chunks early move on to the remaining
+  // ones instead of idling.
+  std::atomic<__swift_size_t> next(0);
+  auto worker = [&] {
+    __swift_size_t i;
+    while ((i = next.fetch_add(1, std::memory_order_relaxed)) < chunkCount)
+      body(context, i);
+  };
+
+  __swift_size_t numHelpers =
+      std::min<__swift_size_t>(_swift_stdlib_hardware_concurrency() - 1,
+                               chunkCount - 1);
+  // The runtime builds without exceptions, so avoid std::vector here; a
+  // plain array of threads needs no reallocation anyway.
+  std::thread *helpers =
+      numHelpers > 0 ? new std::thread[numHelpers] : nullptr;
+  for (__swift_size_t t = 0; t < numHelpers; ++t)
+    helpers[t] = std::thread(worker);
+  worker(); // The calling thread participates too.
+  for (__swift_size_t t = 0; t < numHelpers; ++t)
+    helpers[t].join();
+  delete[] helpers;
+#endif
+}
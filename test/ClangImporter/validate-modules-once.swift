@@ -0,0 +1,9 @@
+// RUN: %empty-directory(%t)
+// RUN: touch %t/Session.modvalidation
+// RUN: %target-swift-frontend -typecheck %s -validate-clang-modules-once -clang-build-session-file %t/Session.modvalidation -module-cache-path %t/mcp
+
+// The session file is required; validating "once" needs a session to key on.
+// RUN: not %target-swift-frontend -typecheck %s -validate-clang-modules-once 2>&1 | %FileCheck %s
+// CHECK: option '-validate-clang-modules-once' requires '-clang-build-session-file'
+
+func foo() {}
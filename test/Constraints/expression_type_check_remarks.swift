@@ -0,0 +1,7 @@
+// This file tests that -Rexpression-type-checking attaches a solver
+// statistics remark to each type-checked expression.
+// RUN: %target-typecheck-verify-swift -Rexpression-type-checking
+
+func add(_ x: Int, _ y: Int) -> Int {
+  return x + y // expected-remark {{type-checking expression took}}
+}
@@ -0,0 +1,36 @@
+#!/usr/bin/env python
+# decode-parseable-output-frames.py - Decode binary parseable output -*- python -*-
+#
+# This source file is part of the Swift.org open source project
+#
+# Copyright (c) 2014 - 2021 Apple Inc. and the Swift project authors
+# Licensed under Apache License v2.0 with Runtime Library Exception
+#
+# See https://swift.org/LICENSE.txt for license information
+# See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+#
+# Reads the driver's binary parseable-output stream ('SWPM' magic, little-
+# endian 32-bit payload length, JSON payload) from stdin and prints each
+# payload preceded by a "frame N bytes" line, for FileCheck consumption.
+
+from __future__ import print_function
+
+import struct
+import sys
+
+stream = getattr(sys.stdin, 'buffer', sys.stdin)
+
+while True:
+    header = stream.read(8)
+    if not header:
+        break
+    if len(header) != 8 or header[:4] != b'SWPM':
+        print("error: malformed frame header", file=sys.stderr)
+        sys.exit(1)
+    length = struct.unpack('<I', header[4:])[0]
+    payload = stream.read(length)
+    if len(payload) != length:
+        print("error: truncated frame payload", file=sys.stderr)
+        sys.exit(1)
+    print("frame %d bytes" % length)
+    print(payload.decode('utf-8'))
@@ -0,0 +1,14 @@
+// RUN: echo "-typecheck %s" | %swift_driver_plain -frontend-server | %FileCheck %s
+// RUN: (echo "-typecheck %s"; echo "-typecheck %S/Inputs/nonexistent-file.swift") | %swift_driver_plain -frontend-server | %FileCheck -check-prefix=CHECK-MIXED %s
+
+// UNSUPPORTED: OS=windows-msvc
+
+// The server reports one exit code line per submitted job and keeps serving
+// after a failed job.
+
+// CHECK: 0
+
+// CHECK-MIXED: 0
+// CHECK-MIXED-NEXT: 1
+
+func f() {}
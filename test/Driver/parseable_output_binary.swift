@@ -0,0 +1,21 @@
+// RUN: %swiftc_driver_plain -emit-executable %s -o %t.out -parseable-output -parseable-output-format binary -driver-skip-execution 2>%t.stream
+// RUN: %{python} %S/Inputs/decode-parseable-output-frames.py < %t.stream | %FileCheck %s
+
+// RUN: not %swiftc_driver_plain -emit-executable %s -o %t.out -parseable-output -parseable-output-format frames -driver-skip-execution 2>&1 | %FileCheck -check-prefix=INVALID %s
+
+// XFAIL: freebsd, openbsd
+
+// Each frame is 'SWPM', a little-endian 32-bit payload length, and the same
+// JSON payload the textual format carries.
+
+// CHECK: frame {{[1-9][0-9]*}} bytes
+// CHECK-NEXT: {
+// CHECK-NEXT: "kind": "began",
+// CHECK-NEXT: "name": "compile",
+
+// CHECK: "kind": "began",
+// CHECK: "name": "link",
+
+// INVALID: invalid value 'frames' in '-parseable-output-format frames'
+
+public func foo() {}
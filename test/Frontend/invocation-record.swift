@@ -0,0 +1,12 @@
+// RUN: %empty-directory(%t)
+
+// 1. Writing a record captures the frontend arguments, minus the record
+//    flag itself.
+// RUN: %target-swift-frontend -typecheck %s -save-invocation-record %t/record.resp
+// RUN: %FileCheck %s --implicit-check-not save-invocation-record < %t/record.resp
+// CHECK: -typecheck
+
+// 2. The record is a replayable response file.
+// RUN: %target-swift-frontend @%t/record.resp
+
+public func foo() {}
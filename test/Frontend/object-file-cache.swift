@@ -0,0 +1,16 @@
+// RUN: %empty-directory(%t)
+
+// 1. Compiling with -object-file-cache-dir populates the cache.
+// RUN: %target-swift-frontend -c %s -o %t/first.o -object-file-cache-dir %t/cache
+// RUN: ls %t/cache/*.o
+
+// 2. Recompiling the same input reuses the cached object rather than
+//    rerunning the backend. Replace the cached entry with a sentinel and
+//    check that it comes back out.
+// RUN: echo sentinel > $(ls %t/cache/*.o | head -n 1)
+// RUN: %target-swift-frontend -c %s -o %t/second.o -object-file-cache-dir %t/cache
+// RUN: grep sentinel %t/second.o
+
+public func foo() -> Int {
+  return 42
+}
@@ -0,0 +1,38 @@
+// RUN: %empty-directory(%t)
+
+// 1. Make sure you can't -emit-ir or -c when you're skipping all function bodies.
+
+// RUN: not %target-swift-frontend -emit-ir %s -experimental-skip-all-function-bodies 2>&1 | %FileCheck %s --check-prefix ERROR
+// RUN: not %target-swift-frontend -c %s -experimental-skip-all-function-bodies 2>&1 | %FileCheck %s --check-prefix ERROR
+// ERROR: does not support emitting IR
+
+// 2. Emit the SIL for the module. Unlike with
+//    -experimental-skip-non-inlinable-function-bodies, even inlinable bodies
+//    are skipped, so no body should make it through.
+
+// RUN: %target-swift-frontend -emit-sil -experimental-skip-all-function-bodies -emit-sorted-sil %s | %FileCheck %s --check-prefix CHECK-SIL
+
+// CHECK-SIL: sil_stage canonical
+
+@usableFromInline
+@inline(never)
+func _blackHole(_ s: String) {}
+
+@inlinable public func inlinableFunc() {
+  _blackHole("@inlinable func body") // CHECK-SIL-NOT: "@inlinable func body"
+}
+
+public func normalFunc() {
+  _blackHole("normal func body") // CHECK-SIL-NOT: "normal func body"
+}
+
+public struct Struct {
+  @inlinable public var inlinableVar: Int {
+    _blackHole("@inlinable getter body") // CHECK-SIL-NOT: "@inlinable getter body"
+    return 0
+  }
+
+  @_transparent public func transparentFunc() {
+    _blackHole("@_transparent func body") // CHECK-SIL-NOT: "@_transparent func body"
+  }
+}
@@ -0,0 +1,21 @@
+// RUN: %empty-directory(%t)
+// RUN: %target-swift-ide-test -batch-code-completion -source-filename %s -skip-filecheck -completion-stats-path %t/stats.json > /dev/null
+// RUN: %FileCheck %s < %t/stats.json
+
+struct MyStruct {
+    init() {}
+    var value: Int
+}
+
+let s = MyStruct()
+_ = s.#^MEMBER^#
+
+// CHECK: "tokens": [
+// CHECK: "name": "MEMBER"
+// CHECK: "num_results": 2
+// CHECK: "reused_astcontext":
+// CHECK: "latency_ms": {
+// CHECK: "count": 1
+// CHECK: "p50":
+// CHECK: "p95":
+// CHECK: "p99":
@@ -0,0 +1,14 @@
+// RUN: %target-swift-frontend -module-name main -emit-ir %s | %FileCheck %s
+
+// Without ObjC interop, fixed-layout class metadata requires no realization
+// step, so references to it are direct instead of calling the accessor.
+// UNSUPPORTED: objc_interop
+
+final class C {}
+
+// CHECK-LABEL: define{{.*}} @"$s4main8metatypeypXpyF"
+// CHECK-NOT: @"$s4main1CCMa"
+// CHECK: ret
+public func metatype() -> Any.Type {
+  return C.self
+}
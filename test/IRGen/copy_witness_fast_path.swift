@@ -0,0 +1,15 @@
+// RUN: %target-swift-frontend -module-name main -emit-ir %s | %FileCheck %s
+
+// Copies of unspecialized generic values take an inline memcpy fast path
+// when the value is dynamically known to be POD, and only fall back to the
+// indirect value witness call otherwise.
+
+// CHECK-LABEL: define{{.*}} @"$s4main4copyyxxlF"
+// CHECK: br i1 {{%.*}}, label %pod.copy, label %witness.copy
+// CHECK: pod.copy:
+// CHECK: call void @llvm.memcpy
+// CHECK: witness.copy:
+public func copy<T>(_ x: T) -> T {
+  let y = x
+  return y
+}
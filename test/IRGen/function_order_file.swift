@@ -0,0 +1,15 @@
+// RUN: %empty-directory(%t)
+// RUN: echo '$s4main1cyyF' > %t/order.txt
+// RUN: echo '$s4main1ayyF' >> %t/order.txt
+// RUN: %target-swift-frontend -module-name main -emit-ir -function-order-file %t/order.txt %s | %FileCheck %s
+
+// Functions named in the order file are emitted first, in the listed order;
+// everything else keeps its original relative order.
+
+// CHECK: define {{.*}}@"$s4main1cyyF"
+// CHECK: define {{.*}}@"$s4main1ayyF"
+// CHECK: define {{.*}}@"$s4main1byyF"
+
+public func a() {}
+public func b() {}
+public func c() {}
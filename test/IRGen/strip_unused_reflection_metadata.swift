@@ -0,0 +1,31 @@
+// RUN: %target-swift-frontend -emit-ir %s -module-name strip | %FileCheck %s --check-prefix=KEEP --check-prefix=KEEP-ALL
+// RUN: %target-swift-frontend -emit-ir %s -module-name strip -strip-unused-reflection-metadata | %FileCheck %s --check-prefix=KEEP --check-prefix=STRIP
+// RUN: %target-swift-frontend -emit-ir %s -module-name strip -strip-unused-reflection-metadata -D MIRROR | %FileCheck %s --check-prefix=KEEP --check-prefix=KEEP-ALL
+
+// Public types stay reflectable: other modules can Mirror their instances.
+public struct Exposed { public var x: Int }
+
+// Internal and unreflected: the field descriptor is stripped.
+struct Internal { var x: Int }
+
+// The attribute opts a type out of stripping.
+@_alwaysEmitReflectionMetadata
+struct Pinned { var x: Int }
+
+public func use() -> Int {
+  return Exposed(x: 0).x + Internal(x: 0).x + Pinned(x: 0).x
+}
+
+#if MIRROR
+// Any reference into the reflection machinery keeps all field descriptors.
+public func reflect(_ x: Any) -> Mirror {
+  return Mirror(reflecting: x)
+}
+#endif
+
+// KEEP-DAG: @"$s5strip7ExposedVMF" = internal constant
+// KEEP-DAG: @"$s5strip6PinnedVMF" = internal constant
+
+// KEEP-ALL-DAG: @"$s5strip8InternalVMF" = internal constant
+
+// STRIP-NOT: @"$s5strip8InternalVMF"
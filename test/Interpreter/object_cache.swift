@@ -0,0 +1,18 @@
+// RUN: %empty-directory(%t)
+// RUN: %target-jit-run %s -jit-object-cache-path %t/cache | %FileCheck %s
+
+// The first run populates the cache with the JITed object.
+// RUN: ls %t/cache/*.o
+
+// The second run reuses the cached object and behaves identically.
+// RUN: %target-jit-run %s -jit-object-cache-path %t/cache | %FileCheck %s
+
+// REQUIRES: swift_interpreter
+
+struct Greeting {
+  var who: String
+  func greet() -> String { return "Hello, \(who)" }
+}
+
+print(Greeting(who: "cache").greet())
+// CHECK: Hello, cache
@@ -369,6 +369,75 @@ bb1:
   ret void
 }
 
+@immortal_object = global %swift.refcounted zeroinitializer
+
+; Retains and releases of statically-allocated objects are no-ops.
+; CHECK-LABEL: @immortal_retain_release(
+; CHECK-NEXT: entry:
+; CHECK-NEXT: call void @user
+; CHECK-NEXT: ret void
+define void @immortal_retain_release() {
+entry:
+  tail call %swift.refcounted* @swift_retain(%swift.refcounted* @immortal_object)
+  tail call void @swift_release(%swift.refcounted* @immortal_object) nounwind
+  tail call %swift.refcounted* @swift_unknownObjectRetain(%swift.refcounted* @immortal_object)
+  tail call void @swift_unknownObjectRelease(%swift.refcounted* @immortal_object)
+  call void @user(%swift.refcounted* @immortal_object) nounwind
+  ret void
+}
+
+; A retain sinks through an unconditional branch into a block with no other
+; predecessors and cancels against the release there.
+; CHECK-LABEL: @cross_block_retain_release(
+; CHECK-NOT: swift_retain
+; CHECK-NOT: swift_release
+; CHECK: ret void
+define void @cross_block_retain_release(%swift.refcounted* %P) {
+entry:
+  tail call %swift.refcounted* @swift_retain(%swift.refcounted* %P)
+  br label %next
+next:
+  tail call void @swift_release(%swift.refcounted* %P) nounwind
+  call void @user(%swift.refcounted* %P) nounwind
+  ret void
+}
+
+; A release hoists through a chain of unconditional branches and cancels
+; against the retain at the top.
+; CHECK-LABEL: @cross_block_release_hoist(
+; CHECK-NOT: swift_retain
+; CHECK-NOT: swift_release
+; CHECK: ret void
+define void @cross_block_release_hoist(%swift.refcounted* %P, i64* %Q) {
+entry:
+  tail call %swift.refcounted* @swift_retain(%swift.refcounted* %P)
+  br label %middle
+middle:
+  store i64 0, i64* %Q
+  br label %last
+last:
+  tail call void @swift_release(%swift.refcounted* %P) nounwind
+  ret void
+}
+
+; No cross-block motion through a conditional branch: the release does not
+; run on the path through %other.
+; CHECK-LABEL: @cross_block_conditional_nopromotion(
+; CHECK: swift_retain
+; CHECK: swift_release
+; CHECK: ret void
+define void @cross_block_conditional_nopromotion(%swift.refcounted* %P, i1 %c) {
+entry:
+  tail call %swift.refcounted* @swift_retain(%swift.refcounted* %P)
+  br i1 %c, label %next, label %other
+other:
+  call void @user(%swift.refcounted* %P) nounwind
+  br label %next
+next:
+  tail call void @swift_release(%swift.refcounted* %P) nounwind
+  ret void
+}
+
 
 !llvm.dbg.cu = !{!1}
 !llvm.module.flags = !{!4}
@@ -0,0 +1,38 @@
+// RUN: %target-swift-emit-silgen -module-name lazy_objc_thunks -sdk %S/Inputs -I %S/Inputs -enable-source-import %s | %FileCheck -check-prefix=EAGER %s
+// RUN: %target-swift-emit-silgen -module-name lazy_objc_thunks -sdk %S/Inputs -I %S/Inputs -enable-source-import -enable-lazy-objc-thunks %s | %FileCheck -check-prefix=LAZY %s
+
+// REQUIRES: objc_interop
+
+import gizmo
+
+@objcMembers
+class Hoozit : Gizmo {
+  // Inferred-@objc, internal, no override or requirement: the foreign thunk
+  // is omitted under -enable-lazy-objc-thunks.
+  func internalMethod() {}
+
+  // Explicit @objc keeps its entry point.
+  @objc func explicitMethod() {}
+
+  // dynamic members are always dispatched through objc_msgSend.
+  dynamic func dynamicMethod() {}
+
+  // Public members may be called from Objective-C in other modules.
+  public func publicMethod() {}
+
+  // Overrides must keep their entry points for super dispatch.
+  override func frob() {}
+}
+
+// EAGER-DAG: sil private [thunk] [ossa] @$s16lazy_objc_thunks6HoozitC14internalMethodyyFTo
+// EAGER-DAG: sil private [thunk] [ossa] @$s16lazy_objc_thunks6HoozitC14explicitMethodyyFTo
+// EAGER-DAG: sil private [thunk] [ossa] @$s16lazy_objc_thunks6HoozitC13dynamicMethodyyFTo
+// EAGER-DAG: sil private [thunk] [ossa] @$s16lazy_objc_thunks6HoozitC12publicMethodyyFTo
+// EAGER-DAG: sil private [thunk] [ossa] @$s16lazy_objc_thunks6HoozitC4frobyyFTo
+
+// LAZY-NOT: @$s16lazy_objc_thunks6HoozitC14internalMethodyyFTo
+// LAZY-DAG: sil private [thunk] [ossa] @$s16lazy_objc_thunks6HoozitC14explicitMethodyyFTo
+// LAZY-DAG: sil private [thunk] [ossa] @$s16lazy_objc_thunks6HoozitC13dynamicMethodyyFTo
+// LAZY-DAG: sil private [thunk] [ossa] @$s16lazy_objc_thunks6HoozitC12publicMethodyyFTo
+// LAZY-DAG: sil private [thunk] [ossa] @$s16lazy_objc_thunks6HoozitC4frobyyFTo
+// LAZY-NOT: @$s16lazy_objc_thunks6HoozitC14internalMethodyyFTo
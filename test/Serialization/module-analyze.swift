@@ -0,0 +1,18 @@
+// RUN: %empty-directory(%t)
+// RUN: %target-swift-frontend -emit-module -o %t/main.swiftmodule %s
+// RUN: %swift-module-analyze %t/main.swiftmodule | %FileCheck %s
+
+// The block and record names come from the BLOCKINFO block the serializer
+// writes, so they track lib/Serialization/ModuleFormat.h automatically.
+
+// CHECK: main.swiftmodule: {{[0-9]+}} bytes
+// CHECK: Blocks:
+// CHECK-DAG: MODULE_BLOCK
+// CHECK-DAG: DECLS_AND_TYPES_BLOCK
+// CHECK: Records:
+// CHECK: DECLS_AND_TYPES_BLOCK/
+
+public struct S {
+  public var x: Int
+  public func f() -> Int { return x }
+}
@@ -0,0 +1,36 @@
+func magnitude(of value: Int) -> Int {
+  return value < 0 ? -value : value
+}
+
+let m = magnitude(of: -3)
+
+// Repeated cursor-info requests against an unmodified open document are
+// served from the cursor info cache; the cached response must be
+// indistinguishable from a freshly resolved one.
+
+// RUN: %sourcekitd-test -req=open %s -- %s \
+// RUN:   == -req=cursor -pos=1:6 %s -- %s \
+// RUN:   == -req=cursor -pos=1:6 %s -- %s \
+// RUN:   == -req=cursor -pos=5:9 %s -- %s \
+// RUN:   == -req=cursor -pos=1:6 %s -- %s | %FileCheck %s
+
+// CHECK: source.lang.swift.decl.function.free (1:6-1:30)
+// CHECK: magnitude(of:)
+// CHECK: s:13cursor_cached9magnitude2of
+// CHECK: (Int) -> Int
+// CHECK: <Declaration>func magnitude(of value: <Type usr="s:Si">Int</Type>) -&gt; <Type usr="s:Si">Int</Type></Declaration>
+
+// CHECK: source.lang.swift.decl.function.free (1:6-1:30)
+// CHECK: magnitude(of:)
+// CHECK: s:13cursor_cached9magnitude2of
+// CHECK: (Int) -> Int
+// CHECK: <Declaration>func magnitude(of value: <Type usr="s:Si">Int</Type>) -&gt; <Type usr="s:Si">Int</Type></Declaration>
+
+// CHECK: source.lang.swift.ref.function.free (1:6-1:30)
+// CHECK: magnitude(of:)
+
+// CHECK: source.lang.swift.decl.function.free (1:6-1:30)
+// CHECK: magnitude(of:)
+// CHECK: s:13cursor_cached9magnitude2of
+// CHECK: (Int) -> Int
+// CHECK: <Declaration>func magnitude(of value: <Type usr="s:Si">Int</Type>) -&gt; <Type usr="s:Si">Int</Type></Declaration>
@@ -0,0 +1,37 @@
+func foo() -> Int {
+  var aaa = 1 + 2
+  aaa = aaa + 3
+  if aaa == 3 { aaa = 4 }
+  return aaa
+}
+
+// Growing a selection one statement at a time within one session reuses the
+// cached analysis of the already-selected leading statements. The swept
+// results must match a fresh resolution of the same range.
+
+// RUN: %sourcekitd-test -req=range -pos=2:3 -end-pos=3:16 %s -- %s == \
+// RUN:   -req=range -pos=2:3 -end-pos=4:26 %s -- %s == \
+// RUN:   -req=range -pos=2:3 -end-pos=5:13 %s -- %s | %FileCheck %s -check-prefix=CHECK-SWEEP
+
+// RUN: %sourcekitd-test -req=range -pos=2:3 -end-pos=5:13 %s -- %s | %FileCheck %s -check-prefix=CHECK-WHOLE
+
+// CHECK-SWEEP: <kind>source.lang.swift.range.multistatement</kind>
+// CHECK-SWEEP: <content>var aaa = 1 + 2
+// CHECK-SWEEP:   aaa = aaa + 3</content>
+
+// CHECK-SWEEP: <kind>source.lang.swift.range.multistatement</kind>
+// CHECK-SWEEP: <content>var aaa = 1 + 2
+// CHECK-SWEEP:   aaa = aaa + 3
+// CHECK-SWEEP:   if aaa == 3 { aaa = 4 }</content>
+
+// CHECK-SWEEP: <kind>source.lang.swift.range.multistatement</kind>
+// CHECK-SWEEP: <content>var aaa = 1 + 2
+// CHECK-SWEEP:   aaa = aaa + 3
+// CHECK-SWEEP:   if aaa == 3 { aaa = 4 }
+// CHECK-SWEEP:   return aaa</content>
+
+// CHECK-WHOLE: <kind>source.lang.swift.range.multistatement</kind>
+// CHECK-WHOLE: <content>var aaa = 1 + 2
+// CHECK-WHOLE:   aaa = aaa + 3
+// CHECK-WHOLE:   if aaa == 3 { aaa = 4 }
+// CHECK-WHOLE:   return aaa</content>
@@ -0,0 +1,2 @@
+/* plain block note */
+func f() { }
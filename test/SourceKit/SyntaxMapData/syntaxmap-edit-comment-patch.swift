@@ -0,0 +1,56 @@
+// RUN: %sourcekitd-test -req=open -print-raw-response %S/Inputs/syntaxmap-edit-comment-patch.swift == -req=edit -print-raw-response %S/Inputs/syntaxmap-edit-comment-patch.swift -pos=1:10 -replace="big " -length=0 == -req=edit -print-raw-response %S/Inputs/syntaxmap-edit-comment-patch.swift -pos=1:10 -replace="q:" -length=0 | %sed_clean > %t.response
+// RUN: %FileCheck -input-file=%t.response %s
+
+// Initial state
+
+// CHECK: {{^}}{
+// CHECK-NEXT: key.offset: 0,
+// CHECK-NEXT: key.length: 36,
+// CHECK-NEXT: key.diagnostic_stage: source.diagnostic.stage.swift.parse,
+// CHECK-NEXT: key.syntaxmap: [
+// CHECK-NEXT:   {
+// CHECK-NEXT:     key.kind: source.lang.swift.syntaxtype.comment,
+// CHECK-NEXT:     key.offset: 0,
+// CHECK-NEXT:     key.length: 22
+// CHECK-NEXT:   },
+// CHECK-NEXT:   {
+// CHECK-NEXT:     key.kind: source.lang.swift.syntaxtype.keyword,
+// CHECK-NEXT:     key.offset: 23,
+// CHECK-NEXT:     key.length: 4
+// CHECK-NEXT:   },
+// CHECK-NEXT:   {
+// CHECK-NEXT:     key.kind: source.lang.swift.syntaxtype.identifier,
+// CHECK-NEXT:     key.offset: 28,
+// CHECK-NEXT:     key.length: 1
+// CHECK-NEXT:   }
+// CHECK-NEXT: ],
+
+// Inserting plain text inside the comment body is absorbed as a patch of the
+// comment token; the response is identical in shape to a reparsed one.
+
+// CHECK: {{^}}{
+// CHECK-NEXT: key.offset: 0,
+// CHECK-NEXT: key.length: 26,
+// CHECK-NEXT: key.diagnostic_stage: source.diagnostic.stage.swift.parse,
+// CHECK-NEXT: key.syntaxmap: [
+// CHECK-NEXT:   {
+// CHECK-NEXT:     key.kind: source.lang.swift.syntaxtype.comment,
+// CHECK-NEXT:     key.offset: 0,
+// CHECK-NEXT:     key.length: 26
+// CHECK-NEXT:   }
+// CHECK-NEXT: ],
+
+// Inserting a ':' could form comment markup, so this edit takes the full
+// reparse path; the client-visible result has the same shape.
+
+// CHECK: {{^}}{
+// CHECK-NEXT: key.offset: 0,
+// CHECK-NEXT: key.length: 28,
+// CHECK-NEXT: key.diagnostic_stage: source.diagnostic.stage.swift.parse,
+// CHECK-NEXT: key.syntaxmap: [
+// CHECK-NEXT:   {
+// CHECK-NEXT:     key.kind: source.lang.swift.syntaxtype.comment,
+// CHECK-NEXT:     key.offset: 0,
+// CHECK-NEXT:     key.length: 28
+// CHECK-NEXT:   }
+// CHECK-NEXT: ],
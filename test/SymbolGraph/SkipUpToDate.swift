@@ -0,0 +1,24 @@
+// RUN: %empty-directory(%t)
+// RUN: %target-build-swift %s -module-name SkipUpToDate -emit-module -emit-module-path %t/
+
+// The first extraction emits the symbol graph.
+// RUN: %target-swift-symbolgraph-extract -module-name SkipUpToDate -I %t -pretty-print -output-dir %t -skip-up-to-date 2>&1 | %FileCheck %s --check-prefix=EMIT
+
+// A second extraction skips the up-to-date output.
+// RUN: %target-swift-symbolgraph-extract -module-name SkipUpToDate -I %t -pretty-print -output-dir %t -skip-up-to-date 2>&1 | %FileCheck %s --check-prefix=SKIP
+
+// A module file newer than the output makes it stale again.
+// RUN: %{python} -c 'import os, sys, time; t = time.time() + 10; os.utime(sys.argv[1], (t, t))' %t/SkipUpToDate.swiftmodule
+// RUN: %target-swift-symbolgraph-extract -module-name SkipUpToDate -I %t -pretty-print -output-dir %t -skip-up-to-date 2>&1 | %FileCheck %s --check-prefix=EMIT
+
+// RUN: %FileCheck %s < %t/SkipUpToDate.symbols.json
+
+// EMIT: Emitting symbol graph for module file:
+// EMIT-NOT: is up to date; skipping.
+// SKIP: Symbol graph for SkipUpToDate is up to date; skipping.
+
+public struct S {
+  public func foo() {}
+}
+
+// CHECK: "precise": "s:12SkipUpToDate1SV"
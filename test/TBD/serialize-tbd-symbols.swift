@@ -0,0 +1,15 @@
+// REQUIRES: VENDOR=apple
+// RUN: %empty-directory(%t)
+
+// RUN: echo 'public class Foo {}' > %t/foo.swift
+// RUN: %target-swift-frontend -emit-module %t/foo.swift -emit-module-path %t/foo.swiftmodule -serialize-module-tbd-symbols
+
+// The symbols of a module built with -serialize-module-tbd-symbols are
+// re-emitted from its swiftmodule rather than recomputed from its AST.
+// RUN: %target-swift-frontend -typecheck %s -emit-tbd -emit-tbd-path %t/embed.tbd -I %t -embed-tbd-for-module foo -module-name main
+// RUN: %FileCheck %s < %t/embed.tbd
+
+import foo
+
+// CHECK-DAG: $s3foo3FooCMa
+// CHECK-DAG: $s3foo3FooCN
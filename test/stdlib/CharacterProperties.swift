@@ -201,6 +201,42 @@ CharacterPropertiesTests.test("Whitespace") {
   expectTrue(Character("\u{3000}").isWhitespace)
 }
 
+CharacterPropertiesTests.test("ASCII classification agreement") {
+  // The ASCII classification fast paths must agree with the scalar property
+  // data, exhaustively.
+  for cu in (0 as UInt32)..<0x80 {
+    let scalar = Unicode.Scalar(cu)!
+    let props = scalar.properties
+    let c = Character(scalar)
+
+    expectEqual(props.isWhitespace, c.isWhitespace, "U+\(cu)")
+    expectEqual(props.isAlphabetic, c.isLetter, "U+\(cu)")
+    expectEqual(props.numericType != nil, c.isNumber, "U+\(cu)")
+    expectEqual(
+      props.numericValue.flatMap { Int(exactly: $0) },
+      c.wholeNumberValue,
+      "U+\(cu)")
+    expectEqual(props.isUppercase, c.isUppercase, "U+\(cu)")
+    expectEqual(props.isLowercase, c.isLowercase, "U+\(cu)")
+    expectEqual(props.isCased, c.isCased, "U+\(cu)")
+
+    let category = props.generalCategory
+    expectEqual(
+      category == .mathSymbol || category == .currencySymbol
+        || category == .modifierSymbol || category == .otherSymbol,
+      c.isSymbol,
+      "U+\(cu)")
+    expectEqual(category == .currencySymbol, c.isCurrencySymbol, "U+\(cu)")
+    expectEqual(
+      category == .connectorPunctuation || category == .dashPunctuation
+        || category == .openPunctuation || category == .closePunctuation
+        || category == .initialPunctuation || category == .finalPunctuation
+        || category == .otherPunctuation,
+      c.isPunctuation,
+      "U+\(cu)")
+  }
+}
+
 CharacterPropertiesTests.test("Newline") {
   expectTrue(Character("\n").isNewline)
   expectTrue(Character("\r").isNewline)
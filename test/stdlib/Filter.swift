@@ -95,4 +95,28 @@ FilterTests.test("chained filter order") {
   expectEqual(result.count, 0)
 }
 
+FilterTests.test("materialization over contiguous storage") {
+  // The contiguous fast path and the iterator path must agree, for both
+  // whole arrays and slices, and the predicate must still run once per
+  // element.
+  var count = 0
+  let array = Array(0..<100)
+  let filtered = Array(array.lazy.filter { count += 1; return $0 % 7 == 0 })
+  expectEqual((0..<100).filter { $0 % 7 == 0 }, filtered)
+  expectEqual(100, count)
+
+  let slice = array[10..<40]
+  expectEqual(
+    (10..<40).filter { $0 % 3 == 0 },
+    Array(slice.lazy.filter { $0 % 3 == 0 }))
+
+  expectEqual([], Array(([] as [Int]).lazy.filter { _ in true }))
+
+  // Chained lazy stages have no contiguous storage and take the
+  // iterator path.
+  expectEqual(
+    [0, 28, 56, 84],
+    Array(array.lazy.filter { $0 % 7 == 0 }.filter { $0 % 4 == 0 }))
+}
+
 runAllTests()
@@ -100,5 +100,15 @@ print(Array(m1))
 // CHECK-NEXT: [2, 4, 6, 8]
 print(Array(m1))
 
+// Materializing a lazy map over contiguous storage (arrays and slices)
+// takes a fused single-pass copy; check it agrees with the iterator path.
+let base = Array(0..<6)
+// CHECK-NEXT: [0, 10, 20, 30, 40, 50]
+print(Array(base.lazy.map { $0 * 10 }))
+// CHECK-NEXT: [20, 30, 40]
+print(Array(base[2..<5].lazy.map { $0 * 10 }))
+// CHECK-NEXT: []
+print(Array(([] as [Int]).lazy.map { $0 }))
+
 // CHECK-NEXT: all done.
 print("all done.")
@@ -146,4 +146,37 @@ PrintTests.test("Printable") {
   expectPrinted("*", CChar32(42)!)
 }
 
+PrintTests.test("FormattedInto") {
+  let buffer = UnsafeMutableBufferPointer<UInt8>.allocate(capacity: 72)
+  defer { buffer.deallocate() }
+
+  func expectFormatted<T: BinaryInteger>(
+    _ expected: String, _ value: T,
+    radix: Int = 10, uppercase: Bool = false,
+    stackTrace: SourceLocStack = SourceLocStack(),
+    file: String = #file, line: UInt = #line
+  ) {
+    let length = value._formatted(
+      radix: radix, uppercase: uppercase, into: buffer)
+    let actual = String(decoding: buffer[..<length], as: UTF8.self)
+    expectEqual(
+      expected, actual,
+      stackTrace: stackTrace.pushIf(true, file: file, line: line))
+    expectEqual(
+      String(value, radix: radix, uppercase: uppercase), actual,
+      stackTrace: stackTrace.pushIf(true, file: file, line: line))
+  }
+
+  expectFormatted("0", Int(0))
+  expectFormatted("42", Int(42))
+  expectFormatted("-42", Int(-42))
+  expectFormatted("-9223372036854775808", Int64.min)
+  expectFormatted("18446744073709551615", UInt64.max)
+  expectFormatted("2a", UInt8(42), radix: 16)
+  expectFormatted("2A", UInt8(42), radix: 16, uppercase: true)
+  expectFormatted(
+    "1111111111111111111111111111111111111111111111111111111111111111",
+    UInt64.max, radix: 2)
+}
+
 runAllTests()
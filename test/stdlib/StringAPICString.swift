@@ -225,5 +225,37 @@ CStringTests.test("Substring.withCString") {
   }
 }
 
+CStringTests.test("String._withBorrowedCString") {
+  // Large enough to stay out of the small-string form, so the borrowed
+  // string actually reads the C buffer in place.
+  let contents = "borrowed c string, long enough to not be small"
+  var utf8 = Array(contents.utf8)
+  utf8.append(0)
+  utf8.withUnsafeBufferPointer { buf in
+    let cstr = UnsafeRawPointer(buf.baseAddress!)
+      .assumingMemoryBound(to: CChar.self)
+    let result = String._withBorrowedCString(cstr) { str -> Int in
+      expectEqual(contents, str)
+      expectEqual(contents.count, str.count)
+      expectTrue(str.hasPrefix("borrowed"))
+      return str.utf8.count
+    }
+    expectEqual(utf8.count - 1, result)
+
+    let unsafeResult = String._withUnsafeBorrowedCString(cstr) { str in
+      str == contents
+    }
+    expectTrue(unsafeResult)
+  }
+
+  // Invalid UTF-8 is rejected without calling the closure.
+  let (invalid, dealloc) = getIllFormedUTF8String1()
+  defer { dealloc() }
+  let invalidResult: Bool? = String._withBorrowedCString(
+    UnsafeRawPointer(invalid).assumingMemoryBound(to: CChar.self)
+  ) { _ in true }
+  expectNil(invalidResult)
+}
+
 runAllTests()
 
@@ -0,0 +1,64 @@
+// RUN: %target-run-simple-swift
+// REQUIRES: executable_test
+
+import StdlibUnittest
+
+var UnsafeAtomicsTests = TestSuite("UnsafeAtomics")
+
+UnsafeAtomicsTests.test("UnsafeAtomicInt") {
+  let storage = UnsafeMutablePointer<Int>.allocate(capacity: 1)
+  defer { storage.deallocate() }
+  storage.initialize(to: 0)
+
+  let atomic = _UnsafeAtomicInt(storage)
+  expectEqual(0, atomic.load())
+
+  atomic.store(42)
+  expectEqual(42, atomic.load())
+
+  expectEqual(42, atomic.exchange(7))
+  expectEqual(7, atomic.load())
+
+  expectEqual(7, atomic.fetchAndAdd(3))
+  expectEqual(10, atomic.load())
+  expectEqual(8, atomic.andAndFetch(0b1100))
+  expectEqual(9, atomic.orAndFetch(0b0001))
+  expectEqual(10, atomic.xorAndFetch(0b0011))
+
+  var expected = 11
+  expectFalse(atomic.compareExchange(expected: &expected, desired: 99))
+  expectEqual(10, expected)
+  expectTrue(atomic.compareExchange(expected: &expected, desired: 99))
+  expectEqual(99, atomic.load())
+}
+
+UnsafeAtomicsTests.test("UnsafeAtomicRawPointer") {
+  let storage =
+    UnsafeMutablePointer<UnsafeMutableRawPointer?>.allocate(capacity: 1)
+  defer { storage.deallocate() }
+  storage.initialize(to: nil)
+
+  var node1 = 0
+  var node2 = 0
+  let p1 = UnsafeMutableRawPointer(&node1)
+  let p2 = UnsafeMutableRawPointer(&node2)
+
+  let atomic = _UnsafeAtomicRawPointer(storage)
+  expectNil(atomic.load())
+
+  atomic.store(p1)
+  expectEqual(p1, atomic.load())
+
+  expectEqual(p1, atomic.exchange(nil))
+  expectNil(atomic.load())
+
+  var expected: UnsafeMutableRawPointer? = p2
+  expectFalse(atomic.compareExchange(expected: &expected, desired: p2))
+  expectNil(expected)
+  expectTrue(atomic.compareExchange(expected: &expected, desired: p2))
+  expectEqual(p2, atomic.load())
+
+  _atomicThreadFence()
+}
+
+runAllTests()
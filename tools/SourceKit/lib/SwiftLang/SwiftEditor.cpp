@@ -504,6 +504,78 @@ struct SwiftSyntaxMap {
     return Affected;
   }
 
+  /// Attempts to absorb replacing \p Len bytes at \p Offset with \p NewText
+  /// as a pure patch of this map, without relexing or reparsing: if the edit
+  /// falls strictly inside a single plain comment token and cannot form or
+  /// break any token boundary, the token is resized in place and the tokens
+  /// after it are shifted. \p Buffer is the document text before the edit.
+  ///
+  /// Returns the patched token, or nothing if the edit does not qualify.
+  llvm::Optional<SwiftSyntaxToken>
+  tryPatchForReplacement(unsigned Offset, unsigned Len, StringRef NewText,
+                         StringRef Buffer) {
+    // Find the last token starting at or before the replaced range.
+    auto Token = std::upper_bound(Tokens.begin(), Tokens.end(), Offset,
+                                  [](unsigned Off, const SwiftSyntaxToken &T) {
+                                    return Off < T.Offset;
+                                  });
+    if (Token == Tokens.begin())
+      return llvm::None;
+    --Token;
+    if (Token->isInvalid())
+      return llvm::None;
+
+    // The edit must stay strictly inside the token's body, keeping the
+    // comment delimiters intact.
+    switch (Token->Kind) {
+    case SyntaxNodeKind::CommentLine:
+      if (Offset < Token->Offset + 2 || Offset + Len > Token->endOffset())
+        return llvm::None;
+      break;
+    case SyntaxNodeKind::CommentBlock:
+      if (Offset < Token->Offset + 2 || Offset + Len > Token->endOffset() - 2)
+        return llvm::None;
+      break;
+    default:
+      // Editing any other kind of token can change lexical structure; leave
+      // it to a reparse.
+      return llvm::None;
+    }
+
+    // Newlines end line comments and change how clients split multi-line
+    // tokens; '*' and '/' can open or close block comments.
+    for (char C : NewText) {
+      if (C == '\n' || C == '\r' || C == '*' || C == '/')
+        return llvm::None;
+    }
+    // A deletion can join '*' and '/' (or '/' and '*') across the removed
+    // range; an insertion cannot, since the inserted text excludes both.
+    if (NewText.empty() && Offset + Len < Buffer.size()) {
+      char Prev = Buffer[Offset - 1];
+      char Next = Buffer[Offset + Len];
+      if ((Prev == '*' && Next == '/') || (Prev == '/' && Next == '*'))
+        return llvm::None;
+    }
+    // Comment bodies may carry nested markup tokens (MARK/TODO/FIXME fields
+    // and URLs), all of which require a ':'. If the post-edit token text has
+    // no ':' at all, the plain-comment classification is stable.
+    if (NewText.contains(':') ||
+        Buffer.slice(Token->Offset, Offset).contains(':') ||
+        Buffer.slice(Offset + Len, Token->endOffset()).contains(':'))
+      return llvm::None;
+
+    // Resize the edited token and shift the tokens after it.
+    for (auto Later = std::next(Token); Later != Tokens.end(); ++Later) {
+      if (NewText.size() >= Len)
+        Later->Offset += NewText.size() - Len;
+      else
+        Later->Offset -= Len - NewText.size();
+    }
+    Token->Length += NewText.size();
+    Token->Length -= Len;
+    return *Token;
+  }
+
   /// Passes each token in this SwiftSyntaxMap to the given \p Consumer
   void forEach(EditorConsumer &Consumer) {
     for (auto &Token: Tokens) {
@@ -1061,6 +1133,13 @@ struct SwiftEditorDocument::Implementation {
   SwiftSyntaxMap SyntaxMap;
   /// The minimal range of syntax highlighted tokens affected by the last edit
   llvm::Optional<SwiftEditorCharRange> AffectedRange;
+  /// The token the last edit was absorbed into as a pure syntax map patch,
+  /// if any. Set by \c replaceText, consumed by
+  /// \c reportIncrementalSyntaxPatch.
+  llvm::Optional<SwiftSyntaxToken> PatchedToken;
+  /// Whether \c SyntaxInfo predates edits that were absorbed as syntax map
+  /// patches and must be regenerated before it is used again
+  bool SyntaxInfoStale = false;
   /// Whether the last operation was an edit rather than a document open
   bool Edited;
   /// The syntax tree of the document
@@ -1888,7 +1967,7 @@ static void updateSemaInfo(RefPtr<SwiftDocumentSemanticInfo> SemanticInfo,
 
 ImmutableTextSnapshotRef SwiftEditorDocument::replaceText(
     unsigned Offset, unsigned Length, llvm::MemoryBuffer *Buf,
-    bool ProvideSemanticInfo, std::string &error) {
+    bool ProvideSemanticInfo, std::string &error, bool TrySyntaxMapPatch) {
 
   ImmutableTextSnapshotRef Snapshot;
   EditableTextBufferRef EditableBuffer;
@@ -1908,16 +1987,33 @@ ImmutableTextSnapshotRef SwiftEditorDocument::replaceText(
     Impl.Edited = true;
     llvm::StringRef Str = Buf->getBuffer();
 
+    // If the caller can serve the edit from a patched syntax map alone, try
+    // absorbing it as a pure patch before the buffer is updated (the patch
+    // check needs the pre-edit text). A successful patch keeps the map
+    // accurate without reparsing; the stale parser state is regenerated
+    // lazily by the next request that needs it.
+    Impl.PatchedToken = llvm::None;
+    if (TrySyntaxMapPatch) {
+      Impl.PatchedToken = Impl.SyntaxMap.tryPatchForReplacement(
+          Offset, Length, Str,
+          EditableBuffer->getSnapshot()->getBuffer()->getText());
+    }
+
     // Update the buffer itself
     Snapshot = EditableBuffer->replace(Offset, Length, Str);
 
-    // Update the old syntax map offsets to account for the replaced range.
-    // Also set the initial AffectedRange to cover any tokens that
-    // the replaced range intersected. This allows for clients that split
-    // multi-line tokens at line boundaries, and ensure all parts of these tokens
-    // will be cleared.
-    Impl.AffectedRange =
-        Impl.SyntaxMap.adjustForReplacement(Offset, Length, Str.size());
+    if (Impl.PatchedToken) {
+      Impl.AffectedRange = llvm::None;
+      Impl.SyntaxInfoStale = true;
+    } else {
+      // Update the old syntax map offsets to account for the replaced range.
+      // Also set the initial AffectedRange to cover any tokens that
+      // the replaced range intersected. This allows for clients that split
+      // multi-line tokens at line boundaries, and ensure all parts of these
+      // tokens will be cleared.
+      Impl.AffectedRange =
+          Impl.SyntaxMap.adjustForReplacement(Offset, Length, Str.size());
+    }
 
     // We need to release `AccessMtx` before calling into the ASTManager, since
     // it may call back to the editor for document state.
@@ -1984,6 +2080,7 @@ void SwiftEditorDocument::parse(ImmutableTextSnapshotRef Snapshot,
     new SwiftDocumentSyntaxInfo(CompInv, Snapshot, Args, Impl.FilePath));
 
   Impl.SyntaxInfo->parse();
+  Impl.SyntaxInfoStale = false;
 }
 
 static UIdent SemaDiagStage("source.diagnostic.stage.swift.sema");
@@ -2105,7 +2202,23 @@ SwiftEditorDocument::getSyntaxTree() const {
 std::string SwiftEditorDocument::getFilePath() const { return Impl.FilePath; }
 
 bool SwiftEditorDocument::hasUpToDateAST() const {
-  return Impl.SyntaxInfo->hasUpToDateAST();
+  return !Impl.SyntaxInfoStale && Impl.SyntaxInfo->hasUpToDateAST();
+}
+
+bool SwiftEditorDocument::reportIncrementalSyntaxPatch(
+    EditorConsumer &Consumer) {
+  llvm::sys::ScopedLock L(Impl.AccessMtx);
+  if (!Impl.PatchedToken)
+    return false;
+  auto &Token = *Impl.PatchedToken;
+  // Report the patched token and an affected range covering it; the client
+  // has invalidated the intersected token on its side and re-adds it here.
+  Consumer.handleSyntaxMap(
+      Token.Offset, Token.Length,
+      SwiftLangSupport::getUIDForSyntaxNodeKind(Token.Kind));
+  Consumer.recordAffectedRange(Token.Offset, Token.Length);
+  Impl.PatchedToken = llvm::None;
+  return true;
 }
 
 llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem>
@@ -2485,15 +2598,29 @@ void SwiftLangSupport::editorReplaceText(StringRef Name,
       StringRef PreEditTextRef(BufferStart + Offset, Length);
       PreEditText = PreEditTextRef.str();
     }
+    // Syntax-map-only edits can sometimes be absorbed as a pure patch of the
+    // previous token index, with no reparse at all. Consumers that need the
+    // syntax tree, the document structure, or semantic info always require a
+    // reparse, as does syntax tree validation.
+    bool TrySyntaxMapPatch =
+        !ValidateSyntaxTree && !Consumer.syntaxTreeEnabled() &&
+        !Consumer.documentStructureEnabled() && !Consumer.needsSemanticInfo();
+
     std::string error;
     Snapshot = EditorDoc->replaceText(Offset, Length, Buf,
-                                      Consumer.needsSemanticInfo(), error);
+                                      Consumer.needsSemanticInfo(), error,
+                                      TrySyntaxMapPatch);
     if (!Snapshot) {
       assert(error.size());
       Consumer.handleRequestError(error.c_str());
       return;
     }
 
+    if (EditorDoc->reportIncrementalSyntaxPatch(Consumer)) {
+      EditorDoc->readSemanticInfo(Snapshot, Consumer);
+      return;
+    }
+
     llvm::Optional<SyntaxParsingCache> SyntaxCache = llvm::None;
     if (EditorDoc->getSyntaxTree().hasValue()) {
       SyntaxCache.emplace(EditorDoc->getSyntaxTree().getValue());
@@ -2609,5 +2736,12 @@ void SwiftLangSupport::editorExpandPlaceholder(StringRef Name, unsigned Offset,
     return;
   }
 
+  if (!EditorDoc->hasUpToDateAST()) {
+    // An up-to-date AST is needed for placeholder expansion. If it does not
+    // exist, fall back to a full reparse of the file.
+    EditorDoc->parse(EditorDoc->getLatestSnapshot(), *this,
+                     /*BuildSyntaxTree=*/true);
+  }
+
   EditorDoc->expandPlaceholder(Offset, Length, Consumer);
 }
@@ -98,7 +98,13 @@ public:
   ImmutableTextSnapshotRef replaceText(unsigned Offset, unsigned Length,
                                        llvm::MemoryBuffer *Buf,
                                        bool ProvideSemanticInfo,
-                                       std::string &error);
+                                       std::string &error,
+                                       bool TrySyntaxMapPatch = false);
+
+  /// If the last edit applied by \c replaceText was absorbed as a pure patch
+  /// of the existing syntax map, report the patched token and its affected
+  /// range to \p Consumer and return true; the edit then needs no reparse.
+  bool reportIncrementalSyntaxPatch(EditorConsumer &Consumer);
 
   void updateSemaInfo();
 
@@ -253,6 +259,34 @@ struct SwiftCompletionCache
   ~SwiftCompletionCache();
 };
 
+/// Caches fully-rendered cursor-info responses for documents that are open in
+/// the editor, keyed by (file, offset, length) and validated against the
+/// document's latest snapshot and compiler arguments. Repeated requests
+/// against an unmodified document -- the common hover pattern -- are answered
+/// without building an AST.
+class SwiftCursorInfoCache
+    : public ThreadSafeRefCountedBase<SwiftCursorInfoCache> {
+  struct Implementation;
+  Implementation &Impl;
+
+public:
+  SwiftCursorInfoCache();
+  ~SwiftCursorInfoCache();
+
+  /// If a response previously recorded for \p Snap's buffer state covers this
+  /// request, passes it to \p Receiver and returns true.
+  bool serveFromCache(
+      StringRef File, unsigned Offset, unsigned Length, uint64_t ArgsHash,
+      ImmutableTextSnapshotRef Snap,
+      std::function<void(const RequestResult<CursorInfoData> &)> Receiver);
+
+  /// Records \p Info as the response for this request, replacing any cached
+  /// responses that were recorded against older states of the document.
+  void record(StringRef File, unsigned Offset, unsigned Length,
+              uint64_t ArgsHash, ImmutableTextSnapshotRef Snap,
+              const CursorInfoData &Info);
+};
+
 struct SwiftPopularAPI : public ThreadSafeRefCountedBase<SwiftPopularAPI> {
   llvm::StringMap<CodeCompletion::PopularityFactor> nameToFactor;
 };
@@ -303,6 +337,7 @@ class SwiftLangSupport : public LangSupport {
   std::shared_ptr<SwiftEditorDocumentFileMap> EditorDocuments;
   SwiftInterfaceGenMap IFaceGenContexts;
   ThreadSafeRefCntPtr<SwiftCompletionCache> CCCache;
+  ThreadSafeRefCntPtr<SwiftCursorInfoCache> CursorInfoCache;
   ThreadSafeRefCntPtr<SwiftPopularAPI> PopularAPI;
   CodeCompletion::SessionCacheMap CCSessions;
   ThreadSafeRefCntPtr<SwiftCustomCompletions> CustomCompletions;
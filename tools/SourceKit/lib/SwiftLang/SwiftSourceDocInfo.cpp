@@ -44,7 +44,10 @@
 #include "clang/Index/USRGeneration.h"
 #include "clang/Lex/Lexer.h"
 
+#include "llvm/ADT/Hashing.h"
+#include "llvm/Support/Allocator.h"
 #include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/StringSaver.h"
 
 #include <numeric>
 
@@ -1647,6 +1650,159 @@ static void resolveRange(SwiftLangSupport &Lang,
                                         llvm::vfs::getRealFileSystem());
 }
 
+//===----------------------------------------------------------------------===//
+// SwiftCursorInfoCache
+//===----------------------------------------------------------------------===//
+
+struct SwiftCursorInfoCache::Implementation {
+  /// An owned deep copy of a \c CursorInfoData response, which itself only
+  /// holds references into the resolving consumer's scratch storage.
+  class OwnedData {
+    llvm::BumpPtrAllocator Allocator;
+    std::vector<StringRef> OverrideUSRs;
+    std::vector<StringRef> AnnotatedRelatedDeclarations;
+    std::vector<StringRef> ModuleGroupArray;
+    CursorInfoData Data;
+
+  public:
+    explicit OwnedData(const CursorInfoData &Info) {
+      llvm::StringSaver Strings(Allocator);
+      auto copy = [&](StringRef Str) -> StringRef {
+        return Str.empty() ? StringRef() : Strings.save(Str);
+      };
+      Data.InternalDiagnostic = copy(Info.InternalDiagnostic);
+      Data.Kind = Info.Kind;
+      Data.Name = copy(Info.Name);
+      Data.USR = copy(Info.USR);
+      Data.TypeName = copy(Info.TypeName);
+      Data.TypeUSR = copy(Info.TypeUSR);
+      Data.ContainerTypeUSR = copy(Info.ContainerTypeUSR);
+      Data.DocComment = copy(Info.DocComment);
+      Data.TypeInterface = copy(Info.TypeInterface);
+      Data.GroupName = copy(Info.GroupName);
+      Data.LocalizationKey = copy(Info.LocalizationKey);
+      Data.AnnotatedDeclaration = copy(Info.AnnotatedDeclaration);
+      Data.FullyAnnotatedDeclaration = copy(Info.FullyAnnotatedDeclaration);
+      Data.ModuleName = copy(Info.ModuleName);
+      Data.ModuleInterfaceName = copy(Info.ModuleInterfaceName);
+      Data.DeclarationLoc = Info.DeclarationLoc;
+      Data.Filename = copy(Info.Filename);
+      for (StringRef USR : Info.OverrideUSRs)
+        OverrideUSRs.push_back(copy(USR));
+      Data.OverrideUSRs = OverrideUSRs;
+      for (StringRef Related : Info.AnnotatedRelatedDeclarations)
+        AnnotatedRelatedDeclarations.push_back(copy(Related));
+      Data.AnnotatedRelatedDeclarations = AnnotatedRelatedDeclarations;
+      for (StringRef Group : Info.ModuleGroupArray)
+        ModuleGroupArray.push_back(copy(Group));
+      Data.ModuleGroupArray = ModuleGroupArray;
+      assert(Info.AvailableActions.empty() &&
+             "refactoring actions are not cached");
+      Data.IsSystem = Info.IsSystem;
+      Data.ParentNameOffset = Info.ParentNameOffset;
+    }
+
+    OwnedData(const OwnedData &) = delete;
+    OwnedData &operator=(const OwnedData &) = delete;
+
+    const CursorInfoData &get() const { return Data; }
+  };
+
+  struct CachedResponse {
+    unsigned Offset;
+    unsigned Length;
+    std::shared_ptr<OwnedData> Response;
+  };
+
+  /// Responses recorded against a single state of a single document. The
+  /// whole set is discarded as soon as the document or its compiler arguments
+  /// change.
+  struct FileCache {
+    ImmutableTextSnapshotRef Snapshot;
+    uint64_t ArgsHash;
+    SmallVector<CachedResponse, 4> Responses;
+  };
+
+  /// Bound on the number of distinct cursor locations remembered per
+  /// document state.
+  static const unsigned MaxResponsesPerFile = 16;
+
+  llvm::sys::Mutex Mtx;
+  llvm::StringMap<FileCache> FileCaches;
+
+  /// Returns the cache for \p File if it still describes \p Snap's buffer
+  /// state and \p ArgsHash; otherwise drops any stale cache and returns null.
+  /// Must be called with \c Mtx held.
+  FileCache *getUpToDateCache(StringRef File, uint64_t ArgsHash,
+                              ImmutableTextSnapshotRef Snap) {
+    auto It = FileCaches.find(File);
+    if (It == FileCaches.end())
+      return nullptr;
+    FileCache &Cache = It->second;
+    if (Cache.ArgsHash == ArgsHash && Cache.Snapshot->isFromSameBuffer(Snap) &&
+        Cache.Snapshot->getStamp() == Snap->getStamp())
+      return &Cache;
+    FileCaches.erase(It);
+    return nullptr;
+  }
+};
+
+SwiftCursorInfoCache::SwiftCursorInfoCache() : Impl(*new Implementation()) {}
+SwiftCursorInfoCache::~SwiftCursorInfoCache() { delete &Impl; }
+
+bool SwiftCursorInfoCache::serveFromCache(
+    StringRef File, unsigned Offset, unsigned Length, uint64_t ArgsHash,
+    ImmutableTextSnapshotRef Snap,
+    std::function<void(const RequestResult<CursorInfoData> &)> Receiver) {
+  std::shared_ptr<Implementation::OwnedData> Response;
+  {
+    llvm::sys::ScopedLock L(Impl.Mtx);
+    auto *Cache = Impl.getUpToDateCache(File, ArgsHash, Snap);
+    if (!Cache)
+      return false;
+    for (auto &Cached : Cache->Responses) {
+      if (Cached.Offset == Offset && Cached.Length == Length) {
+        Response = Cached.Response;
+        break;
+      }
+    }
+  }
+  if (!Response)
+    return false;
+  LOG_INFO_FUNC(High, "serving cursor info from cache");
+  Receiver(RequestResult<CursorInfoData>::fromResult(Response->get()));
+  return true;
+}
+
+void SwiftCursorInfoCache::record(StringRef File, unsigned Offset,
+                                  unsigned Length, uint64_t ArgsHash,
+                                  ImmutableTextSnapshotRef Snap,
+                                  const CursorInfoData &Info) {
+  // Do not pin failures; the retry-with-up-to-date-AST logic in resolveCursor
+  // may do better next time. Refactoring actions are not cached because their
+  // availability is not part of the cache key.
+  if (!Info.InternalDiagnostic.empty() || !Info.AvailableActions.empty())
+    return;
+  auto Response = std::make_shared<Implementation::OwnedData>(Info);
+  llvm::sys::ScopedLock L(Impl.Mtx);
+  auto *Cache = Impl.getUpToDateCache(File, ArgsHash, Snap);
+  if (!Cache) {
+    Cache = &Impl.FileCaches[File];
+    Cache->Snapshot = Snap;
+    Cache->ArgsHash = ArgsHash;
+    Cache->Responses.clear();
+  }
+  for (auto &Cached : Cache->Responses) {
+    if (Cached.Offset == Offset && Cached.Length == Length) {
+      Cached.Response = std::move(Response);
+      return;
+    }
+  }
+  if (Cache->Responses.size() == Implementation::MaxResponsesPerFile)
+    Cache->Responses.erase(Cache->Responses.begin());
+  Cache->Responses.push_back({Offset, Length, std::move(Response)});
+}
+
 void SwiftLangSupport::getCursorInfo(
     StringRef InputFile, unsigned Offset, unsigned Length, bool Actionables,
     bool CancelOnSubsequentRequest, ArrayRef<const char *> Args,
@@ -1687,6 +1843,23 @@ void SwiftLangSupport::getCursorInfo(
     return;
   }
 
+  // A document that is open in the editor tells us cheaply whether it has
+  // changed since a previous request. Serve repeated requests against an
+  // unmodified document from the cursor info cache, without any AST work.
+  ImmutableTextSnapshotRef CacheSnap;
+  uint64_t ArgsHash = 0;
+  if (!Actionables && !vfsOptions.hasValue()) {
+    if (auto EditorDoc = EditorDocuments->findByPath(InputFile))
+      CacheSnap = EditorDoc->getLatestSnapshot();
+  }
+  if (CacheSnap) {
+    for (const char *Arg : Args)
+      ArgsHash = llvm::hash_combine(ArgsHash, StringRef(Arg));
+    if (CursorInfoCache->serveFromCache(InputFile, Offset, Length, ArgsHash,
+                                        CacheSnap, Receiver))
+      return;
+  }
+
   std::string Error;
   SwiftInvocationRef Invok =
       ASTMgr->getInvocation(Args, InputFile, fileSystem, Error);
@@ -1696,6 +1869,21 @@ void SwiftLangSupport::getCursorInfo(
     return;
   }
 
+  if (CacheSnap) {
+    // Record the rendered response so that subsequent requests against this
+    // same document state can skip AST resolution entirely.
+    IntrusiveRefCntPtr<SwiftCursorInfoCache> Cache = CursorInfoCache;
+    std::string File = InputFile.str();
+    auto ClientReceiver = std::move(Receiver);
+    Receiver = [Cache, File, Offset, Length, ArgsHash, CacheSnap,
+                ClientReceiver](const RequestResult<CursorInfoData> &Result) {
+      if (!Result.isError() && !Result.isCancelled())
+        Cache->record(File, Offset, Length, ArgsHash, CacheSnap,
+                      Result.value());
+      ClientReceiver(Result);
+    };
+  }
+
   resolveCursor(*this, InputFile, Offset, Length, Actionables, Invok,
                 /*TryExistingAST=*/true, CancelOnSubsequentRequest, fileSystem,
                 Receiver);
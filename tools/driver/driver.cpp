@@ -45,11 +45,16 @@
 #include "llvm/Support/TargetSelect.h"
 #include "llvm/Support/raw_ostream.h"
 
+#include <iostream>
 #include <memory>
 #include <stdlib.h>
+#include <string>
 
 #if defined(_WIN32)
 #include <windows.h>
+#else
+#include <sys/wait.h>
+#include <unistd.h>
 #endif
 
 using namespace swift;
@@ -126,6 +131,56 @@ static bool shouldRunAsSubcommand(StringRef ExecName,
   return true;
 }
 
+/// Run a persistent frontend compile server.
+///
+/// Reads one frontend job per line from stdin — each line is tokenized like a
+/// response file and interpreted as the arguments of a `-frontend` invocation
+/// — and writes the job's exit code to stdout as a line. The server process
+/// pays the fixed startup cost (loading the executable and its dependent
+/// libraries, LLVM initialization) once; on POSIX platforms every job runs in
+/// a fork of the warmed-up process, so jobs inherit a copy-on-write snapshot
+/// of that state and crashes stay isolated from the server and from other
+/// jobs. On platforms without fork, jobs run sequentially in-process.
+static int run_frontend_server(const char *argv0, void *mainAddr) {
+  llvm::BumpPtrAllocator allocator;
+  llvm::StringSaver saver(allocator);
+
+  std::string line;
+  while (std::getline(std::cin, line)) {
+    SmallVector<const char *, 64> jobArgs;
+    llvm::cl::TokenizeGNUCommandLine(line, saver, jobArgs);
+    if (jobArgs.empty())
+      continue;
+
+    int result;
+#if defined(_WIN32)
+    result = performFrontend(jobArgs, argv0, mainAddr);
+#else
+    pid_t pid = fork();
+    if (pid < 0) {
+      llvm::errs() << "error: unable to fork frontend job ("
+                   << llvm::sys::StrError() << ")\n";
+      return 2;
+    }
+    if (pid == 0) {
+      // Use _exit to skip the server's atexit handlers; the job's own
+      // cleanup has already happened inside performFrontend.
+      _exit(performFrontend(jobArgs, argv0, mainAddr));
+    }
+    int status = 0;
+    if (waitpid(pid, &status, 0) < 0) {
+      llvm::errs() << "error: unable to wait for frontend job ("
+                   << llvm::sys::StrError() << ")\n";
+      return 2;
+    }
+    result = WIFEXITED(status) ? WEXITSTATUS(status) : 2;
+#endif
+    llvm::outs() << result << '\n';
+    llvm::outs().flush();
+  }
+  return 0;
+}
+
 static int run_driver(StringRef ExecName,
                        const ArrayRef<const char *> argv) {
   // Handle integrated tools.
@@ -136,6 +191,10 @@ static int run_driver(StringRef ExecName,
                                                 argv.data()+argv.size()),
                              argv[0], (void *)(intptr_t)getExecutablePath);
     }
+    if (FirstArg == "-frontend-server") {
+      return run_frontend_server(argv[0],
+                                 (void *)(intptr_t)getExecutablePath);
+    }
     if (FirstArg == "-modulewrap") {
       return modulewrap_main(llvm::makeArrayRef(argv.data()+2,
                                                 argv.data()+argv.size()),
@@ -72,6 +72,11 @@ SkipSynthesizedMembers("skip-synthesized-members",
                        llvm::cl::desc("Skip members inherited through classes or default implementations"),
                        llvm::cl::cat(Category));
 
+static llvm::cl::opt<bool>
+SkipUpToDate("skip-up-to-date",
+             llvm::cl::desc("Do not regenerate symbol graph files that are newer than the module file"),
+             llvm::cl::cat(Category));
+
 static llvm::cl::opt<std::string>
 MinimumAccessLevel("minimum-access-level", llvm::cl::desc("Include symbols with this access level or more"), llvm::cl::cat(Category));
 
@@ -193,6 +198,7 @@ int swift_symbolgraph_extract_main(ArrayRef<const char *> Args, const char *Argv
     options::PrettyPrint,
     AccessLevel::Public,
     !options::SkipSynthesizedMembers,
+    options::SkipUpToDate,
   };
 
   if (!options::MinimumAccessLevel.empty()) {
@@ -175,6 +175,10 @@ class SDKContext {
   std::vector<BreakingAttributeInfo> BreakingAttrs;
   // The common version of two ABI/API descriptors under comparison.
   Optional<uint8_t> CommonVersion;
+  // Memoized results of isEqual. The node trees are immutable once loaded,
+  // and the matchers compare the same subtree pairs repeatedly, so an
+  // unchanged module's subtree is only walked the first time it is seen.
+  llvm::DenseMap<std::pair<const SDKNode *, const SDKNode *>, bool> EqualCache;
 public:
   // Define the set of known identifiers.
 #define IDENTIFIER_WITH_NAME(Name, IdStr) StringRef Id_##Name = IdStr;
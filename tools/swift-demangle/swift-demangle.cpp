@@ -74,6 +74,11 @@ static llvm::cl::opt<bool>
 Classify("classify",
            llvm::cl::desc("Display symbol classification characters"));
 
+static llvm::cl::opt<bool>
+BulkMode("bulk",
+           llvm::cl::desc("Bulk mode (read the whole input at once and scan "
+                          "it for mangled names; faster on large inputs)"));
+
 /// Options that are primarily used for testing.
 /// \{
 static llvm::cl::opt<bool> DisplayLocalNameContexts(
@@ -223,6 +228,72 @@ static void demangle(llvm::raw_ostream &os, llvm::StringRef name,
   DCtx.clear();
 }
 
+/// Returns true if \p c can appear in a mangled name.
+///
+/// This matches the character class used by the symbol regex in
+/// demangleSTDIN().
+static bool isSymbolChar(char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+         (c >= '0' && c <= '9') || c == '_' || c == '$' || c == '.';
+}
+
+/// If a mangled name can start at the beginning of \p text, returns the
+/// length of its mangling prefix, otherwise 0.
+static size_t getSymbolPrefixLength(llvm::StringRef text) {
+  size_t prefixLen = 0;
+  if (text.startswith("_T") || text.startswith("$S") || text.startswith("$s"))
+    prefixLen = 2;
+  else if (text.startswith("_$S") || text.startswith("_$s"))
+    prefixLen = 3;
+  // A prefix alone is not a symbol.
+  if (prefixLen == 0 || text.size() <= prefixLen ||
+      !isSymbolChar(text[prefixLen]))
+    return 0;
+  return prefixLen;
+}
+
+/// Demangles all mangled names found in the input, like demangleSTDIN(), but
+/// reads the whole input up front and finds symbols with a plain byte scan.
+///
+/// Large inputs like linker maps are mostly text that cannot start a mangled
+/// name; find_first_of skips over such stretches with a vectorized scan
+/// instead of running the per-line regex machinery.
+static int demangleBulkSTDIN(const swift::Demangle::DemangleOptions &options) {
+  auto input = llvm::MemoryBuffer::getSTDIN();
+  if (!input) {
+    llvm::errs() << "Error reading from stdin: " << input.getError().message()
+                 << '\n';
+    return EXIT_FAILURE;
+  }
+  llvm::StringRef contents = (*input)->getBuffer();
+
+  swift::Demangle::Context DCtx;
+  // Everything before this offset has already been written.
+  size_t emitted = 0;
+  size_t scanPos = 0;
+  while (scanPos < contents.size()) {
+    // Every mangling prefix starts with '_' or '$'.
+    size_t start = contents.find_first_of("_$", scanPos);
+    if (start == llvm::StringRef::npos)
+      break;
+    size_t prefixLen = getSymbolPrefixLength(contents.substr(start));
+    if (prefixLen == 0) {
+      scanPos = start + 1;
+      continue;
+    }
+    size_t end = start + prefixLen;
+    while (end < contents.size() && isSymbolChar(contents[end]))
+      ++end;
+    llvm::outs() << contents.slice(emitted, start);
+    demangle(llvm::outs(), contents.slice(start, end), DCtx, options);
+    emitted = end;
+    scanPos = end;
+  }
+  llvm::outs() << contents.substr(emitted);
+
+  return EXIT_SUCCESS;
+}
+
 static int demangleSTDIN(const swift::Demangle::DemangleOptions &options) {
   // This doesn't handle Unicode symbols, but maybe that's okay.
   // Also accept the future mangling prefix.
@@ -264,6 +335,8 @@ int main(int argc, char **argv) {
 
   if (InputNames.empty()) {
     CompactMode = true;
+    if (BulkMode)
+      return demangleBulkSTDIN(options);
     return demangleSTDIN(options);
   } else {
     swift::Demangle::Context DCtx;
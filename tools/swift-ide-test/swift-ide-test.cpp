@@ -54,6 +54,7 @@
 #include "llvm/ADT/Statistic.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/FileSystem.h"
+#include "llvm/Support/JSON.h"
 #include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/PrettyStackTrace.h"
@@ -432,6 +433,12 @@ static llvm::cl::opt<bool>
 SkipFileCheck("skip-filecheck", llvm::cl::desc("Skip 'FileCheck' checking"),
                                 llvm::cl::cat(Category));
 
+static llvm::cl::opt<std::string>
+CompletionStatsPath("completion-stats-path", llvm::cl::value_desc("path"),
+                    llvm::cl::desc("JSON file for per-token completion "
+                                   "latencies and result counts"),
+                    llvm::cl::cat(Category));
+
 // '-code-completion' options.
 
 static llvm::cl::opt<std::string>
@@ -1081,6 +1088,83 @@ removeCodeCompletionTokens(llvm::MemoryBuffer *Input,
                                               Input->getBufferIdentifier());
 }
 
+/// Forwards completion results to a PrintingCodeCompletionConsumer and
+/// remembers how many results were produced.
+class CountingPrintingCodeCompletionConsumer
+    : public ide::PrintingCodeCompletionConsumer {
+public:
+  unsigned NumResults = 0;
+
+  using PrintingCodeCompletionConsumer::PrintingCodeCompletionConsumer;
+
+  void handleResults(
+      MutableArrayRef<CodeCompletionResult *> Results) override {
+    NumResults = Results.size();
+    PrintingCodeCompletionConsumer::handleResults(Results);
+  }
+};
+
+/// The measurement of a single completion request in batch mode.
+struct CompletionTimingStat {
+  StringRef Name;
+  unsigned Offset;
+  double LatencyMS;
+  unsigned NumResults;
+  bool ReusedASTContext;
+};
+
+/// Writes the collected per-token measurements and the latency distribution
+/// of \p Stats to \p Path as JSON.
+static int writeCompletionStats(StringRef Path,
+                                ArrayRef<CompletionTimingStat> Stats) {
+  std::error_code EC;
+  llvm::raw_fd_ostream OS(Path, EC);
+  if (EC) {
+    llvm::errs() << "error: failed to create stats file: " << Path << "\n";
+    return 1;
+  }
+
+  std::vector<double> Latencies;
+  Latencies.reserve(Stats.size());
+  for (const auto &Stat : Stats)
+    Latencies.push_back(Stat.LatencyMS);
+  std::sort(Latencies.begin(), Latencies.end());
+
+  // Nearest-rank percentile on the sorted latencies.
+  auto percentile = [&](unsigned P) -> double {
+    assert(!Latencies.empty());
+    size_t Rank = (P * Latencies.size() + 99) / 100;
+    return Latencies[Rank == 0 ? 0 : Rank - 1];
+  };
+
+  llvm::json::OStream J(OS, /*IndentSize=*/2);
+  J.object([&] {
+    J.attributeArray("tokens", [&] {
+      for (const auto &Stat : Stats) {
+        J.object([&] {
+          J.attribute("name", Stat.Name);
+          J.attribute("offset", int64_t(Stat.Offset));
+          J.attribute("latency_ms", Stat.LatencyMS);
+          J.attribute("num_results", int64_t(Stat.NumResults));
+          J.attribute("reused_astcontext", Stat.ReusedASTContext);
+        });
+      }
+    });
+    if (!Latencies.empty()) {
+      J.attributeObject("latency_ms", [&] {
+        J.attribute("count", int64_t(Latencies.size()));
+        J.attribute("min", Latencies.front());
+        J.attribute("p50", percentile(50));
+        J.attribute("p95", percentile(95));
+        J.attribute("p99", percentile(99));
+        J.attribute("max", Latencies.back());
+      });
+    }
+  });
+  OS << "\n";
+  return 0;
+}
+
 } // namespace
 
 static int doBatchCodeCompletion(const CompilerInvocation &InitInvok,
@@ -1166,6 +1250,7 @@ static int doBatchCodeCompletion(const CompilerInvocation &InitInvok,
 
   // Process tokens.
   SmallVector<StringRef, 0> FailedTokens;
+  std::vector<CompletionTimingStat> Stats;
   for (const auto &Token : CCTokens) {
     if (!options::CodeCompletionToken.empty() &&
         options::CodeCompletionToken != Token.Name)
@@ -1205,14 +1290,15 @@ static int doBatchCodeCompletion(const CompilerInvocation &InitInvok,
     PrintingDiagnosticConsumer PrintDiags;
     auto completionStart = std::chrono::high_resolution_clock::now();
     bool wasASTContextReused = false;
+    unsigned numResults = 0;
     bool isSuccess = CompletionInst.performOperation(
         Invocation, /*Args=*/{}, FileSystem, completionBuffer.get(), Offset,
         Error, CodeCompletionDiagnostics ? &PrintDiags : nullptr,
         [&](CompilerInstance &CI, bool reusingASTContext) {
           // Create a CodeCompletionConsumer.
-          std::unique_ptr<ide::CodeCompletionConsumer> Consumer(
-              new ide::PrintingCodeCompletionConsumer(OS, IncludeKeywords,
-                                                      IncludeComments));
+          std::unique_ptr<CountingPrintingCodeCompletionConsumer> Consumer(
+              new CountingPrintingCodeCompletionConsumer(OS, IncludeKeywords,
+                                                         IncludeComments));
 
           // Create a factory for code completion callbacks that will feed the
           // Consumer.
@@ -1224,6 +1310,7 @@ static int doBatchCodeCompletion(const CompilerInvocation &InitInvok,
           auto *SF = CI.getCodeCompletionFile();
           performCodeCompletionSecondPass(*SF, *callbacksFactory);
           wasASTContextReused = reusingASTContext;
+          numResults = Consumer->NumResults;
         });
     auto completionEnd = std::chrono::high_resolution_clock::now();
     auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
@@ -1234,6 +1321,15 @@ static int doBatchCodeCompletion(const CompilerInvocation &InitInvok,
     llvm::errs() << "\n";
     OS.flush();
 
+    if (isSuccess) {
+      double latencyMS =
+          std::chrono::duration<double, std::milli>(completionEnd -
+                                                    completionStart)
+              .count();
+      Stats.push_back(
+          {Token.Name, Offset, latencyMS, numResults, wasASTContextReused});
+    }
+
     if (OutputDir.empty()) {
       // If output directory is not specified, print the results to STDOUT.
       llvm::outs() << ResultStr;
@@ -1299,6 +1395,11 @@ static int doBatchCodeCompletion(const CompilerInvocation &InitInvok,
     }
   }
 
+  if (!options::CompletionStatsPath.empty()) {
+    if (int result = writeCompletionStats(options::CompletionStatsPath, Stats))
+      return result;
+  }
+
   if (!FailedTokens.empty()) {
     llvm::errs() << "----\n";
     llvm::errs() << "Unexpected failures: ";
@@ -89,6 +89,57 @@ func dumpMetadataCacheNodes(
   }
 }
 
+func watchMetadataAllocations(
+  context: SwiftReflectionContextRef,
+  interval: UInt,
+  count: UInt
+) throws {
+  var knownPtrs: Set<swift_reflection_ptr_t> = []
+  var sample: UInt = 0
+
+  while count == 0 || sample < count {
+    if sample != 0 {
+      sleep(UInt32(interval))
+    }
+    sample += 1
+
+    let allocations = context.allocations
+    let totalBytes = allocations.reduce(0) { $0 + $1.size }
+    let newAllocations = allocations.filter { !knownPtrs.contains($0.ptr) }
+    for allocation in newAllocations {
+      knownPtrs.insert(allocation.ptr)
+    }
+
+    let newBytes = newAllocations.reduce(0) { $0 + $1.size }
+    print("Sample \(sample): \(allocations.count) metadata allocations, " +
+          "\(totalBytes) bytes total " +
+          "(+\(newAllocations.count) allocations, +\(newBytes) bytes)")
+
+    // Summarize the growth in this window by allocation tag.
+    var newByTag: [swift_metadata_allocation_tag_t: (count: Int, bytes: Int)]
+      = [:]
+    for allocation in newAllocations {
+      let entry = newByTag[allocation.tag] ?? (0, 0)
+      newByTag[allocation.tag] = (entry.count + 1, entry.bytes + allocation.size)
+    }
+    for (tag, entry) in newByTag.sorted(by: { $0.value.bytes > $1.value.bytes }) {
+      let tagName = context.metadataTagName(tag) ?? "<unknown>"
+      print("  +\(entry.bytes) bytes in \(entry.count) allocations " +
+            "tag: \(tag) (\(tagName))")
+    }
+
+    // Attribute new generic metadata to the types being instantiated, so
+    // runaway instantiation shows up by name rather than as raw growth.
+    var newByName: [String: Int] = [:]
+    for metadata in newAllocations.sorted().findGenericMetadata(in: context) {
+      newByName[metadata.name, default: 0] += 1
+    }
+    for (name, instantiations) in newByName.sorted(by: { $0.value > $1.value }) {
+      print("  +\(instantiations) instantiations of \(name)")
+    }
+  }
+}
+
 func printBacktrace(
   style: Backtrace.Style?,
   for ptr: swift_reflection_ptr_t,
@@ -149,6 +200,7 @@ struct SwiftInspect: ParsableCommand {
       DumpRawMetadata.self,
       DumpGenericMetadata.self,
       DumpCacheNodes.self,
+      WatchMetadata.self,
     ])
 }
 
@@ -223,6 +275,29 @@ struct DumpGenericMetadata: ParsableCommand {
   }
 }
 
+struct WatchMetadata: ParsableCommand {
+  static let configuration = CommandConfiguration(
+    abstract: "Periodically sample the target's metadata allocations and " +
+              "report growth per tag and per instantiated type.")
+
+  @OptionGroup()
+  var options: UniversalOptions
+
+  @Option(help: "Seconds to wait between samples")
+  var interval: UInt = 10
+
+  @Option(help: "Number of samples to take; 0 samples until interrupted")
+  var count: UInt = 0
+
+  func run() throws {
+    try withReflectionContext(nameOrPid: options.nameOrPid) { context, _ in
+      try watchMetadataAllocations(context: context,
+                                   interval: interval,
+                                   count: count)
+    }
+  }
+}
+
 struct DumpCacheNodes: ParsableCommand {
   static let configuration = CommandConfiguration(
     abstract: "Print the target's metadata cache nodes.")
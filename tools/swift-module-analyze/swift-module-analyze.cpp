@@ -0,0 +1,257 @@
+//===--- swift-module-analyze.cpp - Attribute swiftmodule size -----------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2021 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+//
+// Decodes a serialized module (.swiftmodule, .swiftdoc, or .swiftsourceinfo)
+// and attributes its size to blocks and record kinds, so that abbreviation
+// and layout changes in lib/Serialization/ModuleFormat.h can be driven by
+// data rather than guesswork. Block and record names come from the BLOCKINFO
+// block the serializer writes into every module, so the output stays in sync
+// with the format version that produced the file.
+//
+//===----------------------------------------------------------------------===//
+
+#include "swift/Basic/LLVMInitialize.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Bitstream/BitstreamReader.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/Format.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/raw_ostream.h"
+#include <cinttypes>
+#include <map>
+#include <vector>
+
+using namespace llvm;
+
+namespace options {
+
+static cl::OptionCategory Category("swift-module-analyze Options");
+
+static cl::opt<std::string>
+InputFilename(cl::Positional, cl::desc("<serialized module file>"),
+              cl::Required, cl::cat(Category));
+
+static cl::opt<bool>
+PerAbbrev("per-abbrev",
+          cl::desc("Attribute record bytes to abbreviation IDs instead of "
+                   "record codes"),
+          cl::cat(Category));
+
+static cl::opt<unsigned>
+Limit("limit", cl::init(0),
+      cl::desc("Only print the N largest record kinds (0 = no limit)"),
+      cl::cat(Category));
+
+} // end namespace options
+
+namespace {
+
+struct RecordUsage {
+  uint64_t Count = 0;
+  uint64_t Bits = 0;
+};
+
+struct BlockUsage {
+  uint64_t Count = 0;
+  uint64_t Bits = 0;
+};
+
+/// Accumulated statistics for one bitstream, keyed by (block ID, record code)
+/// or (block ID, abbreviation ID) depending on \c options::PerAbbrev.
+struct StreamStats {
+  std::map<std::pair<unsigned, unsigned>, RecordUsage> Records;
+  std::map<unsigned, BlockUsage> Blocks;
+};
+
+} // end anonymous namespace
+
+/// The serialized-AST container signatures, kept in sync with
+/// lib/Serialization/{ModuleFormat,DocFormat,SourceInfoFormat}.h. This tool
+/// only inspects the container structure, so it deliberately does not depend
+/// on the rest of the serialization library.
+static const unsigned char SWIFTMODULE_SIGNATURE[] = {0xE2, 0x9C, 0xA8, 0x0E};
+static const unsigned char SWIFTDOC_SIGNATURE[] = {0xE2, 0x9C, 0xA8, 0x07};
+static const unsigned char SWIFTSOURCEINFO_SIGNATURE[] = {0xF0, 0x9F, 0x8F,
+                                                          0x8E};
+
+static bool checkSignature(BitstreamCursor &cursor) {
+  SmallVector<unsigned char, 4> bytes;
+  for (unsigned i = 0; i != 4; ++i) {
+    if (cursor.AtEndOfStream())
+      return false;
+    Expected<SimpleBitstreamCursor::word_t> maybeByte = cursor.Read(8);
+    if (!maybeByte) {
+      consumeError(maybeByte.takeError());
+      return false;
+    }
+    bytes.push_back(maybeByte.get());
+  }
+  return std::equal(bytes.begin(), bytes.end(), SWIFTMODULE_SIGNATURE) ||
+         std::equal(bytes.begin(), bytes.end(), SWIFTDOC_SIGNATURE) ||
+         std::equal(bytes.begin(), bytes.end(), SWIFTSOURCEINFO_SIGNATURE);
+}
+
+/// Walks the contents of an already-entered block, recursing into sub-blocks
+/// and charging each record's bits to the enclosing block. The bits spent on
+/// abbreviation definitions and entry codes are charged to the record or
+/// sub-block that follows them.
+static Error walkBlock(BitstreamCursor &cursor, unsigned blockID,
+                       BitstreamBlockInfo &blockInfo, StreamStats &stats) {
+  SmallVector<uint64_t, 64> scratch;
+  StringRef blob;
+  while (!cursor.AtEndOfStream()) {
+    uint64_t startBit = cursor.GetCurrentBitNo();
+    Expected<BitstreamEntry> maybeEntry = cursor.advance();
+    if (!maybeEntry)
+      return maybeEntry.takeError();
+    BitstreamEntry entry = maybeEntry.get();
+
+    switch (entry.Kind) {
+    case BitstreamEntry::Error:
+      return createStringError(std::errc::illegal_byte_sequence,
+                               "malformed bitstream entry");
+    case BitstreamEntry::EndBlock:
+      return Error::success();
+
+    case BitstreamEntry::SubBlock: {
+      if (entry.ID == bitc::BLOCKINFO_BLOCK_ID) {
+        Expected<Optional<BitstreamBlockInfo>> maybeInfo =
+            cursor.ReadBlockInfoBlock(/*ReadBlockInfoNames=*/true);
+        if (!maybeInfo)
+          return maybeInfo.takeError();
+        if (maybeInfo.get()) {
+          blockInfo = std::move(*maybeInfo.get());
+          cursor.setBlockInfo(&blockInfo);
+        }
+      } else {
+        if (Error Err = cursor.EnterSubBlock(entry.ID))
+          return Err;
+        if (Error Err = walkBlock(cursor, entry.ID, blockInfo, stats))
+          return Err;
+      }
+      auto &block = stats.Blocks[entry.ID];
+      block.Count += 1;
+      block.Bits += cursor.GetCurrentBitNo() - startBit;
+      continue;
+    }
+
+    case BitstreamEntry::Record:
+      break;
+    }
+
+    scratch.clear();
+    Expected<unsigned> maybeCode = cursor.readRecord(entry.ID, scratch, &blob);
+    if (!maybeCode)
+      return maybeCode.takeError();
+    unsigned key = options::PerAbbrev ? entry.ID : maybeCode.get();
+    auto &record = stats.Records[{blockID, key}];
+    record.Count += 1;
+    record.Bits += cursor.GetCurrentBitNo() - startBit;
+  }
+  return Error::success();
+}
+
+static std::string getBlockName(const BitstreamBlockInfo &blockInfo,
+                                unsigned blockID) {
+  if (const BitstreamBlockInfo::BlockInfo *info =
+          blockInfo.getBlockInfo(blockID)) {
+    if (!info->Name.empty())
+      return info->Name;
+  }
+  if (blockID == bitc::BLOCKINFO_BLOCK_ID)
+    return "BLOCKINFO_BLOCK";
+  return ("<block " + Twine(blockID) + ">").str();
+}
+
+static std::string getRecordName(const BitstreamBlockInfo &blockInfo,
+                                 unsigned blockID, unsigned code) {
+  if (options::PerAbbrev)
+    return ("<abbrev " + Twine(code) + ">").str();
+  if (const BitstreamBlockInfo::BlockInfo *info =
+          blockInfo.getBlockInfo(blockID)) {
+    for (const auto &entry : info->RecordNames)
+      if (entry.first == code)
+        return entry.second;
+  }
+  return ("<record " + Twine(code) + ">").str();
+}
+
+int main(int argc, char *argv[]) {
+  PROGRAM_START(argc, argv);
+  INITIALIZE_LLVM();
+
+  cl::HideUnrelatedOptions(options::Category);
+  cl::ParseCommandLineOptions(argc, argv, "Swift Module Size Analyzer\n");
+
+  auto bufferOrError = MemoryBuffer::getFile(options::InputFilename);
+  if (!bufferOrError) {
+    errs() << "error: cannot open '" << options::InputFilename
+           << "': " << bufferOrError.getError().message() << "\n";
+    return 1;
+  }
+  MemoryBuffer &buffer = *bufferOrError.get();
+
+  BitstreamCursor cursor(buffer.getMemBufferRef());
+  if (!checkSignature(cursor)) {
+    errs() << "error: '" << options::InputFilename
+           << "' is not a serialized module file\n";
+    return 1;
+  }
+
+  BitstreamBlockInfo blockInfo;
+  StreamStats stats;
+  // The top level behaves like an implicit block containing only sub-blocks.
+  if (Error Err = walkBlock(cursor, /*blockID=*/0, blockInfo, stats)) {
+    errs() << "error: malformed module file: " << toString(std::move(Err))
+           << "\n";
+    return 1;
+  }
+
+  uint64_t totalBytes = buffer.getBufferSize();
+  outs() << options::InputFilename << ": " << totalBytes << " bytes\n\n";
+
+  outs() << "Blocks:\n";
+  std::vector<std::pair<unsigned, BlockUsage>> blocks(stats.Blocks.begin(),
+                                                      stats.Blocks.end());
+  llvm::sort(blocks, [](const auto &lhs, const auto &rhs) {
+    return lhs.second.Bits > rhs.second.Bits;
+  });
+  for (const auto &entry : blocks) {
+    double bytes = entry.second.Bits / 8.0;
+    outs() << format("  %-40s %8" PRIu64 " x %12.1f bytes  %5.1f%%\n",
+                     getBlockName(blockInfo, entry.first).c_str(),
+                     entry.second.Count, bytes,
+                     totalBytes ? bytes * 100.0 / totalBytes : 0.0);
+  }
+
+  outs() << "\nRecords:\n";
+  std::vector<std::pair<std::pair<unsigned, unsigned>, RecordUsage>> records(
+      stats.Records.begin(), stats.Records.end());
+  llvm::sort(records, [](const auto &lhs, const auto &rhs) {
+    return lhs.second.Bits > rhs.second.Bits;
+  });
+  unsigned printed = 0;
+  for (const auto &entry : records) {
+    if (options::Limit && printed++ == options::Limit)
+      break;
+    double bytes = entry.second.Bits / 8.0;
+    std::string name = (getBlockName(blockInfo, entry.first.first) + "/" +
+                        getRecordName(blockInfo, entry.first.first,
+                                      entry.first.second));
+    outs() << format("  %-56s %8" PRIu64 " x %12.1f bytes  %5.1f%%\n",
+                     name.c_str(), entry.second.Count, bytes,
+                     totalBytes ? bytes * 100.0 / totalBytes : 0.0);
+  }
+
+  return 0;
+}
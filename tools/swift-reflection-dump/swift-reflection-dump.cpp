@@ -28,6 +28,7 @@
 #include "llvm/Object/RelocationResolver.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Error.h"
+#include "llvm/Support/ThreadPool.h"
 
 #if defined(_WIN32)
 #include <io.h>
@@ -624,6 +625,55 @@ static ReflectionContextHolder makeReflectionContextForObjectFiles(
   }
 }
 
+/// Dumps the reflection sections of every image, decoding the images in
+/// parallel when there is more than one.
+///
+/// TypeRefBuilder's uniquing tables and bump allocator are not thread-safe,
+/// so each worker gets a ReflectionContext (and therefore a builder) of its
+/// own and nothing is shared between them. Typerefs are still uniqued within
+/// each image, which is where virtually all of the duplication is. Output is
+/// buffered per image and emitted in command-line order, so the result is
+/// byte-for-byte identical to a serial dump of each image.
+static void dumpAllReflectionSections(
+    const std::vector<const ObjectFile *> &objectFiles, FILE *file) {
+  auto dumpSingleImage = [](const ObjectFile *objectFile, FILE *out) {
+    auto context = makeReflectionContextForObjectFiles({objectFile});
+    context.Builder.dumpAllSections(out);
+  };
+
+  if (objectFiles.size() == 1)
+    return dumpSingleImage(objectFiles.front(), file);
+
+  // Buffer each image's dump in a temporary file so the workers never
+  // interleave output. If any buffer cannot be created, fall back to
+  // processing the images serially.
+  std::vector<FILE *> buffers;
+  for (size_t i = 0, e = objectFiles.size(); i < e; ++i) {
+    FILE *buffer = tmpfile();
+    if (!buffer) {
+      for (FILE *opened : buffers)
+        fclose(opened);
+      for (const ObjectFile *objectFile : objectFiles)
+        dumpSingleImage(objectFile, file);
+      return;
+    }
+    buffers.push_back(buffer);
+  }
+
+  llvm::ThreadPool pool;
+  for (size_t i = 0, e = objectFiles.size(); i < e; ++i)
+    pool.async(dumpSingleImage, objectFiles[i], buffers[i]);
+  pool.wait();
+
+  for (FILE *buffer : buffers) {
+    rewind(buffer);
+    char chunk[4096];
+    for (size_t n; (n = fread(chunk, 1, sizeof(chunk), buffer)) > 0;)
+      fwrite(chunk, 1, n, file);
+    fclose(buffer);
+  }
+}
+
 static int doDumpReflectionSections(ArrayRef<std::string> BinaryFilenames,
                                     StringRef Arch, ActionType Action,
                                     FILE *file) {
@@ -653,15 +703,17 @@ static int doDumpReflectionSections(ArrayRef<std::string> BinaryFilenames,
     ObjectFiles.push_back(O);
   }
   
-  auto context = makeReflectionContextForObjectFiles(ObjectFiles);
-  auto &builder = context.Builder;
-
   switch (Action) {
   case ActionType::DumpReflectionSections:
-    // Dump everything
-    builder.dumpAllSections(file);
+    // Dump everything. The images are independent here, so they can be
+    // decoded in parallel.
+    dumpAllReflectionSections(ObjectFiles, file);
     break;
   case ActionType::DumpTypeLowering: {
+    // Type lowering may need to look across images (e.g. a library and its
+    // dependencies), so keep every image in a single shared context.
+    auto context = makeReflectionContextForObjectFiles(ObjectFiles);
+    auto &builder = context.Builder;
     for (std::string Line; std::getline(std::cin, Line);) {
       if (Line.empty())
         continue;
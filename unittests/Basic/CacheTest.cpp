@@ -233,3 +233,90 @@ TEST(Cache, copyValue) {
   EXPECT_EQ(0, cache.get("b")->ident);
   EXPECT_EQ(4, cache.get("b")->copy); // return by value causes 2nd copy
 }
+
+namespace {
+struct CostedCounter {
+  size_t cost;
+  mutable int enter = 0;
+  mutable int exit = 0;
+  explicit CostedCounter(size_t cost) : cost(cost) {}
+};
+}
+
+namespace swift {
+namespace sys {
+template <>
+struct CacheValueInfo<CostedCounter> {
+  static void *enterCache(const CostedCounter &value) {
+    return const_cast<CostedCounter *>(&value);
+  }
+  static void retain(void *ptr) {
+    static_cast<CostedCounter *>(ptr)->enter += 1;
+  }
+  static void release(void *ptr) {
+    static_cast<CostedCounter *>(ptr)->exit += 1;
+  }
+  static const CostedCounter &getFromCache(void *ptr) {
+    return *static_cast<CostedCounter *>(ptr);
+  }
+  static size_t getCost(const CostedCounter &value) {
+    return value.cost;
+  }
+};
+}
+}
+
+// The default cache implementation evicts least-recently-used entries once
+// the total cost exceeds its budget. The libcache-based implementation
+// evicts based on memory pressure instead, and Windows has no setenv.
+#if !USES_LIBCACHE && !defined(_WIN32)
+TEST(Cache, evictsLeastRecentlyUsedOverCostBudget) {
+  setenv("SWIFT_GENERIC_CACHE_COST_LIMIT", "10", /*overwrite=*/1);
+  {
+    CostedCounter a(6), b(6), c(6);
+    swift::sys::Cache<const char *, CostedCounter> cache(__func__);
+
+    cache.set("a", a);
+    EXPECT_EQ(0, a.exit);
+
+    // Storing "b" pushes the total cost to 12 and evicts "a".
+    cache.set("b", b);
+    EXPECT_EQ(1, a.exit);
+    EXPECT_EQ(0, b.exit);
+    EXPECT_FALSE(cache.get("a").hasValue());
+    EXPECT_TRUE(cache.get("b").hasValue());
+
+    // Storing "c" overflows the budget again and evicts "b", the only
+    // other entry.
+    cache.set("c", c);
+    EXPECT_EQ(1, b.exit);
+    EXPECT_EQ(0, c.exit);
+    EXPECT_TRUE(cache.get("c").hasValue());
+  }
+  unsetenv("SWIFT_GENERIC_CACHE_COST_LIMIT");
+}
+
+TEST(Cache, lookupRefreshesRecency) {
+  setenv("SWIFT_GENERIC_CACHE_COST_LIMIT", "10", /*overwrite=*/1);
+  {
+    CostedCounter a(4), b(4), c(4);
+    swift::sys::Cache<const char *, CostedCounter> cache(__func__);
+
+    cache.set("a", a);
+    cache.set("b", b);
+    EXPECT_EQ(0, a.exit);
+    EXPECT_EQ(0, b.exit);
+
+    // Touch "a" so that "b" is now the least recently used entry.
+    EXPECT_TRUE(cache.get("a").hasValue());
+
+    cache.set("c", c);
+    EXPECT_EQ(0, a.exit);
+    EXPECT_EQ(1, b.exit);
+    EXPECT_TRUE(cache.get("a").hasValue());
+    EXPECT_FALSE(cache.get("b").hasValue());
+    EXPECT_TRUE(cache.get("c").hasValue());
+  }
+  unsetenv("SWIFT_GENERIC_CACHE_COST_LIMIT");
+}
+#endif
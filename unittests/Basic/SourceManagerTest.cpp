@@ -97,3 +97,43 @@ TEST(SourceManager, RangeContains) {
   EXPECT_TRUE(SM.rangeContains(R_ad, R_bc));
 }
 
+TEST(SourceManager, GetLineAndColumnInBuffer) {
+  SourceManager SM;
+  unsigned ID = SM.addMemBufferCopy("aaa\nbb b\n\nccc\n");
+  SourceLoc Start = SM.getLocForBufferStart(ID);
+
+  EXPECT_EQ(SM.getLineAndColumnInBuffer(Start, ID), std::make_pair(1u, 1u));
+  EXPECT_EQ(SM.getLineAndColumnInBuffer(Start.getAdvancedLoc(2), ID),
+            std::make_pair(1u, 3u));
+  // The newline itself belongs to the line it ends.
+  EXPECT_EQ(SM.getLineAndColumnInBuffer(Start.getAdvancedLoc(3), ID),
+            std::make_pair(1u, 4u));
+  EXPECT_EQ(SM.getLineAndColumnInBuffer(Start.getAdvancedLoc(4), ID),
+            std::make_pair(2u, 1u));
+  EXPECT_EQ(SM.getLineAndColumnInBuffer(Start.getAdvancedLoc(7), ID),
+            std::make_pair(2u, 4u));
+  // Empty line.
+  EXPECT_EQ(SM.getLineAndColumnInBuffer(Start.getAdvancedLoc(9), ID),
+            std::make_pair(3u, 1u));
+  EXPECT_EQ(SM.getLineAndColumnInBuffer(Start.getAdvancedLoc(10), ID),
+            std::make_pair(4u, 1u));
+  // Buffer identification is left to the SourceManager when no buffer ID is
+  // passed.
+  EXPECT_EQ(SM.getLineAndColumnInBuffer(Start.getAdvancedLoc(10)),
+            std::make_pair(4u, 1u));
+}
+
+TEST(SourceManager, ResolveFromLineCol) {
+  SourceManager SM;
+  unsigned ID = SM.addMemBufferCopy("aaa\nbb b\n\nccc\n");
+
+  EXPECT_EQ(SM.resolveFromLineCol(ID, 1, 1), llvm::Optional<unsigned>(0u));
+  EXPECT_EQ(SM.resolveFromLineCol(ID, 2, 3), llvm::Optional<unsigned>(6u));
+  // Column ~0u resolves to the end of the line.
+  EXPECT_EQ(SM.resolveFromLineCol(ID, 2, ~0u), llvm::Optional<unsigned>(8u));
+  EXPECT_EQ(SM.resolveFromLineCol(ID, 3, ~0u), llvm::Optional<unsigned>(9u));
+  // A line past the end of the buffer does not resolve.
+  EXPECT_EQ(SM.resolveFromLineCol(ID, 6, 1), llvm::None);
+  EXPECT_EQ(SM.resolveFromLineCol(ID, 0, 1), llvm::None);
+}
+
@@ -0,0 +1,51 @@
+//===--- Once.cpp - Once tests --------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2020 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+#include "swift/Runtime/Once.h"
+#include "ThreadingHelpers.h"
+#include "gtest/gtest.h"
+#include <atomic>
+
+using namespace swift;
+
+TEST(OnceTest, once_runs_once) {
+  static swift_once_t predicate;
+  int counter = 0;
+
+  for (int i = 0; i < 10; ++i) {
+    swift_once(
+        &predicate, [](void *ctx) { ++*static_cast<int *>(ctx); }, &counter);
+  }
+  ASSERT_EQ(counter, 1);
+}
+
+TEST(OnceTest, once_threaded) {
+  static swift_once_t predicate;
+  static std::atomic<int> counter(0);
+
+  threadedExecute(10,
+                  [&](int) {
+                    swift_once(
+                        &predicate,
+                        [](void *) {
+                          // Give contending threads a chance to pile up on
+                          // the waiting path.
+                          std::this_thread::sleep_for(
+                              std::chrono::milliseconds(10));
+                          counter.fetch_add(1);
+                        },
+                        nullptr);
+                    ASSERT_EQ(counter.load(), 1);
+                  },
+                  [] {});
+  ASSERT_EQ(counter.load(), 1);
+}
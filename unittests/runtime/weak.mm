@@ -104,6 +104,11 @@ TEST(WeakTest, simple_swift) {
   ASSERT_EQ(nullptr, tmp);
   swift_release(tmp);
 
+  // The second load after the object's death takes the zeroed fast path.
+  tmp = swift_weakLoadStrong(&ref1);
+  ASSERT_EQ(nullptr, tmp);
+  swift_release(tmp);
+
   WeakReference ref2;
   res = swift_weakCopyInit(&ref2, &ref1);
   ASSERT_EQ(res, &ref2);
@@ -3163,6 +3163,24 @@ SetTestSuite.test("intersect") {
   expectEqual(Set<Int>(), Set<Int>().intersection(Set<Int>()))
   expectEqual(Set<Int>(), s1.intersection(Set<Int>()))
   expectEqual(Set<Int>(), Set<Int>().intersection(s1))
+
+  // When every element survives, the result shares the original's storage.
+  expectEqual(identity1, s1.intersection(s2)._rawIdentifier())
+
+  // Partial overlap, in both iteration orders.
+  expectEqual(Set([2020, 3030]), s1.intersection(Set([2020, 3030, 7070])))
+  expectEqual(Set([2020, 3030]), Set([2020, 3030, 7070]).intersection(s1))
+
+  // Large enough to need a heap-allocated scratch bitset.
+  let big1 = Set(0..<1000)
+  let big2 = Set(500..<1500)
+  expectEqual(Set(500..<1000), big1.intersection(big2))
+  expectEqual(Set(500..<1000), big2.intersection(big1))
+
+  // Sequence overloads, including duplicate elements in the argument.
+  expectEqual(Set([1010, 2020]), s1.intersection([1010, 2020, 1010, 7070]))
+  expectEqual(Set<Int>(), s1.intersection([] as [Int]))
+  expectEqual(Set(500..<1000), big1.intersection(Array(500..<1500)))
 }
 
 SetTestSuite.test("formIntersection") {
@@ -886,6 +886,77 @@ StringTests.test("COW/replaceSubrange/end") {
   }
 }
 
+StringTests.test("COW/replaceSubrange/substring") {
+  // Replacing with a Substring of another string must splice in place on
+  // uniquely referenced native storage, without reallocating.
+  do {
+    var str = "12345678"
+    str.reserveCapacity(32) // Ensure on heap
+    let heapStrIdentity = str.bufferID
+    expectNotNil(heapStrIdentity)
+
+    let donor = "abcdefgh"
+    str.replaceSubrange(
+      str.index(_nth: 2)..<str.index(_nth: 5), with: donor[donor.startIndex..<donor.index(_nth: 3)])
+    expectEqual(heapStrIdentity, str.bufferID)
+    expectEqual("12abc678", str)
+
+    // Same-width replacements of different lengths stay in place as long as
+    // the capacity suffices.
+    str.replaceSubrange(str.index(_nth: 1)..<str.index(_nth: 6), with: donor[donor.index(_nth: 7)...])
+    expectEqual(heapStrIdentity, str.bufferID)
+    expectEqual("1h78", str)
+  }
+
+  // Replacing with a substring of self holds a second reference to the
+  // storage, so the original storage must stay intact.
+  do {
+    var str = "12345678"
+    str.reserveCapacity(32)
+    let heapStrIdentity = str.bufferID
+
+    let slice = str[str.index(_nth: 4)...]
+    str.replaceSubrange(str.startIndex..<str.index(_nth: 2), with: slice)
+    expectNotEqual(heapStrIdentity, str.bufferID)
+    expectEqual("5678345678", str)
+    expectEqual("5678", slice)
+  }
+
+  // Non-ASCII substrings splice correctly.
+  do {
+    var str = "abcdefgh"
+    str.reserveCapacity(32)
+    let heapStrIdentity = str.bufferID
+
+    let donor = "xyz\u{301}w"
+    str.replaceSubrange(
+      str.index(_nth: 3)..<str.index(_nth: 5), with: donor[donor.index(_nth: 1)..<donor.index(_nth: 3)])
+    expectEqual(heapStrIdentity, str.bufferID)
+    expectEqual("abcyz\u{301}fgh", str)
+  }
+}
+
+StringTests.test("Comparison/nonASCIIPrecomposed") {
+  // Precomposed (NFC) non-ASCII strings compare binary; mixed-form inputs
+  // must still compare canonically.
+  let nfcCafe = "caf\u{E9}"
+  let nfdCafe = "cafe\u{301}"
+  expectEqual(nfcCafe, nfdCafe)
+  expectFalse(nfcCafe < nfdCafe)
+  expectFalse(nfdCafe < nfcCafe)
+
+  let lhs = "日本\u{E9}語 abc"
+  let rhs = "日本\u{E9}語 abd"
+  expectNotEqual(lhs, rhs)
+  expectTrue(lhs < rhs)
+
+  // Hangul syllables are their own NFC segments; their decompositions are
+  // canonically equal.
+  let nfcHangul = "\u{AC01}\u{AC01}\u{AC01}"
+  let nfdHangul = "\u{1100}\u{1161}\u{11A8}\u{1100}\u{1161}\u{11A8}\u{1100}\u{1161}\u{11A8}"
+  expectEqual(nfcHangul, nfdHangul)
+}
+
 func asciiString<
   S: Sequence
 >(_ content: S) -> String